@@ -0,0 +1,330 @@
+/* ============================================================================
+* Copyright (C) 2023 Ryan Eubank
+*
+* This program is free software: you can redistribute it and/or modify
+* it under the terms of the GNU General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License
+* along with this program.  If not, see <https://www.gnu.org/licenses/>.
+* ========================================================================= */
+
+#pragma once
+
+#include <atomic>
+#include <concepts>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <utility>
+
+#include "../concepts/collection.h"
+#include "../containers/Node.h"
+
+namespace collections {
+
+	// ------------------------------------------------------------------------
+	/// <summary>
+	/// MPSCQueue is a multi-producer single-consumer queue with the Queue 
+	/// interface, built on ForwardList's singly linked nodes (Vyukov's 
+	/// intrusive MPSC queue). Any number of threads may enqueue at once with
+	/// a wait-free exchange on the back of the queue, while a single 
+	/// consumer thread reads and dequeues from the front without locks.
+	/// </summary>
+	/// 
+	/// <typeparam name="element_t">
+	/// The type of elements contained by the queue.
+	/// </typeparam>
+	/// <typeparam name="allocator_t">
+	/// The allocator type used to allocate nodes. Producers allocate and the
+	/// consumer deallocates concurrently, so the allocator must be safe to 
+	/// use from multiple threads.
+	/// </typeparam> ----------------------------------------------------------
+	template <class element_t, class allocator_t = std::allocator<element_t>>
+	class MPSCQueue {
+	public:
+
+		using allocator_type	= allocator_t;
+		using value_type		= element_t;
+		using size_type			= std::size_t;
+		using reference			= value_type&;
+		using const_reference	= const value_type&;
+
+	private:
+
+		using node_type				= Node<value_type, allocator_type, 1>;
+		using node_base				= node_type::base;
+		using alloc_traits			= std::allocator_traits<allocator_type>;
+		using node_allocator_type	= rebind<allocator_t, node_type>;
+		using node_alloc_traits		= std::allocator_traits<node_allocator_type>;
+		using node_ptr				= node_type::base_ptr;
+		using queue_node_ptr		= node_alloc_traits::pointer;
+
+		constexpr static auto next = 0u;
+
+		// keeps the producer and consumer ends from sharing a cache line.
+		constexpr static size_type CACHE_LINE = 64;
+
+		static_assert(
+			!arena_allocator<allocator_t>,
+			"MPSCQueue embeds its stub node, which cannot be addressed by "
+			"arena links."
+		);
+
+		static_assert(
+			std::atomic_ref<node_ptr>::is_always_lock_free,
+			"MPSCQueue requires lock-free atomic access to node pointers."
+		);
+
+	public:
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// ~~~ Default Constructor ~~~
+		/// 
+		///	<para>
+		/// Constructs an empty queue.
+		/// </para></summary> -------------------------------------------------
+		MPSCQueue() : MPSCQueue(allocator_type()) {}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// ~~~ Allocator Constructor ~~~
+		/// 
+		///	<para>
+		/// Constructs an empty queue which allocates nodes with the given
+		/// allocator.
+		/// </para></summary> 
+		/// 
+		/// <param name="alloc">
+		/// The allocator instance used by the queue.
+		/// </param> ----------------------------------------------------------
+		explicit MPSCQueue(const allocator_type& alloc) noexcept :
+			_allocator(alloc),
+			_stub(),
+			_back(&_stub),
+			_front(&_stub)
+		{
+
+		}
+
+		// the queue is pinned in place while producers hold its address.
+		MPSCQueue(const MPSCQueue&) = delete;
+		MPSCQueue& operator=(const MPSCQueue&) = delete;
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// ~~~ Destructor ~~~
+		/// 
+		///	<para>
+		/// Destroys the remaining elements. No producer may still be 
+		/// enqueueing.
+		/// </para></summary> -------------------------------------------------
+		~MPSCQueue() {
+			clear();
+			release(_front);
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Returns true if the consumer sees no elements in the queue. An 
+		/// element whose enqueue is still in progress, and every element
+		/// enqueued after it, becomes visible once that enqueue completes.
+		/// Consumer only.
+		/// </summary>
+		/// 
+		/// <returns>
+		/// Returns true if there is no element to dequeue.
+		/// </returns> --------------------------------------------------------
+		[[nodiscard]] bool isEmpty() const noexcept {
+			return first() == nullptr;
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Dequeues every visible element. Consumer only.
+		/// </summary> --------------------------------------------------------
+		void clear() {
+			while (!isEmpty())
+				dequeue_front();
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Returns the element at the front of the queue. Consumer only, and
+		/// the queue must not be empty.
+		/// </summary>
+		/// 
+		/// <returns>
+		/// Returns a reference to the element at the front of the queue.
+		/// </returns> --------------------------------------------------------
+		[[nodiscard]] reference front() {
+			return first()->value();
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Returns the element at the front of the queue. Consumer only, and
+		/// the queue must not be empty.
+		/// </summary>
+		/// 
+		/// <returns>
+		/// Returns a constant reference to the element at the front of the 
+		/// queue.
+		/// </returns> --------------------------------------------------------
+		[[nodiscard]] const_reference front() const {
+			return first()->value();
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Adds an element to the back of the queue. Safe to call from any
+		/// number of threads at once.
+		/// </summary>
+		/// 
+		/// <param name="element">
+		/// The element to add.
+		/// </param> ----------------------------------------------------------
+		void enqueue_back(const_reference element) {
+			emplace_back(element);
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Moves an element to the back of the queue. Safe to call from any
+		/// number of threads at once.
+		/// </summary>
+		/// 
+		/// <param name="element">
+		/// The element to add.
+		/// </param> ----------------------------------------------------------
+		void enqueue_back(value_type&& element) {
+			emplace_back(std::move(element));
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Constructs an element in place at the back of the queue. Safe to
+		/// call from any number of threads at once.
+		/// </summary>
+		/// 
+		/// <param name="args">
+		/// The arguments to construct the new element with.
+		/// </param> ----------------------------------------------------------
+		template <class... Args>
+		void emplace_back(Args&&... args) {
+			queue_node_ptr node = node_alloc_traits::allocate(_allocator, 1);
+
+			try {
+				node_alloc_traits::construct(
+					_allocator, node, std::in_place_t{}, 
+					std::forward<Args>(args)...
+				);
+			}
+			catch (...) {
+				node_alloc_traits::deallocate(_allocator, node, 1);
+				throw;
+			}
+
+			link(node);
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Removes the element at the front of the queue. Consumer only, and
+		/// the queue must not be empty.
+		/// </summary> --------------------------------------------------------
+		void dequeue_front() {
+			node_ptr node = first();
+			allocator_type alloc(_allocator);
+			alloc_traits::destroy(alloc, std::addressof(node->value()));
+
+			// the emptied node stays behind as the queue's stub.
+			release(std::exchange(_front, node));
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Moves up to count elements from the front of the queue into the 
+		/// output iterator, stopping early if the queue runs dry. Consumer 
+		/// only.
+		/// </summary>
+		/// 
+		/// <param name="out">
+		/// The output iterator receiving the elements, in queue order.
+		/// </param>
+		/// 
+		/// <param name="count">
+		/// The maximum number of elements to dequeue.
+		/// </param>
+		/// 
+		/// <returns>
+		/// Returns the number of elements dequeued.
+		/// </returns> --------------------------------------------------------
+		template <std::output_iterator<value_type&&> out_iterator>
+		size_type dequeue_front(out_iterator out, size_type count) {
+			size_type dequeued = 0;
+
+			for (node_ptr node; dequeued < count && (node = first()); ) {
+				*out = std::move(node->value());
+				++out;
+				++dequeued;
+				dequeue_front();
+			}
+
+			return dequeued;
+		}
+
+	private:
+
+		[[no_unique_address, msvc::no_unique_address]] 
+		node_allocator_type _allocator;
+
+		node_base _stub;
+
+		alignas(CACHE_LINE) std::atomic<node_ptr> _back;
+		alignas(CACHE_LINE) node_ptr _front;
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Publishes a node at the back of the queue. The exchange orders 
+		/// producers, and the following store makes the node reachable from
+		/// its predecessor. Until that store lands the consumer sees the 
+		/// queue end at the predecessor.
+		/// </summary> --------------------------------------------------------
+		void link(node_ptr node) noexcept {
+			node_ptr previous = _back.exchange(node, std::memory_order_acq_rel);
+			std::atomic_ref(previous->to(next)).store(
+				node, std::memory_order_release);
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Returns the node holding the front element, or null if none is 
+		/// visible to the consumer.
+		/// </summary> --------------------------------------------------------
+		[[nodiscard]] node_ptr first() const noexcept {
+			return std::atomic_ref(_front->to(next)).load(
+				std::memory_order_acquire);
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Frees a retired stub whose element has already been destroyed.
+		/// </summary> --------------------------------------------------------
+		void release(node_ptr stub) noexcept {
+			if (stub == &_stub)
+				return;
+
+			queue_node_ptr node = static_cast<queue_node_ptr>(stub);
+			node_alloc_traits::destroy(_allocator, node);
+			node_alloc_traits::deallocate(_allocator, node, 1);
+		}
+	};
+}
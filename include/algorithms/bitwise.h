@@ -0,0 +1,276 @@
+/* ============================================================================
+* Copyright (C) 2023 Ryan Eubank
+*
+* This program is free software: you can redistribute it and/or modify
+* it under the terms of the GNU General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License
+* along with this program.  If not, see <https://www.gnu.org/licenses/>.
+* ========================================================================= */
+
+#pragma once
+
+#include <bit>
+#include <cstdint>
+#include <cstdlib>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+namespace collections {
+
+	struct popcount_ {
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Counts the total number of set bits in the given block of words.
+		/// Uses a vectorized nibble lookup when compiled with AVX2 support
+		/// and the hardware popcount instruction for the remaining words.
+		/// </summary>
+		///
+		/// <param name="words">
+		/// Pointer to the first word of the block.
+		/// </param>
+		/// <param name="count">
+		/// The number of words in the block.
+		/// </param>
+		///
+		/// <returns>
+		/// Returns the number of bits set to one in the block.
+		/// </returns> --------------------------------------------------------
+		size_t operator()(const uint64_t* words, size_t count) const noexcept {
+			size_t total = 0;
+			size_t i = 0;
+
+		#if defined(__AVX2__)
+			const __m256i lookup = _mm256_setr_epi8(
+				0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4,
+				0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4
+			);
+			const __m256i lowMask = _mm256_set1_epi8(0x0f);
+			__m256i sums = _mm256_setzero_si256();
+
+			for (; i + 4 <= count; i += 4) {
+				__m256i block = _mm256_loadu_si256(
+					reinterpret_cast<const __m256i*>(words + i));
+				__m256i low = _mm256_and_si256(block, lowMask);
+				__m256i high = _mm256_and_si256(
+					_mm256_srli_epi16(block, 4), lowMask);
+				__m256i bytes = _mm256_add_epi8(
+					_mm256_shuffle_epi8(lookup, low),
+					_mm256_shuffle_epi8(lookup, high)
+				);
+				sums = _mm256_add_epi64(
+					sums, _mm256_sad_epu8(bytes, _mm256_setzero_si256()));
+			}
+
+			total += static_cast<size_t>(_mm256_extract_epi64(sums, 0));
+			total += static_cast<size_t>(_mm256_extract_epi64(sums, 1));
+			total += static_cast<size_t>(_mm256_extract_epi64(sums, 2));
+			total += static_cast<size_t>(_mm256_extract_epi64(sums, 3));
+		#endif
+
+			for (; i < count; ++i)
+				total += std::popcount(words[i]);
+
+			return total;
+		}
+	};
+
+	struct bitwise_and_ {
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Performs an in place bitwise AND of the destination block with the
+		/// source block, i.e. dst[i] &= src[i] for every word.
+		/// </summary>
+		///
+		/// <param name="dst">
+		/// Pointer to the first word of the block being modified.
+		/// </param>
+		/// <param name="src">
+		/// Pointer to the first word of the block being read.
+		/// </param>
+		/// <param name="count">
+		/// The number of words to process.
+		/// </param> ----------------------------------------------------------
+		void operator()(
+			uint64_t* dst,
+			const uint64_t* src,
+			size_t count
+		) const noexcept {
+			size_t i = 0;
+
+		#if defined(__AVX2__)
+			for (; i + 4 <= count; i += 4) {
+				auto* out = reinterpret_cast<__m256i*>(dst + i);
+				auto* in = reinterpret_cast<const __m256i*>(src + i);
+				_mm256_storeu_si256(out, _mm256_and_si256(
+					_mm256_loadu_si256(out), _mm256_loadu_si256(in)));
+			}
+		#endif
+
+			for (; i < count; ++i)
+				dst[i] &= src[i];
+		}
+	};
+
+	struct bitwise_or_ {
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Performs an in place bitwise OR of the destination block with the
+		/// source block, i.e. dst[i] |= src[i] for every word.
+		/// </summary>
+		///
+		/// <param name="dst">
+		/// Pointer to the first word of the block being modified.
+		/// </param>
+		/// <param name="src">
+		/// Pointer to the first word of the block being read.
+		/// </param>
+		/// <param name="count">
+		/// The number of words to process.
+		/// </param> ----------------------------------------------------------
+		void operator()(
+			uint64_t* dst,
+			const uint64_t* src,
+			size_t count
+		) const noexcept {
+			size_t i = 0;
+
+		#if defined(__AVX2__)
+			for (; i + 4 <= count; i += 4) {
+				auto* out = reinterpret_cast<__m256i*>(dst + i);
+				auto* in = reinterpret_cast<const __m256i*>(src + i);
+				_mm256_storeu_si256(out, _mm256_or_si256(
+					_mm256_loadu_si256(out), _mm256_loadu_si256(in)));
+			}
+		#endif
+
+			for (; i < count; ++i)
+				dst[i] |= src[i];
+		}
+	};
+
+	struct bitwise_xor_ {
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Performs an in place bitwise XOR of the destination block with the
+		/// source block, i.e. dst[i] ^= src[i] for every word.
+		/// </summary>
+		///
+		/// <param name="dst">
+		/// Pointer to the first word of the block being modified.
+		/// </param>
+		/// <param name="src">
+		/// Pointer to the first word of the block being read.
+		/// </param>
+		/// <param name="count">
+		/// The number of words to process.
+		/// </param> ----------------------------------------------------------
+		void operator()(
+			uint64_t* dst,
+			const uint64_t* src,
+			size_t count
+		) const noexcept {
+			size_t i = 0;
+
+		#if defined(__AVX2__)
+			for (; i + 4 <= count; i += 4) {
+				auto* out = reinterpret_cast<__m256i*>(dst + i);
+				auto* in = reinterpret_cast<const __m256i*>(src + i);
+				_mm256_storeu_si256(out, _mm256_xor_si256(
+					_mm256_loadu_si256(out), _mm256_loadu_si256(in)));
+			}
+		#endif
+
+			for (; i < count; ++i)
+				dst[i] ^= src[i];
+		}
+	};
+
+	struct bitwise_andnot_ {
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Clears every bit of the destination block that is set in the
+		/// source block, i.e. dst[i] &= ~src[i] for every word.
+		/// </summary>
+		///
+		/// <param name="dst">
+		/// Pointer to the first word of the block being modified.
+		/// </param>
+		/// <param name="src">
+		/// Pointer to the first word of the block being read.
+		/// </param>
+		/// <param name="count">
+		/// The number of words to process.
+		/// </param> ----------------------------------------------------------
+		void operator()(
+			uint64_t* dst,
+			const uint64_t* src,
+			size_t count
+		) const noexcept {
+			size_t i = 0;
+
+		#if defined(__AVX2__)
+			for (; i + 4 <= count; i += 4) {
+				auto* out = reinterpret_cast<__m256i*>(dst + i);
+				auto* in = reinterpret_cast<const __m256i*>(src + i);
+				_mm256_storeu_si256(out, _mm256_andnot_si256(
+					_mm256_loadu_si256(in), _mm256_loadu_si256(out)));
+			}
+		#endif
+
+			for (; i < count; ++i)
+				dst[i] &= ~src[i];
+		}
+	};
+
+	struct bitwise_not_ {
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Inverts every bit in the given block of words in place.
+		/// </summary>
+		///
+		/// <param name="dst">
+		/// Pointer to the first word of the block being modified.
+		/// </param>
+		/// <param name="count">
+		/// The number of words to process.
+		/// </param> ----------------------------------------------------------
+		void operator()(uint64_t* dst, size_t count) const noexcept {
+			size_t i = 0;
+
+		#if defined(__AVX2__)
+			const __m256i ones = _mm256_set1_epi64x(-1);
+			for (; i + 4 <= count; i += 4) {
+				auto* out = reinterpret_cast<__m256i*>(dst + i);
+				_mm256_storeu_si256(
+					out, _mm256_xor_si256(_mm256_loadu_si256(out), ones));
+			}
+		#endif
+
+			for (; i < count; ++i)
+				dst[i] = ~dst[i];
+		}
+	};
+
+	inline constexpr popcount_ popcount;
+	inline constexpr bitwise_and_ bitwise_and;
+	inline constexpr bitwise_or_ bitwise_or;
+	inline constexpr bitwise_xor_ bitwise_xor;
+	inline constexpr bitwise_andnot_ bitwise_andnot;
+	inline constexpr bitwise_not_ bitwise_not;
+}
@@ -21,6 +21,8 @@
 #include <iterator>
 #include <ranges>
 
+#include "../util/prefetch.h"
+
 namespace collections {
 
 	struct copy_ {
@@ -74,6 +76,59 @@ namespace collections {
 			return destination;
 		}
 
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Copies the given iterator range to the destination starting at
+		/// the given output iterator. Node based iterators prefetch the next
+		/// node while the current element is copied.
+		/// </summary>
+		/// 
+		/// <typeparam name="iterator">
+		/// The type of the input iterator being copied from.
+		/// </typeparam>
+		/// 
+		/// <typeparam name="sentinel">
+		/// The sentinel or end iterator of the range being copied from.
+		/// </typeparam>
+		/// 
+		/// <typeparam name="output">
+		/// The type of the output iterator being copied to.
+		/// </typeparam>
+		/// 
+		/// <param name="begin">
+		/// The beginning of the iterator range to copy from.
+		/// </param>
+		/// 
+		/// <param name="end">
+		/// The end of the iterator range to copy from.
+		/// </param>
+		/// 
+		/// <param name="destination">
+		/// The destination to copy to.
+		/// </param> 
+		/// 
+		/// <returns>
+		/// Returns the destination iterator pointing past the last element
+		/// copied, or the original destination if the range is empty.
+		/// </returns> --------------------------------------------------------
+		template <
+			std::input_iterator iterator,
+			std::sentinel_for<iterator> sentinel,
+			std::weakly_incrementable output
+		>
+		constexpr output operator()(
+			prefetching_t,
+			iterator begin,
+			sentinel end,
+			output destination
+		) const {
+			while (begin != end) {
+				prefetch_next(begin);
+				*destination++ = *begin++;
+			}
+			return destination;
+		}
+
 		// --------------------------------------------------------------------
 		/// <summary>
 		/// Copies the given range to the destination starting at the output 
@@ -111,6 +166,46 @@ namespace collections {
 			return (*this)
 				(std::ranges::begin(rg), std::ranges::end(rg), destination);
 		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Copies the given range to the destination starting at the output 
+		/// iterator. Node based iterators prefetch the next node while the
+		/// current element is copied.
+		/// </summary>
+		/// 
+		/// <typeparam name="range">
+		/// The type of the input range being copied from.
+		/// </typeparam>
+		/// 
+		/// <typeparam name="output">
+		/// The type of the output iterator being copied to.
+		/// </typeparam>
+		/// 
+		/// <param name="rg">
+		/// The range being copied from.
+		/// </param>
+		/// 
+		/// <param name="destination">
+		/// The output iterator to start copying to.
+		/// </param>
+		/// 
+		/// <returns>
+		/// Returns the destination iterator pointing past the last element
+		/// copied, or the original destination if the range is empty.
+		/// </returns> --------------------------------------------------------
+		template <
+			std::ranges::input_range range,
+			std::weakly_incrementable output
+		>
+		constexpr output operator()(
+			prefetching_t tag,
+			const range& rg,
+			output destination
+		) const {
+			return (*this)
+				(tag, std::ranges::begin(rg), std::ranges::end(rg), destination);
+		}
 	};
 
 	struct copy_n_ {
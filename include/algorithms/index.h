@@ -21,6 +21,8 @@
 #include <iterator>
 #include <ranges>
 
+#include "../util/prefetch.h"
+
 namespace collections {
 
 	struct index_of_ {
@@ -70,7 +72,58 @@ namespace collections {
 					return i;
 				i++;
 			}
-			return -1;
+			return static_cast<int64_t>(-1);
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Returns the index position of the specified element in the given 
+		/// sequence, starting at 0. Node based iterators prefetch the next 
+		/// node while the current element is compared.
+		/// </summary>
+		/// 
+		/// <typeparam name="T">
+		/// The type of the value being searched.
+		/// </typeparam>
+		/// <typeparam name="iterator">
+		/// The type of the input iterator being iterated over.
+		/// </typeparam>
+		/// <typeparam name="sentinel">
+		/// The type of the sentinel or end iterator.
+		/// </typeparam>
+		/// 
+		/// <param name="begin">
+		/// The beginning iterator of the range.
+		/// </param>
+		/// <param name="end">
+		/// The sentinel or end iterator of the range.
+		/// </param>
+		/// <param name="value">
+		/// The value to search for.
+		/// </param>
+		/// 
+		/// <returns>
+		/// Returns the index of the element if found, returns -1 otherwise.
+		/// </returns> --------------------------------------------------------
+		template <
+			class T,
+			std::input_iterator iterator,
+			std::sentinel_for<iterator> sentinel
+		>
+		constexpr auto operator()(
+			prefetching_t,
+			iterator begin,
+			sentinel end,
+			const T& value
+		) const {
+			int64_t i = 0;
+			while (begin != end) {
+				prefetch_next(begin);
+				if (*begin++ == value)
+					return i;
+				i++;
+			}
+			return static_cast<int64_t>(-1);
 		}
 
 		// --------------------------------------------------------------------
@@ -101,6 +154,40 @@ namespace collections {
 			return (*this)
 				(std::ranges::begin(rg), std::ranges::end(rg), value);
 		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Returns the index position of the specified element in the given 
+		/// sequence, starting at 0. Node based iterators prefetch the next 
+		/// node while the current element is compared.
+		/// </summary>
+		/// 
+		/// <typeparam name="T">
+		/// The type of the value being searched for.
+		/// </typeparam>
+		/// <typeparam name="range">
+		/// The type of the range being searched.
+		/// </typeparam>
+		/// 
+		/// <param name="rg">
+		/// The range to be searched.
+		/// </param>
+		/// <param name="value">
+		/// The value to search for.
+		/// </param>
+		/// 
+		/// <returns>
+		/// Returns the index of the element if found, returns -1 otherwise.
+		/// </returns>
+		template <class T, std::ranges::input_range range>
+		constexpr auto operator()(
+			prefetching_t tag, 
+			const range& rg, 
+			const T& value
+		) const {
+			return (*this)
+				(tag, std::ranges::begin(rg), std::ranges::end(rg), value);
+		}
 	};
 
 	inline constexpr index_of_ index_of;
@@ -23,6 +23,7 @@
 
 #include "../concepts/associative.h"
 #include "../concepts/collection.h"
+#include "../util/prefetch.h"
 
 namespace collections {
 
@@ -76,6 +77,57 @@ namespace collections {
 			return begin;
 		}
 
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Returns an iterator to the given value if found in the specified
+		/// iterator pair. Node based iterators prefetch the next node while
+		/// the current element is compared.
+		/// </summary>
+		/// 
+		/// <typeparam name="T">
+		/// The type of the value being searched.
+		/// </typeparam>
+		/// <typeparam name="iterator">
+		/// The type of the input iterator being iterated over.
+		/// </typeparam>
+		/// <typeparam name="sentinel">
+		/// The type of the sentinel or end iterator.
+		/// </typeparam>
+		/// 
+		/// <param name="begin">
+		/// The beginning iterator of the range.
+		/// </param>
+		/// <param name="end">
+		/// The sentinel or end iterator of the range.
+		/// </param>
+		/// <param name="value">
+		/// The value to search for.
+		/// </param>
+		/// 
+		/// <returns>
+		/// Returns a valid iterator to the searched element or the end 
+		/// iterator if the value is not found.
+		/// </returns> --------------------------------------------------------
+		template <
+			class T,
+			std::input_iterator iterator,
+			std::sentinel_for<iterator> sentinel
+		>
+		constexpr auto operator()(
+			prefetching_t,
+			iterator begin,
+			sentinel end,
+			const T& value
+		) const {
+			while (begin != end) {
+				prefetch_next(begin);
+				if (*begin == value)
+					break;
+				begin++;
+			}
+			return begin;
+		}
+
 		// --------------------------------------------------------------------
 		/// <summary>
 		/// Returns an iterator to the given value if found in the specified
@@ -105,6 +157,41 @@ namespace collections {
 			return (*this)(std::ranges::begin(rg), std::ranges::end(rg), value);
 		}
 
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Returns an iterator to the given value if found in the specified
+		/// range. Node based iterators prefetch the next node while the 
+		/// current element is compared.
+		/// </summary>
+		/// 
+		/// <typeparam name="T">
+		/// The type of the value being searched for.
+		/// </typeparam>
+		/// <typeparam name="range">
+		/// The type of the range to be searched.
+		/// </typeparam>
+		/// 
+		/// <param name="rg">
+		/// The range to be searched.
+		/// </param>
+		/// <param name="value">
+		/// The value to search for.
+		/// </param>
+		/// 
+		/// <returns>
+		/// Returns a valid iterator to the searched element or the end 
+		/// iterator if the value is not found.
+		/// </returns> --------------------------------------------------------
+		template <class T, std::ranges::input_range range>
+		constexpr auto operator()(
+			prefetching_t tag, 
+			range&& rg, 
+			const T& value
+		) const {
+			return (*this)(
+				tag, std::ranges::begin(rg), std::ranges::end(rg), value);
+		}
+
 		// --------------------------------------------------------------------
 		/// <summary>
 		/// Returns an iterator to the given value if found within the 
@@ -182,8 +269,64 @@ namespace collections {
 			predicate p
 		) const {
 			while (begin != end) {
-				if (p(*begin++))
+				if (p(*begin))
+					break;
+				begin++;
+			}
+			return begin;
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Returns the first iterator in the specified range that matches
+		/// the given predicate. Node based iterators prefetch the next node
+		/// while the predicate is evaluated.
+		/// </summary>
+		/// 
+		/// <typeparam name="predicate">
+		/// The type of the predicate function to match against elements.
+		/// </typeparam>
+		/// 
+		/// <typeparam name="iterator">
+		/// The type of the input iterator being iterated over.
+		/// </typeparam>
+		/// 
+		/// <typeparam name="sentinel">
+		/// The type of the sentinel or end iterator.
+		/// </typeparam>
+		/// 
+		/// <param name="begin">
+		/// The beginning iterator of the range.
+		/// </param>
+		/// 
+		/// <param name="end">
+		/// The sentinel or end iterator of the range.
+		/// </param>
+		/// 
+		/// <param name="p">
+		/// The predicate to match against.
+		/// </param>
+		/// 
+		/// <returns>
+		/// Returns at iterator to the first matching element, otherwise returns 
+		/// the end iterator.
+		/// </returns> --------------------------------------------------------
+		template <
+			class predicate,
+			std::input_iterator iterator,
+			std::sentinel_for<iterator> sentinel
+		> requires std::predicate<predicate, std::iter_value_t<iterator>>
+		constexpr auto operator()(
+			prefetching_t,
+			iterator begin,
+			sentinel end,
+			predicate p
+		) const {
+			while (begin != end) {
+				prefetch_next(begin);
+				if (p(*begin))
 					break;
+				begin++;
 			}
 			return begin;
 		}
@@ -222,6 +365,46 @@ namespace collections {
 		constexpr auto operator()(range&& rg, predicate p) const {
 			return (*this)(std::ranges::begin(rg), std::ranges::end(rg), p);
 		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Returns the first iterator in the specified range that matches
+		/// the given predicate. Node based iterators prefetch the next node
+		/// while the predicate is evaluated.
+		/// </summary>
+		/// 
+		/// <typeparam name="predicate">
+		/// The type of the predicate function to match against elements.
+		/// </typeparam>
+		/// 
+		/// <typeparam name="range">
+		/// The type of the range to be searched.
+		/// </typeparam>
+		/// 
+		/// <param name="rg">
+		/// The range to be searched.
+		/// </param>
+		/// 
+		/// <param name="p">
+		/// The predicate to match against.
+		/// </param>
+		/// 
+		/// <returns>
+		/// Returns at iterator to the first matching element, otherwise returns 
+		/// the end iterator of the range.
+		/// </returns> --------------------------------------------------------
+		template <
+			class predicate, 
+			std::ranges::input_range range
+		> requires std::predicate<predicate, std::ranges::range_value_t<range>>
+		constexpr auto operator()(
+			prefetching_t tag, 
+			range&& rg, 
+			predicate p
+		) const {
+			return (*this)(
+				tag, std::ranges::begin(rg), std::ranges::end(rg), p);
+		}
 	};
 
 	inline constexpr find_ find;
@@ -305,6 +488,41 @@ namespace collections {
 			return (*this)(std::ranges::begin(rg), std::ranges::end(rg), value);
 		}
 
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Returns an iterator to the given value if found in the specified
+		/// range. Node based iterators prefetch the next node while the 
+		/// current element is compared.
+		/// </summary>
+		/// 
+		/// <typeparam name="T">
+		/// The type of the value being searched for.
+		/// </typeparam>
+		/// <typeparam name="range">
+		/// The type of the range to be searched.
+		/// </typeparam>
+		/// 
+		/// <param name="rg">
+		/// The range to be searched.
+		/// </param>
+		/// <param name="value">
+		/// The value to search for.
+		/// </param>
+		/// 
+		/// <returns>
+		/// Returns a valid iterator to the searched element or the end 
+		/// iterator if the value is not found.
+		/// </returns> --------------------------------------------------------
+		template <class T, std::ranges::input_range range>
+		constexpr auto operator()(
+			prefetching_t tag, 
+			range&& rg, 
+			const T& value
+		) const {
+			return (*this)(
+				tag, std::ranges::begin(rg), std::ranges::end(rg), value);
+		}
+
 		// --------------------------------------------------------------------
 		/// <summary>
 		/// Returns an iterator to the given value if found within the 
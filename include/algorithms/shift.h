@@ -20,6 +20,7 @@
 #include <cstdlib>
 #include <iterator>
 #include <ranges>
+#include <utility>
 
 namespace collections {
 
@@ -28,7 +29,7 @@ namespace collections {
 
 		constexpr void _shift(auto begin, auto end, int64_t amount) const {
 			while (begin != end) {
-				*std::next(begin, amount) = *begin;
+				*std::next(begin, amount) = std::move(*begin);
 				begin++;
 			}
 		}
@@ -39,7 +40,8 @@ namespace collections {
 		/// <summary>
 		/// Performs a shift of the elements in a bidirectional iterator pair 
 		/// moving them forward or backwards in the sequence by the specified 
-		/// amount.
+		/// amount. Elements are moved, so the vacated positions are left in a
+		/// valid but unspecified state.
 		/// </summary>
 		/// 
 		/// <typeparam name="iterator">
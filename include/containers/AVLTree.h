@@ -17,11 +17,16 @@
 
 #pragma once
 
+#include <algorithm>
+#include <bit>
 #include <functional>
+#include <future>
 #include <initializer_list>
 #include <iterator>
 #include <memory>
 #include <ranges>
+#include <stdexcept>
+#include <thread>
 #include <type_traits>
 #include <utility>
 
@@ -32,6 +37,7 @@
 #include "../concepts/map.h"
 #include "../concepts/positional.h"
 #include "../util/key_value_pair.h"
+#include "../util/types.h"
 
 namespace collections {
 
@@ -39,19 +45,30 @@ namespace collections {
 		class element_t,
 		class compare_t,
 		class allocator_t,
-		bool hasDuplicates
+		bool hasDuplicates,
+		bool isRanked = false
 	> 
 	class AVLTree : public impl::BaseBST<
 		element_t, 
 		compare_t, 
 		allocator_t,
 		hasDuplicates,
-		AVLTree<element_t, compare_t, allocator_t, hasDuplicates>>
+		isRanked,
+		false,
+		AVLTree<element_t, compare_t, allocator_t, hasDuplicates, isRanked>>
 	{
 	private:
 
-		using tree		= AVLTree<element_t, compare_t, allocator_t, hasDuplicates>;
-		using base_tree	= impl::BaseBST<element_t, compare_t, allocator_t, hasDuplicates, tree>;
+		using tree		= AVLTree<element_t, compare_t, allocator_t, hasDuplicates, isRanked>;
+		using base_tree	= impl::BaseBST<
+			element_t, 
+			compare_t, 
+			allocator_t, 
+			hasDuplicates, 
+			isRanked, 
+			false, 
+			tree
+		>;
 
 		using _node_type			= struct avl_node;
 		using alloc_traits			= base_tree::alloc_traits;
@@ -61,6 +78,7 @@ namespace collections {
 		using const_base_ptr		= base_tree::const_base_ptr;
 		using node_ptr				= base_tree::node_ptr;
 		using const_node_ptr		= base_tree::const_node_ptr;
+		using split_result			= base_tree::split_result;
 		using avl_ptr				= node_alloc_traits::pointer;
 		using const_avl_ptr			= node_alloc_traits::const_pointer;
 
@@ -89,6 +107,7 @@ namespace collections {
 		using const_reverse_iterator	= base_tree::const_reverse_iterator;
 
 		static constexpr bool allow_duplicates = hasDuplicates;
+		static constexpr bool is_ranked = isRanked;
 
 		// --------------------------------------------------------------------
 		/// <summary>
@@ -135,11 +154,9 @@ namespace collections {
 		/// The AVLTree to be copied.
 		/// </param> ----------------------------------------------------------
 		AVLTree(const AVLTree& copy) : AVLTree(
-			copy.begin<traversal_order::POST_ORDER>(),
-			copy.end<traversal_order::POST_ORDER>(),
 			alloc_traits::select_on_container_copy_construction(copy._allocator)
 		) {
-
+			this->cloneFrom(copy);
 		}
 
 		// --------------------------------------------------------------------
@@ -288,6 +305,229 @@ namespace collections {
 			return this->moveAssign(std::move(other));
 		}
 
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Moves every element not ordered before the given key out of this 
+		/// tree and into the returned tree.
+		/// </summary>
+		/// 
+		/// <param name="key">
+		/// The element or key to split the tree at.
+		/// </param>
+		/// 
+		/// <returns>
+		/// Returns a tree holding the elements greater than or equivalent to 
+		/// key.
+		/// </returns>
+		/// 
+		/// <remarks>
+		/// Splitting relinks the existing nodes in O(log n). Ranked trees 
+		/// size both halves from the subtree counts, while unranked trees 
+		/// also walk the smaller half once to count it.
+		/// </remarks> --------------------------------------------------------
+		[[nodiscard]] AVLTree split(key_type key) {
+			AVLTree result(_allocator);
+			this->splitInto(result, key);
+			return result;
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Joins two trees and an element that sits between them into a 
+		/// single tree in O(log n), reusing the nodes of both trees.
+		/// </summary>
+		/// 
+		/// <param name="lower">
+		/// The tree holding the elements ordered before element.
+		/// </param>
+		/// <param name="element">
+		/// The element to join the trees at.
+		/// </param>
+		/// <param name="upper">
+		/// The tree holding the elements ordered after element.
+		/// </param>
+		/// 
+		/// <returns>
+		/// Returns the joined tree, which uses the allocator of lower.
+		/// </returns>
+		/// 
+		/// <exception cref="std::invalid_argument">
+		/// Thrown if the three arguments are not in order.
+		/// </exception> ------------------------------------------------------
+		[[nodiscard]] static AVLTree join(
+			AVLTree lower, 
+			const_reference element, 
+			AVLTree upper
+		) {
+			const key_type& key = base_tree::keyOf(element);
+			bool isOrdered = (lower.isEmpty() || 
+					base_tree::isInOrder(base_tree::keyOfNode(lower._max), key)) &&
+				(upper.isEmpty() || 
+					base_tree::isInOrder(key, base_tree::keyOfNode(upper._min)));
+
+			[[unlikely]] if (!isOrdered)
+				throw std::invalid_argument("Joined trees are not in order.");
+
+			size_type size = lower.size() + upper.size() + 1;
+			base_ptr middle = lower.createNode(element);
+			base_ptr higher = nullptr;
+
+			try {
+				higher = lower.adopt(upper);
+			}
+			catch (...) {
+				lower.destroyNode(middle);
+				throw;
+			}
+
+			lower.resetRoot(joinNodes(lower.releaseRoot(), middle, higher), size);
+			return lower;
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Joins two trees into a single tree in O(log n), reusing the nodes 
+		/// of both trees.
+		/// </summary>
+		/// 
+		/// <param name="lower">
+		/// The tree holding the elements ordered first.
+		/// </param>
+		/// <param name="upper">
+		/// The tree holding the elements ordered last.
+		/// </param>
+		/// 
+		/// <returns>
+		/// Returns the joined tree, which uses the allocator of lower.
+		/// </returns>
+		/// 
+		/// <exception cref="std::invalid_argument">
+		/// Thrown if every element of lower is not ordered before upper.
+		/// </exception> ------------------------------------------------------
+		[[nodiscard]] static AVLTree join(AVLTree lower, AVLTree upper) {
+			return base_tree::joinTrees(std::move(lower), std::move(upper));
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Adds every element of the given tree to this one. For trees 
+		/// without duplicates, elements already in this tree are kept.
+		/// </summary>
+		/// 
+		/// <param name="other">
+		/// The tree to merge into this one, whose nodes are moved into this 
+		/// tree. Pass a copy to keep the original.
+		/// </param>
+		/// 
+		/// <remarks>
+		/// Merges by splitting and joining subtrees in O(m log(n/m + 1)) for 
+		/// trees of sizes m and n where m is less than n, without allocating.
+		/// If the comparator throws, the exception propagates and both trees 
+		/// are left empty, as are they for every set operation.
+		/// </remarks> --------------------------------------------------------
+		void unionWith(AVLTree&& other) {
+			combineWith(other, 0, &AVLTree::uniteNodes);
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Adds every element of the given tree to this one, running the 
+		/// independent halves of the merge on separate threads when given 
+		/// the parallel tag.
+		/// </summary>
+		/// 
+		/// <typeparam name="execution_tag">
+		/// Either serial_t or parallel_t, deciding whether the merge may run
+		/// in parallel.
+		/// </typeparam>
+		/// 
+		/// <param name="other">
+		/// The tree to merge into this one.
+		/// </param>
+		/// 
+		/// <remarks>
+		/// Parallel merges destroy nodes from several threads, so the 
+		/// allocator must be safe to use concurrently.
+		/// </remarks> --------------------------------------------------------
+		template <class execution_tag>
+			requires std::same_as<execution_tag, serial_t> || 
+				std::same_as<execution_tag, parallel_t>
+		void unionWith(execution_tag, AVLTree&& other) {
+			combineWith(other, forksFor<execution_tag>(), &AVLTree::uniteNodes);
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Removes every element of this tree that is not also in the given 
+		/// tree, in O(m log(n/m + 1)).
+		/// </summary>
+		/// 
+		/// <param name="other">
+		/// The tree to intersect with.
+		/// </param> ----------------------------------------------------------
+		void intersectionWith(AVLTree&& other) requires (!hasDuplicates) {
+			combineWith(other, 0, &AVLTree::intersectNodes);
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Removes every element of this tree that is not also in the given 
+		/// tree, running in parallel when given the parallel tag.
+		/// </summary>
+		/// 
+		/// <typeparam name="execution_tag">
+		/// Either serial_t or parallel_t, deciding whether the intersection 
+		/// may run in parallel.
+		/// </typeparam>
+		/// 
+		/// <param name="other">
+		/// The tree to intersect with.
+		/// </param> ----------------------------------------------------------
+		template <class execution_tag>
+			requires std::same_as<execution_tag, serial_t> || 
+				std::same_as<execution_tag, parallel_t>
+		void intersectionWith(execution_tag, AVLTree&& other) 
+			requires (!hasDuplicates) 
+		{
+			combineWith(other, forksFor<execution_tag>(), &AVLTree::intersectNodes);
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Removes every element of the given tree from this one, in 
+		/// O(m log(n/m + 1)).
+		/// </summary>
+		/// 
+		/// <param name="other">
+		/// The tree holding the elements to remove.
+		/// </param> ----------------------------------------------------------
+		void differenceWith(AVLTree&& other) requires (!hasDuplicates) {
+			combineWith(other, 0, &AVLTree::subtractNodes);
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Removes every element of the given tree from this one, running in 
+		/// parallel when given the parallel tag.
+		/// </summary>
+		/// 
+		/// <typeparam name="execution_tag">
+		/// Either serial_t or parallel_t, deciding whether the difference may
+		/// run in parallel.
+		/// </typeparam>
+		/// 
+		/// <param name="other">
+		/// The tree holding the elements to remove.
+		/// </param> ----------------------------------------------------------
+		template <class execution_tag>
+			requires std::same_as<execution_tag, serial_t> || 
+				std::same_as<execution_tag, parallel_t>
+		void differenceWith(execution_tag, AVLTree&& other) 
+			requires (!hasDuplicates) 
+		{
+			combineWith(other, forksFor<execution_tag>(), &AVLTree::subtractNodes);
+		}
+
 	private:
 
 		struct avl_node : base_tree::node_type {
@@ -319,8 +559,10 @@ namespace collections {
 		}
 
 		void destroyNode(base_ptr n) {
-			node_alloc_traits::destroy(_allocator, static_cast<avl_ptr>(n));
-			node_alloc_traits::deallocate(_allocator, static_cast<avl_ptr>(n), 1);
+			avl_ptr node = static_cast<avl_ptr>(n);
+			node_alloc_traits::destroy(_allocator, std::addressof(node->value()));
+			node_alloc_traits::destroy(_allocator, node);
+			node_alloc_traits::deallocate(_allocator, node, 1);
 		}
 
 		[[nodiscard]] size_type heightOfNode(const_base_ptr n) const noexcept {
@@ -361,6 +603,10 @@ namespace collections {
 				n = rebalance(n)->to(parent);
 		}
 
+		void onBuildNode(base_ptr n, const_base_ptr source) {
+			updateHeight(n);
+		}
+
 		void onAccessNode(base_ptr n) {}
 
 		void rebalanceOnInsert(base_ptr n) {
@@ -422,6 +668,377 @@ namespace collections {
 
 			return result;
 		}
+
+		// ---------------------------------------------------------------------
+		// Join based set operations work on detached subtrees. Only the parent 
+		// links below each subtree root are kept valid; roots are relinked by 
+		// whichever join consumes them. Parallel operations fork at most forks 
+		// levels deep, and never for subtrees shorter than parallel_grain.
+
+		using node_operation = base_ptr (AVLTree::*)(
+			base_ptr, base_ptr, size_type&, size_type);
+
+		constexpr static int64_t parallel_grain = 12;
+
+		template <class execution_tag>
+		[[nodiscard]] static size_type forksFor() {
+			if constexpr (std::same_as<execution_tag, parallel_t>)
+				return std::bit_width(std::thread::hardware_concurrency()) + 1;
+			else
+				return 0;
+		}
+
+		[[nodiscard]] static int64_t heightOfSubtree(const_base_ptr n) noexcept {
+			return n ? static_cast<const_avl_ptr>(n)->_height : -1;
+		}
+
+		void combineWith(AVLTree& other, size_type forks, node_operation op) {
+			size_type total = this->size() + other.size();
+			size_type discarded = 0;
+
+			base_ptr theirs = this->adopt(other);
+			base_ptr result = (this->*op)(this->releaseRoot(), theirs, discarded, forks);
+			this->resetRoot(result, total - discarded);
+		}
+
+		static base_ptr linkNodes(base_ptr l, base_ptr n, base_ptr r) {
+			n->to(left) = l;
+			n->to(right) = r;
+			n->to(parent) = nullptr;
+
+			if (l)
+				l->to(parent) = n;
+
+			if (r)
+				r->to(parent) = n;
+
+			static_cast<avl_ptr>(n)->_height = 
+				std::max(heightOfSubtree(l), heightOfSubtree(r)) + 1;
+			base_tree::updateNode(n);
+			return n;
+		}
+
+		static base_ptr rotateLeftOf(base_ptr n) {
+			base_ptr child = n->to(right);
+			linkNodes(n->to(left), n, child->to(left));
+			return linkNodes(n, child, child->to(right));
+		}
+
+		static base_ptr rotateRightOf(base_ptr n) {
+			base_ptr child = n->to(left);
+			linkNodes(child->to(right), n, n->to(right));
+			return linkNodes(child->to(left), child, n);
+		}
+
+		static base_ptr rebalanceSubtree(base_ptr n) {
+			base_ptr l = n->to(left);
+			base_ptr r = n->to(right);
+			int64_t balance = heightOfSubtree(r) - heightOfSubtree(l);
+
+			if (balance > 1) {
+				if (heightOfSubtree(r->to(left)) > heightOfSubtree(r->to(right)))
+					linkNodes(l, n, rotateRightOf(r));
+				return rotateLeftOf(n);
+			}
+
+			if (balance < -1) {
+				if (heightOfSubtree(l->to(right)) > heightOfSubtree(l->to(left)))
+					linkNodes(rotateLeftOf(l), n, r);
+				return rotateRightOf(n);
+			}
+
+			return n;
+		}
+
+		// joins l, n and r where l is more than one level taller than r by 
+		// walking down the right spine of l to a subtree r can hang beside.
+		static base_ptr joinRight(base_ptr l, base_ptr n, base_ptr r) {
+			base_ptr spine = l->to(right);
+
+			if (heightOfSubtree(spine) <= heightOfSubtree(r) + 1)
+				spine = linkNodes(spine, n, r);
+			else
+				spine = joinRight(spine, n, r);
+
+			return rebalanceSubtree(linkNodes(l->to(left), l, spine));
+		}
+
+		static base_ptr joinLeft(base_ptr l, base_ptr n, base_ptr r) {
+			base_ptr spine = r->to(left);
+
+			if (heightOfSubtree(spine) <= heightOfSubtree(l) + 1)
+				spine = linkNodes(l, n, spine);
+			else
+				spine = joinLeft(l, n, spine);
+
+			return rebalanceSubtree(linkNodes(spine, r, r->to(right)));
+		}
+
+		static base_ptr joinNodes(base_ptr l, base_ptr n, base_ptr r) {
+			int64_t leftHeight = heightOfSubtree(l);
+			int64_t rightHeight = heightOfSubtree(r);
+
+			if (leftHeight > rightHeight + 1)
+				return joinRight(l, n, r);
+
+			if (rightHeight > leftHeight + 1)
+				return joinLeft(l, n, r);
+
+			return linkNodes(l, n, r);
+		}
+
+		static base_ptr joinNodes(base_ptr l, base_ptr r) {
+			if (!l)
+				return r;
+
+			auto [rest, last] = splitLast(l);
+			return joinNodes(rest, last, r);
+		}
+
+		static split_result splitLast(base_ptr n) {
+			if (!n->to(right))
+				return { n->to(left), n };
+
+			auto [rest, last] = splitLast(n->to(right));
+			return { joinNodes(n->to(left), n, rest), last };
+		}
+
+		// splits n into the nodes ordered before key and the rest. When match 
+		// is given, a node equivalent to key is left out and returned there.
+		static split_result splitNodes(
+			base_ptr n, 
+			const key_type& key, 
+			base_ptr* match = nullptr
+		) {
+			if (!n)
+				return { nullptr, nullptr };
+
+			base_ptr l = n->to(left);
+			base_ptr r = n->to(right);
+
+			if (compare_t{}(base_tree::keyOfNode(n), key)) {
+				auto [lower, upper] = splitNodes(r, key, match);
+				return { joinNodes(l, n, lower), upper };
+			}
+
+			if (match && !compare_t{}(key, base_tree::keyOfNode(n))) {
+				*match = n;
+				return { l, r };
+			}
+
+			auto [lower, upper] = splitNodes(l, key, match);
+			return { lower, joinNodes(upper, n, r) };
+		}
+
+		// splits n around key for a set operation. The nodes are only relinked
+		// once every comparison is done, so a throwing comparison leaves n 
+		// whole, and both n and the other subtree of the operation are then 
+		// destroyed before rethrowing.
+		split_result splitOrDestroy(
+			base_ptr n, 
+			const key_type& key, 
+			base_ptr other, 
+			base_ptr* match
+		) {
+			try {
+				return splitNodes(n, key, match);
+			}
+			catch (...) {
+				this->destroySubtree(n);
+				this->destroySubtree(other);
+				throw;
+			}
+		}
+
+		// runs op on both pairs of subtrees, forking the left pair onto 
+		// another thread while there are forks left and the work is large.
+		// If the thread cannot be started the halves run here instead. Like 
+		// each operation, a throwing half leaves nothing behind: the other 
+		// half is still run to completion or destroyed before rethrowing.
+		split_result forkJoin(
+			size_type forks, 
+			int64_t height, 
+			size_type& discarded, 
+			node_operation op, 
+			split_result lefts, 
+			split_result rights
+		) {
+			if (forks == 0 || height < parallel_grain) {
+				base_ptr l = nullptr;
+
+				try {
+					l = (this->*op)(lefts.first, lefts.second, discarded, forks);
+				}
+				catch (...) {
+					this->destroySubtree(rights.first);
+					this->destroySubtree(rights.second);
+					throw;
+				}
+
+				try {
+					return { l, (this->*op)(rights.first, rights.second, discarded, forks) };
+				}
+				catch (...) {
+					this->destroySubtree(l);
+					throw;
+				}
+			}
+
+			size_type forkedDiscards = 0;
+			std::future<base_ptr> forked;
+
+			try {
+				forked = std::async(std::launch::async, [&, lefts]() {
+					return (this->*op)(lefts.first, lefts.second, forkedDiscards, forks - 1);
+				});
+			}
+			catch (...) {
+				return forkJoin(0, height, discarded, op, lefts, rights);
+			}
+
+			base_ptr r = nullptr;
+
+			try {
+				r = (this->*op)(rights.first, rights.second, discarded, forks - 1);
+			}
+			catch (...) {
+				try {
+					this->destroySubtree(forked.get());
+				}
+				catch (...) {}
+				throw;
+			}
+
+			base_ptr l = nullptr;
+
+			try {
+				l = forked.get();
+			}
+			catch (...) {
+				this->destroySubtree(r);
+				throw;
+			}
+
+			discarded += forkedDiscards;
+			return { l, r };
+		}
+
+		// Each operation consumes both subtrees. If a comparison throws, 
+		// every node of both is destroyed before the exception propagates.
+
+		base_ptr uniteNodes(
+			base_ptr mine, 
+			base_ptr theirs, 
+			size_type& discarded, 
+			size_type forks
+		) {
+			if (!mine)
+				return theirs;
+
+			if (!theirs)
+				return mine;
+
+			int64_t height = std::max(heightOfSubtree(mine), heightOfSubtree(theirs));
+			base_ptr match = nullptr;
+			base_ptr l = mine->to(left);
+			base_ptr r = mine->to(right);
+			auto [lower, upper] = splitOrDestroy(
+				theirs, base_tree::keyOfNode(mine), mine, 
+				hasDuplicates ? nullptr : &match);
+
+			if (match) {
+				destroyNode(match);
+				++discarded;
+			}
+
+			split_result joined;
+
+			try {
+				joined = forkJoin(forks, height, discarded, 
+					&AVLTree::uniteNodes, { l, lower }, { r, upper });
+			}
+			catch (...) {
+				destroyNode(mine);
+				throw;
+			}
+
+			return joinNodes(joined.first, mine, joined.second);
+		}
+
+		base_ptr intersectNodes(
+			base_ptr mine, 
+			base_ptr theirs, 
+			size_type& discarded, 
+			size_type forks
+		) {
+			if (!mine || !theirs) {
+				discarded += this->destroySubtree(mine ? mine : theirs);
+				return nullptr;
+			}
+
+			int64_t height = std::max(heightOfSubtree(mine), heightOfSubtree(theirs));
+			base_ptr match = nullptr;
+			base_ptr l = mine->to(left);
+			base_ptr r = mine->to(right);
+			auto [lower, upper] = splitOrDestroy(
+				theirs, base_tree::keyOfNode(mine), mine, &match);
+
+			split_result joined;
+
+			try {
+				joined = forkJoin(forks, height, discarded, 
+					&AVLTree::intersectNodes, { l, lower }, { r, upper });
+			}
+			catch (...) {
+				if (match)
+					destroyNode(match);
+				destroyNode(mine);
+				throw;
+			}
+
+			++discarded;
+
+			if (match) {
+				destroyNode(match);
+				return joinNodes(joined.first, mine, joined.second);
+			}
+
+			destroyNode(mine);
+			return joinNodes(joined.first, joined.second);
+		}
+
+		base_ptr subtractNodes(
+			base_ptr mine, 
+			base_ptr theirs, 
+			size_type& discarded, 
+			size_type forks
+		) {
+			if (!mine || !theirs) {
+				if (theirs)
+					discarded += this->destroySubtree(theirs);
+				return mine;
+			}
+
+			int64_t height = std::max(heightOfSubtree(mine), heightOfSubtree(theirs));
+			base_ptr match = nullptr;
+			base_ptr l = theirs->to(left);
+			base_ptr r = theirs->to(right);
+			auto [lower, upper] = splitOrDestroy(
+				mine, base_tree::keyOfNode(theirs), theirs, &match);
+
+			destroyNode(theirs);
+			++discarded;
+
+			if (match) {
+				destroyNode(match);
+				++discarded;
+			}
+
+			auto [joinedLeft, joinedRight] = forkJoin(forks, height, discarded, 
+				&AVLTree::subtractNodes, { lower, l }, { upper, r });
+
+			return joinNodes(joinedLeft, joinedRight);
+		}
 	};
 
 	template <
@@ -474,6 +1091,60 @@ namespace collections {
 		true
 	>;
 
+	template <
+		class element_t,
+		template <class> class compare_t = std::less,
+		template <class> class allocator_t = std::allocator
+	>
+	using RankedAVL = AVLTree<
+		element_t, 
+		compare_t<element_t>, 
+		allocator_t<element_t>, 
+		false,
+		true
+	>;
+
+	template <
+		class key_t,
+		class element_t,
+		template <class> class compare_t = std::less,
+		template <class> class allocator_t = std::allocator
+	>
+	using RankedMapAVL = AVLTree<
+		key_value_pair<const key_t, element_t>,
+		compare_t<key_t>,
+		std::allocator<key_value_pair<key_t, element_t>>,
+		false,
+		true
+	>;
+
+	template <
+		class element_t,
+		template <class> class compare_t = std::less,
+		template <class> class allocator_t = std::allocator
+	>
+	using RankedMultiAVL = AVLTree<
+		element_t, 
+		compare_t<element_t>, 
+		allocator_t<element_t>, 
+		true,
+		true
+	>;
+
+	template <
+		class key_t,
+		class element_t,
+		template <class> class compare_t = std::less,
+		template <class> class allocator_t = std::allocator
+	>
+	using RankedMultiMapAVL = AVLTree<
+		key_value_pair<const key_t, element_t>,
+		compare_t<key_t>,
+		std::allocator<key_value_pair<key_t, element_t>>,
+		true,
+		true
+	>;
+
 	static_assert(
 		collection<SimpleAVL<int>>,
 		"AVLTree does not meet the requirements for a collection."
@@ -503,4 +1174,9 @@ namespace collections {
 		multimap<MultiMapAVL<int, int >>,
 		"AVLTree does not meet the requirements for a multimap."
 	);
+
+	static_assert(
+		collection<RankedAVL<int>>,
+		"AVLTree does not meet the requirements for a collection when ranked."
+	);
 }
\ No newline at end of file
@@ -0,0 +1,1720 @@
+/* ============================================================================
+* Copyright (C) 2023 Ryan Eubank
+*
+* This program is free software: you can redistribute it and/or modify
+* it under the terms of the GNU General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License
+* along with this program.  If not, see <https://www.gnu.org/licenses/>.
+* ========================================================================= */
+
+#pragma once
+
+#include <algorithm>
+#include <compare>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <initializer_list>
+#include <istream>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <new>
+#include <ostream>
+#include <ranges>
+#include <type_traits>
+#include <utility>
+
+#include "../algorithms/compare.h"
+#include "../algorithms/stream.h"
+#include "../concepts/associative.h"
+#include "../concepts/collection.h"
+#include "../concepts/iterable.h"
+#include "../concepts/map.h"
+#include "../concepts/positional.h"
+#include "../util/key_value_pair.h"
+
+namespace collections {
+
+	// -------------------------------------------------------------------------
+	/// <summary>
+	/// The default number of elements held by each BTree node; enough to fill
+	/// four 64 byte cache lines, but never fewer than three.
+	/// </summary> -------------------------------------------------------------
+	template <class element_t>
+	inline constexpr std::size_t btree_default_capacity =
+		std::clamp<std::size_t>(256 / sizeof(element_t), 3, 255);
+
+	// -------------------------------------------------------------------------
+	/// <summary>
+	/// BTree is an ordered associative container storing up to nodeCapacity
+	/// elements contiguously in each node. A lookup touches O(log n)
+	/// elements spread over only O(log n / log nodeCapacity) nodes, and
+	/// leaves, which hold almost every element, carry no child links, so the
+	/// tree uses far fewer pointers and cache misses than a binary tree.
+	///
+	/// <para>
+	/// Nodes are searched with a branchless linear count for arithmetic keys
+	/// under std::less or std::greater, which compilers vectorize, and with
+	/// a binary search otherwise. Elements are relocated between slots as
+	/// nodes split and merge, so any insertion or removal invalidates all
+	/// iterators into the tree, and element move constructors are expected
+	/// not to throw.
+	/// </para>
+	/// </summary>
+	///
+	/// <typeparam name="element_t">
+	/// The type of the elements contained by the BTree.
+	/// </typeparam>
+	/// <typeparam name="compare_t">
+	/// The comparison ordering the keys of the BTree.
+	/// </typeparam>
+	/// <typeparam name="allocator_t">
+	/// The type of the allocator responsible for allocating the nodes.
+	/// </typeparam>
+	/// <typeparam name="hasDuplicates">
+	/// Whether the BTree may hold elements with equivalent keys.
+	/// </typeparam>
+	/// <typeparam name="nodeCapacity">
+	/// The maximum number of elements held by each node.
+	/// </typeparam> -----------------------------------------------------------
+	template <
+		class element_t,
+		class compare_t,
+		class allocator_t,
+		bool hasDuplicates,
+		std::size_t nodeCapacity = btree_default_capacity<element_t>
+	> requires std::predicate<
+		compare_t,
+		typename key_traits<element_t>::key_type,
+		typename key_traits<element_t>::key_type
+	>
+	class BTree final {
+	private:
+
+		static_assert(
+			nodeCapacity >= 3 &&
+			nodeCapacity < std::numeric_limits<std::uint16_t>::max(),
+			"BTree nodes must hold at least 3 and fewer than 65535 elements."
+		);
+
+		template <bool isConst>
+		class BTreeIterator;
+
+		using alloc_t		= rebind<allocator_t, element_t>;
+		using alloc_traits	= std::allocator_traits<alloc_t>;
+
+	public:
+
+		using value_type		= element_t;
+		using key_type			= key_traits<element_t>::key_type;
+		using mapped_type		= key_traits<element_t>::mapped_type;
+		using allocator_type	= allocator_t;
+		using size_type			= alloc_traits::size_type;
+		using difference_type	= alloc_traits::difference_type;
+		using pointer			= alloc_traits::pointer;
+		using const_pointer		= alloc_traits::const_pointer;
+		using reference			= value_type&;
+		using const_reference	= const value_type&;
+
+		using iterator					= BTreeIterator<false>;
+		using const_iterator			= BTreeIterator<true>;
+		using reverse_iterator			= std::reverse_iterator<iterator>;
+		using const_reverse_iterator	= std::reverse_iterator<const_iterator>;
+
+		static constexpr bool allow_duplicates		= hasDuplicates;
+		static constexpr bool is_map				= pair_type<element_t>;
+		static constexpr size_type node_capacity	= nodeCapacity;
+
+	private:
+
+		using stored_key = std::remove_cv_t<key_type>;
+
+		static constexpr bool is_linear_search =
+			std::is_arithmetic_v<stored_key> && (
+				std::same_as<compare_t, std::less<stored_key>> ||
+				std::same_as<compare_t, std::greater<stored_key>> ||
+				std::same_as<compare_t, std::less<>> ||
+				std::same_as<compare_t, std::greater<>>
+			);
+
+		static constexpr size_type min_count = (nodeCapacity - 1) / 2;
+		static constexpr size_type split_index = nodeCapacity / 2;
+
+		struct internal_node;
+
+		struct leaf_node {
+			internal_node* parent = nullptr;
+			std::uint16_t position = 0;
+			std::uint16_t count = 0;
+			bool isLeaf = true;
+
+			alignas(value_type) std::byte storage[nodeCapacity * sizeof(value_type)];
+
+			[[nodiscard]] value_type* at(size_type index) noexcept {
+				return std::launder(reinterpret_cast<value_type*>(storage)) + index;
+			}
+
+			[[nodiscard]] const value_type* at(size_type index) const noexcept {
+				return const_cast<leaf_node*>(this)->at(index);
+			}
+		};
+
+		struct internal_node : leaf_node {
+			leaf_node* children[nodeCapacity + 1] = {};
+
+			internal_node() noexcept {
+				this->isLeaf = false;
+			}
+		};
+
+	public:
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// ~~~ Default Constructor ~~~
+		///
+		/// <para>
+		/// Constructs an empty BTree.
+		/// </para></summary> -------------------------------------------------
+		BTree() noexcept(
+			std::is_nothrow_default_constructible_v<allocator_type>
+		) : BTree(allocator_type{}) {
+
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// ~~~ Allocator Constructor ~~~
+		///
+		/// <para>
+		/// Constructs an empty BTree with the given allocator.
+		/// </para></summary>
+		///
+		/// <param name="alloc">
+		/// The allocator instance used by the tree.
+		/// </param> ----------------------------------------------------------
+		explicit BTree(const allocator_type& alloc) noexcept(
+			std::is_nothrow_copy_constructible_v<allocator_type>
+		) : _allocator(alloc), _root(nullptr), _size(0) {
+
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// ~~~ Copy Constructor ~~~
+		///
+		/// <para>
+		/// Constructs a deep copy of the given BTree, cloning its node
+		/// structure in O(n).
+		/// </para></summary>
+		///
+		/// <param name="copy">
+		/// The tree to copy.
+		/// </param> ----------------------------------------------------------
+		BTree(const BTree& copy) : BTree(
+			alloc_traits::select_on_container_copy_construction(copy._allocator)
+		) {
+			cloneFrom(copy);
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// ~~~ Move Constructor ~~~
+		///
+		/// <para>
+		/// Takes over the nodes of the given BTree, leaving it empty.
+		/// </para></summary>
+		///
+		/// <param name="other">
+		/// The tree to move from.
+		/// </param> ----------------------------------------------------------
+		BTree(BTree&& other) noexcept(
+			std::is_nothrow_move_constructible_v<allocator_type>
+		) : _allocator(std::move(other._allocator)),
+			_root(std::exchange(other._root, nullptr)),
+			_size(std::exchange(other._size, 0))
+		{
+
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// ~~~ Initializer List Constructor ~~~
+		///
+		/// <para>
+		/// Constructs a BTree with a copy of the elements in the given
+		/// initializer list.
+		/// </para></summary>
+		///
+		/// <param name="init">
+		/// The initialization list to copy elements from.
+		/// </param>
+		/// <param name="alloc">
+		/// The allocator instance used by the tree.
+		/// </param> ----------------------------------------------------------
+		BTree(
+			std::initializer_list<value_type> init,
+			const allocator_type& alloc = allocator_type{}
+		) : BTree(init.begin(), init.end(), alloc) {
+
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// ~~~ Iterator Constructor ~~~
+		///
+		/// <para>
+		/// Constructs a BTree with a copy of the elements from the given
+		/// iterator pair.
+		/// </para></summary>
+		///
+		/// <param name="begin">
+		/// The beginning of the iterator pair to copy from.
+		/// </param>
+		/// <param name="end">
+		/// The end of the iterator pair to copy from.
+		/// </param>
+		/// <param name="alloc">
+		/// The allocator instance used by the tree.
+		/// </param> ----------------------------------------------------------
+		template <
+			std::input_iterator in_iterator,
+			std::sentinel_for<in_iterator> sentinel
+		>
+		BTree(
+			in_iterator begin,
+			sentinel end,
+			const allocator_type& alloc = allocator_type{}
+		) : BTree(alloc) {
+			insert(begin, end);
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// ~~~ Range Constructor ~~~
+		///
+		/// <para>
+		/// Constructs a BTree with a copy of the elements from the given
+		/// range.
+		/// </para></summary>
+		///
+		/// <param name="r">
+		/// The range to construct the tree with.
+		/// </param>
+		/// <param name="alloc">
+		/// The allocator instance for the tree.
+		/// </param> ----------------------------------------------------------
+		template <std::ranges::input_range range>
+		BTree(
+			from_range_t tag,
+			range&& r,
+			const allocator_type& alloc = allocator_type{}
+		) : BTree(std::ranges::begin(r), std::ranges::end(r), alloc) {
+
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// ~~~ Destructor ~~~
+		///
+		/// <para>
+		/// Destroys every element and releases the tree's memory.
+		/// </para></summary> -------------------------------------------------
+		~BTree() {
+			clear();
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// ~~~ Copy Assignment Operator ~~~
+		///
+		/// <para>
+		/// Replaces the contents of the tree with a copy of the other tree.
+		/// </para></summary>
+		///
+		/// <param name="other">
+		/// The tree to copy.
+		/// </param> ----------------------------------------------------------
+		BTree& operator=(const BTree& other) {
+			static constexpr bool isAlwaysEqual =
+				alloc_traits::is_always_equal::value;
+			static constexpr bool willPropagate =
+				alloc_traits::propagate_on_container_copy_assignment::value;
+
+			if (&other == this)
+				return *this;
+
+			clear();
+
+			if (!isAlwaysEqual && willPropagate && _allocator != other._allocator)
+				_allocator = other._allocator;
+
+			cloneFrom(other);
+			return *this;
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// ~~~ Move Assignment Operator ~~~
+		///
+		/// <para>
+		/// Replaces the contents of the tree with those of the other tree,
+		/// moving elements one by one only when the allocators are unequal
+		/// and do not propagate.
+		/// </para></summary>
+		///
+		/// <param name="other">
+		/// The tree to move from.
+		/// </param> ----------------------------------------------------------
+		BTree& operator=(BTree&& other)
+			noexcept(alloc_traits::is_always_equal::value)
+		{
+			static constexpr bool isAlwaysEqual =
+				alloc_traits::is_always_equal::value;
+			static constexpr bool willPropagate =
+				alloc_traits::propagate_on_container_move_assignment::value;
+
+			if (&other == this)
+				return *this;
+
+			clear();
+
+			if (isAlwaysEqual || _allocator == other._allocator)
+				swapMembers(other);
+			else if (willPropagate) {
+				_allocator = std::move(other._allocator);
+				swapMembers(other);
+			}
+			else {
+				insert(
+					std::move_iterator(other.begin()),
+					std::move_iterator(other.end())
+				);
+				other.clear();
+			}
+
+			return *this;
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Returns whether the tree is empty and contains no elements.
+		/// </summary> --------------------------------------------------------
+		[[nodiscard]] bool isEmpty() const noexcept {
+			return !_size;
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Returns the number of elements contained by the tree.
+		/// </summary> --------------------------------------------------------
+		[[nodiscard]] size_type size() const noexcept {
+			return _size;
+		}
+
+		// ---------------------------------------------------------------------
+		/// <summary>
+		/// Returns the theoretical maximum size for the container.
+		/// </summary> ---------------------------------------------------------
+		[[nodiscard]] size_type max_size() const noexcept {
+			return alloc_traits::max_size(_allocator);
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Returns the number of node levels below the root, which is zero
+		/// for an empty tree or a tree held in a single node.
+		/// </summary> --------------------------------------------------------
+		[[nodiscard]] size_type height() const noexcept {
+			size_type height = 0;
+
+			for (const leaf_node* n = _root; n && !n->isLeaf; ++height)
+				n = childOf(n, 0);
+
+			return height;
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Removes and destroys every element in the tree.
+		/// </summary> --------------------------------------------------------
+		void clear() noexcept {
+			destroySubtree(_root);
+			_root = nullptr;
+			_size = 0;
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Returns an iterator to the smallest element of the tree.
+		/// </summary> --------------------------------------------------------
+		[[nodiscard]] iterator minimum() noexcept {
+			return begin();
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Returns an iterator to the smallest element of the tree.
+		/// </summary> --------------------------------------------------------
+		[[nodiscard]] const_iterator minimum() const noexcept {
+			return begin();
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Returns an iterator to the largest element of the tree.
+		/// </summary> --------------------------------------------------------
+		[[nodiscard]] iterator maximum() noexcept {
+			return _root ? std::prev(end()) : end();
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Returns an iterator to the largest element of the tree.
+		/// </summary> --------------------------------------------------------
+		[[nodiscard]] const_iterator maximum() const noexcept {
+			return _root ? std::prev(end()) : end();
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Returns an iterator to the first element of the tree.
+		/// </summary> --------------------------------------------------------
+		[[nodiscard]] iterator begin() noexcept {
+			return iterator(this, leftMostLeafOf(_root), 0);
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Returns an iterator to the first element of the tree.
+		/// </summary> --------------------------------------------------------
+		[[nodiscard]] const_iterator begin() const noexcept {
+			return const_iterator(this, leftMostLeafOf(_root), 0);
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Returns an iterator to the first element of the tree.
+		/// </summary> --------------------------------------------------------
+		[[nodiscard]] const_iterator cbegin() const noexcept {
+			return begin();
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Returns an iterator past the last element of the tree.
+		/// </summary> --------------------------------------------------------
+		[[nodiscard]] iterator end() noexcept {
+			return iterator(this, nullptr, 0);
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Returns an iterator past the last element of the tree.
+		/// </summary> --------------------------------------------------------
+		[[nodiscard]] const_iterator end() const noexcept {
+			return const_iterator(this, nullptr, 0);
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Returns an iterator past the last element of the tree.
+		/// </summary> --------------------------------------------------------
+		[[nodiscard]] const_iterator cend() const noexcept {
+			return end();
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Returns a reverse iterator to the last element of the tree.
+		/// </summary> --------------------------------------------------------
+		[[nodiscard]] reverse_iterator rbegin() noexcept {
+			return reverse_iterator(end());
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Returns a reverse iterator to the last element of the tree.
+		/// </summary> --------------------------------------------------------
+		[[nodiscard]] const_reverse_iterator rbegin() const noexcept {
+			return const_reverse_iterator(end());
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Returns a reverse iterator to the last element of the tree.
+		/// </summary> --------------------------------------------------------
+		[[nodiscard]] const_reverse_iterator crbegin() const noexcept {
+			return rbegin();
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Returns a reverse iterator before the first element of the tree.
+		/// </summary> --------------------------------------------------------
+		[[nodiscard]] reverse_iterator rend() noexcept {
+			return reverse_iterator(begin());
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Returns a reverse iterator before the first element of the tree.
+		/// </summary> --------------------------------------------------------
+		[[nodiscard]] const_reverse_iterator rend() const noexcept {
+			return const_reverse_iterator(begin());
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Returns a reverse iterator before the first element of the tree.
+		/// </summary> --------------------------------------------------------
+		[[nodiscard]] const_reverse_iterator crend() const noexcept {
+			return rend();
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Searches the tree for the given key.
+		/// </summary>
+		///
+		/// <param name="key">
+		/// The element or key to search for.
+		/// </param>
+		///
+		/// <returns>
+		/// Returns an iterator to the first element equivalent to key, or
+		/// the end iterator if there is none.
+		/// </returns> --------------------------------------------------------
+		[[nodiscard]] iterator find(const key_type& key) {
+			auto [n, index] = boundOf<false>(key);
+
+			if (n && !compare(key, keyOf(*n->at(index))))
+				return iterator(this, n, index);
+
+			return end();
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Searches the tree for the given key.
+		/// </summary>
+		///
+		/// <param name="key">
+		/// The element or key to search for.
+		/// </param>
+		///
+		/// <returns>
+		/// Returns an iterator to the first element equivalent to key, or
+		/// the end iterator if there is none.
+		/// </returns> --------------------------------------------------------
+		[[nodiscard]] const_iterator find(const key_type& key) const {
+			return const_cast<BTree*>(this)->find(key);
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Returns whether the tree holds an element equivalent to key.
+		/// </summary> --------------------------------------------------------
+		[[nodiscard]] bool contains(const key_type& key) const {
+			return find(key) != end();
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Returns an iterator to the first element not ordered before key.
+		/// </summary>
+		///
+		/// <param name="key">
+		/// The element or key to bound.
+		/// </param> ----------------------------------------------------------
+		[[nodiscard]] iterator lowerBound(const key_type& key) {
+			auto [n, index] = boundOf<false>(key);
+			return iterator(this, n, index);
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Returns an iterator to the first element not ordered before key.
+		/// </summary>
+		///
+		/// <param name="key">
+		/// The element or key to bound.
+		/// </param> ----------------------------------------------------------
+		[[nodiscard]] const_iterator lowerBound(const key_type& key) const {
+			return const_cast<BTree*>(this)->lowerBound(key);
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Returns an iterator to the first element ordered after key.
+		/// </summary>
+		///
+		/// <param name="key">
+		/// The element or key to bound.
+		/// </param> ----------------------------------------------------------
+		[[nodiscard]] iterator upperBound(const key_type& key) {
+			auto [n, index] = boundOf<true>(key);
+			return iterator(this, n, index);
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Returns an iterator to the first element ordered after key.
+		/// </summary>
+		///
+		/// <param name="key">
+		/// The element or key to bound.
+		/// </param> ----------------------------------------------------------
+		[[nodiscard]] const_iterator upperBound(const key_type& key) const {
+			return const_cast<BTree*>(this)->upperBound(key);
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Returns the number of elements equivalent to the given key.
+		/// </summary> --------------------------------------------------------
+		[[nodiscard]] size_type count(const key_type& key) const {
+			if constexpr (hasDuplicates) {
+				auto distance = std::distance(lowerBound(key), upperBound(key));
+				return static_cast<size_type>(distance);
+			}
+			else
+				return contains(key) ? 1 : 0;
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Inserts a copy of the given element. Trees without duplicates
+		/// are left unchanged when an equivalent element already exists.
+		/// </summary>
+		///
+		/// <returns>
+		/// Returns an iterator to the inserted element, or to the existing
+		/// equivalent element.
+		/// </returns> --------------------------------------------------------
+		iterator insert(const_reference element) {
+			return placeElement(value_type(element));
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Moves the given element into the tree. Trees without duplicates
+		/// are left unchanged when an equivalent element already exists.
+		/// </summary>
+		///
+		/// <returns>
+		/// Returns an iterator to the inserted element, or to the existing
+		/// equivalent element.
+		/// </returns> --------------------------------------------------------
+		iterator insert(value_type&& element) {
+			return placeElement(std::move(element));
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Inserts a copy of every element in the given range.
+		/// </summary>
+		///
+		/// <param name="begin">
+		/// The beginning of the range to insert.
+		/// </param>
+		/// <param name="end">
+		/// The end of the range to insert.
+		/// </param>
+		///
+		/// <returns>
+		/// Returns an iterator to the element inserted last, or to the
+		/// existing element equivalent to it.
+		/// </returns> --------------------------------------------------------
+		template <
+			std::input_iterator in_iterator,
+			std::sentinel_for<in_iterator> sentinel
+		>
+		iterator insert(in_iterator begin, sentinel end) {
+			iterator result = this->end();
+
+			// each insert invalidates the previous result, so only the 
+			// last one is returned.
+			while (begin != end)
+				result = placeElement(value_type(*begin++));
+
+			return result;
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Inserts a copy of the given element. The position hint is accepted
+		/// for interface compatibility; the element is placed by its key.
+		/// </summary> --------------------------------------------------------
+		iterator insert(const_iterator position, const_reference element) {
+			return insert(element);
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Moves the given element into the tree. The position hint is
+		/// accepted for interface compatibility; the element is placed by
+		/// its key.
+		/// </summary> --------------------------------------------------------
+		iterator insert(const_iterator position, value_type&& element) {
+			return insert(std::move(element));
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Inserts a copy of every element in the given range. The position
+		/// hint is accepted for interface compatibility.
+		/// </summary> --------------------------------------------------------
+		template <
+			std::input_iterator in_iterator,
+			std::sentinel_for<in_iterator> sentinel
+		>
+		iterator insert(
+			const_iterator position,
+			in_iterator begin,
+			sentinel end
+		) {
+			return insert(begin, end);
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Constructs an element from the given arguments and inserts it.
+		/// </summary>
+		///
+		/// <returns>
+		/// Returns an iterator to the inserted element, or to the existing
+		/// equivalent element.
+		/// </returns> --------------------------------------------------------
+		template <class T, class ...Args>
+			requires (!std::convertible_to<T, const_iterator>)
+		iterator emplace(T&& arg1, Args&&... args) {
+			return placeElement(
+				value_type(std::forward<T>(arg1), std::forward<Args>(args)...));
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Constructs an element from the given arguments and inserts it.
+		/// The position hint is accepted for interface compatibility.
+		/// </summary> --------------------------------------------------------
+		template <class ...Args>
+		iterator emplace(const_iterator position, Args&&... args) {
+			return placeElement(value_type(std::forward<Args>(args)...));
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Removes the element at the given position.
+		/// </summary>
+		///
+		/// <returns>
+		/// Returns an iterator to the element that followed the removed one.
+		/// </returns> --------------------------------------------------------
+		iterator remove(const_iterator position) {
+			auto [n, index] = eraseAt(position.node(), position._index);
+			return iterator(this, n, index);
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Removes every element in the range [begin, end).
+		/// </summary>
+		///
+		/// <returns>
+		/// Returns an iterator to the element that followed the range.
+		/// </returns> --------------------------------------------------------
+		iterator remove(const_iterator begin, const_iterator end) {
+			difference_type count = std::distance(begin, end);
+			iterator position(this, begin.node(), begin._index);
+
+			while (count-- > 0)
+				position = remove(position);
+
+			return position;
+		}
+
+		// ---------------------------------------------------------------------
+		/// <summary>
+		/// Swaps the contents of the given BTrees.
+		/// </summary> --------------------------------------------------------
+		friend void swap(BTree& a, BTree& b)
+			noexcept(alloc_traits::is_always_equal::value)
+		{
+			a.swap(b);
+		}
+
+		// ---------------------------------------------------------------------
+		/// <summary>
+		/// Swaps the contents of this BTree with the given tree.
+		/// </summary> --------------------------------------------------------
+		void swap(BTree& other)
+			noexcept(alloc_traits::is_always_equal::value)
+		{
+			static constexpr bool isAlwaysEqual =
+				alloc_traits::is_always_equal::value;
+			static constexpr bool willPropagate =
+				alloc_traits::propagate_on_container_swap::value;
+			bool isInstanceEqual = _allocator == other._allocator;
+
+			if (isAlwaysEqual || isInstanceEqual)
+				swapMembers(other);
+			else if (willPropagate) {
+				using std::swap;
+				swap(_allocator, other._allocator);
+				swapMembers(other);
+			}
+			else // Undefined behavior under STL specification
+				;
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// ~~~ Equality Operator ~~~
+		/// </summary>
+		///
+		/// <returns>
+		/// Returns true if both trees hold equal elements in the same order.
+		/// </returns> --------------------------------------------------------
+		friend bool operator==(const BTree& lhs, const BTree& rhs) noexcept {
+			if (lhs.size() == rhs.size())
+				return collections::lexicographic_compare(lhs, rhs) == 0;
+			return false;
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// ~~~ Comparison Operator ~~~
+		/// </summary>
+		///
+		/// <returns>
+		/// Orders trees by size first and then lexicographically by their
+		/// elements.
+		/// </returns> --------------------------------------------------------
+		friend auto operator<=>(const BTree& lhs, const BTree& rhs)
+			noexcept requires std::three_way_comparable<value_type>
+		{
+			using comparison = decltype(value_type{} <=> value_type{});
+
+			auto compareSize = lhs.size() <=> rhs.size();
+			if (compareSize == 0)
+				return collections::lexicographic_compare(lhs, rhs);
+
+			return static_cast<comparison>(compareSize);
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// ~~~ Output Stream Operator ~~~
+		/// </summary>
+		///
+		/// <returns>
+		/// Returns the output stream after writing the tree's size and
+		/// elements.
+		/// </returns> --------------------------------------------------------
+		template <typename char_t>
+		friend std::basic_ostream<char_t>& operator<<(
+			std::basic_ostream<char_t>& os,
+			const BTree& tree
+		) {
+			collections::stream(tree.begin(), tree.end(), tree.size(), os);
+			return os;
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// ~~~ Input Stream Operator ~~~
+		/// </summary>
+		///
+		/// <returns>
+		/// Returns the input stream after reading a size followed by that
+		/// many elements into the tree.
+		/// </returns> --------------------------------------------------------
+		template <typename char_t>
+		friend std::basic_istream<char_t>& operator>>(
+			std::basic_istream<char_t>& is,
+			BTree& tree
+		) {
+			size_type size = 0;
+			value_type value{};
+			is >> size;
+
+			tree.clear();
+
+			for (size_type i = 0; i < size; ++i) {
+				is >> value;
+				tree.insert(value);
+			}
+
+			return is;
+		}
+
+	private:
+
+		[[no_unique_address, msvc::no_unique_address]]
+		alloc_t _allocator;
+		leaf_node* _root;
+		size_type _size;
+
+		void swapMembers(BTree& other) noexcept {
+			std::swap(_root, other._root);
+			std::swap(_size, other._size);
+		}
+
+		[[nodiscard]] static const key_type& keyOf(const_reference element) {
+			if constexpr (is_map)
+				return element.key();
+			else
+				return element;
+		}
+
+		[[nodiscard]] static bool compare(const key_type& a, const key_type& b) {
+			return compare_t{}(a, b);
+		}
+
+		[[nodiscard]] static leaf_node* childOf(
+			const leaf_node* n,
+			size_type index
+		) noexcept {
+			return static_cast<const internal_node*>(n)->children[index];
+		}
+
+		static void setChild(
+			leaf_node* n,
+			size_type index,
+			leaf_node* child
+		) noexcept {
+			static_cast<internal_node*>(n)->children[index] = child;
+			child->parent = static_cast<internal_node*>(n);
+			child->position = static_cast<std::uint16_t>(index);
+		}
+
+		[[nodiscard]] static leaf_node* leftMostLeafOf(const leaf_node* n) noexcept {
+			while (n && !n->isLeaf)
+				n = childOf(n, 0);
+			return const_cast<leaf_node*>(n);
+		}
+
+		[[nodiscard]] static leaf_node* rightMostLeafOf(const leaf_node* n) noexcept {
+			while (n && !n->isLeaf)
+				n = childOf(n, n->count);
+			return const_cast<leaf_node*>(n);
+		}
+
+		// ----------------------------- SEARCH ---------------------------- //
+
+		// counts the elements of n ordered before key, or not ordered after
+		// it when inclusive, giving the index of its lower or upper bound.
+		template <bool inclusive>
+		[[nodiscard]] static size_type boundIn(
+			const leaf_node* n,
+			const key_type& key
+		) {
+			if constexpr (is_linear_search) {
+				size_type index = 0;
+
+				for (size_type i = 0; i < n->count; ++i) {
+					if constexpr (inclusive)
+						index += !compare(key, keyOf(*n->at(i)));
+					else
+						index += compare(keyOf(*n->at(i)), key);
+				}
+
+				return index;
+			}
+			else {
+				size_type low = 0;
+				size_type high = n->count;
+
+				while (low < high) {
+					size_type middle = low + (high - low) / 2;
+					const key_type& current = keyOf(*n->at(middle));
+					bool isBefore = inclusive
+						? !compare(key, current)
+						: compare(current, key);
+
+					if (isBefore)
+						low = middle + 1;
+					else
+						high = middle;
+				}
+
+				return low;
+			}
+		}
+
+		template <bool inclusive>
+		[[nodiscard]] std::pair<leaf_node*, size_type> boundOf(
+			const key_type& key
+		) const {
+			leaf_node* bound = nullptr;
+			size_type boundIndex = 0;
+
+			for (leaf_node* n = _root; n; ) {
+				size_type index = boundIn<inclusive>(n, key);
+
+				if (index < n->count) {
+					bound = n;
+					boundIndex = index;
+
+					// keys are unique so an equal key is the bound itself
+					if constexpr (!inclusive && !hasDuplicates)
+						if (!compare(key, keyOf(*n->at(index))))
+							break;
+				}
+
+				if (n->isLeaf)
+					break;
+
+				n = childOf(n, index);
+			}
+
+			return { bound, boundIndex };
+		}
+
+		// --------------------------- ALLOCATION -------------------------- //
+
+		template <class node_t>
+		[[nodiscard]] node_t* createNode() {
+			using node_allocator_type = rebind<allocator_t, node_t>;
+			using node_alloc_traits = std::allocator_traits<node_allocator_type>;
+
+			node_allocator_type alloc(_allocator);
+			node_t* n = node_alloc_traits::allocate(alloc, 1);
+			node_alloc_traits::construct(alloc, n);
+			return n;
+		}
+
+		template <class node_t>
+		void deallocateNode(leaf_node* n) noexcept {
+			using node_allocator_type = rebind<allocator_t, node_t>;
+			using node_alloc_traits = std::allocator_traits<node_allocator_type>;
+
+			node_allocator_type alloc(_allocator);
+			node_t* typed = static_cast<node_t*>(n);
+			node_alloc_traits::destroy(alloc, typed);
+			node_alloc_traits::deallocate(alloc, typed, 1);
+		}
+
+		[[nodiscard]] leaf_node* createNodeLike(const leaf_node* n) {
+			if (n->isLeaf)
+				return createNode<leaf_node>();
+			return createNode<internal_node>();
+		}
+
+		// releases a node whose elements have already been destroyed or
+		// moved out.
+		void destroyNode(leaf_node* n) noexcept {
+			if (n->isLeaf)
+				deallocateNode<leaf_node>(n);
+			else
+				deallocateNode<internal_node>(n);
+		}
+
+		void destroySubtree(leaf_node* n) noexcept {
+			if (!n)
+				return;
+
+			for (size_type i = 0; i < n->count; ++i)
+				alloc_traits::destroy(_allocator, n->at(i));
+
+			if (!n->isLeaf)
+				for (size_type i = 0; i <= n->count; ++i)
+					destroySubtree(childOf(n, i));
+
+			destroyNode(n);
+		}
+
+		void cloneFrom(const BTree& other) {
+			_root = cloneSubtree(other._root);
+			_size = other._size;
+		}
+
+		[[nodiscard]] leaf_node* cloneSubtree(const leaf_node* source) {
+			if (!source)
+				return nullptr;
+
+			leaf_node* copy = createNodeLike(source);
+
+			try {
+				for (; copy->count < source->count; ++copy->count) {
+					alloc_traits::construct(
+						_allocator, copy->at(copy->count), *source->at(copy->count));
+				}
+
+				if (!source->isLeaf)
+					for (size_type i = 0; i <= source->count; ++i)
+						setChild(copy, i, cloneSubtree(childOf(source, i)));
+			}
+			catch (...) {
+				destroySubtree(copy);
+				throw;
+			}
+
+			return copy;
+		}
+
+		// --------------------------- RELOCATION -------------------------- //
+
+		void relocate(value_type* to, value_type* from) {
+			alloc_traits::construct(_allocator, to, std::move(*from));
+			alloc_traits::destroy(_allocator, from);
+		}
+
+		// moves the elements [index, count) of n one slot to the right.
+		void shiftRight(leaf_node* n, size_type index) {
+			for (size_type i = n->count; i > index; --i)
+				relocate(n->at(i), n->at(i - 1));
+		}
+
+		// moves the elements (index, count) of n one slot to the left over
+		// the empty slot at index.
+		void shiftLeft(leaf_node* n, size_type index) {
+			for (size_type i = index + 1; i < n->count; ++i)
+				relocate(n->at(i - 1), n->at(i));
+		}
+
+		static void shiftChildrenRight(leaf_node* n, size_type index) noexcept {
+			for (size_type i = n->count + 1; i > index; --i)
+				setChild(n, i, childOf(n, i - 1));
+		}
+
+		static void shiftChildrenLeft(leaf_node* n, size_type index) noexcept {
+			for (size_type i = index + 1; i <= n->count; ++i)
+				setChild(n, i - 1, childOf(n, i));
+		}
+
+		// --------------------------- INSERTION --------------------------- //
+
+		iterator placeElement(value_type&& element) {
+			const key_type& key = keyOf(element);
+
+			if (!_root)
+				return placeInEmpty(std::move(element));
+
+			leaf_node* n = _root;
+
+			while (true) {
+				size_type index = boundIn<hasDuplicates>(n, key);
+
+				if constexpr (!hasDuplicates)
+					if (index < n->count && !compare(key, keyOf(*n->at(index))))
+						return iterator(this, n, index);
+
+				if (n->isLeaf)
+					return placeInLeaf(n, index, std::move(element));
+
+				n = childOf(n, index);
+			}
+		}
+
+		iterator placeInEmpty(value_type&& element) {
+			_root = createNode<leaf_node>();
+
+			try {
+				return placeInLeaf(_root, 0, std::move(element));
+			}
+			catch (...) {
+				destroyNode(_root);
+				_root = nullptr;
+				throw;
+			}
+		}
+
+		iterator placeInLeaf(leaf_node* n, size_type index, value_type&& element) {
+			if (n->count == nodeCapacity)
+				std::tie(n, index) = splitFor(n, index);
+
+			shiftRight(n, index);
+
+			try {
+				alloc_traits::construct(_allocator, n->at(index), std::move(element));
+			}
+			catch (...) {
+				shiftLeft(n, index);
+				throw;
+			}
+
+			++n->count;
+			++_size;
+			return iterator(this, n, index);
+		}
+
+		// splits the full node n, and any full ancestors, so that an element
+		// can be inserted at index. Returns the node and index it now
+		// belongs at.
+		std::pair<leaf_node*, size_type> splitFor(leaf_node* n, size_type index) {
+			if (!n->parent) {
+				internal_node* root = createNode<internal_node>();
+				setChild(root, 0, n);
+				_root = root;
+			}
+			else if (n->parent->count == nodeCapacity)
+				splitFor(n->parent, n->position);
+
+			leaf_node* sibling = createNodeLike(n);
+			internal_node* p = n->parent;
+			size_type position = n->position;
+			size_type moved = nodeCapacity - split_index - 1;
+
+			for (size_type i = 0; i < moved; ++i)
+				relocate(sibling->at(i), n->at(split_index + 1 + i));
+
+			if (!n->isLeaf)
+				for (size_type i = 0; i <= moved; ++i)
+					setChild(sibling, i, childOf(n, split_index + 1 + i));
+
+			shiftRight(p, position);
+			shiftChildrenRight(p, position + 1);
+			relocate(p->at(position), n->at(split_index));
+			setChild(p, position + 1, sibling);
+
+			++p->count;
+			n->count = static_cast<std::uint16_t>(split_index);
+			sibling->count = static_cast<std::uint16_t>(moved);
+
+			if (index <= split_index)
+				return { n, index };
+			return { sibling, index - split_index - 1 };
+		}
+
+		// ---------------------------- REMOVAL ---------------------------- //
+
+		// removes the element at index of n and returns the position of the
+		// element that followed it, or {nullptr, 0} if it was the last.
+		std::pair<leaf_node*, size_type> eraseAt(leaf_node* n, size_type index) {
+			bool isInternal = !n->isLeaf;
+			alloc_traits::destroy(_allocator, n->at(index));
+
+			if (n->isLeaf)
+				shiftLeft(n, index);
+			else {
+				leaf_node* leaf = rightMostLeafOf(childOf(n, index));
+				relocate(n->at(index), leaf->at(leaf->count - 1));
+				n = leaf;
+				index = leaf->count - 1;
+			}
+
+			--n->count;
+			--_size;
+
+			// 'at' is the slot of the leaf the element was taken from. When 
+			// it is past the last element it stands for whatever follows 
+			// the leaf.
+			std::pair<leaf_node*, size_type> at{ n, index };
+			rebalanceFrom(n, at);
+
+			if (_size == 0)
+				return { nullptr, 0 };
+
+			auto& [node, slot] = at;
+			while (node && slot == node->count) {
+				slot = node->position;
+				node = node->parent;
+			}
+
+			// an internal element was replaced by its predecessor, which 
+			// now sits at 'at'
+			if (isInternal)
+				increment(node, slot);
+
+			if (!node)
+				slot = 0;
+
+			return at;
+		}
+
+		// restores the minimum count of n and its ancestors, keeping 'at'
+		// on the same slot of the leaf n as its elements move.
+		void rebalanceFrom(leaf_node* n, std::pair<leaf_node*, size_type>& at) {
+			while (n != _root && n->count < min_count) {
+				internal_node* p = n->parent;
+				size_type position = n->position;
+
+				leaf_node* left = position > 0
+					? childOf(p, position - 1)
+					: nullptr;
+
+				leaf_node* right = position < p->count
+					? childOf(p, position + 1)
+					: nullptr;
+
+				if (left && left->count > min_count) {
+					if (at.first == n)
+						++at.second;
+					return rotateFromLeft(p, position);
+				}
+
+				if (right && right->count > min_count)
+					return rotateFromRight(p, position);
+
+				if (left && at.first == n)
+					at = { left, left->count + 1 + at.second };
+
+				merge(p, left ? position - 1 : position);
+				n = p;
+			}
+
+			if (_root->count == 0) {
+				leaf_node* child = _root->isLeaf ? nullptr : childOf(_root, 0);
+				destroyNode(_root);
+				_root = child;
+
+				if (child)
+					child->parent = nullptr;
+			}
+		}
+
+		// moves the separator before the child at position down into it,
+		// replacing it with the last element of the left sibling.
+		void rotateFromLeft(internal_node* p, size_type position) {
+			leaf_node* n = childOf(p, position);
+			leaf_node* left = childOf(p, position - 1);
+
+			shiftRight(n, 0);
+			relocate(n->at(0), p->at(position - 1));
+			relocate(p->at(position - 1), left->at(left->count - 1));
+
+			if (!n->isLeaf) {
+				shiftChildrenRight(n, 0);
+				setChild(n, 0, childOf(left, left->count));
+			}
+
+			++n->count;
+			--left->count;
+		}
+
+		// moves the separator after the child at position down into it,
+		// replacing it with the first element of the right sibling.
+		void rotateFromRight(internal_node* p, size_type position) {
+			leaf_node* n = childOf(p, position);
+			leaf_node* right = childOf(p, position + 1);
+
+			relocate(n->at(n->count), p->at(position));
+			relocate(p->at(position), right->at(0));
+			shiftLeft(right, 0);
+
+			if (!n->isLeaf) {
+				setChild(n, n->count + 1, childOf(right, 0));
+				shiftChildrenLeft(right, 0);
+			}
+
+			++n->count;
+			--right->count;
+		}
+
+		// merges the child at index, the separator after it, and its right
+		// sibling into a single node.
+		void merge(internal_node* p, size_type index) {
+			leaf_node* left = childOf(p, index);
+			leaf_node* right = childOf(p, index + 1);
+			size_type offset = left->count + 1;
+
+			relocate(left->at(left->count), p->at(index));
+
+			for (size_type i = 0; i < right->count; ++i)
+				relocate(left->at(offset + i), right->at(i));
+
+			if (!left->isLeaf)
+				for (size_type i = 0; i <= right->count; ++i)
+					setChild(left, offset + i, childOf(right, i));
+
+			left->count = static_cast<std::uint16_t>(offset + right->count);
+			destroyNode(right);
+
+			shiftLeft(p, index);
+			shiftChildrenLeft(p, index + 1);
+			--p->count;
+		}
+
+		// ------------------------- TRAVERSAL ----------------------------- //
+
+		static void increment(leaf_node*& n, size_type& index) noexcept {
+			if (!n->isLeaf) {
+				n = leftMostLeafOf(childOf(n, index + 1));
+				index = 0;
+				return;
+			}
+
+			++index;
+
+			while (n && index == n->count) {
+				index = n->position;
+				n = n->parent;
+			}
+
+			if (!n)
+				index = 0;
+		}
+
+		void decrement(leaf_node*& n, size_type& index) const noexcept {
+			if (!n) {
+				n = rightMostLeafOf(_root);
+				index = n->count - 1;
+				return;
+			}
+
+			if (!n->isLeaf) {
+				n = rightMostLeafOf(childOf(n, index));
+				index = n->count - 1;
+				return;
+			}
+
+			while (index == 0) {
+				index = n->position;
+				n = n->parent;
+			}
+
+			--index;
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// BTreeIterator is a bidirectional iterator over the elements of a
+		/// BTree in key order. It is invalidated by any insertion or removal.
+		/// </summary>
+		///
+		/// <typeparam name="isConst">
+		/// Whether the iterator provides const access to the elements.
+		/// </typeparam> ------------------------------------------------------
+		template <bool isConst>
+		class BTreeIterator {
+		private:
+
+			const BTree* _tree = nullptr;
+			leaf_node* _node = nullptr;
+			size_type _index = 0;
+
+			BTreeIterator(const BTree* tree, leaf_node* n, size_type index) :
+				_tree(tree), _node(n), _index(index)
+			{
+
+			}
+
+			[[nodiscard]] leaf_node* node() const noexcept {
+				return _node;
+			}
+
+			friend class BTree;
+
+		public:
+
+			// set values must be const to preserve ordering
+			using value_type = std::conditional_t<
+				is_map, element_t, const element_t
+			>;
+
+			using difference_type = std::ptrdiff_t;
+
+			using pointer = std::conditional_t<
+				isConst, const value_type*, value_type*
+			>;
+
+			using reference = std::conditional_t<
+				isConst, const value_type&, value_type&
+			>;
+
+			using iterator_category = std::bidirectional_iterator_tag;
+
+			// ----------------------------------------------------------------
+			/// <summary>
+			/// ~~~ Default Constructor ~~~
+			///
+			///	<para>
+			/// Constructs an empty BTreeIterator.
+			/// </para></summary> ---------------------------------------------
+			BTreeIterator() = default;
+
+			// ----------------------------------------------------------------
+			/// <summary>
+			/// ~~~ Implicit Conversion Constructor ~~~
+			///
+			/// <para>
+			/// Converts a non-const BTreeIterator to a const one.
+			/// </para></summary> ---------------------------------------------
+			template<
+				bool wasConst,
+				class = std::enable_if_t<isConst && !wasConst>
+			>
+			BTreeIterator(BTreeIterator<wasConst> copy) :
+				BTreeIterator(copy._tree, copy._node, copy._index)
+			{
+
+			}
+
+			// ----------------------------------------------------------------
+			/// <summary>
+			/// ~~~ Dereference Operator ~~~
+			/// </summary>
+			///
+			/// <returns>
+			/// Returns a reference to the current element.
+			///	</returns> ----------------------------------------------------
+			reference operator*() const {
+				return *_node->at(_index);
+			}
+
+			// ----------------------------------------------------------------
+			/// <summary>
+			/// ~~~ Arrow Operator ~~~
+			/// </summary>
+			///
+			/// <returns>
+			/// Returns a pointer to the current element.
+			///	</returns> ----------------------------------------------------
+			pointer operator->() const {
+				return _node->at(_index);
+			}
+
+			// ----------------------------------------------------------------
+			/// <summary>
+			/// ~~~ Pre-Increment Operator ~~~
+			/// </summary> ----------------------------------------------------
+			BTreeIterator& operator++() {
+				BTree::increment(_node, _index);
+				return *this;
+			}
+
+			// ----------------------------------------------------------------
+			/// <summary>
+			/// ~~~ Post-Increment Operator ~~~
+			/// </summary> ----------------------------------------------------
+			BTreeIterator operator++(int) {
+				auto copy = *this;
+				++(*this);
+				return copy;
+			}
+
+			// ----------------------------------------------------------------
+			/// <summary>
+			/// ~~~ Pre-Decrement Operator ~~~
+			/// </summary> ----------------------------------------------------
+			BTreeIterator& operator--() {
+				_tree->decrement(_node, _index);
+				return *this;
+			}
+
+			// ----------------------------------------------------------------
+			/// <summary>
+			/// ~~~ Post-Decrement Operator ~~~
+			/// </summary> ----------------------------------------------------
+			BTreeIterator operator--(int) {
+				auto copy = *this;
+				--(*this);
+				return copy;
+			}
+
+			// ----------------------------------------------------------------
+			/// <summary>
+			/// ~~~ Equality Operator ~~~
+			/// </summary>
+			///
+			/// <returns>
+			/// Returns true if both iterators point to the same element.
+			///	</returns> ----------------------------------------------------
+			friend bool operator==(
+				const BTreeIterator& lhs,
+				const BTreeIterator& rhs
+			) {
+				return lhs._tree == rhs._tree &&
+					lhs._node == rhs._node &&
+					lhs._index == rhs._index;
+			}
+		};
+
+		static_assert(
+			std::bidirectional_iterator<iterator>,
+			"BTreeIterator is not a valid bidirectional iterator."
+		);
+	};
+
+	template <
+		class element_t,
+		template <class> class compare_t = std::less,
+		template <class> class allocator_t = std::allocator
+	>
+	using BTreeSet = BTree<
+		element_t,
+		compare_t<element_t>,
+		allocator_t<element_t>,
+		false
+	>;
+
+	template <
+		class element_t,
+		template <class> class compare_t = std::less,
+		template <class> class allocator_t = std::allocator
+	>
+	using BTreeMultiSet = BTree<
+		element_t,
+		compare_t<element_t>,
+		allocator_t<element_t>,
+		true
+	>;
+
+	template <
+		class key_t,
+		class element_t,
+		template <class> class compare_t = std::less,
+		template <class> class allocator_t = std::allocator
+	>
+	using BTreeMap = BTree<
+		key_value_pair<const key_t, element_t>,
+		compare_t<key_t>,
+		allocator_t<key_value_pair<key_t, element_t>>,
+		false
+	>;
+
+	template <
+		class key_t,
+		class element_t,
+		template <class> class compare_t = std::less,
+		template <class> class allocator_t = std::allocator
+	>
+	using BTreeMultiMap = BTree<
+		key_value_pair<const key_t, element_t>,
+		compare_t<key_t>,
+		allocator_t<key_value_pair<key_t, element_t>>,
+		true
+	>;
+
+	static_assert(
+		collection<BTreeSet<int>>,
+		"BTree does not meet the requirements for a collection."
+	);
+
+	static_assert(
+		associative<BTreeSet<int>>,
+		"BTree does not meet the requirements for associative access."
+	);
+
+	static_assert(
+		positional<BTreeSet<int>>,
+		"BTree does not meet the requirements for positional access."
+	);
+
+	static_assert(
+		bidirectionally_iterable<BTreeSet<int>>,
+		"BTree does not meet the requirements for bidirectional iteration."
+	);
+
+	static_assert(
+		map<BTreeMap<int, int>>,
+		"BTree does not meet the requirements for a map."
+	);
+
+	static_assert(
+		multimap<BTreeMultiMap<int, int>>,
+		"BTree does not meet the requirements for a multimap."
+	);
+}
@@ -39,19 +39,46 @@ namespace collections {
 		class element_t,
 		class compare_t,
 		class allocator_t,
-		bool hasDuplicates
+		bool hasDuplicates,
+		bool isRanked = false,
+		bool cachesHeights = false
 	>
 	class BinarySearchTree : public impl::BaseBST<
 		element_t,
 		compare_t,
 		allocator_t,
 		hasDuplicates,
-		BinarySearchTree<element_t, compare_t, allocator_t, hasDuplicates>>
+		isRanked,
+		cachesHeights,
+		BinarySearchTree<
+			element_t, 
+			compare_t, 
+			allocator_t, 
+			hasDuplicates, 
+			isRanked, 
+			cachesHeights
+		>
+	>
 	{
 	private:
 
-		using tree = BinarySearchTree<element_t, compare_t, allocator_t, hasDuplicates>;
-		using base_tree = impl::BaseBST<element_t, compare_t, allocator_t, hasDuplicates, tree>;
+		using tree = BinarySearchTree<
+			element_t, 
+			compare_t, 
+			allocator_t, 
+			hasDuplicates, 
+			isRanked, 
+			cachesHeights
+		>;
+		using base_tree = impl::BaseBST<
+			element_t, 
+			compare_t, 
+			allocator_t, 
+			hasDuplicates, 
+			isRanked, 
+			cachesHeights, 
+			tree
+		>;
 
 		using alloc_traits			= base_tree::alloc_traits;
 		using node_allocator_type	= base_tree::node_allocator_type;
@@ -60,6 +87,7 @@ namespace collections {
 		using const_base_ptr		= base_tree::const_base_ptr;
 		using node_ptr				= base_tree::node_ptr;
 		using const_node_ptr		= base_tree::const_node_ptr;
+		using alloc_ptr				= node_alloc_traits::pointer;
 
 		friend class base_tree;
 
@@ -86,6 +114,8 @@ namespace collections {
 		using const_reverse_iterator	= base_tree::const_reverse_iterator;
 
 		static constexpr bool allow_duplicates = hasDuplicates;
+		static constexpr bool is_ranked = isRanked;
+		static constexpr bool caches_heights = cachesHeights;
 
 		// ---------------------------------------------------------------------
 		/// <summary>
@@ -132,11 +162,9 @@ namespace collections {
 		/// The BinarySearchTree to be copied.
 		/// </param> -----------------------------------------------------------
 		BinarySearchTree(const BinarySearchTree& copy) : BinarySearchTree(
-			copy.begin<traversal_order::POST_ORDER>(),
-			copy.end<traversal_order::POST_ORDER>(),
 			alloc_traits::select_on_container_copy_construction(copy._allocator)
 		) {
-
+			this->cloneFrom(copy);
 		}
 
 		// ---------------------------------------------------------------------
@@ -293,15 +321,15 @@ namespace collections {
 
 		template <class... Args>
 		[[nodiscard]] node_ptr createNode(Args&&... args) {
-			node_ptr n = node_alloc_traits::allocate(_allocator, 1);
+			alloc_ptr n = node_alloc_traits::allocate(_allocator, 1);
 			node_alloc_traits::construct(
 				_allocator, n, std::in_place_t{}, std::forward<Args>(args)...);
 			return n;
 		}
 
 		void destroyNode(base_ptr n) {
-			node_alloc_traits::destroy(_allocator, static_cast<node_ptr>(n));
-			node_alloc_traits::deallocate(_allocator, static_cast<node_ptr>(n), 1);
+			node_alloc_traits::destroy(_allocator, static_cast<alloc_ptr>(n));
+			node_alloc_traits::deallocate(_allocator, static_cast<alloc_ptr>(n), 1);
 		}
 
 		[[nodiscard]] size_type heightOfNode(const_base_ptr n) const noexcept {
@@ -327,6 +355,8 @@ namespace collections {
 			this->removeAt(n);
 		}
 
+		void onBuildNode(base_ptr n, const_base_ptr source) {}
+
 		void onAccessNode(base_ptr n) {}
 	};
 
@@ -380,6 +410,60 @@ namespace collections {
 		true
 	>;
 
+	template <
+		class element_t,
+		template <class> class compare_t = std::less,
+		template <class> class allocator_t = std::allocator
+	>
+	using RankedBST = BinarySearchTree<
+		element_t, 
+		compare_t<element_t>, 
+		allocator_t<element_t>, 
+		false,
+		true
+	>;
+
+	template <
+		class key_t,
+		class element_t,
+		template <class> class compare_t = std::less,
+		template <class> class allocator_t = std::allocator
+	>
+	using RankedMapBST = BinarySearchTree<
+		key_value_pair<const key_t, element_t>,
+		compare_t<key_t>,
+		std::allocator<key_value_pair<key_t, element_t>>,
+		false,
+		true
+	>;
+
+	template <
+		class element_t,
+		template <class> class compare_t = std::less,
+		template <class> class allocator_t = std::allocator
+	>
+	using RankedMultiBST = BinarySearchTree<
+		element_t, 
+		compare_t<element_t>, 
+		allocator_t<element_t>, 
+		true,
+		true
+	>;
+
+	template <
+		class key_t,
+		class element_t,
+		template <class> class compare_t = std::less,
+		template <class> class allocator_t = std::allocator
+	>
+	using RankedMultiMapBST = BinarySearchTree<
+		key_value_pair<const key_t, element_t>,
+		compare_t<key_t>,
+		std::allocator<key_value_pair<key_t, element_t>>,
+		true,
+		true
+	>;
+
 	static_assert(
 		collection<SimpleBST<int>>,
 		"BinarySearchTree does not meet the requirements for a collection."
@@ -409,4 +493,9 @@ namespace collections {
 		multimap<MultiMapBST<int, int>>,
 		"MultiMapBST does not meet the requirements for a multimap."
 	);
+
+	static_assert(
+		collection<RankedBST<int>>,
+		"BinarySearchTree does not meet the requirements for a collection when ranked."
+	);
 }
\ No newline at end of file
@@ -0,0 +1,1597 @@
+/* ============================================================================
+* Copyright (C) 2023 Ryan Eubank
+*
+* This program is free software: you can redistribute it and/or modify
+* it under the terms of the GNU General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License
+* along with this program.  If not, see <https://www.gnu.org/licenses/>.
+* ========================================================================= */
+
+#pragma once
+
+#include <bit>
+#include <compare>
+#include <cstdint>
+#include <cstdlib>
+#include <initializer_list>
+#include <istream>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <ostream>
+#include <ranges>
+#include <sstream>
+#include <type_traits>
+#include <utility>
+
+#include "../algorithms/bitwise.h"
+#include "../algorithms/stream.h"
+#include "../concepts/collection.h"
+#include "../concepts/iterable.h"
+#include "../util/types.h"
+#include "DynamicArray.h"
+
+namespace collections {
+
+	// -------------------------------------------------------------------------
+	/// <summary>
+	/// BitArray is a dynamically sized sequence of bits packed into 64-bit
+	/// words. Bits are addressed individually through a proxy reference while
+	/// bulk operations (AND/OR/XOR/NOT, counting, and searching) run a whole
+	/// word at a time.
+	/// </summary>
+	///
+	/// <typeparam name="allocator_t">
+	/// The type of the allocator responsible for allocating memory to the
+	/// array. It is rebound to allocate whole words.
+	/// </typeparam> -----------------------------------------------------------
+	template <class allocator_t = std::allocator<uint64_t>>
+	class BitArray final {
+	private:
+
+		template <bool isConst>
+		class BitArrayIterator;
+
+		class BitReference;
+
+		using word_type			= uint64_t;
+		using word_allocator	= rebind<allocator_t, word_type>;
+		using word_array		= DynamicArray<word_type, word_allocator>;
+
+		static constexpr size_t BITS_PER_WORD =
+			std::numeric_limits<word_type>::digits;
+
+	public:
+
+		using value_type		= bool;
+		using allocator_type	= allocator_t;
+		using reference			= BitReference;
+		using const_reference	= bool;
+		using size_type			= word_array::size_type;
+		using difference_type	= word_array::difference_type;
+
+		using iterator					= BitArrayIterator<false>;
+		using const_iterator			= BitArrayIterator<true>;
+		using reverse_iterator			= std::reverse_iterator<iterator>;
+		using const_reverse_iterator	= std::reverse_iterator<const_iterator>;
+
+		using pointer			= iterator;
+		using const_pointer		= const_iterator;
+
+		// ---------------------------------------------------------------------
+		/// <summary>
+		/// ~~~ Default Constructor ~~~
+		///
+		///	<para>
+		/// Constructs an empty BitArray.
+		/// </para></summary> --------------------------------------------------
+		constexpr BitArray()
+			noexcept(std::is_nothrow_default_constructible_v<allocator_type>) :
+			_words(),
+			_size(0)
+		{
+
+		}
+
+		// ---------------------------------------------------------------------
+		/// <summary>
+		/// ~~~ Allocator Constructor ~~~
+		///
+		///	<para>
+		/// Constructs an empty BitArray.
+		/// </para></summary>
+		///
+		/// <param name="alloc">
+		/// The allocator instance used by the array.
+		/// </param> -----------------------------------------------------------
+		explicit BitArray(const allocator_type& alloc)
+			noexcept(std::is_nothrow_copy_constructible_v<allocator_type>) :
+			_words(word_allocator(alloc)),
+			_size(0)
+		{
+
+		}
+
+		// ---------------------------------------------------------------------
+		/// <summary>
+		/// ~~~ Copy Constructor ~~~
+		///
+		/// <para>
+		/// Constructs a deep copy of the specified BitArray.
+		/// </para></summary>
+		///
+		/// <param name="copy">
+		/// The array to be copied.
+		/// </param> -----------------------------------------------------------
+		BitArray(const BitArray& copy) = default;
+
+		// ---------------------------------------------------------------------
+		/// <summary>
+		/// ~~~ Move Constructor ~~~
+		///
+		/// <para>
+		/// Constructs a BitArray by moving the data from the provided array
+		/// into this one.
+		/// </para></summary>
+		///
+		/// <param name="other">
+		/// The array to be moved into this one.
+		/// </param> -----------------------------------------------------------
+		BitArray(BitArray&& other)
+			noexcept(std::is_nothrow_move_constructible_v<word_array>) :
+			_words(std::move(other._words)),
+			_size(std::exchange(other._size, 0))
+		{
+
+		}
+
+		// ---------------------------------------------------------------------
+		/// <summary>
+		/// ~~~ Reserve Constructor ~~~
+		///
+		/// <para>
+		/// Constructs an empty BitArray with enough capacity for the specified
+		/// number of bits.
+		/// </para></summary>
+		///
+		/// <param name="capacity">
+		/// The initial capacity for the array in bits.
+		/// </param>
+		/// <param name="alloc">
+		/// The allocator instance used by the array. Default constructs the
+		/// allocator if unspecified.
+		/// </param> ----------------------------------------------------------
+		BitArray(
+			Reserve capacity,
+			const allocator_type& alloc = allocator_type{}
+		) : BitArray(alloc) {
+			reserve(capacity.get());
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// ~~~ Fill Constructor ~~~
+		///
+		/// <para>
+		/// Constructs a BitArray with the specified number of bits, each set
+		/// to the given value (or cleared if unspecified).
+		/// </para></summary>
+		///
+		/// <param name="size">
+		/// The number of bits in the array.
+		/// </param>
+		/// <param name="value">
+		/// The value to initialize every bit to.
+		/// </param>
+		/// <param name="alloc">
+		/// The allocator instance used by the array. Default constructs the
+		/// allocator if unspecified.
+		/// </param> ----------------------------------------------------------
+		BitArray(
+			Size size,
+			bool value = false,
+			const allocator_type& alloc = allocator_type{}
+		) : BitArray(alloc) {
+			resize(size.get(), value);
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// ~~~ Initialization Constructor ~~~
+		///
+		/// <para>
+		/// Constructs a BitArray with a copy of the bits in the specified
+		/// initialization list.
+		/// </para></summary>
+		///
+		/// <param name="init">
+		/// The initialization list to copy bits from.
+		/// </param>
+		/// <param name="alloc">
+		/// The allocator instance used by the array. Default constructs the
+		/// allocator if unspecified.
+		/// </param> ----------------------------------------------------------
+		BitArray(
+			std::initializer_list<value_type> init,
+			const allocator_type& alloc = allocator_type{}
+		) : BitArray(init.begin(), init.end(), alloc) {
+
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// ~~~ Iterator Constructor ~~~
+		///
+		/// <para>
+		/// Constructs a BitArray with a copy of the values from the given
+		/// iterator/sentinel pair.
+		/// </para></summary>
+		///
+		/// <typeparam name="in_iterator">
+		/// The type of the beginning iterator to copy from.
+		/// </typeparam>
+		/// <typeparam name="sentinel">
+		/// The type of the end iterator or sentinel.
+		/// </typeparam>
+		///
+		/// <param name="begin">
+		/// The beginning of the range to copy from.
+		/// </param>
+		/// <param name="end">
+		/// The end of the range to copy from.
+		/// </param>
+		/// <param name="alloc">
+		/// The allocator instance used by the array. Default constructs the
+		/// allocator if unspecified.
+		/// </param> ----------------------------------------------------------
+		template <
+			std::input_iterator in_iterator,
+			std::sentinel_for<in_iterator> sentinel
+		>
+		BitArray(
+			in_iterator begin,
+			sentinel end,
+			const allocator_type& alloc = allocator_type{}
+		) : BitArray(alloc) {
+			if constexpr (std::forward_iterator<in_iterator>)
+				reserve(static_cast<size_type>(std::ranges::distance(begin, end)));
+
+			while (begin != end)
+				insertBack(static_cast<bool>(*begin++));
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// ~~~ Range Constructor ~~~
+		///
+		/// <para>
+		/// Constructs a BitArray with a copy of the values from the given
+		/// range.
+		/// </para></summary>
+		///
+		/// <typeparam name="range">
+		/// The type of the range being constructed from.
+		/// </typeparam>
+		///
+		/// <param name="tag">
+		/// Range construction tag to disabiguate this constructor from
+		/// construction with an initializer list.
+		/// </param>
+		/// <param name="rg">
+		/// The range to construct the array with.
+		/// </param>
+		/// <param name="alloc">
+		/// The allocator instance for the array. Default constructs the
+		/// allocator if unspecified.
+		/// </param> ----------------------------------------------------------
+		template <std::ranges::input_range range>
+		BitArray(
+			from_range_t tag,
+			range&& rg,
+			const allocator_type& alloc = allocator_type{}
+		) : BitArray(std::ranges::begin(rg), std::ranges::end(rg), alloc) {
+
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// ~~~ Destructor ~~~
+		///
+		/// <para>
+		/// Destructs the array safely releasing its memory.
+		/// </para></summary> -------------------------------------------------
+		~BitArray() = default;
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// ~~~ Copy Assignment Operator ~~~
+		///
+		/// <para>
+		/// Copies the data from the given argument to this array.
+		/// </para></summary>
+		///
+		/// <param name="other">
+		/// The array to copy from.
+		/// </param>
+		///
+		/// <returns>
+		/// Returns the caller with the copied data.
+		/// </returns> --------------------------------------------------------
+		BitArray& operator=(const BitArray& other) = default;
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// ~~~ Move Assignment Operator ~~~
+		///
+		/// <para>
+		/// Moves the data from the given argument to this array.
+		/// </para></summary>
+		///
+		/// <param name="other">
+		/// The array to move from.
+		/// </param>
+		///
+		/// <returns>
+		/// Returns the caller with the moved data.
+		/// </returns> --------------------------------------------------------
+		BitArray& operator=(BitArray&& other)
+			noexcept(std::is_nothrow_move_assignable_v<word_array>)
+		{
+			_words = std::move(other._words);
+			_size = std::exchange(other._size, 0);
+			return *this;
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// ~~~ Index Operator ~~~
+		/// </summary>
+		///
+		/// <param name="index">
+		/// The index of the bit to retrieve.
+		/// </param>
+		///
+		/// <returns>
+		/// Returns a proxy reference to the bit at the specified index.
+		/// </returns> --------------------------------------------------------
+		[[nodiscard]] reference operator[](size_type index) noexcept {
+			return reference(&_words[wordOf(index)], maskOf(index));
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// ~~~ Index Operator ~~~
+		/// </summary>
+		///
+		/// <param name="index">
+		/// The index of the bit to retrieve.
+		/// </param>
+		///
+		/// <returns>
+		/// Returns the value of the bit at the specified index.
+		/// </returns> --------------------------------------------------------
+		[[nodiscard]] const_reference operator[](size_type index) const noexcept {
+			return test(index);
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Performs safe indexing of the array checking the bounds of
+		/// the requested index before returning the appropriate bit.
+		/// </summary>
+		///
+		/// <param name="index">
+		/// The index of the bit to retrieve.
+		/// </param>
+		///
+		/// <returns>
+		/// Returns a proxy reference to the bit at the specified index.
+		/// </returns> --------------------------------------------------------
+		[[nodiscard]] reference at(size_type index) {
+			validateIndexExists(index);
+			return (*this)[index];
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Performs safe indexing of the array checking the bounds of
+		/// the requested index before returning the appropriate bit.
+		/// </summary>
+		///
+		/// <param name="index">
+		/// The index of the bit to retrieve.
+		/// </param>
+		///
+		/// <returns>
+		/// Returns the value of the bit at the specified index.
+		/// </returns> --------------------------------------------------------
+		[[nodiscard]] const_reference at(size_type index) const {
+			validateIndexExists(index);
+			return test(index);
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Returns the value of the bit at the given index. No bounds checking
+		/// is performed.
+		/// </summary>
+		///
+		/// <param name="index">
+		/// The index of the bit to test.
+		/// </param>
+		///
+		/// <returns>
+		/// Returns true if the bit is set, false otherwise.
+		/// </returns> --------------------------------------------------------
+		[[nodiscard]] bool test(size_type index) const noexcept {
+			return (_words[wordOf(index)] & maskOf(index)) != 0;
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Sets the bit at the given index to one.
+		/// </summary>
+		///
+		/// <param name="index">
+		/// The index of the bit to set.
+		/// </param> ----------------------------------------------------------
+		void set(size_type index) noexcept {
+			_words[wordOf(index)] |= maskOf(index);
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Sets the bit at the given index to the specified value.
+		/// </summary>
+		///
+		/// <param name="index">
+		/// The index of the bit to set.
+		/// </param>
+		/// <param name="value">
+		/// The value to assign to the bit.
+		/// </param> ----------------------------------------------------------
+		void set(size_type index, bool value) noexcept {
+			word_type& word = _words[wordOf(index)];
+			word_type mask = maskOf(index);
+			word = (word & ~mask) | (-static_cast<word_type>(value) & mask);
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Sets every bit in the array to one.
+		/// </summary> --------------------------------------------------------
+		void set() noexcept {
+			for (auto& word : _words)
+				word = ~word_type(0);
+			clearUnusedBits();
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Clears the bit at the given index to zero.
+		/// </summary>
+		///
+		/// <param name="index">
+		/// The index of the bit to clear.
+		/// </param> ----------------------------------------------------------
+		void reset(size_type index) noexcept {
+			_words[wordOf(index)] &= ~maskOf(index);
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Clears every bit in the array to zero.
+		/// </summary> --------------------------------------------------------
+		void reset() noexcept {
+			for (auto& word : _words)
+				word = 0;
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Inverts the bit at the given index.
+		/// </summary>
+		///
+		/// <param name="index">
+		/// The index of the bit to flip.
+		/// </param> ----------------------------------------------------------
+		void flip(size_type index) noexcept {
+			_words[wordOf(index)] ^= maskOf(index);
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Inverts every bit in the array.
+		/// </summary> --------------------------------------------------------
+		void flip() noexcept {
+			collections::bitwise_not(_words.asRawPointer(), _words.size());
+			clearUnusedBits();
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Returns the number of bits set to one in the array.
+		/// </summary>
+		///
+		/// <returns>
+		/// Returns the population count of the array.
+		/// </returns> --------------------------------------------------------
+		[[nodiscard]] size_type count() const noexcept {
+			return collections::popcount(_words.asRawPointer(), _words.size());
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Returns whether every bit in the array is set. Returns true for an
+		/// empty array.
+		/// </summary>
+		///
+		/// <returns>
+		/// Returns true if no bit in the array is zero.
+		/// </returns> --------------------------------------------------------
+		[[nodiscard]] bool all() const noexcept {
+			size_type full = _size / BITS_PER_WORD;
+
+			for (size_type i = 0; i < full; ++i)
+				if (~_words[i])
+					return false;
+
+			size_type remainder = _size % BITS_PER_WORD;
+			return !remainder || _words[full] == lowMask(remainder);
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Returns whether any bit in the array is set.
+		/// </summary>
+		///
+		/// <returns>
+		/// Returns true if at least one bit in the array is one.
+		/// </returns> --------------------------------------------------------
+		[[nodiscard]] bool any() const noexcept {
+			for (auto word : _words)
+				if (word)
+					return true;
+			return false;
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Returns whether no bits in the array are set.
+		/// </summary>
+		///
+		/// <returns>
+		/// Returns true if every bit in the array is zero.
+		/// </returns> --------------------------------------------------------
+		[[nodiscard]] bool none() const noexcept {
+			return !any();
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Returns the index of the first set bit in the array.
+		/// </summary>
+		///
+		/// <returns>
+		/// Returns the index of the lowest set bit, or size() if no bit is
+		/// set.
+		/// </returns> --------------------------------------------------------
+		[[nodiscard]] size_type findFirst() const noexcept {
+			return scanFrom(0, _words.isEmpty() ? 0 : _words[0]);
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Returns the index of the first set bit after the given position.
+		/// </summary>
+		///
+		/// <param name="index">
+		/// The position to search after. The bit at this index is not
+		/// considered.
+		/// </param>
+		///
+		/// <returns>
+		/// Returns the index of the next set bit strictly after the given
+		/// index, or size() if there is none.
+		/// </returns> --------------------------------------------------------
+		[[nodiscard]] size_type findNext(size_type index) const noexcept {
+			++index;
+			if (index >= _size)
+				return _size;
+
+			size_type word = wordOf(index);
+			return scanFrom(word, _words[word] & ~lowMask(index % BITS_PER_WORD));
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Returns the packed words backing the array. Bits are stored
+		/// least significant first and any bits past size() in the final
+		/// word are always zero.
+		/// </summary>
+		///
+		/// <returns>
+		/// Returns a const pointer to the first word of the array.
+		/// </returns> --------------------------------------------------------
+		[[nodiscard]] const word_type* asRawPointer() const noexcept {
+			return _words.asRawPointer();
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Returns the number of words used to store the array's bits.
+		/// </summary>
+		///
+		/// <returns>
+		/// Returns the number of words accessible through asRawPointer().
+		/// </returns> --------------------------------------------------------
+		[[nodiscard]] size_type wordCount() const noexcept {
+			return _words.size();
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Returns the capacity of the array in bits.
+		/// </summary>
+		///
+		/// <returns>
+		/// Returns the number of bits the array can hold before it must
+		/// reallocate.
+		/// </returns> --------------------------------------------------------
+		[[nodiscard]] size_type capacity() const noexcept {
+			return _words.capacity() * BITS_PER_WORD;
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Returns the allocator managing memory for the container.
+		/// </summary>
+		///
+		/// <returns>
+		/// Returns a copy of the allocator managing memory for the container.
+		/// </returns> --------------------------------------------------------
+		[[nodiscard]] allocator_type allocator() const noexcept {
+			return static_cast<allocator_type>(_words.allocator());
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Returns the number of bits contained by the array.
+		/// </summary>
+		///
+		/// <returns>
+		/// Returns the number of bits in the array.
+		/// </returns> --------------------------------------------------------
+		[[nodiscard]] size_type size() const noexcept {
+			return _size;
+		}
+
+		// ---------------------------------------------------------------------
+		/// <summary>
+		/// Returns the theoretical maximum size for the container.
+		/// </summary>
+		///
+		/// <returns>
+		/// Returns the size limit of the container type.
+		/// </returns> ---------------------------------------------------------
+		[[nodiscard]] size_type max_size() const noexcept {
+			constexpr size_type limit =
+				std::numeric_limits<size_type>::max() / BITS_PER_WORD;
+			return std::min(_words.max_size(), limit) * BITS_PER_WORD;
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Returns whether the array is empty and contains no bits.
+		/// </summary>
+		///
+		/// <returns>
+		/// Returns true is the array contains zero bits, false otherwise.
+		/// </returns> --------------------------------------------------------
+		[[nodiscard]] bool isEmpty() const noexcept {
+			return _size == 0;
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Empties and clears the array of all bits. Capacity is retained.
+		/// </summary> --------------------------------------------------------
+		void clear() noexcept {
+			_words.clear();
+			_size = 0;
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Shrinks the array to fit its current contents exactly.
+		/// </summary> --------------------------------------------------------
+		void trim() {
+			if (_words.isEmpty())
+				_words = word_array(_words.allocator());
+			else
+				_words.trim();
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Allocates enough space in the array to hold the specified number
+		/// of bits. Throws an exception if memory cannot be reserved.
+		/// </summary>
+		///
+		/// <param name="capacity">
+		/// The number of bits to reserve space for.
+		/// </param> ----------------------------------------------------------
+		void reserve(size_type capacity) {
+			size_type words = wordsFor(capacity);
+			if (words > _words.capacity())
+				_words.reserve(words);
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Grows or shrinks the array to the specified number of bits. New
+		/// bits are initialized to the given value.
+		/// </summary>
+		///
+		/// <param name="size">
+		/// The new number of bits in the array.
+		/// </param>
+		/// <param name="value">
+		/// The value to initialize newly added bits to.
+		/// </param> ----------------------------------------------------------
+		void resize(size_type size, bool value = false) {
+			size_type words = wordsFor(size);
+
+			if (size > _size) {
+				size_type remainder = _size % BITS_PER_WORD;
+				if (value && remainder)
+					_words.back() |= ~lowMask(remainder);
+
+				if (words > _words.size())
+					_words.resize(words, value ? ~word_type(0) : word_type(0));
+			}
+			else if (words < _words.size())
+				_words.remove(_words.begin() + words, _words.end());
+
+			_size = size;
+			clearUnusedBits();
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Returns an iterator pointing to the beginning of the array.
+		/// </summary>
+		///
+		/// <returns>
+		/// Returns a random access iterator to the first bit in the array.
+		/// </returns> --------------------------------------------------------
+		[[nodiscard]] iterator begin() noexcept {
+			return iterator(this, 0);
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Returns an iterator pointing to the end of the array.
+		/// </summary>
+		///
+		/// <returns>
+		/// Returns a random access iterator to the location after the last
+		/// bit in the array.
+		/// </returns> --------------------------------------------------------
+		[[nodiscard]] iterator end() noexcept {
+			return iterator(this, _size);
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Returns a constant iterator pointing to the beginning of the array.
+		/// </summary>
+		///
+		/// <returns>
+		/// Returns a constant random access iterator to the first bit in the
+		/// array.
+		/// </returns> --------------------------------------------------------
+		[[nodiscard]] const_iterator begin() const noexcept {
+			return const_iterator(this, 0);
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Returns a constant iterator pointing to the end of the array.
+		/// </summary>
+		///
+		/// <returns>
+		/// Returns a constant random access iterator to the location after the
+		/// last bit in the array.
+		/// </returns> --------------------------------------------------------
+		[[nodiscard]] const_iterator end() const noexcept {
+			return const_iterator(this, _size);
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Returns a constant iterator pointing to the beginning of the array.
+		/// </summary>
+		///
+		/// <returns>
+		/// Returns a constant random access iterator to the first bit in the
+		/// array.
+		/// </returns> --------------------------------------------------------
+		[[nodiscard]] const_iterator cbegin() const noexcept {
+			return begin();
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Returns a constant iterator pointing to the end of the array.
+		/// </summary>
+		///
+		/// <returns>
+		/// Returns a constant random access iterator to the location after the
+		/// last bit in the array.
+		/// </returns> --------------------------------------------------------
+		[[nodiscard]] const_iterator cend() const noexcept {
+			return end();
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Returns a reverse iterator pointing to the end of the array.
+		/// </summary>
+		///
+		/// <returns>
+		/// Returns a reverse iterator to the last bit in the array.
+		/// </returns> --------------------------------------------------------
+		[[nodiscard]] reverse_iterator rbegin() noexcept {
+			return reverse_iterator(end());
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Returns a reverse iterator pointing to the beginning of the array.
+		/// </summary>
+		///
+		/// <returns>
+		/// Returns a reverse iterator to the location before the first bit in
+		/// the array.
+		/// </returns> --------------------------------------------------------
+		[[nodiscard]] reverse_iterator rend() noexcept {
+			return reverse_iterator(begin());
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Returns a constant reverse iterator pointing to the end of the
+		/// array.
+		/// </summary>
+		///
+		/// <returns>
+		/// Returns a constant reverse iterator to the last bit in the array.
+		/// </returns> --------------------------------------------------------
+		[[nodiscard]] const_reverse_iterator rbegin() const noexcept {
+			return const_reverse_iterator(end());
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Returns a constant reverse iterator pointing to the beginning of
+		/// the array.
+		/// </summary>
+		///
+		/// <returns>
+		/// Returns a constant reverse iterator to the location before the
+		/// first bit in the array.
+		/// </returns> --------------------------------------------------------
+		[[nodiscard]] const_reverse_iterator rend() const noexcept {
+			return const_reverse_iterator(begin());
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Returns a constant reverse iterator pointing to the end of the
+		/// array.
+		/// </summary>
+		///
+		/// <returns>
+		/// Returns a constant reverse iterator to the last bit in the array.
+		/// </returns> --------------------------------------------------------
+		[[nodiscard]] const_reverse_iterator crbegin() const noexcept {
+			return rbegin();
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Returns a constant reverse iterator pointing to the beginning of
+		/// the array.
+		/// </summary>
+		///
+		/// <returns>
+		/// Returns a constant reverse iterator to the location before the
+		/// first bit in the array.
+		/// </returns> --------------------------------------------------------
+		[[nodiscard]] const_reverse_iterator crend() const noexcept {
+			return rend();
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Returns the value of the first bit in the array.
+		/// </summary>
+		///
+		/// <returns>
+		/// Returns a proxy reference to the first bit.
+		/// </returns> --------------------------------------------------------
+		[[nodiscard]] reference front() {
+			return (*this)[0];
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Returns the value of the first bit in the array.
+		/// </summary>
+		///
+		/// <returns>
+		/// Returns the value of the first bit.
+		/// </returns> --------------------------------------------------------
+		[[nodiscard]] const_reference front() const {
+			return test(0);
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Returns the value of the last bit in the array.
+		/// </summary>
+		///
+		/// <returns>
+		/// Returns a proxy reference to the last bit.
+		/// </returns> --------------------------------------------------------
+		[[nodiscard]] reference back() {
+			return (*this)[_size - 1];
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Returns the value of the last bit in the array.
+		/// </summary>
+		///
+		/// <returns>
+		/// Returns the value of the last bit.
+		/// </returns> --------------------------------------------------------
+		[[nodiscard]] const_reference back() const {
+			return test(_size - 1);
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Appends a bit to the end of the array, growing the underlying
+		/// word storage geometrically when it is full.
+		/// </summary>
+		///
+		/// <param name="value">
+		/// The value of the bit to append.
+		/// </param>
+		///
+		/// <returns>
+		/// Returns an iterator to the appended bit.
+		/// </returns> --------------------------------------------------------
+		iterator insertBack(bool value) {
+			if (_size % BITS_PER_WORD == 0)
+				_words.insertBack(word_type(0));
+
+			if (value)
+				set(_size);
+
+			return iterator(this, _size++);
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Removes the last bit in the array.
+		/// </summary> --------------------------------------------------------
+		void removeBack() {
+			reset(--_size);
+			if (_size % BITS_PER_WORD == 0)
+				_words.removeBack();
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// ~~~ Bitwise AND Assignment Operator ~~~
+		///
+		/// <para>
+		/// Clears every bit that is not also set in the given array. Bits
+		/// past the end of a shorter argument are treated as zero.
+		/// </para></summary>
+		///
+		/// <param name="other">
+		/// The array to AND with.
+		/// </param>
+		///
+		/// <returns>
+		/// Returns the caller after modification.
+		/// </returns> --------------------------------------------------------
+		BitArray& operator&=(const BitArray& other) noexcept {
+			size_type common = std::min(_words.size(), other._words.size());
+			collections::bitwise_and(
+				_words.asRawPointer(), other._words.asRawPointer(), common);
+
+			for (size_type i = common; i < _words.size(); ++i)
+				_words[i] = 0;
+
+			return *this;
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// ~~~ Bitwise OR Assignment Operator ~~~
+		///
+		/// <para>
+		/// Sets every bit that is set in the given array. Bits past the end
+		/// of this array are ignored.
+		/// </para></summary>
+		///
+		/// <param name="other">
+		/// The array to OR with.
+		/// </param>
+		///
+		/// <returns>
+		/// Returns the caller after modification.
+		/// </returns> --------------------------------------------------------
+		BitArray& operator|=(const BitArray& other) noexcept {
+			size_type common = std::min(_words.size(), other._words.size());
+			collections::bitwise_or(
+				_words.asRawPointer(), other._words.asRawPointer(), common);
+			clearUnusedBits();
+			return *this;
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// ~~~ Bitwise XOR Assignment Operator ~~~
+		///
+		/// <para>
+		/// Flips every bit that is set in the given array. Bits past the end
+		/// of this array are ignored.
+		/// </para></summary>
+		///
+		/// <param name="other">
+		/// The array to XOR with.
+		/// </param>
+		///
+		/// <returns>
+		/// Returns the caller after modification.
+		/// </returns> --------------------------------------------------------
+		BitArray& operator^=(const BitArray& other) noexcept {
+			size_type common = std::min(_words.size(), other._words.size());
+			collections::bitwise_xor(
+				_words.asRawPointer(), other._words.asRawPointer(), common);
+			clearUnusedBits();
+			return *this;
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// ~~~ Bitwise NOT Operator ~~~
+		/// </summary>
+		///
+		/// <returns>
+		/// Returns a copy of the array with every bit inverted.
+		/// </returns> --------------------------------------------------------
+		[[nodiscard]] BitArray operator~() const {
+			BitArray copy = *this;
+			copy.flip();
+			return copy;
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// ~~~ Bitwise AND Operator ~~~
+		/// </summary>
+		///
+		/// <returns>
+		/// Returns a new array the size of lhs holding lhs AND rhs.
+		/// </returns> --------------------------------------------------------
+		[[nodiscard]] friend BitArray operator&(BitArray lhs, const BitArray& rhs) {
+			lhs &= rhs;
+			return lhs;
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// ~~~ Bitwise OR Operator ~~~
+		/// </summary>
+		///
+		/// <returns>
+		/// Returns a new array the size of lhs holding lhs OR rhs.
+		/// </returns> --------------------------------------------------------
+		[[nodiscard]] friend BitArray operator|(BitArray lhs, const BitArray& rhs) {
+			lhs |= rhs;
+			return lhs;
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// ~~~ Bitwise XOR Operator ~~~
+		/// </summary>
+		///
+		/// <returns>
+		/// Returns a new array the size of lhs holding lhs XOR rhs.
+		/// </returns> --------------------------------------------------------
+		[[nodiscard]] friend BitArray operator^(BitArray lhs, const BitArray& rhs) {
+			lhs ^= rhs;
+			return lhs;
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Swaps the contents of the given BitArrays.
+		/// </summary>
+		///
+		/// <param name="a">
+		/// The first array to be swapped.
+		/// </param>
+		///
+		/// <param name="b">
+		/// The second array to be swapped.
+		/// </param> ----------------------------------------------------------
+		friend void swap(BitArray& a, BitArray& b)
+			noexcept(noexcept(a._words.swap(b._words)))
+		{
+			a.swap(b);
+		}
+
+		// ---------------------------------------------------------------------
+		/// <summary>
+		/// Swaps the contents of this BitArray with the given array.
+		/// </summary>
+		///
+		/// <param name="other">
+		/// The container to be swapped with.
+		/// </param> -----------------------------------------------------------
+		void swap(BitArray& other) noexcept(noexcept(_words.swap(other._words))) {
+			_words.swap(other._words);
+			std::swap(_size, other._size);
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// ~~~ Equality Operator ~~~
+		/// </summary>
+		///
+		/// <param name="lhs">
+		/// The BitArray appearing on the left side of the operator.
+		/// </param>
+		/// <param name="rhs">
+		/// The BitArray appearing on the right side of the operator.
+		/// </param>
+		///
+		/// <returns>
+		/// Returns true if the given arrays are the same size and hold the
+		/// same bits.
+		/// </returns> --------------------------------------------------------
+		friend bool operator==(
+			const BitArray& lhs,
+			const BitArray& rhs
+		) noexcept {
+			if (lhs._size != rhs._size)
+				return false;
+
+			for (size_type i = 0; i < lhs._words.size(); ++i)
+				if (lhs._words[i] != rhs._words[i])
+					return false;
+
+			return true;
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// ~~~ Comparison Operator ~~~
+		/// </summary>
+		///
+		/// <param name="lhs">
+		/// The BitArray appearing on the left side of the operator.
+		/// </param>
+		/// <param name="rhs">
+		/// The BitArray appearing on the right side of the operator.
+		/// </param>
+		///
+		/// <returns>
+		/// Returns the lexicographic ordering of the two arrays from the
+		/// first bit on, comparing a word at a time. A shorter array that is
+		/// a prefix of the other is ordered first.
+		/// </returns> --------------------------------------------------------
+		friend std::strong_ordering operator<=>(
+			const BitArray& lhs,
+			const BitArray& rhs
+		) noexcept {
+			size_type common = std::min(lhs._size, rhs._size);
+			size_type words = wordsFor(common);
+
+			for (size_type i = 0; i < words; ++i) {
+				word_type diff = lhs._words[i] ^ rhs._words[i];
+				if (!diff)
+					continue;
+
+				size_type bit = std::countr_zero(diff);
+				if (i * BITS_PER_WORD + bit >= common)
+					break;
+
+				return (lhs._words[i] >> bit & 1) <=> (rhs._words[i] >> bit & 1);
+			}
+
+			return lhs._size <=> rhs._size;
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// ~~~ Output Stream Operator ~~~
+		/// </summary>
+		///
+		/// <typeparam name="char_t">
+		/// The type of the character stream written to by the operator.
+		/// </typeparam>
+		///
+		/// <param name="os">
+		/// The stream being written to.
+		/// </param>
+		/// <param name="arr">
+		/// The array being read from.
+		/// </param>
+		///
+		/// <returns>
+		/// Returns the output stream after writing.
+		/// </returns> --------------------------------------------------------
+		template <typename char_t>
+		friend std::basic_ostream<char_t>& operator<<(
+			std::basic_ostream<char_t>& os,
+			const BitArray& arr
+		) {
+			collections::stream(arr, os);
+			return os;
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// ~~~ Input Stream Operator ~~~
+		/// </summary>
+		///
+		/// <typeparam name="char_t">
+		/// The type of the character stream read by the operator.
+		/// </typeparam>
+		///
+		/// <param name="is">
+		/// The stream being read from.
+		/// </param>
+		/// <param name="arr">
+		/// The array being written to.
+		/// </param>
+		///
+		/// <returns>
+		/// Returns the input stream after reading.
+		/// </returns> --------------------------------------------------------
+		template <typename char_t>
+		friend std::basic_istream<char_t>& operator>>(
+			std::basic_istream<char_t>& is,
+			BitArray& arr
+		) {
+			size_type size = 0;
+			is >> size;
+
+			arr.clear();
+			arr.resize(size);
+
+			for (size_type i = 0; i < size; ++i) {
+				bool value = false;
+				is >> value;
+				arr.set(i, value);
+			}
+
+			return is;
+		}
+
+	private:
+
+		word_array _words;
+		size_type _size;
+
+		[[nodiscard]] static constexpr size_type wordOf(size_type index) noexcept {
+			return index / BITS_PER_WORD;
+		}
+
+		[[nodiscard]] static constexpr word_type maskOf(size_type index) noexcept {
+			return word_type(1) << (index % BITS_PER_WORD);
+		}
+
+		[[nodiscard]] static constexpr word_type lowMask(size_type bits) noexcept {
+			return bits ? (~word_type(0) >> (BITS_PER_WORD - bits)) : 0;
+		}
+
+		[[nodiscard]] static constexpr size_type wordsFor(size_type bits) noexcept {
+			return (bits + BITS_PER_WORD - 1) / BITS_PER_WORD;
+		}
+
+		[[nodiscard]] size_type scanFrom(
+			size_type index,
+			word_type word
+		) const noexcept {
+			while (!word) {
+				if (++index >= _words.size())
+					return _size;
+				word = _words[index];
+			}
+
+			return index * BITS_PER_WORD + std::countr_zero(word);
+		}
+
+		void clearUnusedBits() noexcept {
+			size_type remainder = _size % BITS_PER_WORD;
+			if (remainder)
+				_words.back() &= lowMask(remainder);
+		}
+
+		void validateIndexExists(size_type index) const {
+			[[unlikely]] if (index >= size())
+				invalidIndex(index);
+		}
+
+		[[noreturn]] void invalidIndex(size_type index) const {
+			constexpr auto INVALID_INDEX = "Invalid Index: out of range.";
+			std::stringstream err{};
+
+			err << INVALID_INDEX << std::endl << "Index: " << index
+				<< " Size: " << size() << std::endl;
+			throw std::out_of_range(err.str().c_str());
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Proxy reference to a single bit within a BitArray word.
+		/// </summary> --------------------------------------------------------
+		class BitReference {
+		private:
+
+			word_type* _word;
+			word_type _mask;
+
+			BitReference(word_type* word, word_type mask) noexcept :
+				_word(word),
+				_mask(mask)
+			{
+
+			}
+
+			friend class BitArray;
+
+		public:
+
+			BitReference(const BitReference& copy) = default;
+
+			// ----------------------------------------------------------------
+			/// <summary>
+			/// ~~~ Assignment Operator ~~~
+			/// </summary>
+			///
+			/// <param name="value">
+			/// The value to assign to the referenced bit.
+			/// </param>
+			///
+			/// <returns>
+			/// Returns the reference after assignment.
+			/// </returns> ----------------------------------------------------
+			const BitReference& operator=(bool value) const noexcept {
+				if (value)
+					*_word |= _mask;
+				else
+					*_word &= ~_mask;
+				return *this;
+			}
+
+			// ----------------------------------------------------------------
+			/// <summary>
+			/// ~~~ Copy Assignment Operator ~~~
+			///
+			/// <para>
+			/// Assigns the value of the bit referred to by other, not the
+			/// reference itself.
+			/// </para></summary>
+			///
+			/// <param name="other">
+			/// The reference to read the assigned value from.
+			/// </param>
+			///
+			/// <returns>
+			/// Returns the reference after assignment.
+			/// </returns> ----------------------------------------------------
+			const BitReference& operator=(const BitReference& other) const noexcept {
+				return *this = static_cast<bool>(other);
+			}
+
+			// ----------------------------------------------------------------
+			/// <summary>
+			/// Returns the value of the referenced bit.
+			/// </summary> ----------------------------------------------------
+			operator bool() const noexcept {
+				return (*_word & _mask) != 0;
+			}
+
+			// ----------------------------------------------------------------
+			/// <summary>
+			/// Returns the inverse of the referenced bit.
+			/// </summary> ----------------------------------------------------
+			bool operator~() const noexcept {
+				return !static_cast<bool>(*this);
+			}
+
+			// ----------------------------------------------------------------
+			/// <summary>
+			/// Inverts the referenced bit.
+			/// </summary> ----------------------------------------------------
+			const BitReference& flip() const noexcept {
+				*_word ^= _mask;
+				return *this;
+			}
+		};
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Random access iterator over the bits of a BitArray. Dereferencing
+		/// a mutable iterator yields a proxy reference, a const iterator
+		/// yields the bit's value.
+		/// </summary> --------------------------------------------------------
+		template <bool isConst>
+		class BitArrayIterator {
+		private:
+
+			using array_pointer = std::conditional_t<
+				isConst, const BitArray*, BitArray*>;
+
+			array_pointer _array;
+			size_type _index;
+
+			BitArrayIterator(array_pointer arr, size_type index) noexcept :
+				_array(arr),
+				_index(index)
+			{
+
+			}
+
+			friend class BitArray;
+
+			template <bool>
+			friend class BitArrayIterator;
+
+		public:
+
+			using value_type = bool;
+			using difference_type = std::ptrdiff_t;
+			using pointer = void;
+			using reference = std::conditional_t<
+				isConst, bool, typename BitArray::reference>;
+			using iterator_category = std::random_access_iterator_tag;
+
+			BitArrayIterator() noexcept : _array(nullptr), _index(0) {}
+
+			// -----------------------------------------------------------------
+			/// <summary>
+			/// ~~~ Implicit Conversion Constructor ~~~
+			///
+			/// <para>
+			/// Converts a non-const BitArrayIterator to a const one.
+			/// </para></summary>
+			///
+			/// <param name="other">
+			/// The non-const BitArrayIterator to copy from.
+			/// </param> -------------------------------------------------------
+			template<
+				bool wasConst,
+				class = std::enable_if_t<isConst && !wasConst>
+			>
+			BitArrayIterator(BitArrayIterator<wasConst> copy) noexcept
+				: BitArrayIterator(copy._array, copy._index) {}
+
+			reference operator*() const noexcept {
+				if constexpr (isConst)
+					return _array->test(_index);
+				else
+					return (*_array)[_index];
+			}
+
+			reference operator[](difference_type n) const noexcept {
+				return *(*this + n);
+			}
+
+			BitArrayIterator& operator++() noexcept {
+				++_index;
+				return *this;
+			}
+
+			BitArrayIterator operator++(int) noexcept {
+				auto copy = *this;
+				++_index;
+				return copy;
+			}
+
+			BitArrayIterator& operator--() noexcept {
+				--_index;
+				return *this;
+			}
+
+			BitArrayIterator operator--(int) noexcept {
+				auto copy = *this;
+				--_index;
+				return copy;
+			}
+
+			BitArrayIterator& operator+=(difference_type n) noexcept {
+				_index += n;
+				return *this;
+			}
+
+			BitArrayIterator& operator-=(difference_type n) noexcept {
+				_index -= n;
+				return *this;
+			}
+
+			friend BitArrayIterator operator+(
+				BitArrayIterator it,
+				difference_type n
+			) noexcept {
+				return it += n;
+			}
+
+			friend BitArrayIterator operator+(
+				difference_type n,
+				BitArrayIterator it
+			) noexcept {
+				return it += n;
+			}
+
+			friend BitArrayIterator operator-(
+				BitArrayIterator it,
+				difference_type n
+			) noexcept {
+				return it -= n;
+			}
+
+			friend difference_type operator-(
+				const BitArrayIterator& lhs,
+				const BitArrayIterator& rhs
+			) noexcept {
+				return static_cast<difference_type>(lhs._index) -
+					static_cast<difference_type>(rhs._index);
+			}
+
+			friend bool operator==(
+				const BitArrayIterator& lhs,
+				const BitArrayIterator& rhs
+			) noexcept {
+				return lhs._index == rhs._index;
+			}
+
+			friend auto operator<=>(
+				const BitArrayIterator& lhs,
+				const BitArrayIterator& rhs
+			) noexcept {
+				return lhs._index <=> rhs._index;
+			}
+		};
+	};
+
+	static_assert(
+		collection<BitArray<>>,
+		"BitArray does not meet the requirements for a collection."
+	);
+
+	static_assert(
+		random_access_iterable<BitArray<>>,
+		"BitArray does not meet the requirements for random access iteration."
+	);
+}
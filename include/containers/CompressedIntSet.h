@@ -0,0 +1,1676 @@
+/* ============================================================================
+* Copyright (C) 2023 Ryan Eubank
+*
+* This program is free software: you can redistribute it and/or modify
+* it under the terms of the GNU General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License
+* along with this program.  If not, see <https://www.gnu.org/licenses/>.
+* ========================================================================= */
+
+#pragma once
+
+#include <bit>
+#include <compare>
+#include <cstdint>
+#include <cstdlib>
+#include <initializer_list>
+#include <istream>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <ostream>
+#include <ranges>
+#include <type_traits>
+#include <utility>
+
+#include "../algorithms/bitwise.h"
+#include "../algorithms/stream.h"
+#include "../concepts/associative.h"
+#include "../concepts/collection.h"
+#include "../concepts/iterable.h"
+#include "DynamicArray.h"
+
+namespace collections {
+
+	// -------------------------------------------------------------------------
+	/// <summary>
+	/// CompressedIntSet is an ordered set of 32-bit unsigned integers stored
+	/// in the roaring bitmap layout. Values are partitioned by their high 16
+	/// bits into chunks, and each chunk stores its low 16 bits in whichever
+	/// of three forms is smallest:
+	///
+	/// <list type="bullet">
+	///		<para><item><term>
+	///			- array: a sorted array of up to 4096 values.
+	///		</term></item></para>
+	///		<para><item><term>
+	///			- bitmap: a 65536-bit bitmap for dense chunks.
+	///		</term></item></para>
+	///		<para><item><term>
+	///			- run: sorted [first, last] intervals, produced by optimize().
+	///		</term></item></para>
+	/// </list>
+	///
+	/// Union, intersection and difference work chunk by chunk, using the
+	/// word-parallel kernels from bitwise.h on bitmap chunks.
+	/// </summary>
+	///
+	/// <typeparam name="allocator_t">
+	/// The type of the allocator responsible for allocating memory to the
+	/// set. It is rebound for the chunk directory and chunk storage.
+	/// </typeparam> -----------------------------------------------------------
+	template <class allocator_t = std::allocator<uint32_t>>
+	class CompressedIntSet final {
+	private:
+
+		class CompressedIntSetIterator;
+
+		enum class chunk_type : uint8_t { ARRAY, BITMAP, RUN };
+
+		using low_allocator		= rebind<allocator_t, uint16_t>;
+		using word_allocator	= rebind<allocator_t, uint64_t>;
+		using low_array			= DynamicArray<uint16_t, low_allocator>;
+		using word_array		= DynamicArray<uint64_t, word_allocator>;
+
+		struct chunk {
+			uint16_t key;
+			chunk_type type;
+			uint32_t cardinality;
+			low_array values;
+			word_array words;
+		};
+
+		using chunk_allocator	= rebind<allocator_t, chunk>;
+		using chunk_array		= DynamicArray<chunk, chunk_allocator>;
+
+		static constexpr uint32_t CHUNK_BITS	= 65536;
+		static constexpr uint32_t CHUNK_WORDS	= CHUNK_BITS / 64;
+		static constexpr uint32_t ARRAY_LIMIT	= 4096;
+
+	public:
+
+		using value_type		= uint32_t;
+		using key_type			= uint32_t;
+		using allocator_type	= allocator_t;
+		using reference			= value_type;
+		using const_reference	= value_type;
+		using size_type			= chunk_array::size_type;
+		using difference_type	= chunk_array::difference_type;
+
+		using iterator			= CompressedIntSetIterator;
+		using const_iterator	= CompressedIntSetIterator;
+
+		using pointer			= const_iterator;
+		using const_pointer		= const_iterator;
+
+		// ---------------------------------------------------------------------
+		/// <summary>
+		/// ~~~ Default Constructor ~~~
+		///
+		///	<para>
+		/// Constructs an empty set.
+		/// </para></summary> --------------------------------------------------
+		CompressedIntSet() : _chunks(), _size(0) {
+
+		}
+
+		// ---------------------------------------------------------------------
+		/// <summary>
+		/// ~~~ Allocator Constructor ~~~
+		///
+		///	<para>
+		/// Constructs an empty set.
+		/// </para></summary>
+		///
+		/// <param name="alloc">
+		/// The allocator instance used by the set.
+		/// </param> -----------------------------------------------------------
+		explicit CompressedIntSet(const allocator_type& alloc) :
+			_chunks(chunk_allocator(alloc)),
+			_size(0)
+		{
+
+		}
+
+		// ---------------------------------------------------------------------
+		/// <summary>
+		/// ~~~ Copy Constructor ~~~
+		///
+		/// <para>
+		/// Constructs a deep copy of the specified set.
+		/// </para></summary>
+		///
+		/// <param name="copy">
+		/// The set to be copied.
+		/// </param> -----------------------------------------------------------
+		CompressedIntSet(const CompressedIntSet& copy) = default;
+
+		// ---------------------------------------------------------------------
+		/// <summary>
+		/// ~~~ Move Constructor ~~~
+		///
+		/// <para>
+		/// Constructs a set by moving the data from the provided set into
+		/// this one.
+		/// </para></summary>
+		///
+		/// <param name="other">
+		/// The set to be moved into this one.
+		/// </param> -----------------------------------------------------------
+		CompressedIntSet(CompressedIntSet&& other) noexcept :
+			_chunks(std::move(other._chunks)),
+			_size(std::exchange(other._size, 0))
+		{
+
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// ~~~ Initialization Constructor ~~~
+		///
+		/// <para>
+		/// Constructs a set containing the values in the specified
+		/// initialization list.
+		/// </para></summary>
+		///
+		/// <param name="init">
+		/// The initialization list to copy values from.
+		/// </param>
+		/// <param name="alloc">
+		/// The allocator instance used by the set. Default constructs the
+		/// allocator if unspecified.
+		/// </param> ----------------------------------------------------------
+		CompressedIntSet(
+			std::initializer_list<value_type> init,
+			const allocator_type& alloc = allocator_type{}
+		) : CompressedIntSet(init.begin(), init.end(), alloc) {
+
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// ~~~ Iterator Constructor ~~~
+		///
+		/// <para>
+		/// Constructs a set containing the values from the given
+		/// iterator/sentinel pair.
+		/// </para></summary>
+		///
+		/// <typeparam name="in_iterator">
+		/// The type of the beginning iterator to copy from.
+		/// </typeparam>
+		/// <typeparam name="sentinel">
+		/// The type of the end iterator or sentinel.
+		/// </typeparam>
+		///
+		/// <param name="begin">
+		/// The beginning of the range to copy from.
+		/// </param>
+		/// <param name="end">
+		/// The end of the range to copy from.
+		/// </param>
+		/// <param name="alloc">
+		/// The allocator instance used by the set. Default constructs the
+		/// allocator if unspecified.
+		/// </param> ----------------------------------------------------------
+		template <
+			std::input_iterator in_iterator,
+			std::sentinel_for<in_iterator> sentinel
+		>
+		CompressedIntSet(
+			in_iterator begin,
+			sentinel end,
+			const allocator_type& alloc = allocator_type{}
+		) : CompressedIntSet(alloc) {
+			insert(begin, end);
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// ~~~ Range Constructor ~~~
+		///
+		/// <para>
+		/// Constructs a set containing the values from the given range.
+		/// </para></summary>
+		///
+		/// <typeparam name="range">
+		/// The type of the range being constructed from.
+		/// </typeparam>
+		///
+		/// <param name="tag">
+		/// Range construction tag to disabiguate this constructor from
+		/// construction with an initializer list.
+		/// </param>
+		/// <param name="rg">
+		/// The range to construct the set with.
+		/// </param>
+		/// <param name="alloc">
+		/// The allocator instance for the set. Default constructs the
+		/// allocator if unspecified.
+		/// </param> ----------------------------------------------------------
+		template <std::ranges::input_range range>
+		CompressedIntSet(
+			from_range_t tag,
+			range&& rg,
+			const allocator_type& alloc = allocator_type{}
+		) : CompressedIntSet(std::ranges::begin(rg), std::ranges::end(rg), alloc) {
+
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// ~~~ Destructor ~~~
+		///
+		/// <para>
+		/// Destructs the set safely releasing its memory.
+		/// </para></summary> -------------------------------------------------
+		~CompressedIntSet() = default;
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// ~~~ Copy Assignment Operator ~~~
+		///
+		/// <para>
+		/// Copies the data from the given argument to this set.
+		/// </para></summary>
+		///
+		/// <param name="other">
+		/// The set to copy from.
+		/// </param>
+		///
+		/// <returns>
+		/// Returns the caller with the copied data.
+		/// </returns> --------------------------------------------------------
+		CompressedIntSet& operator=(const CompressedIntSet& other) = default;
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// ~~~ Move Assignment Operator ~~~
+		///
+		/// <para>
+		/// Moves the data from the given argument to this set.
+		/// </para></summary>
+		///
+		/// <param name="other">
+		/// The set to move from.
+		/// </param>
+		///
+		/// <returns>
+		/// Returns the caller with the moved data.
+		/// </returns> --------------------------------------------------------
+		CompressedIntSet& operator=(CompressedIntSet&& other) {
+			_chunks = std::move(other._chunks);
+			_size = std::exchange(other._size, 0);
+			return *this;
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Returns the allocator managing memory for the container.
+		/// </summary>
+		///
+		/// <returns>
+		/// Returns a copy of the allocator managing memory for the container.
+		/// </returns> --------------------------------------------------------
+		[[nodiscard]] allocator_type allocator() const noexcept {
+			return static_cast<allocator_type>(_chunks.allocator());
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Returns the number of values contained by the set.
+		/// </summary>
+		///
+		/// <returns>
+		/// Returns the number of values in the set.
+		/// </returns> --------------------------------------------------------
+		[[nodiscard]] size_type size() const noexcept {
+			return _size;
+		}
+
+		// ---------------------------------------------------------------------
+		/// <summary>
+		/// Returns the theoretical maximum size for the container.
+		/// </summary>
+		///
+		/// <returns>
+		/// Returns the number of distinct 32-bit values.
+		/// </returns> ---------------------------------------------------------
+		[[nodiscard]] size_type max_size() const noexcept {
+			return static_cast<size_type>(
+				std::numeric_limits<value_type>::max()) + 1;
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Returns whether the set is empty and contains no values.
+		/// </summary>
+		///
+		/// <returns>
+		/// Returns true is the set contains zero values, false otherwise.
+		/// </returns> --------------------------------------------------------
+		[[nodiscard]] bool isEmpty() const noexcept {
+			return _size == 0;
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Empties and clears the set of all values.
+		/// </summary> --------------------------------------------------------
+		void clear() noexcept {
+			_chunks.clear();
+			_size = 0;
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Returns an iterator to the smallest value in the set.
+		/// </summary>
+		///
+		/// <returns>
+		/// Returns a forward iterator visiting values in ascending order.
+		/// </returns> --------------------------------------------------------
+		[[nodiscard]] const_iterator begin() const noexcept {
+			return chunkBegin(0);
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Returns an iterator past the largest value in the set.
+		/// </summary>
+		///
+		/// <returns>
+		/// Returns the end iterator of the set.
+		/// </returns> --------------------------------------------------------
+		[[nodiscard]] const_iterator end() const noexcept {
+			return const_iterator(this, _chunks.size(), 0, 0);
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Returns an iterator to the smallest value in the set.
+		/// </summary>
+		///
+		/// <returns>
+		/// Returns a forward iterator visiting values in ascending order.
+		/// </returns> --------------------------------------------------------
+		[[nodiscard]] const_iterator cbegin() const noexcept {
+			return begin();
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Returns an iterator past the largest value in the set.
+		/// </summary>
+		///
+		/// <returns>
+		/// Returns the end iterator of the set.
+		/// </returns> --------------------------------------------------------
+		[[nodiscard]] const_iterator cend() const noexcept {
+			return end();
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Searches the set for the given value.
+		/// </summary>
+		///
+		/// <param name="key">
+		/// The value to search for.
+		/// </param>
+		///
+		/// <returns>
+		/// Returns an iterator to the value, or end() if it is not present.
+		/// </returns> --------------------------------------------------------
+		[[nodiscard]] const_iterator find(key_type key) const {
+			const_iterator result = lowerBound(key);
+			return (result != end() && *result == key) ? result : end();
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Returns whether the set contains the given value.
+		/// </summary>
+		///
+		/// <param name="key">
+		/// The value to search for.
+		/// </param>
+		///
+		/// <returns>
+		/// Returns true if the value is in the set, false otherwise.
+		/// </returns> --------------------------------------------------------
+		[[nodiscard]] bool contains(key_type key) const {
+			size_type index = chunkLowerBound(highOf(key));
+			if (index == _chunks.size() || _chunks[index].key != highOf(key))
+				return false;
+			return chunkContains(_chunks[index], lowOf(key));
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Returns an iterator to the first value not less than the given key.
+		/// </summary>
+		///
+		/// <param name="key">
+		/// The value to compare against.
+		/// </param>
+		///
+		/// <returns>
+		/// Returns an iterator to the smallest value >= key, or end().
+		/// </returns> --------------------------------------------------------
+		[[nodiscard]] const_iterator lowerBound(key_type key) const {
+			size_type index = chunkLowerBound(highOf(key));
+
+			if (index < _chunks.size() && _chunks[index].key == highOf(key)) {
+				const_iterator result = end();
+				if (chunkLowerBound(index, lowOf(key), result))
+					return result;
+				++index;
+			}
+
+			return chunkBegin(index);
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Returns an iterator to the first value greater than the given key.
+		/// </summary>
+		///
+		/// <param name="key">
+		/// The value to compare against.
+		/// </param>
+		///
+		/// <returns>
+		/// Returns an iterator to the smallest value > key, or end().
+		/// </returns> --------------------------------------------------------
+		[[nodiscard]] const_iterator upperBound(key_type key) const {
+			if (key == std::numeric_limits<key_type>::max())
+				return end();
+			return lowerBound(key + 1);
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Inserts the given value into the set.
+		/// </summary>
+		///
+		/// <param name="element">
+		/// The value to be inserted.
+		/// </param>
+		///
+		/// <returns>
+		/// Returns an iterator to the inserted value, or the existing equal
+		/// value preventing insertion.
+		/// </returns> --------------------------------------------------------
+		iterator insert(const_reference element) {
+			return insertValue(element);
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Inserts the given range of values into the set.
+		/// </summary>
+		///
+		/// <param name="begin">
+		/// The beginning iterator of the range to insert.
+		/// </param>
+		/// <param name="end">
+		/// The end iterator of the range to insert.
+		/// </param>
+		///
+		/// <returns>
+		/// Returns an iterator to the last value inserted, or end() if
+		/// begin == end.
+		/// </returns> --------------------------------------------------------
+		template <
+			std::input_iterator in_iterator,
+			std::sentinel_for<in_iterator> sentinel
+		>
+		iterator insert(in_iterator begin, sentinel end) {
+			iterator result = this->end();
+			while (begin != end)
+				result = insertValue(static_cast<value_type>(*begin++));
+			return result;
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Constructs a value from the given arguments and inserts it.
+		/// </summary>
+		///
+		/// <param name="args">
+		/// The arguments to construct the new value with.
+		/// </param>
+		///
+		/// <returns>
+		/// Returns an iterator to the inserted value.
+		/// </returns> --------------------------------------------------------
+		template <class T, class ...Args>
+			requires (!std::convertible_to<T, const_iterator>)
+		iterator emplace(T&& arg1, Args&&... args) {
+			return insertValue(
+				value_type(std::forward<T>(arg1), std::forward<Args>(args)...));
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Removes the value at the given position from the set.
+		/// </summary>
+		///
+		/// <param name="position">
+		/// The iterator position of the value to be removed.
+		/// </param>
+		///
+		/// <returns>
+		/// Returns an iterator to the value following the removed value.
+		/// </returns> --------------------------------------------------------
+		iterator remove(const_iterator position) {
+			value_type value = *position;
+			removeValue(value);
+			return upperBound(value);
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Removes all values in the given iterator range [begin, end).
+		/// </summary>
+		///
+		/// <returns>
+		/// Returns an iterator to the value following the removed range.
+		/// </returns> --------------------------------------------------------
+		iterator remove(const_iterator begin, const_iterator end) {
+			if (begin == end)
+				return begin;
+
+			bool toEnd = (end == this->end());
+			value_type stop = toEnd ? 0 : *end;
+
+			while (begin != this->end() && (toEnd || *begin < stop))
+				begin = remove(begin);
+
+			return begin;
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Converts each chunk to whichever of the array, bitmap, or run
+		/// forms is smallest. Chunks with long runs of consecutive values
+		/// gain the most; the set's contents are unchanged.
+		/// </summary> --------------------------------------------------------
+		void optimize() {
+			for (auto& c : _chunks) {
+				size_type runBytes = runCountOf(c) * 4;
+				size_type arrayBytes = c.cardinality * 2;
+				size_type bitmapBytes = CHUNK_WORDS * 8;
+
+				if (runBytes < arrayBytes && runBytes < bitmapBytes) {
+					if (c.type != chunk_type::RUN)
+						toRun(c);
+				}
+				else if (c.cardinality <= ARRAY_LIMIT) {
+					if (c.type != chunk_type::ARRAY)
+						toArray(c);
+				}
+				else if (c.type != chunk_type::BITMAP)
+					toBitmap(c);
+			}
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// ~~~ Union Assignment Operator ~~~
+		///
+		/// <para>
+		/// Adds every value in the given set to this one.
+		/// </para></summary>
+		///
+		/// <param name="other">
+		/// The set to union with.
+		/// </param>
+		///
+		/// <returns>
+		/// Returns the caller after modification.
+		/// </returns> --------------------------------------------------------
+		CompressedIntSet& operator|=(const CompressedIntSet& other) {
+			if (this == &other || other.isEmpty())
+				return *this;
+
+			// everything that can throw happens before a chunk is moved: the
+			// chunks only other holds are copied aside, and chunks both hold
+			// are united in place, each left whole if its union throws.
+			chunk_array result(_chunks.allocator());
+			result.reserve(_chunks.size() + other._chunks.size());
+
+			chunk_array added(_chunks.allocator());
+			added.reserve(other._chunks.size());
+
+			for (size_type i = 0, j = 0; j < other._chunks.size(); ++j) {
+				while (i < _chunks.size() && _chunks[i].key < other._chunks[j].key)
+					++i;
+
+				if (i == _chunks.size() || other._chunks[j].key != _chunks[i].key)
+					added.insertBack(other._chunks[j]);
+			}
+
+			try {
+				for (size_type i = 0, j = 0; j < other._chunks.size(); ++j) {
+					while (i < _chunks.size() && _chunks[i].key < other._chunks[j].key)
+						++i;
+
+					if (i < _chunks.size() && other._chunks[j].key == _chunks[i].key)
+						uniteChunk(_chunks[i], other._chunks[j]);
+				}
+			}
+			catch (...) {
+				recount();
+				throw;
+			}
+
+			size_type i = 0, j = 0;
+			while (i < _chunks.size() || j < added.size()) {
+				if (j == added.size() ||
+					(i < _chunks.size() && _chunks[i].key < added[j].key))
+					result.insertBack(std::move(_chunks[i++]));
+				else
+					result.insertBack(std::move(added[j++]));
+			}
+
+			_chunks = std::move(result);
+			recount();
+			return *this;
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// ~~~ Intersection Assignment Operator ~~~
+		///
+		/// <para>
+		/// Removes every value that is not also in the given set.
+		/// </para></summary>
+		///
+		/// <param name="other">
+		/// The set to intersect with.
+		/// </param>
+		///
+		/// <returns>
+		/// Returns the caller after modification.
+		/// </returns> --------------------------------------------------------
+		CompressedIntSet& operator&=(const CompressedIntSet& other) {
+			if (this == &other)
+				return *this;
+
+			size_type kept = 0, i = 0, j = 0;
+			try {
+				for (; i < _chunks.size(); ++i) {
+					chunk& c = _chunks[i];
+
+					while (j < other._chunks.size() && other._chunks[j].key < c.key)
+						++j;
+
+					if (j == other._chunks.size() || other._chunks[j].key != c.key)
+						continue;
+
+					intersectChunk(c, other._chunks[j]);
+					keepChunk(i, kept);
+				}
+			}
+			catch (...) {
+				keepChunksFrom(i, kept);
+				throw;
+			}
+
+			truncateChunks(kept);
+			return *this;
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// ~~~ Difference Assignment Operator ~~~
+		///
+		/// <para>
+		/// Removes every value that is also in the given set.
+		/// </para></summary>
+		///
+		/// <param name="other">
+		/// The set whose values are removed.
+		/// </param>
+		///
+		/// <returns>
+		/// Returns the caller after modification.
+		/// </returns> --------------------------------------------------------
+		CompressedIntSet& operator-=(const CompressedIntSet& other) {
+			if (this == &other) {
+				clear();
+				return *this;
+			}
+
+			size_type kept = 0, i = 0, j = 0;
+			try {
+				for (; i < _chunks.size(); ++i) {
+					chunk& c = _chunks[i];
+
+					while (j < other._chunks.size() && other._chunks[j].key < c.key)
+						++j;
+
+					if (j < other._chunks.size() && other._chunks[j].key == c.key)
+						subtractChunk(c, other._chunks[j]);
+
+					keepChunk(i, kept);
+				}
+			}
+			catch (...) {
+				keepChunksFrom(i, kept);
+				throw;
+			}
+
+			truncateChunks(kept);
+			return *this;
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// ~~~ Union Operator ~~~
+		/// </summary>
+		///
+		/// <returns>
+		/// Returns a new set holding every value in either set.
+		/// </returns> --------------------------------------------------------
+		[[nodiscard]] friend CompressedIntSet operator|(
+			CompressedIntSet lhs,
+			const CompressedIntSet& rhs
+		) {
+			lhs |= rhs;
+			return lhs;
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// ~~~ Intersection Operator ~~~
+		/// </summary>
+		///
+		/// <returns>
+		/// Returns a new set holding the values present in both sets.
+		/// </returns> --------------------------------------------------------
+		[[nodiscard]] friend CompressedIntSet operator&(
+			CompressedIntSet lhs,
+			const CompressedIntSet& rhs
+		) {
+			lhs &= rhs;
+			return lhs;
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// ~~~ Difference Operator ~~~
+		/// </summary>
+		///
+		/// <returns>
+		/// Returns a new set holding the values of lhs not present in rhs.
+		/// </returns> --------------------------------------------------------
+		[[nodiscard]] friend CompressedIntSet operator-(
+			CompressedIntSet lhs,
+			const CompressedIntSet& rhs
+		) {
+			lhs -= rhs;
+			return lhs;
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Swaps the contents of the given sets.
+		/// </summary>
+		///
+		/// <param name="a">
+		/// The first set to be swapped.
+		/// </param>
+		///
+		/// <param name="b">
+		/// The second set to be swapped.
+		/// </param> ----------------------------------------------------------
+		friend void swap(CompressedIntSet& a, CompressedIntSet& b) noexcept {
+			a.swap(b);
+		}
+
+		// ---------------------------------------------------------------------
+		/// <summary>
+		/// Swaps the contents of this set with the given set.
+		/// </summary>
+		///
+		/// <param name="other">
+		/// The container to be swapped with.
+		/// </param> -----------------------------------------------------------
+		void swap(CompressedIntSet& other) noexcept {
+			_chunks.swap(other._chunks);
+			std::swap(_size, other._size);
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// ~~~ Equality Operator ~~~
+		/// </summary>
+		///
+		/// <param name="lhs">
+		/// The set appearing on the left side of the operator.
+		/// </param>
+		/// <param name="rhs">
+		/// The set appearing on the right side of the operator.
+		/// </param>
+		///
+		/// <returns>
+		/// Returns true if both sets contain exactly the same values,
+		/// regardless of how their chunks are represented.
+		/// </returns> --------------------------------------------------------
+		friend bool operator==(
+			const CompressedIntSet& lhs,
+			const CompressedIntSet& rhs
+		) noexcept {
+			if (lhs._size != rhs._size)
+				return false;
+
+			auto a = lhs.begin();
+			auto b = rhs.begin();
+
+			for (; a != lhs.end(); ++a, ++b)
+				if (*a != *b)
+					return false;
+
+			return true;
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// ~~~ Comparison Operator ~~~
+		/// </summary>
+		///
+		/// <param name="lhs">
+		/// The set appearing on the left side of the operator.
+		/// </param>
+		/// <param name="rhs">
+		/// The set appearing on the right side of the operator.
+		/// </param>
+		///
+		/// <returns>
+		/// Returns the lexicographic ordering of the sets' ascending values.
+		/// </returns> --------------------------------------------------------
+		friend std::strong_ordering operator<=>(
+			const CompressedIntSet& lhs,
+			const CompressedIntSet& rhs
+		) noexcept {
+			auto a = lhs.begin();
+			auto b = rhs.begin();
+
+			for (; a != lhs.end() && b != rhs.end(); ++a, ++b)
+				if (auto order = *a <=> *b; order != 0)
+					return order;
+
+			return lhs._size <=> rhs._size;
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// ~~~ Output Stream Operator ~~~
+		/// </summary>
+		///
+		/// <typeparam name="char_t">
+		/// The type of the character stream written to by the operator.
+		/// </typeparam>
+		///
+		/// <param name="os">
+		/// The stream being written to.
+		/// </param>
+		/// <param name="set">
+		/// The set being read from.
+		/// </param>
+		///
+		/// <returns>
+		/// Returns the output stream after writing.
+		/// </returns> --------------------------------------------------------
+		template <typename char_t>
+		friend std::basic_ostream<char_t>& operator<<(
+			std::basic_ostream<char_t>& os,
+			const CompressedIntSet& set
+		) {
+			collections::stream(set, os);
+			return os;
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// ~~~ Input Stream Operator ~~~
+		/// </summary>
+		///
+		/// <typeparam name="char_t">
+		/// The type of the character stream read by the operator.
+		/// </typeparam>
+		///
+		/// <param name="is">
+		/// The stream being read from.
+		/// </param>
+		/// <param name="set">
+		/// The set being written to.
+		/// </param>
+		///
+		/// <returns>
+		/// Returns the input stream after reading.
+		/// </returns> --------------------------------------------------------
+		template <typename char_t>
+		friend std::basic_istream<char_t>& operator>>(
+			std::basic_istream<char_t>& is,
+			CompressedIntSet& set
+		) {
+			size_type size = 0;
+			is >> size;
+
+			set.clear();
+			for (size_type i = 0; i < size; ++i) {
+				value_type value = 0;
+				is >> value;
+				set.insert(value);
+			}
+
+			return is;
+		}
+
+	private:
+
+		chunk_array _chunks;
+		size_type _size;
+
+		[[nodiscard]] static constexpr uint16_t highOf(value_type value) noexcept {
+			return static_cast<uint16_t>(value >> 16);
+		}
+
+		[[nodiscard]] static constexpr uint16_t lowOf(value_type value) noexcept {
+			return static_cast<uint16_t>(value & 0xffff);
+		}
+
+		[[nodiscard]] static constexpr value_type valueOf(
+			uint16_t high,
+			uint32_t low
+		) noexcept {
+			return (static_cast<value_type>(high) << 16) | low;
+		}
+
+		[[nodiscard]] static size_type runCount(const chunk& c) noexcept {
+			return c.values.size() / 2;
+		}
+
+		[[nodiscard]] static uint16_t runFirst(const chunk& c, size_type i) noexcept {
+			return c.values[2 * i];
+		}
+
+		[[nodiscard]] static uint16_t runLast(const chunk& c, size_type i) noexcept {
+			return c.values[2 * i + 1];
+		}
+
+		[[nodiscard]] static bool testBit(
+			const word_array& words,
+			uint32_t bit
+		) noexcept {
+			return (words[bit >> 6] >> (bit & 63)) & 1;
+		}
+
+		template <bool value>
+		[[nodiscard]] static uint32_t nextBit(
+			const word_array& words,
+			uint32_t from
+		) noexcept {
+			if (from >= CHUNK_BITS)
+				return CHUNK_BITS;
+
+			uint32_t index = from >> 6;
+			uint64_t word = value ? words[index] : ~words[index];
+			word &= ~uint64_t(0) << (from & 63);
+
+			while (!word) {
+				if (++index == CHUNK_WORDS)
+					return CHUNK_BITS;
+				word = value ? words[index] : ~words[index];
+			}
+
+			return (index << 6) + std::countr_zero(word);
+		}
+
+		static void setBits(
+			word_array& words,
+			uint32_t first,
+			uint32_t last
+		) noexcept {
+			uint32_t firstWord = first >> 6;
+			uint32_t lastWord = last >> 6;
+			uint64_t firstMask = ~uint64_t(0) << (first & 63);
+			uint64_t lastMask = ~uint64_t(0) >> (63 - (last & 63));
+
+			if (firstWord == lastWord) {
+				words[firstWord] |= firstMask & lastMask;
+				return;
+			}
+
+			words[firstWord] |= firstMask;
+			for (uint32_t i = firstWord + 1; i < lastWord; ++i)
+				words[i] = ~uint64_t(0);
+			words[lastWord] |= lastMask;
+		}
+
+		[[nodiscard]] static size_type arrayLowerBound(
+			const low_array& values,
+			uint16_t low
+		) noexcept {
+			size_type first = 0;
+			size_type last = values.size();
+
+			while (first < last) {
+				size_type mid = first + (last - first) / 2;
+				if (values[mid] < low)
+					first = mid + 1;
+				else
+					last = mid;
+			}
+
+			return first;
+		}
+
+		[[nodiscard]] static size_type runLowerBound(
+			const chunk& c,
+			uint16_t low
+		) noexcept {
+			size_type first = 0;
+			size_type last = runCount(c);
+
+			while (first < last) {
+				size_type mid = first + (last - first) / 2;
+				if (runLast(c, mid) < low)
+					first = mid + 1;
+				else
+					last = mid;
+			}
+
+			return first;
+		}
+
+		[[nodiscard]] static bool chunkContains(
+			const chunk& c,
+			uint16_t low
+		) noexcept {
+			switch (c.type) {
+				case chunk_type::ARRAY: {
+					size_type i = arrayLowerBound(c.values, low);
+					return i < c.values.size() && c.values[i] == low;
+				}
+				case chunk_type::BITMAP:
+					return testBit(c.words, low);
+				default: {
+					size_type i = runLowerBound(c, low);
+					return i < runCount(c) && runFirst(c, i) <= low;
+				}
+			}
+		}
+
+		[[nodiscard]] static size_type runCountOf(const chunk& c) noexcept {
+			size_type runs = 0;
+
+			switch (c.type) {
+				case chunk_type::ARRAY:
+					for (size_type i = 0; i < c.values.size(); ++i)
+						if (i == 0 || c.values[i] != c.values[i - 1] + 1)
+							++runs;
+					return runs;
+				case chunk_type::BITMAP: {
+					uint64_t carry = 0;
+					for (uint32_t i = 0; i < CHUNK_WORDS; ++i) {
+						uint64_t word = c.words[i];
+						runs += std::popcount(word & ~((word << 1) | carry));
+						carry = word >> 63;
+					}
+					return runs;
+				}
+				default:
+					return runCount(c);
+			}
+		}
+
+		[[nodiscard]] size_type chunkLowerBound(uint16_t high) const noexcept {
+			size_type first = 0;
+			size_type last = _chunks.size();
+
+			while (first < last) {
+				size_type mid = first + (last - first) / 2;
+				if (_chunks[mid].key < high)
+					first = mid + 1;
+				else
+					last = mid;
+			}
+
+			return first;
+		}
+
+		[[nodiscard]] const_iterator chunkBegin(size_type index) const noexcept {
+			if (index >= _chunks.size())
+				return end();
+
+			const chunk& c = _chunks[index];
+			switch (c.type) {
+				case chunk_type::ARRAY:
+					return const_iterator(this, index, 0, valueOf(c.key, c.values[0]));
+				case chunk_type::BITMAP: {
+					uint32_t bit = nextBit<true>(c.words, 0);
+					return const_iterator(this, index, bit, valueOf(c.key, bit));
+				}
+				default:
+					return const_iterator(this, index, 0, valueOf(c.key, runFirst(c, 0)));
+			}
+		}
+
+		[[nodiscard]] bool chunkLowerBound(
+			size_type index,
+			uint16_t low,
+			const_iterator& result
+		) const noexcept {
+			const chunk& c = _chunks[index];
+
+			switch (c.type) {
+				case chunk_type::ARRAY: {
+					size_type i = arrayLowerBound(c.values, low);
+					if (i == c.values.size())
+						return false;
+					result = const_iterator(this, index, i, valueOf(c.key, c.values[i]));
+					return true;
+				}
+				case chunk_type::BITMAP: {
+					uint32_t bit = nextBit<true>(c.words, low);
+					if (bit == CHUNK_BITS)
+						return false;
+					result = const_iterator(this, index, bit, valueOf(c.key, bit));
+					return true;
+				}
+				default: {
+					size_type i = runLowerBound(c, low);
+					if (i == runCount(c))
+						return false;
+					uint16_t first = std::max(runFirst(c, i), low);
+					result = const_iterator(this, index, i, valueOf(c.key, first));
+					return true;
+				}
+			}
+		}
+
+		[[nodiscard]] chunk makeChunk(uint16_t key) const {
+			return chunk{
+				key,
+				chunk_type::ARRAY,
+				0,
+				low_array(low_allocator(_chunks.allocator())),
+				word_array(word_allocator(_chunks.allocator()))
+			};
+		}
+
+		void toBitmap(chunk& c) {
+			word_array words(word_allocator(_chunks.allocator()));
+			words.resize(CHUNK_WORDS, 0);
+
+			if (c.type == chunk_type::ARRAY)
+				for (auto low : c.values)
+					words[low >> 6] |= uint64_t(1) << (low & 63);
+			else
+				for (size_type i = 0; i < runCount(c); ++i)
+					setBits(words, runFirst(c, i), runLast(c, i));
+
+			c.words = std::move(words);
+			c.values = low_array(low_allocator(_chunks.allocator()));
+			c.type = chunk_type::BITMAP;
+		}
+
+		void toArray(chunk& c) {
+			low_array values(low_allocator(_chunks.allocator()));
+			if (c.cardinality)
+				values.reserve(c.cardinality);
+
+			if (c.type == chunk_type::BITMAP) {
+				for (uint32_t i = 0; i < CHUNK_WORDS; ++i) {
+					for (uint64_t word = c.words[i]; word; word &= word - 1)
+						values.insertBack(static_cast<uint16_t>(
+							(i << 6) + std::countr_zero(word)));
+				}
+			}
+			else {
+				for (size_type i = 0; i < runCount(c); ++i)
+					for (uint32_t v = runFirst(c, i); v <= runLast(c, i); ++v)
+						values.insertBack(static_cast<uint16_t>(v));
+			}
+
+			c.values = std::move(values);
+			c.words = word_array(word_allocator(_chunks.allocator()));
+			c.type = chunk_type::ARRAY;
+		}
+
+		void toRun(chunk& c) {
+			low_array runs(low_allocator(_chunks.allocator()));
+			runs.reserve(runCountOf(c) * 2);
+
+			if (c.type == chunk_type::ARRAY) {
+				for (size_type i = 0; i < c.values.size(); ++i) {
+					if (i == 0 || c.values[i] != c.values[i - 1] + 1) {
+						runs.insertBack(c.values[i]);
+						runs.insertBack(c.values[i]);
+					}
+					else
+						runs.back() = c.values[i];
+				}
+			}
+			else {
+				uint32_t first = nextBit<true>(c.words, 0);
+				while (first < CHUNK_BITS) {
+					uint32_t next = nextBit<false>(c.words, first);
+					runs.insertBack(static_cast<uint16_t>(first));
+					runs.insertBack(static_cast<uint16_t>(next - 1));
+					first = nextBit<true>(c.words, next);
+				}
+			}
+
+			c.values = std::move(runs);
+			c.words = word_array(word_allocator(_chunks.allocator()));
+			c.type = chunk_type::RUN;
+		}
+
+		void makeMutable(chunk& c) {
+			if (c.type != chunk_type::RUN)
+				return;
+
+			if (c.cardinality <= ARRAY_LIMIT)
+				toArray(c);
+			else
+				toBitmap(c);
+		}
+
+		void onBitmapShrunk(chunk& c) {
+			c.cardinality = static_cast<uint32_t>(
+				collections::popcount(c.words.asRawPointer(), CHUNK_WORDS));
+			if (c.cardinality <= ARRAY_LIMIT)
+				toArray(c);
+		}
+
+		void uniteChunk(chunk& mine, const chunk& theirs) {
+			if (theirs.type == chunk_type::RUN) {
+				chunk copy = theirs;
+				makeMutable(copy);
+				uniteChunk(mine, copy);
+				return;
+			}
+
+			makeMutable(mine);
+
+			if (mine.type == chunk_type::ARRAY && theirs.type == chunk_type::ARRAY) {
+				if (mine.cardinality + theirs.cardinality <= ARRAY_LIMIT) {
+					mergeArrays(mine, theirs);
+					return;
+				}
+			}
+
+			if (mine.type == chunk_type::ARRAY)
+				toBitmap(mine);
+
+			if (theirs.type == chunk_type::BITMAP)
+				collections::bitwise_or(
+					mine.words.asRawPointer(),
+					theirs.words.asRawPointer(),
+					CHUNK_WORDS
+				);
+			else
+				for (auto low : theirs.values)
+					mine.words[low >> 6] |= uint64_t(1) << (low & 63);
+
+			mine.cardinality = static_cast<uint32_t>(
+				collections::popcount(mine.words.asRawPointer(), CHUNK_WORDS));
+		}
+
+		void mergeArrays(chunk& mine, const chunk& theirs) {
+			low_array merged(low_allocator(_chunks.allocator()));
+			merged.reserve(mine.cardinality + theirs.cardinality);
+
+			size_type i = 0, j = 0;
+			const low_array& a = mine.values;
+			const low_array& b = theirs.values;
+
+			while (i < a.size() && j < b.size()) {
+				if (a[i] < b[j])
+					merged.insertBack(a[i++]);
+				else if (b[j] < a[i])
+					merged.insertBack(b[j++]);
+				else {
+					merged.insertBack(a[i++]);
+					++j;
+				}
+			}
+
+			while (i < a.size())
+				merged.insertBack(a[i++]);
+			while (j < b.size())
+				merged.insertBack(b[j++]);
+
+			mine.cardinality = static_cast<uint32_t>(merged.size());
+			mine.values = std::move(merged);
+		}
+
+		void intersectChunk(chunk& mine, const chunk& theirs) {
+			if (theirs.type == chunk_type::RUN) {
+				chunk copy = theirs;
+				makeMutable(copy);
+				intersectChunk(mine, copy);
+				return;
+			}
+
+			makeMutable(mine);
+
+			if (mine.type == chunk_type::BITMAP && theirs.type == chunk_type::BITMAP) {
+				collections::bitwise_and(
+					mine.words.asRawPointer(),
+					theirs.words.asRawPointer(),
+					CHUNK_WORDS
+				);
+				onBitmapShrunk(mine);
+			}
+			else if (mine.type == chunk_type::BITMAP) {
+				low_array values(low_allocator(_chunks.allocator()));
+				values.reserve(theirs.values.size());
+
+				for (auto low : theirs.values)
+					if (testBit(mine.words, low))
+						values.insertBack(low);
+
+				mine.cardinality = static_cast<uint32_t>(values.size());
+				mine.values = std::move(values);
+				mine.words = word_array(word_allocator(_chunks.allocator()));
+				mine.type = chunk_type::ARRAY;
+			}
+			else if (theirs.type == chunk_type::BITMAP)
+				filterArray(mine, [&](uint16_t low) {
+					return testBit(theirs.words, low);
+				});
+			else {
+				size_type j = 0;
+				filterArray(mine, [&](uint16_t low) {
+					while (j < theirs.values.size() && theirs.values[j] < low)
+						++j;
+					return j < theirs.values.size() && theirs.values[j] == low;
+				});
+			}
+		}
+
+		void subtractChunk(chunk& mine, const chunk& theirs) {
+			if (theirs.type == chunk_type::RUN) {
+				chunk copy = theirs;
+				makeMutable(copy);
+				subtractChunk(mine, copy);
+				return;
+			}
+
+			makeMutable(mine);
+
+			if (mine.type == chunk_type::BITMAP) {
+				if (theirs.type == chunk_type::BITMAP)
+					collections::bitwise_andnot(
+						mine.words.asRawPointer(),
+						theirs.words.asRawPointer(),
+						CHUNK_WORDS
+					);
+				else
+					for (auto low : theirs.values)
+						mine.words[low >> 6] &= ~(uint64_t(1) << (low & 63));
+
+				onBitmapShrunk(mine);
+			}
+			else if (theirs.type == chunk_type::BITMAP)
+				filterArray(mine, [&](uint16_t low) {
+					return !testBit(theirs.words, low);
+				});
+			else {
+				size_type j = 0;
+				filterArray(mine, [&](uint16_t low) {
+					while (j < theirs.values.size() && theirs.values[j] < low)
+						++j;
+					return j == theirs.values.size() || theirs.values[j] != low;
+				});
+			}
+		}
+
+		template <class predicate>
+		void filterArray(chunk& c, predicate keep) {
+			size_type kept = 0;
+			for (size_type i = 0; i < c.values.size(); ++i)
+				if (keep(c.values[i]))
+					c.values[kept++] = c.values[i];
+
+			c.values.remove(c.values.begin() + kept, c.values.end());
+			c.cardinality = static_cast<uint32_t>(kept);
+		}
+
+		void keepChunk(size_type index, size_type& kept) {
+			if (_chunks[index].cardinality == 0)
+				return;
+			if (index != kept)
+				_chunks[kept] = std::move(_chunks[index]);
+			++kept;
+		}
+
+		void truncateChunks(size_type kept) {
+			_chunks.remove(_chunks.begin() + kept, _chunks.end());
+			recount();
+		}
+
+		// a chunk operation threw at index, which left that chunk whole, so 
+		// it and every chunk after it are kept and the moved-from chunks in 
+		// between are dropped.
+		void keepChunksFrom(size_type index, size_type kept) {
+			for (; index < _chunks.size(); ++index)
+				keepChunk(index, kept);
+
+			truncateChunks(kept);
+		}
+
+		void recount() noexcept {
+			_size = 0;
+			for (const auto& c : _chunks)
+				_size += c.cardinality;
+		}
+
+		iterator insertValue(value_type value) {
+			uint16_t high = highOf(value);
+			uint16_t low = lowOf(value);
+			size_type index = chunkLowerBound(high);
+
+			if (index == _chunks.size() || _chunks[index].key != high) {
+				chunk c = makeChunk(high);
+				c.values.insertBack(low);
+				c.cardinality = 1;
+				_chunks.insert(_chunks.begin() + index, std::move(c));
+				++_size;
+				return iterator(this, index, 0, value);
+			}
+
+			chunk& c = _chunks[index];
+			makeMutable(c);
+
+			if (c.type == chunk_type::ARRAY) {
+				size_type i = arrayLowerBound(c.values, low);
+				if (i < c.values.size() && c.values[i] == low)
+					return iterator(this, index, i, value);
+
+				if (c.cardinality < ARRAY_LIMIT) {
+					c.values.insert(c.values.begin() + i, low);
+					++c.cardinality;
+					++_size;
+					return iterator(this, index, i, value);
+				}
+
+				toBitmap(c);
+			}
+
+			uint64_t& word = c.words[low >> 6];
+			uint64_t mask = uint64_t(1) << (low & 63);
+
+			if (!(word & mask)) {
+				word |= mask;
+				++c.cardinality;
+				++_size;
+			}
+
+			return iterator(this, index, low, value);
+		}
+
+		bool removeValue(value_type value) {
+			uint16_t high = highOf(value);
+			uint16_t low = lowOf(value);
+			size_type index = chunkLowerBound(high);
+
+			if (index == _chunks.size() || _chunks[index].key != high)
+				return false;
+
+			chunk& c = _chunks[index];
+			if (!chunkContains(c, low))
+				return false;
+
+			makeMutable(c);
+
+			if (c.type == chunk_type::ARRAY)
+				c.values.remove(c.values.begin() + arrayLowerBound(c.values, low));
+			else
+				c.words[low >> 6] &= ~(uint64_t(1) << (low & 63));
+
+			--_size;
+			if (--c.cardinality == 0)
+				_chunks.remove(_chunks.begin() + index);
+			else if (c.type == chunk_type::BITMAP && c.cardinality <= ARRAY_LIMIT)
+				toArray(c);
+
+			return true;
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Forward iterator visiting the values of a CompressedIntSet in
+		/// ascending order. The position within a chunk is an array index,
+		/// a bit index, or a run index depending on the chunk's form.
+		/// </summary> --------------------------------------------------------
+		class CompressedIntSetIterator {
+		public:
+
+			using value_type		= CompressedIntSet::value_type;
+			using difference_type	= std::ptrdiff_t;
+			using pointer			= void;
+			using reference			= value_type;
+			using iterator_category	= std::forward_iterator_tag;
+
+		private:
+
+			const CompressedIntSet* _set;
+			size_type _chunk;
+			size_type _position;
+			value_type _value;
+
+			CompressedIntSetIterator(
+				const CompressedIntSet* set,
+				size_type chunk,
+				size_type position,
+				value_type value
+			) noexcept :
+				_set(set),
+				_chunk(chunk),
+				_position(position),
+				_value(value)
+			{
+
+			}
+
+			friend class CompressedIntSet;
+
+		public:
+
+			CompressedIntSetIterator() noexcept :
+				_set(nullptr),
+				_chunk(0),
+				_position(0),
+				_value(0)
+			{
+
+			}
+
+			reference operator*() const noexcept {
+				return _value;
+			}
+
+			CompressedIntSetIterator& operator++() noexcept {
+				const chunk& c = _set->_chunks[_chunk];
+
+				switch (c.type) {
+					case chunk_type::ARRAY:
+						if (++_position < c.values.size()) {
+							_value = valueOf(c.key, c.values[_position]);
+							return *this;
+						}
+						break;
+					case chunk_type::BITMAP: {
+						uint32_t bit = nextBit<true>(
+							c.words, static_cast<uint32_t>(_position) + 1);
+						if (bit < CHUNK_BITS) {
+							_position = bit;
+							_value = valueOf(c.key, bit);
+							return *this;
+						}
+						break;
+					}
+					default:
+						if (lowOf(_value) < runLast(c, _position)) {
+							++_value;
+							return *this;
+						}
+						if (++_position < runCount(c)) {
+							_value = valueOf(c.key, runFirst(c, _position));
+							return *this;
+						}
+						break;
+				}
+
+				*this = _set->chunkBegin(_chunk + 1);
+				return *this;
+			}
+
+			CompressedIntSetIterator operator++(int) noexcept {
+				auto copy = *this;
+				++(*this);
+				return copy;
+			}
+
+			friend bool operator==(
+				const CompressedIntSetIterator& lhs,
+				const CompressedIntSetIterator& rhs
+			) noexcept {
+				return lhs._chunk == rhs._chunk &&
+					lhs._position == rhs._position &&
+					lhs._value == rhs._value;
+			}
+		};
+	};
+
+	static_assert(
+		collection<CompressedIntSet<>>,
+		"CompressedIntSet does not meet the requirements for a collection."
+	);
+
+	static_assert(
+		associative<CompressedIntSet<>>,
+		"CompressedIntSet does not meet the requirements for associative access."
+	);
+
+	static_assert(
+		forward_iterable<CompressedIntSet<>>,
+		"CompressedIntSet does not meet the requirements for forward iteration."
+	);
+}
@@ -605,8 +605,10 @@ namespace collections {
 		/// </value> ----------------------------------------------------------
 		void resize(size_type size, const_reference value = value_type{}) {
 			reserve(size);
-			for (size_type i = this->size(); i < size; ++i)
-				constructElement(_end++, value);
+			for (size_type i = this->size(); i < size; ++i) {
+				constructElement(_end, value);
+				++_end;
+			}
 		}
 
 		// --------------------------------------------------------------------
@@ -1595,10 +1597,14 @@ namespace collections {
 			ensureCapacity();
 			pos = _begin + offset;
 
-			if (pos == _end)
-				constructElement(_end++, std::forward<T>(element));
+			// the end only moves past an element once it is constructed, so a
+			// throwing constructor leaves the array as it was.
+			if (pos == _end) {
+				constructElement(_end, std::forward<T>(element));
+				++_end;
+			}
 			else {
-				constructElement(_end, *(_end - 1));
+				constructElement(_end, std::move_if_noexcept(*(_end - 1)));
 				collections::shift(pos, _end++ - 1, 1);
 
 				if constexpr (std::assignable_from<value_type, T>)
@@ -1662,8 +1668,10 @@ namespace collections {
 			std::sentinel_for<fwd_iterator> sentinel
 		>
 		void constructAtEnd(fwd_iterator begin, sentinel end) {
-			while (begin != end)
-				constructElement(_end++, *begin++);
+			while (begin != end) {
+				constructElement(_end, *begin++);
+				++_end;
+			}
 		}
 
 		void ensureCapacity() {
@@ -17,13 +17,17 @@
 
 #pragma once
 
+#include <concepts>
 #include <exception>
+#include <functional>
 #include <initializer_list>
 #include <istream>
 #include <iterator>
+#include <limits>
 #include <memory>
 #include <ostream>
 #include <ranges>
+#include <span>
 #include <sstream>
 #include <type_traits>
 #include <utility>
@@ -38,6 +42,9 @@
 #include "../concepts/iterable.h"
 #include "../concepts/positional.h"
 #include "../concepts/sequential.h"
+#include "../util/NodeBatch.h"
+#include "../util/NodeCache.h"
+#include "../util/prefetch.h"
 
 namespace collections {
 
@@ -72,7 +79,9 @@ namespace collections {
 
 		using value_type		= element_t;
 		using allocator_type	= allocator_t;
-		using node_type			= Node<value_type, allocator_type, 1>;
+		using node_type			= Node<
+			value_type, allocator_type, 1, batch_tag_edge<allocator_type>
+		>;
 		using size_type			= alloc_traits::size_type;
 		using difference_type	= alloc_traits::difference_type;
 		using pointer			= alloc_traits::pointer;
@@ -94,6 +103,9 @@ namespace collections {
 		using const_node_ptr		= node_type::const_base_ptr;
 		using list_node_ptr			= node_alloc_traits::pointer;
 		using const_list_node_ptr	= node_alloc_traits::const_pointer;
+		using node_batches			= NodeBatches<node_type, allocator_type>;
+		using node_cache			= NodeCache<node_type, allocator_type>;
+		using node_sentinel			= SentinelNode<node_base, allocator_type>;
 
 		constexpr static auto next = 0u;
 
@@ -106,14 +118,16 @@ namespace collections {
 		///	<para>
 		/// Constructs an empty ForwardList.
 		/// </para></summary> -------------------------------------------------
-		constexpr ForwardList()
-			noexcept(std::is_nothrow_default_constructible_v<allocator_type>) :
-			_sentinel(),
-			_tail(&_sentinel),
+		constexpr ForwardList() noexcept(
+			std::is_nothrow_default_constructible_v<allocator_type> &&
+			std::is_nothrow_constructible_v<node_sentinel, const allocator_type&>
+		) :
+			_sentinel(allocator_type{}),
+			_tail(_sentinel.get()),
 			_size(),
 			_allocator(allocator_type{})
 		{
-			_sentinel.to(next) = _tail;
+			_sentinel->to(next) = _tail;
 		}
 
 		// --------------------------------------------------------------------
@@ -127,14 +141,18 @@ namespace collections {
 		/// <param name="alloc">
 		/// The allocator instance used by the list.
 		/// </param> ----------------------------------------------------------
-		constexpr explicit ForwardList(const allocator_type& alloc)
-			noexcept(std::is_nothrow_copy_constructible_v<allocator_type>) :
-			_sentinel(),
-			_tail(&_sentinel),
+		constexpr explicit ForwardList(const allocator_type& alloc) noexcept(
+			std::is_nothrow_copy_constructible_v<allocator_type> &&
+			std::is_nothrow_constructible_v<node_sentinel, const allocator_type&>
+		) :
+			_sentinel(alloc),
+			_tail(_sentinel.get()),
 			_size(),
-			_allocator(alloc)
+			_allocator(alloc),
+			_batches(alloc),
+			_cache(alloc)
 		{
-			_sentinel.to(next) = _tail;
+			_sentinel->to(next) = _tail;
 		}
 
 		// --------------------------------------------------------------------
@@ -168,12 +186,16 @@ namespace collections {
 		/// <param name="other">
 		/// The ForwardList to be moved into this one.
 		/// </param> ----------------------------------------------------------
-		ForwardList(ForwardList&& other) 
-			noexcept(std::is_nothrow_move_constructible_v<allocator_type>) : 
+		ForwardList(ForwardList&& other) noexcept(
+			std::is_nothrow_move_constructible_v<allocator_type> &&
+			std::is_nothrow_move_constructible_v<node_sentinel>
+		) : 
 			_sentinel(std::move(other._sentinel)),
 			_tail(std::move(other._tail)),
 			_size(std::move(other._size)),
-			_allocator(std::move(other._allocator))
+			_allocator(std::move(other._allocator)),
+			_batches(std::move(other._batches)),
+			_cache(std::move(other._cache))
 		{
 			onMove(std::move(other));
 		}
@@ -299,6 +321,7 @@ namespace collections {
 		/// </para></summary> -------------------------------------------------
 		~ForwardList() {
 			clear();
+			releaseNodes();
 		}
 
 		// --------------------------------------------------------------------
@@ -323,8 +346,14 @@ namespace collections {
 				alloc_traits::propagate_on_container_copy_assignment::value;
 			bool isInstanceEqual = _allocator == other._allocator;
 
-			if (!isAlwaysEqual && !isInstanceEqual && willPropagate) 
+			if (!isAlwaysEqual && !isInstanceEqual && willPropagate) {
+				clear();
+				releaseNodes();
+				_sentinel = node_sentinel(other._allocator);
 				_allocator = other._allocator;
+				_tail = _sentinel.get();
+				_sentinel->to(next) = _tail;
+			}
 
 			elementWiseCopy(other);
 			return *this;
@@ -360,8 +389,9 @@ namespace collections {
 			} 
 			else if (willPropagate) {
 				clear();
-				_allocator = std::move(other._allocator);
+				releaseNodes();
 				moveMembers(std::move(other));
+				_allocator = std::move(other._allocator);
 			}
 			else
 				elementWiseCopy(std::move(other));
@@ -449,6 +479,53 @@ namespace collections {
 			remove(begin(), end());
 		}
 
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Keeps enough node storage for the list to hold the given number of
+		/// elements without allocating. Missing nodes are allocated up front,
+		/// and from then on clear() and remove() park up to count nodes for 
+		/// later inserts to reuse instead of freeing them.
+		/// </summary>
+		/// 
+		/// <param name="count">
+		/// The number of elements the list should hold without allocating.
+		/// </param> ----------------------------------------------------------
+		void reserveNodes(size_type count) {
+			_cache.reserve(count);
+
+			size_type available = size() + _cache.size();
+			if (count <= available)
+				return;
+
+			size_type missing = count - available;
+
+			while (node_batches::isWorthBatching(missing)) {
+				std::span<node_type> nodes = _batches.allocate(missing);
+				for (node_type& n : nodes)
+					(void)_cache.park(std::addressof(n), true);
+				missing -= nodes.size();
+			}
+
+			_batches.reset();
+
+			for (; missing > 0; --missing) {
+				node_type* n = node_alloc_traits::allocate(_allocator, 1);
+				(void)_cache.park(n, false);
+			}
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Frees the nodes parked for reuse. The reserved count is kept, so 
+		/// later removals park nodes again.
+		/// </summary> --------------------------------------------------------
+		void releaseNodes() noexcept {
+			_cache.release(_allocator, _batches);
+
+			if (isEmpty())
+				_batches.reset();
+		}
+
 		// --------------------------------------------------------------------
 		/// <summary>
 		/// Returns the number of elements contained by the list.
@@ -471,7 +548,7 @@ namespace collections {
 		/// list.
 		/// </returns> --------------------------------------------------------
 		[[nodiscard]] iterator begin() noexcept {
-			return iterator(&_sentinel);
+			return iterator(_sentinel.get());
 		}
 
 		// --------------------------------------------------------------------
@@ -498,7 +575,7 @@ namespace collections {
 		/// the list.
 		/// </returns> --------------------------------------------------------
 		[[nodiscard]] const_iterator begin() const noexcept {
-			return const_iterator(&_sentinel);
+			return const_iterator(_sentinel.get());
 		}
 
 		// --------------------------------------------------------------------
@@ -550,7 +627,7 @@ namespace collections {
 		/// list.
 		/// </returns> --------------------------------------------------------
 		[[nodiscard]] stable_iterator stable_begin() noexcept {
-			return stable_iterator(_sentinel.to(next));
+			return stable_iterator(_sentinel->to(next));
 		}
 
 		// --------------------------------------------------------------------
@@ -563,7 +640,7 @@ namespace collections {
 		/// element in the list.
 		/// </returns> --------------------------------------------------------
 		[[nodiscard]] stable_iterator stable_end() noexcept {
-			return stable_iterator(&_sentinel);
+			return stable_iterator(_sentinel.get());
 		}
 
 		// --------------------------------------------------------------------
@@ -576,7 +653,7 @@ namespace collections {
 		/// list.
 		/// </returns> --------------------------------------------------------
 		[[nodiscard]] const_stable_iterator stable_begin() const noexcept {
-			return const_stable_iterator(_sentinel.to(next));
+			return const_stable_iterator(_sentinel->to(next));
 		}
 
 		// --------------------------------------------------------------------
@@ -589,7 +666,7 @@ namespace collections {
 		/// last element in the list.
 		/// </returns> --------------------------------------------------------
 		[[nodiscard]] const_stable_iterator stable_end() const noexcept {
-			return const_stable_iterator(&_sentinel);
+			return const_stable_iterator(_sentinel.get());
 		}
 
 		// --------------------------------------------------------------------
@@ -601,7 +678,7 @@ namespace collections {
 		/// Returns a reference to the first element in the list.
 		/// </returns> --------------------------------------------------------
 		[[nodiscard]] reference front() {
-			return _sentinel.to(next)->value();
+			return _sentinel->to(next)->value();
 		}
 
 		// --------------------------------------------------------------------
@@ -613,7 +690,7 @@ namespace collections {
 		/// Returns a constant reference to the first element in the list.
 		/// </returns> --------------------------------------------------------
 		[[nodiscard]] const_reference front() const {
-			return _sentinel.to(next)->value();
+			return _sentinel->to(next)->value();
 		}
 
 		// --------------------------------------------------------------------
@@ -691,7 +768,7 @@ namespace collections {
 		/// Returns an iterator to the inserted element.
 		/// </returns> ---------------------------------------------------------
 		iterator insertFront(const_reference element) {
-			return insertAt(&_sentinel, element);
+			return insertAt(_sentinel.get(), element);
 		}
 
 		// --------------------------------------------------------------------
@@ -707,7 +784,7 @@ namespace collections {
 		/// Returns an iterator to the inserted element.
 		/// </returns> ---------------------------------------------------------
 		iterator insertFront(value_type&& element) {
-			return insertAt(&_sentinel, std::move(element));
+			return insertAt(_sentinel.get(), std::move(element));
 		}
 
 		// --------------------------------------------------------------------
@@ -1033,7 +1110,7 @@ namespace collections {
 		/// Removes the first element in the list.
 		/// </summary> --------------------------------------------------------
 		void removeFront() {
-			remove(&_sentinel);
+			remove(_sentinel.get());
 		}
 
 		// --------------------------------------------------------------------
@@ -1042,7 +1119,7 @@ namespace collections {
 		/// iterating through the list and calling remove(position).
 		/// </summary> --------------------------s------------------------------
 		void removeBack() {
-			node_ptr n = &_sentinel;
+			node_ptr n = _sentinel.get();
 			while (n->to(next) != _tail)
 				n = n->to(next);
 			remove(n);
@@ -1097,7 +1174,7 @@ namespace collections {
 		/// </returns> ---------------------------------------------------------
 		template <class ...Args>
 		iterator emplaceFront(Args&&... args) {
-			return insertAt(&_sentinel, std::forward<Args>(args)...);
+			return insertAt(_sentinel.get(), std::forward<Args>(args)...);
 		}
 
 		// --------------------------------------------------------------------
@@ -1215,7 +1292,7 @@ namespace collections {
 			const_iterator end
 		) {
 			size_type dist = std::distance(begin, end);
-			auto head = begin.node()->to(next);
+			node_ptr head = begin.node()->to(next);
 			other.snip(begin.node(), end.node());
 			splice(position.node(), head, end.node());
 			other._size -= dist;
@@ -1245,13 +1322,194 @@ namespace collections {
 			const_stable_iterator end
 		) {
 			size_type dist = std::distance(begin, end);
-			auto head = begin.node()->to(next);
+			node_ptr head = begin.node()->to(next);
 			other.snip(begin.node(), end.node());
 			splice(position.node(), head, end.node());
 			other._size -= dist;
 			_size += dist;
 		}
 
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Sorts the list in place using a stable bottom-up merge sort. Only
+		/// node links are rewritten, so no elements are copied or moved, no
+		/// memory is allocated, and stable iterators remain valid. If the 
+		/// comparison throws, every element is kept in the list in an 
+		/// unspecified order.
+		/// </summary>
+		/// 
+		/// <typeparam name="compare_t">
+		/// The type of the strict weak ordering used to compare elements.
+		/// </typeparam>
+		/// 
+		/// <param name="compare">
+		/// The ordering returning true if its first argument belongs before
+		/// its second.
+		/// </param> ----------------------------------------------------------
+		template <class compare_t = std::less<value_type>>
+			requires std::predicate<compare_t&, const_reference, const_reference>
+		void sort(compare_t compare = {}) {
+			if (_size < 2)
+				return;
+
+			node_ptr chain = _sentinel->to(next);
+			_tail->to(next) = nullptr;
+
+			try {
+				chain = sortChain(chain, compare);
+			}
+			catch (...) {
+				relinkChain(chain);
+				throw;
+			}
+
+			relinkChain(chain);
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Merges the given sorted list into this sorted list in linear time,
+		/// leaving the other list empty. Nodes are spliced rather than 
+		/// copied, and equal elements from this list stay ahead of those from
+		/// the other list. If the comparison throws, each element stays in 
+		/// one of the two lists and both remain sorted.
+		/// </summary>
+		/// 
+		/// <typeparam name="compare_t">
+		/// The type of the strict weak ordering both lists are sorted by.
+		/// </typeparam>
+		/// 
+		/// <param name="other">
+		/// The sorted list to merge into this one.
+		/// </param>
+		/// 
+		/// <param name="compare">
+		/// The ordering returning true if its first argument belongs before
+		/// its second.
+		/// </param>
+		/// 
+		/// <remarks>
+		/// Nodes can only be spliced between lists with equal allocators. 
+		/// Otherwise the elements of other are first moved into nodes from 
+		/// this list's allocator.
+		/// </remarks> --------------------------------------------------------
+		template <class compare_t = std::less<value_type>>
+			requires std::predicate<compare_t&, const_reference, const_reference>
+		void merge(ForwardList& other, compare_t compare = {}) {
+			if (&other == this)
+				return;
+
+			if constexpr (!alloc_traits::is_always_equal::value) {
+				if (_allocator != other._allocator) {
+					ForwardList moved(
+						std::make_move_iterator(other.begin()),
+						std::make_move_iterator(other.end()),
+						_allocator
+					);
+					other.clear();
+					merge(moved, compare);
+					return;
+				}
+			}
+
+			node_ptr before = _sentinel.get();
+			node_ptr otherEnd = other._sentinel.get();
+
+			while (other._sentinel->to(next) != otherEnd) {
+				node_ptr first = other._sentinel->to(next);
+
+				while (before->to(next) != _sentinel.get() && 
+					!compare(first->value(), before->to(next)->value()))
+					before = before->to(next);
+
+				// sizes move with each run, so a throwing comparison leaves
+				// both counts right.
+				node_ptr last = first;
+				size_type count = 1;
+
+				if (before->to(next) == _sentinel.get()) {
+					last = other._tail;
+					count = other._size;
+				}
+				else {
+					node_ptr bound = before->to(next);
+					while (last->to(next) != otherEnd && 
+						compare(last->to(next)->value(), bound->value())) {
+						last = last->to(next);
+						++count;
+					}
+				}
+
+				other.snip(otherEnd, last);
+				splice(before, first, last);
+				other._size -= count;
+				_size += count;
+				before = last;
+			}
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Removes all but the first element from every run of consecutive
+		/// equal elements in the list.
+		/// </summary>
+		/// 
+		/// <typeparam name="equality_t">
+		/// The type of the predicate used to compare elements.
+		/// </typeparam>
+		/// 
+		/// <param name="equal">
+		/// The predicate returning true if two elements are equal.
+		/// </param>
+		/// 
+		/// <returns>
+		/// Returns the number of elements removed.
+		/// </returns> --------------------------------------------------------
+		template <class equality_t = std::equal_to<value_type>>
+			requires std::predicate<equality_t&, const_reference, const_reference>
+		size_type unique(equality_t equal = {}) {
+			size_type initialSize = _size;
+			node_ptr n = _sentinel->to(next);
+
+			while (n != _sentinel.get()) {
+				node_ptr last = n;
+				while (last->to(next) != _sentinel.get() && 
+					equal(n->value(), last->to(next)->value()))
+					last = last->to(next);
+
+				if (last != n)
+					remove(n, last);
+
+				n = n->to(next);
+			}
+
+			return initialSize - _size;
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Reverses the order of the elements in the list by redirecting the
+		/// link of every node. Stable iterators remain valid.
+		/// </summary> --------------------------------------------------------
+		void reverse() noexcept {
+			if (_size < 2)
+				return;
+
+			node_ptr first = _sentinel->to(next);
+			node_ptr last = _sentinel.get();
+			node_ptr n = first;
+
+			while (n != _sentinel.get()) {
+				node_ptr following = n->to(next);
+				n->to(next) = last;
+				last = n;
+				n = following;
+			}
+
+			_sentinel->to(next) = last;
+			_tail = first;
+		}
+
 		// --------------------------------------------------------------------
 		/// <summary> 
 		/// Swaps the contents of the given ForwardLists.
@@ -1421,9 +1679,11 @@ namespace collections {
 
 		[[no_unique_address, msvc::no_unique_address]] //TODO define macro for correct attr depending on compiler
 		node_allocator_type _allocator;
-		node_base _sentinel;
+		node_sentinel _sentinel;
 		node_ptr _tail;
 		size_type _size;
+		node_batches _batches;
+		node_cache _cache;
 
 		struct node_chain {
 			size_type count = 0;
@@ -1433,17 +1693,37 @@ namespace collections {
 
 		template <class... Args>
 		[[nodiscard]] node_ptr createNode(Args&&... args) {
-			node_type* n = node_alloc_traits::allocate(_allocator, 1);
-			node_alloc_traits::construct(
-				_allocator, n, std::in_place_t{}, std::forward<Args>(args)...);
+			bool isBatched = false;
+			node_type* n = _cache.take(isBatched);
+			if (!n)
+				n = node_alloc_traits::allocate(_allocator, 1);
+
+			try {
+				node_alloc_traits::construct(
+					_allocator, n, std::in_place_t{}, std::forward<Args>(args)...);
+			}
+			catch (...) {
+				freeNode(n, isBatched);
+				throw;
+			}
+
+			if (isBatched)
+				node_batches::mark(n);
+
 			return n;
 		}
 
 		void destroyNode(node_ptr n) {
-			node_alloc_traits::destroy(
-				_allocator, static_cast<list_node_ptr>(n));
-			node_alloc_traits::deallocate(
-				_allocator, static_cast<list_node_ptr>(n), 1);
+			list_node_ptr node = static_cast<list_node_ptr>(n);
+			bool isBatched = node_batches::isBatched(node);
+			node_alloc_traits::destroy(_allocator, std::addressof(node->value()));
+			node_alloc_traits::destroy(_allocator, node);
+			freeNode(node, isBatched);
+		}
+
+		void freeNode(list_node_ptr node, bool isBatched) noexcept {
+			if (!_cache.park(node, isBatched))
+				_batches.deallocate(_allocator, node, isBatched);
 		}
 
 
@@ -1455,6 +1735,12 @@ namespace collections {
 			if (begin == end)
 				return { 0, nullptr, nullptr };
 
+			if constexpr (std::forward_iterator<in_iterator>) {
+				auto count = static_cast<size_type>(std::ranges::distance(begin, end));
+				if (node_batches::isWorthBatching(count) && count > _cache.size())
+					return createBatchChain(begin, count);
+			}
+
 			size_type count = 0;
 			node_ptr head = nullptr;
 			node_ptr tail = nullptr;
@@ -1472,32 +1758,227 @@ namespace collections {
 				}
 			}
 			catch (...) {
-				destroy(head, tail);
+				// the tail of a chain still has the null link it was built with
+				destroy(head, nullptr);
 				throw;
 			}
 
 			return { count, head, tail };
 		}
 
+		// builds the chain from runs of nodes carved from blocks, so only
+		// chains longer than a block are split across blocks. The list stops
+		// carving once the chain is built, so it keeps no half empty block.
+		template <std::input_iterator in_iterator>
+		node_chain createBatchChain(in_iterator begin, size_type count) {
+			node_chain chain;
+
+			try {
+				while (node_batches::isWorthBatching(count - chain.count)) {
+					std::span<node_type> nodes = 
+						_batches.allocate(count - chain.count);
+					constructRun(nodes, begin);
+
+					for (size_type i = 1; i < nodes.size(); ++i)
+						nodes[i - 1].to(next) = &nodes[i];
+
+					if (chain.tail)
+						chain.tail->to(next) = &nodes.front();
+					else
+						chain.head = &nodes.front();
+
+					chain.tail = &nodes.back();
+					chain.count += nodes.size();
+				}
+
+				// a remainder too short to fill most of a block is allocated
+				// node by node.
+				for (; chain.count < count; ++chain.count) {
+					node_ptr n = createNode(*begin++);
+					chain.tail->to(next) = n;
+					chain.tail = n;
+				}
+			}
+			catch (...) {
+				// the tail of a chain still has the null link it was built with
+				destroy(chain.head, nullptr);
+				_batches.reset();
+				throw;
+			}
+
+			_batches.reset();
+			return chain;
+		}
+
+		template <std::input_iterator in_iterator>
+		void constructRun(std::span<node_type> nodes, in_iterator& begin) {
+			size_type i = 0;
+
+			try {
+				for (; i < nodes.size(); ++i) {
+					node_alloc_traits::construct(
+						_allocator, &nodes[i], std::in_place_t{}, *begin++);
+					node_batches::mark(&nodes[i]);
+				}
+			}
+			catch (...) {
+				// the block is freed along with the last of its nodes
+				for (size_type j = 0; j < nodes.size(); ++j) {
+					if (j < i)
+						destroyNode(&nodes[j]);
+					else
+						freeNode(&nodes[j], true);
+				}
+				throw;
+			}
+		}
+
+		// merges the chains a and b, consuming both. If the comparison 
+		// throws, every node of both is left chained from a instead.
+		template <class compare_t>
+		[[nodiscard]] static node_ptr mergeChains(
+			node_ptr& a, 
+			node_ptr& b, 
+			compare_t& compare
+		) {
+			node_ptr head = nullptr;
+			node_ptr tail = nullptr;
+
+			try {
+				while (a && b) {
+					node_ptr n = nullptr;
+					if (compare(b->value(), a->value())) {
+						n = b;
+						b = b->to(next);
+					}
+					else {
+						n = a;
+						a = a->to(next);
+					}
+					append(head, tail, n);
+				}
+			}
+			catch (...) {
+				if (tail)
+					tail->to(next) = nullptr;
+
+				a = concatChains(head, concatChains(a, b));
+				b = nullptr;
+				throw;
+			}
+
+			append(head, tail, a ? a : b);
+			a = nullptr;
+			b = nullptr;
+			return head;
+		}
+
+		static node_ptr concatChains(node_ptr a, node_ptr b) noexcept {
+			if (!a)
+				return b;
+
+			node_ptr last = a;
+			while (last->to(next))
+				last = last->to(next);
+
+			last->to(next) = b;
+			return a;
+		}
+
+		static void append(node_ptr& head, node_ptr& tail, node_ptr n) noexcept {
+			if (tail)
+				tail->to(next) = n;
+			else
+				head = n;
+			tail = n;
+		}
+
+		// sorts the chain starting at head, consuming it. If the comparison
+		// throws, every node is chained back onto head in no particular 
+		// order, so the caller can put them back in the list.
+		template <class compare_t>
+		[[nodiscard]] static node_ptr sortChain(node_ptr& head, compare_t& compare) {
+			// bins[i] holds a sorted run of 2^i nodes, and runs in higher 
+			// bins hold earlier nodes, so merging them as the left operand
+			// keeps the sort stable.
+			constexpr auto MAX_BINS = std::numeric_limits<size_type>::digits;
+			node_ptr bins[MAX_BINS] = {};
+			node_ptr result = nullptr;
+			size_type filled = 0;
+
+			try {
+				while (head) {
+					node_ptr run = head;
+					head = head->to(next);
+					run->to(next) = nullptr;
+
+					size_type i = 0;
+					for (; i < filled && bins[i]; ++i)
+						run = mergeChains(bins[i], run, compare);
+
+					if (i == filled)
+						++filled;
+					bins[i] = run;
+				}
+
+				for (size_type i = 0; i < filled; ++i) {
+					if (!bins[i])
+						continue;
+
+					if (result)
+						result = mergeChains(bins[i], result, compare);
+					else
+						result = std::exchange(bins[i], nullptr);
+				}
+			}
+			catch (...) {
+				for (node_ptr bin : bins)
+					head = concatChains(bin, head);
+
+				head = concatChains(result, head);
+				throw;
+			}
+
+			return result;
+		}
+
+		void relinkChain(node_ptr head) noexcept {
+			node_ptr last = _sentinel.get();
+
+			while (head) {
+				last->to(next) = head;
+				last = head;
+				head = head->to(next);
+			}
+
+			last->to(next) = _sentinel.get();
+			_tail = last;
+		}
+
 		void fixLinkLoops(ForwardList& a, ForwardList& b) {
-			if (a._sentinel.to(next) == &b._sentinel)
-				a._sentinel.to(next) = &a._sentinel;
-			if (a._tail == &b._sentinel)
-				a._tail = &a._sentinel;
-			a._tail->to(next) = &a._sentinel;
+			if (a._sentinel->to(next) == b._sentinel.get())
+				a._sentinel->to(next) = a._sentinel.get();
+			if (a._tail == b._sentinel.get())
+				a._tail = a._sentinel.get();
+			a._tail->to(next) = a._sentinel.get();
 		}
 
 		void onMove(ForwardList&& other) noexcept {
 			fixLinkLoops(*this, other);
-			other._sentinel.to(next) = &other._sentinel;
-			other._tail = &other._sentinel;
+			other._sentinel->to(next) = other._sentinel.get();
+			other._tail = other._sentinel.get();
 			other._size = 0;
 		}
 
-		void moveMembers(ForwardList&& other) noexcept {
+		void moveMembers(ForwardList&& other) 
+			noexcept(std::is_nothrow_move_assignable_v<node_sentinel>) 
+		{
+			releaseNodes();
 			_sentinel = std::move(other._sentinel);
 			_tail = std::move(other._tail);
 			_size = std::move(other._size);
+			_batches = std::move(other._batches);
+			_cache = std::move(other._cache);
 			onMove(std::move(other));
 		}
 
@@ -1506,6 +1987,8 @@ namespace collections {
 			swap(_sentinel, other._sentinel);
 			swap(_tail, other._tail);
 			swap(_size, other._size);
+			_batches.swap(other._batches);
+			_cache.swap(other._cache);
 			fixLinkLoops(*this, other);
 			fixLinkLoops(other, *this);
 		};
@@ -1517,7 +2000,7 @@ namespace collections {
 
 		[[nodiscard]] const_node_ptr getNodeBefore(size_type index) const {
 			if (index == 0)
-				return &_sentinel;
+				return _sentinel.get();
 			else
 				return getNodeAt(index - 1);
 		}
@@ -1528,7 +2011,7 @@ namespace collections {
 		}
 
 		[[nodiscard]] const_node_ptr getNodeAt(size_type index) const {
-			const_node_ptr n = _sentinel.to(next);
+			const_node_ptr n = _sentinel->to(next);
 			for (size_type i = 0; i < index; ++i)
 				n = n->to(next);
 			return n;
@@ -1619,6 +2102,10 @@ namespace collections {
 			node_ptr end = tail->to(next);
 			snip(head, tail);
 			_size -= destroy(begin, end);
+
+			if (!_size)
+				_batches.reset();
+
 			return iterator(head);
 		}
 
@@ -1790,6 +2277,16 @@ namespace collections {
 				return &_node->to(next)->value();
 			}
 
+			// -----------------------------------------------------------------
+			/// <summary>
+			/// Prefetches the node holding the element the next increment 
+			/// will move to, so that its load overlaps with work on the 
+			/// current element.
+			/// </summary> -----------------------------------------------------
+			void prefetch() const noexcept {
+				collections::prefetch(_node->to(next)->to(next));
+			}
+
 			// -----------------------------------------------------------------
 			/// <summary>
 			/// ~~~ Pre-Increment Operator ~~~
@@ -1972,6 +2469,15 @@ namespace collections {
 				return &_node->value();
 			}
 
+			// -----------------------------------------------------------------
+			/// <summary>
+			/// Prefetches the node the next increment will move to, so that
+			/// its load overlaps with work on the current element.
+			/// </summary> -----------------------------------------------------
+			void prefetch() const noexcept {
+				collections::prefetch(_node->to(next));
+			}
+
 			// -----------------------------------------------------------------
 			/// <summary>
 			/// ~~~ Pre-Increment Operator ~~~
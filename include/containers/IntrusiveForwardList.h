@@ -0,0 +1,761 @@
+/* ============================================================================
+ * Copyright (C) 2023 Ryan Eubank
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ * ========================================================================= */
+
+#pragma once
+
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "../concepts/collection.h"
+#include "../concepts/iterable.h"
+#include "../util/member_offset.h"
+
+namespace collections {
+
+	// -------------------------------------------------------------------------
+	/// <summary>
+	/// IntrusiveForwardListHook holds the link of an object stored in an 
+	/// IntrusiveForwardList. Copying an object never copies its list 
+	/// membership, so a copied hook always starts unlinked.
+	/// </summary> -------------------------------------------------------------
+	class IntrusiveForwardListHook {
+	public:
+
+		IntrusiveForwardListHook() noexcept = default;
+		IntrusiveForwardListHook(const IntrusiveForwardListHook&) noexcept {}
+		IntrusiveForwardListHook& operator=(
+			const IntrusiveForwardListHook&
+		) noexcept { 
+			return *this; 
+		}
+
+		// ---------------------------------------------------------------------
+		/// <summary>
+		/// Returns true if the hook is currently linked into a list.
+		/// </summary> ---------------------------------------------------------
+		[[nodiscard]] bool isLinked() const noexcept {
+			return _next != nullptr;
+		}
+
+	private:
+
+		IntrusiveForwardListHook* _next = nullptr;
+
+		template <class T, IntrusiveForwardListHook T::* hook>
+		friend class IntrusiveForwardList;
+	};
+
+	// -------------------------------------------------------------------------
+	/// <summary>
+	/// IntrusiveForwardList is a singly linked list whose link lives inside 
+	/// the objects it stores. The list never allocates, copies or destroys
+	/// its elements: it only links objects whose lifetime the caller already
+	/// manages. An object must be removed from the list before it is 
+	/// destroyed.
+	///
+	/// <para>
+	/// Like ForwardList, iterators refer to the link before their element, so 
+	/// inserting or removing at an iterator is O(1) and end() is an iterator
+	/// to the last link. Removing an object by reference has to find the 
+	/// link before it and is O(n). Elements are inserted by reference and 
+	/// there are no emplace methods, since the list never creates objects.
+	/// </para>
+	/// </summary>
+	///
+	/// <typeparam name="T">
+	/// The type of the objects linked by the list.
+	/// </typeparam> 
+	/// 
+	/// <typeparam name="hook">
+	/// Pointer to the IntrusiveForwardListHook member of T used by this list.
+	/// </typeparam> -----------------------------------------------------------
+	template <class T, IntrusiveForwardListHook T::* hook>
+	class IntrusiveForwardList {
+	private:
+
+		template <bool isConst>
+		class IntrusiveForwardListIterator;
+
+		using hook_type = IntrusiveForwardListHook;
+
+	public:
+
+		using value_type		= T;
+		using size_type			= std::size_t;
+		using difference_type	= std::ptrdiff_t;
+		using pointer			= value_type*;
+		using const_pointer		= const value_type*;
+		using reference			= value_type&;
+		using const_reference	= const value_type&;
+
+		using iterator			= IntrusiveForwardListIterator<false>;
+		using const_iterator	= IntrusiveForwardListIterator<true>;
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// ~~~ Default Constructor ~~~
+		/// 
+		/// <para>
+		/// Constructs an empty list.
+		/// </para></summary> -------------------------------------------------
+		IntrusiveForwardList() noexcept : _sentinel(), _tail(), _size() {
+			resetSentinel();
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// ~~~ Range Constructor ~~~
+		/// 
+		/// <para>
+		/// Constructs a list linking every object in the given range in 
+		/// order.
+		/// </para></summary>
+		/// 
+		/// <param name="begin">
+		/// The iterator to the first object to link.
+		/// </param>
+		/// 
+		/// <param name="end">
+		/// The sentinel marking the end of the range.
+		/// </param> ----------------------------------------------------------
+		template <
+			std::input_iterator in_iterator,
+			std::sentinel_for<in_iterator> sentinel
+		> requires std::same_as<std::iter_reference_t<in_iterator>, reference>
+		IntrusiveForwardList(in_iterator begin, sentinel end) 
+			: IntrusiveForwardList() 
+		{
+			insert(this->end(), begin, end);
+		}
+
+		IntrusiveForwardList(const IntrusiveForwardList&) = delete;
+		IntrusiveForwardList& operator=(const IntrusiveForwardList&) = delete;
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// ~~~ Move Constructor ~~~
+		/// 
+		/// <para>
+		/// Takes over every object linked into the other list, leaving it 
+		/// empty.
+		/// </para></summary>
+		/// 
+		/// <param name="other">
+		/// The list to move from.
+		/// </param> ----------------------------------------------------------
+		IntrusiveForwardList(IntrusiveForwardList&& other) noexcept 
+			: IntrusiveForwardList() 
+		{
+			swap(other);
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// ~~~ Move Assignment Operator ~~~
+		/// 
+		/// <para>
+		/// Unlinks this list's objects and takes over every object linked 
+		/// into the other list, leaving it empty.
+		/// </para></summary>
+		/// 
+		/// <param name="other">
+		/// The list to move from.
+		/// </param> ----------------------------------------------------------
+		IntrusiveForwardList& operator=(IntrusiveForwardList&& other) noexcept {
+			if (&other != this) {
+				clear();
+				swap(other);
+			}
+
+			return *this;
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// ~~~ Destructor ~~~
+		/// 
+		/// <para>
+		/// Unlinks every object in the list without destroying them.
+		/// </para></summary> -------------------------------------------------
+		~IntrusiveForwardList() {
+			clear();
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Returns the number of objects linked into the list.
+		/// </summary> --------------------------------------------------------
+		[[nodiscard]] size_type size() const noexcept {
+			return _size;
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Returns the maximum number of objects the list can link.
+		/// </summary> --------------------------------------------------------
+		[[nodiscard]] size_type max_size() const noexcept {
+			return std::numeric_limits<difference_type>::max();
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Returns true if no objects are linked into the list.
+		/// </summary> --------------------------------------------------------
+		[[nodiscard]] bool isEmpty() const noexcept {
+			return !(_size);
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Unlinks every object from the list without destroying them.
+		/// </summary> --------------------------------------------------------
+		void clear() noexcept {
+			hook_type* h = _sentinel._next;
+
+			while (h != &_sentinel) {
+				hook_type* following = h->_next;
+				h->_next = nullptr;
+				h = following;
+			}
+
+			resetSentinel();
+			_size = 0;
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Returns an iterator to the first object in the list.
+		/// </summary> --------------------------------------------------------
+		[[nodiscard]] iterator begin() noexcept {
+			return iterator(&_sentinel);
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Returns a const iterator to the first object in the list.
+		/// </summary> --------------------------------------------------------
+		[[nodiscard]] const_iterator begin() const noexcept {
+			return const_iterator(&_sentinel);
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Returns a const iterator to the first object in the list.
+		/// </summary> --------------------------------------------------------
+		[[nodiscard]] const_iterator cbegin() const noexcept {
+			return begin();
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Returns an iterator past the last object in the list.
+		/// </summary> --------------------------------------------------------
+		[[nodiscard]] iterator end() noexcept {
+			return iterator(_tail);
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Returns a const iterator past the last object in the list.
+		/// </summary> --------------------------------------------------------
+		[[nodiscard]] const_iterator end() const noexcept {
+			return const_iterator(_tail);
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Returns a const iterator past the last object in the list.
+		/// </summary> --------------------------------------------------------
+		[[nodiscard]] const_iterator cend() const noexcept {
+			return end();
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Returns the first object in the list.
+		/// </summary> --------------------------------------------------------
+		[[nodiscard]] reference front() {
+			return ownerOf(_sentinel._next);
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Returns the first object in the list.
+		/// </summary> --------------------------------------------------------
+		[[nodiscard]] const_reference front() const {
+			return ownerOf(_sentinel._next);
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Returns the last object in the list.
+		/// </summary> --------------------------------------------------------
+		[[nodiscard]] reference back() {
+			return ownerOf(_tail);
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Returns the last object in the list.
+		/// </summary> --------------------------------------------------------
+		[[nodiscard]] const_reference back() const {
+			return ownerOf(_tail);
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Links the given object at the front of the list.
+		/// </summary>
+		/// 
+		/// <param name="element">
+		/// The unlinked object to insert.
+		/// </param>
+		/// 
+		/// <returns>
+		/// Returns an iterator to the inserted object.
+		/// </returns> --------------------------------------------------------
+		iterator insertFront(reference element) {
+			return insert(begin(), element);
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Links the given object at the back of the list.
+		/// </summary>
+		/// 
+		/// <param name="element">
+		/// The unlinked object to insert.
+		/// </param>
+		/// 
+		/// <returns>
+		/// Returns an iterator to the inserted object.
+		/// </returns> --------------------------------------------------------
+		iterator insertBack(reference element) {
+			return insert(end(), element);
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Links the given object before the element at the given position.
+		/// </summary>
+		/// 
+		/// <param name="position">
+		/// The iterator position to insert the object at.
+		/// </param>
+		/// 
+		/// <param name="element">
+		/// The unlinked object to insert.
+		/// </param>
+		/// 
+		/// <returns>
+		/// Returns an iterator to the inserted object.
+		/// </returns> 
+		/// 
+		/// <exception cref="std::invalid_argument">
+		/// Thrown if the object is already linked into a list by this hook.
+		/// </exception> ------------------------------------------------------
+		iterator insert(const_iterator position, reference element) {
+			hook_type* h = std::addressof(element.*hook);
+			validateUnlinked(h);
+			link(position.node(), h, h);
+			++_size;
+			return iterator(position.node());
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Links every object in the given range before the element at the
+		/// given position.
+		/// </summary>
+		/// 
+		/// <param name="position">
+		/// The iterator position to insert the objects at.
+		/// </param>
+		/// 
+		/// <param name="begin">
+		/// The iterator to the first object to link.
+		/// </param>
+		/// 
+		/// <param name="end">
+		/// The sentinel marking the end of the range.
+		/// </param>
+		/// 
+		/// <returns>
+		/// Returns an iterator to the first inserted object, or position if
+		/// the range is empty.
+		/// </returns> --------------------------------------------------------
+		template <
+			std::input_iterator in_iterator,
+			std::sentinel_for<in_iterator> sentinel
+		> requires std::same_as<std::iter_reference_t<in_iterator>, reference>
+		iterator insert(const_iterator position, in_iterator begin, sentinel end) {
+			hook_type* before = position.node();
+
+			for (; begin != end; ++begin) {
+				insert(const_iterator(before), *begin);
+				before = before->_next;
+			}
+
+			return iterator(position.node());
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Unlinks the first object in the list.
+		/// </summary> --------------------------------------------------------
+		void removeFront() noexcept {
+			unlinkAfter(&_sentinel);
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Unlinks the last object in the list. This has to find the link 
+		/// before the last object and is O(n).
+		/// </summary> --------------------------------------------------------
+		void removeBack() noexcept {
+			unlinkAfter(findLinkBefore(_tail));
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Unlinks the object at the given position in O(1).
+		/// </summary>
+		/// 
+		/// <param name="position">
+		/// The iterator to the object to remove.
+		/// </param>
+		/// 
+		/// <returns>
+		/// Returns an iterator to the object following the removed one.
+		/// </returns> --------------------------------------------------------
+		iterator remove(const_iterator position) noexcept {
+			unlinkAfter(position.node());
+			return iterator(position.node());
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Unlinks the given object. This has to find the link before the
+		/// object and is O(n). The object must be linked into this list.
+		/// </summary>
+		/// 
+		/// <param name="element">
+		/// The object to remove.
+		/// </param>
+		/// 
+		/// <returns>
+		/// Returns an iterator to the object following the removed one.
+		/// </returns> --------------------------------------------------------
+		iterator remove(reference element) noexcept {
+			hook_type* before = findLinkBefore(std::addressof(element.*hook));
+			return remove(const_iterator(before));
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Unlinks every object in the range [begin, end).
+		/// </summary>
+		/// 
+		/// <param name="begin">
+		/// The iterator to the first object to remove.
+		/// </param>
+		/// 
+		/// <param name="end">
+		/// The iterator following the last object to remove.
+		/// </param>
+		/// 
+		/// <returns>
+		/// Returns an iterator to the object following the removed range.
+		/// </returns> --------------------------------------------------------
+		iterator remove(const_iterator begin, const_iterator end) noexcept {
+			hook_type* before = begin.node();
+			hook_type* stop = end.node()->_next;
+
+			while (before->_next != stop) 
+				unlinkAfter(before);
+
+			return iterator(before);
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Moves the objects in the range [begin, end) of the other list so
+		/// they precede the element at the given position in this list. The 
+		/// position must not lie inside the range. This is O(1) when both
+		/// lists are the same and O(end - begin) otherwise to count the 
+		/// moved objects.
+		/// </summary>
+		/// 
+		/// <param name="position">
+		/// The iterator position to move the objects to.
+		/// </param>
+		/// 
+		/// <param name="other">
+		/// The list the range belongs to, which may be this list.
+		/// </param>
+		/// 
+		/// <param name="begin">
+		/// The iterator to the first object to move.
+		/// </param>
+		/// 
+		/// <param name="end">
+		/// The iterator following the last object to move.
+		/// </param> ----------------------------------------------------------
+		void splice(
+			const_iterator position,
+			IntrusiveForwardList& other,
+			const_iterator begin,
+			const_iterator end
+		) noexcept {
+			if (begin == end)
+				return;
+
+			if (&other != this) {
+				auto count = static_cast<size_type>(std::distance(begin, end));
+				other._size -= count;
+				_size += count;
+			}
+
+			hook_type* head = begin.node()->_next;
+			hook_type* tail = end.node();
+			other.snip(begin.node(), tail);
+			link(position.node(), head, tail);
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Moves every object of the other list so they precede the element 
+		/// at the given position in this list in O(1).
+		/// </summary>
+		/// 
+		/// <param name="position">
+		/// The iterator position to move the objects to.
+		/// </param>
+		/// 
+		/// <param name="other">
+		/// The list to move every object from.
+		/// </param> ----------------------------------------------------------
+		void splice(
+			const_iterator position, 
+			IntrusiveForwardList& other
+		) noexcept {
+			if (&other == this || other.isEmpty())
+				return;
+
+			hook_type* head = other._sentinel._next;
+			hook_type* tail = other._tail;
+			_size += other._size;
+			other.resetSentinel();
+			other._size = 0;
+			link(position.node(), head, tail);
+		}
+
+		// ---------------------------------------------------------------------
+		/// <summary> 
+		/// Swaps the contents of the given lists.
+		/// </summary>
+		/// 
+		/// <param name="a">
+		/// The first list to be swapped.
+		/// </param>
+		/// 
+		/// <param name="b">
+		/// The second list to be swapped.
+		/// </param> ----------------------------------------------------------
+		friend void swap(IntrusiveForwardList& a, IntrusiveForwardList& b) 
+			noexcept 
+		{
+			a.swap(b);
+		}
+
+		// ---------------------------------------------------------------------
+		/// <summary> 
+		/// Swaps the contents of this list with the given list.
+		/// </summary>
+		/// 
+		/// <param name="other">
+		/// The list to be swapped with.
+		/// </param> -----------------------------------------------------------
+		void swap(IntrusiveForwardList& other) noexcept {
+			IntrusiveForwardList* lists[] = { this, &other };
+			hook_type* heads[] = { _sentinel._next, other._sentinel._next };
+			hook_type* tails[] = { _tail, other._tail };
+
+			for (int i = 0; i < 2; ++i) {
+				IntrusiveForwardList* target = lists[1 - i];
+				target->resetSentinel();
+
+				if (heads[i] != &lists[i]->_sentinel)
+					target->link(&target->_sentinel, heads[i], tails[i]);
+			}
+
+			std::swap(_size, other._size);
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Returns true if the two lists link equal objects in the same 
+		/// order.
+		/// </summary> --------------------------------------------------------
+		friend bool operator==(
+			const IntrusiveForwardList& a, 
+			const IntrusiveForwardList& b
+		) requires std::equality_comparable<value_type> {
+			return a.size() == b.size() && 
+				std::equal(a.begin(), a.end(), b.begin());
+		}
+
+	private:
+
+		hook_type _sentinel;
+		hook_type* _tail;
+		size_type _size;
+
+		[[nodiscard]] static reference ownerOf(hook_type* h) noexcept {
+			auto address = reinterpret_cast<std::byte*>(h) - member_offset<hook>();
+			return *std::launder(reinterpret_cast<T*>(address));
+		}
+
+		[[nodiscard]] static const_reference ownerOf(const hook_type* h) noexcept {
+			return ownerOf(const_cast<hook_type*>(h));
+		}
+
+		void resetSentinel() noexcept {
+			_sentinel._next = &_sentinel;
+			_tail = &_sentinel;
+		}
+
+		void validateUnlinked(const hook_type* h) const {
+			if (h->isLinked())
+				throw std::invalid_argument("Element is already linked.");
+		}
+
+		[[nodiscard]] hook_type* findLinkBefore(const hook_type* h) noexcept {
+			hook_type* before = &_sentinel;
+			while (before->_next != h)
+				before = before->_next;
+			return before;
+		}
+
+		void link(hook_type* position, hook_type* head, hook_type* tail) noexcept {
+			tail->_next = position->_next; // links **AFTER** position
+			position->_next = head;
+
+			if (_tail == position)
+				_tail = tail;
+		}
+
+		void snip(hook_type* head, hook_type* tail) noexcept {
+			head->_next = tail->_next; // removes (head, tail]
+
+			if (_tail == tail)
+				_tail = head;
+		}
+
+		void unlinkAfter(hook_type* before) noexcept {
+			hook_type* h = before->_next;
+			snip(before, h);
+			h->_next = nullptr;
+			--_size;
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Iterator type for intrusive forward lists. Each iterator refers to
+		/// the link before its element, and dereferencing recovers the 
+		/// object from the address of the following hook.
+		/// </summary>
+		/// 
+		/// <typeparam name="isConst">
+		/// Boolean to control if the iterator type is constant or not.
+		/// </typeparam> ------------------------------------------------------
+		template <bool isConst>
+		class IntrusiveForwardListIterator {
+		public:
+
+			using value_type		= std::conditional_t<isConst, const T, T>;
+			using difference_type	= std::ptrdiff_t;
+			using pointer			= value_type*;
+			using reference			= value_type&;
+			using iterator_category	= std::forward_iterator_tag;
+
+			IntrusiveForwardListIterator() = default;
+
+			// -----------------------------------------------------------------
+			/// <summary>
+			/// Converts a non-const iterator to a const iterator.
+			/// </summary> -----------------------------------------------------
+			template <bool wasConst> requires (isConst && !wasConst)
+			IntrusiveForwardListIterator(
+				IntrusiveForwardListIterator<wasConst> copy
+			) noexcept : _hook(copy._hook) {}
+
+			reference operator*() const noexcept {
+				return ownerOf(_hook->_next);
+			}
+
+			pointer operator->() const noexcept {
+				return std::addressof(ownerOf(_hook->_next));
+			}
+
+			IntrusiveForwardListIterator& operator++() noexcept {
+				_hook = _hook->_next;
+				return *this;
+			}
+
+			IntrusiveForwardListIterator operator++(int) noexcept {
+				auto copy = *this;
+				_hook = _hook->_next;
+				return copy;
+			}
+
+			friend bool operator==(
+				const IntrusiveForwardListIterator& a, 
+				const IntrusiveForwardListIterator& b
+			) noexcept {
+				return a._hook == b._hook;
+			}
+
+		private:
+
+			using hook_ptr = std::conditional_t<
+				isConst, const hook_type*, hook_type*>;
+
+			hook_ptr _hook = nullptr;
+
+			explicit IntrusiveForwardListIterator(hook_ptr h) noexcept 
+				: _hook(h) {}
+
+			[[nodiscard]] hook_type* node() const noexcept {
+				return const_cast<hook_type*>(_hook);
+			}
+
+			template <bool>
+			friend class IntrusiveForwardListIterator;
+
+			friend class IntrusiveForwardList;
+		};
+	};
+}
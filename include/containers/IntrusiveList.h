@@ -0,0 +1,826 @@
+/* ============================================================================
+ * Copyright (C) 2023 Ryan Eubank
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ * ========================================================================= */
+
+#pragma once
+
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "../concepts/collection.h"
+#include "../concepts/iterable.h"
+#include "../util/member_offset.h"
+
+namespace collections {
+
+	// -------------------------------------------------------------------------
+	/// <summary>
+	/// IntrusiveListHook holds the links of an object stored in an 
+	/// IntrusiveList. Objects embed a hook for every intrusive list they can 
+	/// belong to at once. Copying an object never copies its list membership,
+	/// so a copied hook always starts unlinked.
+	/// </summary> -------------------------------------------------------------
+	class IntrusiveListHook {
+	public:
+
+		IntrusiveListHook() noexcept = default;
+		IntrusiveListHook(const IntrusiveListHook&) noexcept {}
+		IntrusiveListHook& operator=(const IntrusiveListHook&) noexcept { 
+			return *this; 
+		}
+
+		// ---------------------------------------------------------------------
+		/// <summary>
+		/// Returns true if the hook is currently linked into a list.
+		/// </summary> ---------------------------------------------------------
+		[[nodiscard]] bool isLinked() const noexcept {
+			return _next != nullptr;
+		}
+
+	private:
+
+		IntrusiveListHook* _prev = nullptr;
+		IntrusiveListHook* _next = nullptr;
+
+		template <class T, IntrusiveListHook T::* hook>
+		friend class IntrusiveList;
+	};
+
+	// -------------------------------------------------------------------------
+	/// <summary>
+	/// IntrusiveList is a doubly linked list whose links live inside the
+	/// objects it stores. The list never allocates, copies or destroys its
+	/// elements: it only links objects whose lifetime the caller already
+	/// manages, so an object can be inserted or removed in O(1) given either
+	/// an iterator or a reference to it. An object must be removed from the
+	/// list before it is destroyed.
+	///
+	/// <para>
+	/// The insert, remove and splice interface mirrors LinkedList, except 
+	/// that elements are inserted by reference and there are no emplace 
+	/// methods, since the list never creates objects.
+	/// </para>
+	/// </summary>
+	///
+	/// <typeparam name="T">
+	/// The type of the objects linked by the list.
+	/// </typeparam> 
+	/// 
+	/// <typeparam name="hook">
+	/// Pointer to the IntrusiveListHook member of T used by this list.
+	/// </typeparam> -----------------------------------------------------------
+	template <class T, IntrusiveListHook T::* hook>
+	class IntrusiveList {
+	private:
+
+		template <bool isConst>
+		class IntrusiveListIterator;
+
+		using hook_type = IntrusiveListHook;
+
+	public:
+
+		using value_type		= T;
+		using size_type			= std::size_t;
+		using difference_type	= std::ptrdiff_t;
+		using pointer			= value_type*;
+		using const_pointer		= const value_type*;
+		using reference			= value_type&;
+		using const_reference	= const value_type&;
+
+		using iterator					= IntrusiveListIterator<false>;
+		using const_iterator			= IntrusiveListIterator<true>;
+		using reverse_iterator			= std::reverse_iterator<iterator>;
+		using const_reverse_iterator	= std::reverse_iterator<const_iterator>;
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// ~~~ Default Constructor ~~~
+		/// 
+		/// <para>
+		/// Constructs an empty list.
+		/// </para></summary> -------------------------------------------------
+		IntrusiveList() noexcept : _sentinel(), _size() {
+			resetSentinel();
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// ~~~ Range Constructor ~~~
+		/// 
+		/// <para>
+		/// Constructs a list linking every object in the given range in 
+		/// order.
+		/// </para></summary>
+		/// 
+		/// <param name="begin">
+		/// The iterator to the first object to link.
+		/// </param>
+		/// 
+		/// <param name="end">
+		/// The sentinel marking the end of the range.
+		/// </param> ----------------------------------------------------------
+		template <
+			std::input_iterator in_iterator,
+			std::sentinel_for<in_iterator> sentinel
+		> requires std::same_as<std::iter_reference_t<in_iterator>, reference>
+		IntrusiveList(in_iterator begin, sentinel end) : IntrusiveList() {
+			insert(this->end(), begin, end);
+		}
+
+		IntrusiveList(const IntrusiveList&) = delete;
+		IntrusiveList& operator=(const IntrusiveList&) = delete;
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// ~~~ Move Constructor ~~~
+		/// 
+		/// <para>
+		/// Takes over every object linked into the other list, leaving it 
+		/// empty.
+		/// </para></summary>
+		/// 
+		/// <param name="other">
+		/// The list to move from.
+		/// </param> ----------------------------------------------------------
+		IntrusiveList(IntrusiveList&& other) noexcept : IntrusiveList() {
+			swap(other);
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// ~~~ Move Assignment Operator ~~~
+		/// 
+		/// <para>
+		/// Unlinks this list's objects and takes over every object linked 
+		/// into the other list, leaving it empty.
+		/// </para></summary>
+		/// 
+		/// <param name="other">
+		/// The list to move from.
+		/// </param> ----------------------------------------------------------
+		IntrusiveList& operator=(IntrusiveList&& other) noexcept {
+			if (&other != this) {
+				clear();
+				swap(other);
+			}
+
+			return *this;
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// ~~~ Destructor ~~~
+		/// 
+		/// <para>
+		/// Unlinks every object in the list without destroying them.
+		/// </para></summary> -------------------------------------------------
+		~IntrusiveList() {
+			clear();
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Returns the number of objects linked into the list.
+		/// </summary> --------------------------------------------------------
+		[[nodiscard]] size_type size() const noexcept {
+			return _size;
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Returns the maximum number of objects the list can link.
+		/// </summary> --------------------------------------------------------
+		[[nodiscard]] size_type max_size() const noexcept {
+			return std::numeric_limits<difference_type>::max();
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Returns true if no objects are linked into the list.
+		/// </summary> --------------------------------------------------------
+		[[nodiscard]] bool isEmpty() const noexcept {
+			return !(_size);
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Unlinks every object from the list without destroying them.
+		/// </summary> --------------------------------------------------------
+		void clear() noexcept {
+			hook_type* h = _sentinel._next;
+
+			while (h != &_sentinel) {
+				hook_type* following = h->_next;
+				h->_prev = nullptr;
+				h->_next = nullptr;
+				h = following;
+			}
+
+			resetSentinel();
+			_size = 0;
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Returns an iterator to the first object in the list.
+		/// </summary> --------------------------------------------------------
+		[[nodiscard]] iterator begin() noexcept {
+			return iterator(_sentinel._next);
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Returns a const iterator to the first object in the list.
+		/// </summary> --------------------------------------------------------
+		[[nodiscard]] const_iterator begin() const noexcept {
+			return const_iterator(_sentinel._next);
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Returns a const iterator to the first object in the list.
+		/// </summary> --------------------------------------------------------
+		[[nodiscard]] const_iterator cbegin() const noexcept {
+			return begin();
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Returns an iterator past the last object in the list.
+		/// </summary> --------------------------------------------------------
+		[[nodiscard]] iterator end() noexcept {
+			return iterator(&_sentinel);
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Returns a const iterator past the last object in the list.
+		/// </summary> --------------------------------------------------------
+		[[nodiscard]] const_iterator end() const noexcept {
+			return const_iterator(&_sentinel);
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Returns a const iterator past the last object in the list.
+		/// </summary> --------------------------------------------------------
+		[[nodiscard]] const_iterator cend() const noexcept {
+			return end();
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Returns a reverse iterator to the last object in the list.
+		/// </summary> --------------------------------------------------------
+		[[nodiscard]] reverse_iterator rbegin() noexcept {
+			return std::make_reverse_iterator(end());
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Returns a const reverse iterator to the last object in the list.
+		/// </summary> --------------------------------------------------------
+		[[nodiscard]] const_reverse_iterator rbegin() const noexcept {
+			return std::make_reverse_iterator(end());
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Returns a const reverse iterator to the last object in the list.
+		/// </summary> --------------------------------------------------------
+		[[nodiscard]] const_reverse_iterator crbegin() const noexcept {
+			return rbegin();
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Returns a reverse iterator before the first object in the list.
+		/// </summary> --------------------------------------------------------
+		[[nodiscard]] reverse_iterator rend() noexcept {
+			return std::make_reverse_iterator(begin());
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Returns a const reverse iterator before the first object in the 
+		/// list.
+		/// </summary> --------------------------------------------------------
+		[[nodiscard]] const_reverse_iterator rend() const noexcept {
+			return std::make_reverse_iterator(begin());
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Returns a const reverse iterator before the first object in the 
+		/// list.
+		/// </summary> --------------------------------------------------------
+		[[nodiscard]] const_reverse_iterator crend() const noexcept {
+			return rend();
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Returns an iterator to the given object in O(1). The object must
+		/// be linked into this list.
+		/// </summary>
+		/// 
+		/// <param name="element">
+		/// The linked object to get an iterator to.
+		/// </param> ----------------------------------------------------------
+		[[nodiscard]] iterator iteratorTo(reference element) noexcept {
+			return iterator(std::addressof(element.*hook));
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Returns a const iterator to the given object in O(1). The object
+		/// must be linked into this list.
+		/// </summary>
+		/// 
+		/// <param name="element">
+		/// The linked object to get an iterator to.
+		/// </param> ----------------------------------------------------------
+		[[nodiscard]] const_iterator iteratorTo(
+			const_reference element
+		) const noexcept {
+			return const_iterator(std::addressof(element.*hook));
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Returns the first object in the list.
+		/// </summary> --------------------------------------------------------
+		[[nodiscard]] reference front() {
+			return ownerOf(_sentinel._next);
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Returns the first object in the list.
+		/// </summary> --------------------------------------------------------
+		[[nodiscard]] const_reference front() const {
+			return ownerOf(_sentinel._next);
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Returns the last object in the list.
+		/// </summary> --------------------------------------------------------
+		[[nodiscard]] reference back() {
+			return ownerOf(_sentinel._prev);
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Returns the last object in the list.
+		/// </summary> --------------------------------------------------------
+		[[nodiscard]] const_reference back() const {
+			return ownerOf(_sentinel._prev);
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Links the given object at the front of the list.
+		/// </summary>
+		/// 
+		/// <param name="element">
+		/// The unlinked object to insert.
+		/// </param>
+		/// 
+		/// <returns>
+		/// Returns an iterator to the inserted object.
+		/// </returns> --------------------------------------------------------
+		iterator insertFront(reference element) {
+			return insert(begin(), element);
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Links the given object at the back of the list.
+		/// </summary>
+		/// 
+		/// <param name="element">
+		/// The unlinked object to insert.
+		/// </param>
+		/// 
+		/// <returns>
+		/// Returns an iterator to the inserted object.
+		/// </returns> --------------------------------------------------------
+		iterator insertBack(reference element) {
+			return insert(end(), element);
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Links the given object before the given position.
+		/// </summary>
+		/// 
+		/// <param name="position">
+		/// The iterator position to insert the object before.
+		/// </param>
+		/// 
+		/// <param name="element">
+		/// The unlinked object to insert.
+		/// </param>
+		/// 
+		/// <returns>
+		/// Returns an iterator to the inserted object.
+		/// </returns> 
+		/// 
+		/// <exception cref="std::invalid_argument">
+		/// Thrown if the object is already linked into a list by this hook.
+		/// </exception> ------------------------------------------------------
+		iterator insert(const_iterator position, reference element) {
+			hook_type* h = std::addressof(element.*hook);
+			validateUnlinked(h);
+			link(position.node(), h, h);
+			++_size;
+			return iterator(h);
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Links every object in the given range before the given position.
+		/// </summary>
+		/// 
+		/// <param name="position">
+		/// The iterator position to insert the objects before.
+		/// </param>
+		/// 
+		/// <param name="begin">
+		/// The iterator to the first object to link.
+		/// </param>
+		/// 
+		/// <param name="end">
+		/// The sentinel marking the end of the range.
+		/// </param>
+		/// 
+		/// <returns>
+		/// Returns an iterator to the first inserted object, or position if 
+		/// the range is empty.
+		/// </returns> --------------------------------------------------------
+		template <
+			std::input_iterator in_iterator,
+			std::sentinel_for<in_iterator> sentinel
+		> requires std::same_as<std::iter_reference_t<in_iterator>, reference>
+		iterator insert(const_iterator position, in_iterator begin, sentinel end) {
+			iterator result(position.node());
+			bool first = true;
+
+			for (; begin != end; ++begin) {
+				iterator inserted = insert(position, *begin);
+				if (first) {
+					result = inserted;
+					first = false;
+				}
+			}
+
+			return result;
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Unlinks the first object in the list.
+		/// </summary> --------------------------------------------------------
+		void removeFront() noexcept {
+			unlink(_sentinel._next);
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Unlinks the last object in the list.
+		/// </summary> --------------------------------------------------------
+		void removeBack() noexcept {
+			unlink(_sentinel._prev);
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Unlinks the object at the given position in O(1).
+		/// </summary>
+		/// 
+		/// <param name="position">
+		/// The iterator to the object to remove.
+		/// </param>
+		/// 
+		/// <returns>
+		/// Returns an iterator to the object following the removed one.
+		/// </returns> --------------------------------------------------------
+		iterator remove(const_iterator position) noexcept {
+			return iterator(unlink(position.node()));
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Unlinks the given object in O(1). The object must be linked into
+		/// this list.
+		/// </summary>
+		/// 
+		/// <param name="element">
+		/// The object to remove.
+		/// </param>
+		/// 
+		/// <returns>
+		/// Returns an iterator to the object following the removed one.
+		/// </returns> --------------------------------------------------------
+		iterator remove(reference element) noexcept {
+			return remove(iteratorTo(element));
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Unlinks every object in the range [begin, end).
+		/// </summary>
+		/// 
+		/// <param name="begin">
+		/// The iterator to the first object to remove.
+		/// </param>
+		/// 
+		/// <param name="end">
+		/// The iterator following the last object to remove.
+		/// </param>
+		/// 
+		/// <returns>
+		/// Returns an iterator to end.
+		/// </returns> --------------------------------------------------------
+		iterator remove(const_iterator begin, const_iterator end) noexcept {
+			hook_type* h = begin.node();
+			while (h != end.node())
+				h = unlink(h);
+			return iterator(h);
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Moves the objects in the range [begin, end) of the other list 
+		/// before the given position in this list in O(1) when both lists
+		/// are the same, and O(end - begin) otherwise to count the moved 
+		/// objects. The position must not lie inside the range.
+		/// </summary>
+		/// 
+		/// <param name="position">
+		/// The iterator position to move the objects before.
+		/// </param>
+		/// 
+		/// <param name="other">
+		/// The list the range belongs to, which may be this list.
+		/// </param>
+		/// 
+		/// <param name="begin">
+		/// The iterator to the first object to move.
+		/// </param>
+		/// 
+		/// <param name="end">
+		/// The iterator following the last object to move.
+		/// </param> ----------------------------------------------------------
+		void splice(
+			const_iterator position,
+			IntrusiveList& other,
+			const_iterator begin,
+			const_iterator end
+		) noexcept {
+			if (begin == end)
+				return;
+
+			if (&other != this) {
+				auto count = static_cast<size_type>(std::distance(begin, end));
+				other._size -= count;
+				_size += count;
+			}
+
+			hook_type* head = begin.node();
+			hook_type* tail = end.node()->_prev;
+			snip(head, tail);
+			link(position.node(), head, tail);
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Moves every object of the other list before the given position in
+		/// this list in O(1).
+		/// </summary>
+		/// 
+		/// <param name="position">
+		/// The iterator position to move the objects before.
+		/// </param>
+		/// 
+		/// <param name="other">
+		/// The list to move every object from.
+		/// </param> ----------------------------------------------------------
+		void splice(const_iterator position, IntrusiveList& other) noexcept {
+			if (&other == this || other.isEmpty())
+				return;
+
+			hook_type* head = other._sentinel._next;
+			hook_type* tail = other._sentinel._prev;
+			_size += other._size;
+			other.resetSentinel();
+			other._size = 0;
+			link(position.node(), head, tail);
+		}
+
+		// ---------------------------------------------------------------------
+		/// <summary> 
+		/// Swaps the contents of the given lists.
+		/// </summary>
+		/// 
+		/// <param name="a">
+		/// The first list to be swapped.
+		/// </param>
+		/// 
+		/// <param name="b">
+		/// The second list to be swapped.
+		/// </param> ----------------------------------------------------------
+		friend void swap(IntrusiveList& a, IntrusiveList& b) noexcept {
+			a.swap(b);
+		}
+
+		// ---------------------------------------------------------------------
+		/// <summary> 
+		/// Swaps the contents of this list with the given list.
+		/// </summary>
+		/// 
+		/// <param name="other">
+		/// The list to be swapped with.
+		/// </param> -----------------------------------------------------------
+		void swap(IntrusiveList& other) noexcept {
+			IntrusiveList* lists[] = { this, &other };
+			hook_type* heads[] = { _sentinel._next, other._sentinel._next };
+			hook_type* tails[] = { _sentinel._prev, other._sentinel._prev };
+
+			for (int i = 0; i < 2; ++i) {
+				IntrusiveList* target = lists[1 - i];
+				target->resetSentinel();
+
+				if (heads[i] != &lists[i]->_sentinel)
+					target->link(&target->_sentinel, heads[i], tails[i]);
+			}
+
+			std::swap(_size, other._size);
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Returns true if the two lists link equal objects in the same 
+		/// order.
+		/// </summary> --------------------------------------------------------
+		friend bool operator==(const IntrusiveList& a, const IntrusiveList& b) 
+			requires std::equality_comparable<value_type>
+		{
+			return a.size() == b.size() && 
+				std::equal(a.begin(), a.end(), b.begin());
+		}
+
+	private:
+
+		hook_type _sentinel;
+		size_type _size;
+
+		[[nodiscard]] static reference ownerOf(hook_type* h) noexcept {
+			auto address = reinterpret_cast<std::byte*>(h) - member_offset<hook>();
+			return *std::launder(reinterpret_cast<T*>(address));
+		}
+
+		[[nodiscard]] static const_reference ownerOf(const hook_type* h) noexcept {
+			return ownerOf(const_cast<hook_type*>(h));
+		}
+
+		void resetSentinel() noexcept {
+			_sentinel._next = &_sentinel;
+			_sentinel._prev = &_sentinel;
+		}
+
+		void validateUnlinked(const hook_type* h) const {
+			if (h->isLinked())
+				throw std::invalid_argument("Element is already linked.");
+		}
+
+		static void link(hook_type* position, hook_type* head, hook_type* tail) noexcept {
+			head->_prev = position->_prev;
+			position->_prev->_next = head;
+			tail->_next = position;
+			position->_prev = tail;
+		}
+
+		static void snip(hook_type* head, hook_type* tail) noexcept {
+			head->_prev->_next = tail->_next;
+			tail->_next->_prev = head->_prev;
+		}
+
+		hook_type* unlink(hook_type* h) noexcept {
+			hook_type* following = h->_next;
+			snip(h, h);
+			h->_prev = nullptr;
+			h->_next = nullptr;
+			--_size;
+			return following;
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Iterator type for intrusive lists. Dereferencing recovers the 
+		/// object from the address of its hook.
+		/// </summary>
+		/// 
+		/// <typeparam name="isConst">
+		/// Boolean to control if the iterator type is constant or not.
+		/// </typeparam> ------------------------------------------------------
+		template <bool isConst>
+		class IntrusiveListIterator {
+		public:
+
+			using value_type		= std::conditional_t<isConst, const T, T>;
+			using difference_type	= std::ptrdiff_t;
+			using pointer			= value_type*;
+			using reference			= value_type&;
+			using iterator_category	= std::bidirectional_iterator_tag;
+
+			IntrusiveListIterator() = default;
+
+			// -----------------------------------------------------------------
+			/// <summary>
+			/// Converts a non-const iterator to a const iterator.
+			/// </summary> -----------------------------------------------------
+			template <bool wasConst> requires (isConst && !wasConst)
+			IntrusiveListIterator(IntrusiveListIterator<wasConst> copy) 
+				noexcept : _hook(copy._hook) {}
+
+			reference operator*() const noexcept {
+				return ownerOf(_hook);
+			}
+
+			pointer operator->() const noexcept {
+				return std::addressof(ownerOf(_hook));
+			}
+
+			IntrusiveListIterator& operator++() noexcept {
+				_hook = _hook->_next;
+				return *this;
+			}
+
+			IntrusiveListIterator operator++(int) noexcept {
+				auto copy = *this;
+				_hook = _hook->_next;
+				return copy;
+			}
+
+			IntrusiveListIterator& operator--() noexcept {
+				_hook = _hook->_prev;
+				return *this;
+			}
+
+			IntrusiveListIterator operator--(int) noexcept {
+				auto copy = *this;
+				_hook = _hook->_prev;
+				return copy;
+			}
+
+			friend bool operator==(
+				const IntrusiveListIterator& a, 
+				const IntrusiveListIterator& b
+			) noexcept {
+				return a._hook == b._hook;
+			}
+
+		private:
+
+			using hook_ptr = std::conditional_t<
+				isConst, const hook_type*, hook_type*>;
+
+			hook_ptr _hook = nullptr;
+
+			explicit IntrusiveListIterator(hook_ptr h) noexcept : _hook(h) {}
+
+			[[nodiscard]] hook_type* node() const noexcept {
+				return const_cast<hook_type*>(_hook);
+			}
+
+			template <bool>
+			friend class IntrusiveListIterator;
+
+			friend class IntrusiveList;
+		};
+	};
+}
@@ -17,13 +17,17 @@
 
 #pragma once
 
+#include <concepts>
 #include <exception>
+#include <functional>
 #include <initializer_list>
 #include <istream>
 #include <iterator>
+#include <limits>
 #include <memory>
 #include <ostream>
 #include <ranges>
+#include <span>
 #include <sstream>
 #include <type_traits>
 #include <utility>
@@ -38,6 +42,9 @@
 #include "../concepts/iterable.h"
 #include "../concepts/positional.h"
 #include "../concepts/sequential.h"
+#include "../util/NodeBatch.h"
+#include "../util/NodeCache.h"
+#include "../util/prefetch.h"
 
 namespace collections {
 
@@ -70,7 +77,9 @@ namespace collections {
 
 		using value_type		= element_t;
 		using allocator_type	= allocator_t;
-		using node_type			= Node<value_type, allocator_type, 2>;
+		using node_type			= Node<
+			value_type, allocator_type, 2, batch_tag_edge<allocator_type>
+		>;
 		using size_type			= alloc_traits::size_type;
 		using difference_type	= alloc_traits::difference_type;
 		using pointer			= alloc_traits::pointer;
@@ -92,6 +101,9 @@ namespace collections {
 		using const_node_ptr		= node_type::const_base_ptr;
 		using list_node_ptr			= node_alloc_traits::pointer;
 		using const_list_node_ptr	= node_alloc_traits::const_pointer;
+		using node_batches			= NodeBatches<node_type, allocator_type>;
+		using node_cache			= NodeCache<node_type, allocator_type>;
+		using node_sentinel			= SentinelNode<node_base, allocator_type>;
 
 		constexpr static auto prev = 0u;
 		constexpr static auto next = 1u;
@@ -105,14 +117,16 @@ namespace collections {
 		///	<para>
 		/// Constructs an empty LinkedList.
 		/// </para></summary> -------------------------------------------------
-		constexpr LinkedList()
-			noexcept(std::is_nothrow_default_constructible_v<allocator_type>) :
-			_sentinel(),
+		constexpr LinkedList() noexcept(
+			std::is_nothrow_default_constructible_v<allocator_type> &&
+			std::is_nothrow_constructible_v<node_sentinel, const allocator_type&>
+		) :
+			_sentinel(allocator_type{}),
 			_size(),
 			_allocator(allocator_type{})
 		{
-			_sentinel.to(next) = &_sentinel;
-			_sentinel.to(prev) = &_sentinel;
+			_sentinel->to(next) = _sentinel.get();
+			_sentinel->to(prev) = _sentinel.get();
 		}
 
 		// --------------------------------------------------------------------
@@ -126,14 +140,18 @@ namespace collections {
 		/// <param name="alloc">
 		/// The allocator instance used by the list.
 		/// </param> ----------------------------------------------------------
-		constexpr explicit LinkedList(const allocator_type& alloc)
-			noexcept(std::is_nothrow_copy_constructible_v<allocator_type>) :
-			_sentinel(),
+		constexpr explicit LinkedList(const allocator_type& alloc) noexcept(
+			std::is_nothrow_copy_constructible_v<allocator_type> &&
+			std::is_nothrow_constructible_v<node_sentinel, const allocator_type&>
+		) :
+			_sentinel(alloc),
 			_size(),
-			_allocator(alloc)
+			_allocator(alloc),
+			_batches(alloc),
+			_cache(alloc)
 		{
-			_sentinel.to(next) = &_sentinel;
-			_sentinel.to(prev) = &_sentinel;
+			_sentinel->to(next) = _sentinel.get();
+			_sentinel->to(prev) = _sentinel.get();
 		}
 
 		// --------------------------------------------------------------------
@@ -167,11 +185,16 @@ namespace collections {
 		/// <param name="other">
 		/// The LinkedList to be moved into this one.
 		/// </param> ----------------------------------------------------------
-		LinkedList(LinkedList&& other) 
-			noexcept(std::is_nothrow_move_constructible_v<allocator_type>) : 
+		LinkedList(LinkedList&& other) noexcept(
+			std::is_nothrow_move_constructible_v<allocator_type> &&
+			std::is_nothrow_move_constructible_v<node_sentinel>
+		) : 
 			_sentinel(std::move(other._sentinel)),
 			_size(std::move(other._size)),
-			_allocator(std::move(other._allocator))
+			_isSizeStale(other._isSizeStale),
+			_allocator(std::move(other._allocator)),
+			_batches(std::move(other._batches)),
+			_cache(std::move(other._cache))
 		{
 			onMove(std::move(other));
 		}
@@ -297,6 +320,7 @@ namespace collections {
 		/// </para></summary> -------------------------------------------------
 		~LinkedList() {
 			clear();
+			releaseNodes();
 		}
 
 		// --------------------------------------------------------------------
@@ -321,8 +345,14 @@ namespace collections {
 				alloc_traits::propagate_on_container_copy_assignment::value;
 			bool isInstanceEqual = _allocator == other._allocator;
 
-			if (!isAlwaysEqual && !isInstanceEqual && willPropagate) 
+			if (!isAlwaysEqual && !isInstanceEqual && willPropagate) {
+				clear();
+				releaseNodes();
+				_sentinel = node_sentinel(other._allocator);
 				_allocator = other._allocator;
+				_sentinel->to(next) = _sentinel.get();
+				_sentinel->to(prev) = _sentinel.get();
+			}
 
 			elementWiseCopy(other);
 			return *this;
@@ -358,8 +388,9 @@ namespace collections {
 			} 
 			else if (willPropagate) {
 				clear();
-				_allocator = std::move(other._allocator);
+				releaseNodes();
 				moveMembers(std::move(other));
+				_allocator = std::move(other._allocator);
 			}
 			else
 				elementWiseCopy(std::move(other));
@@ -435,7 +466,7 @@ namespace collections {
 		/// Returns true is the list has zero elements, false otherwise.
 		/// </returns> --------------------------------------------------------
 		[[nodiscard]] bool isEmpty() const noexcept {
-			return !(_size);
+			return _sentinel->to(next) == _sentinel.get();
 		}
 
 		// --------------------------------------------------------------------
@@ -449,16 +480,82 @@ namespace collections {
 
 		// --------------------------------------------------------------------
 		/// <summary>
-		/// Returns the number of elements contained by the list.
+		/// Keeps enough node storage for the list to hold the given number of
+		/// elements without allocating. Missing nodes are allocated up front,
+		/// and from then on clear() and remove() park up to count nodes for 
+		/// later inserts to reuse instead of freeing them.
+		/// </summary>
+		/// 
+		/// <param name="count">
+		/// The number of elements the list should hold without allocating.
+		/// </param> ----------------------------------------------------------
+		void reserveNodes(size_type count) {
+			_cache.reserve(count);
+
+			size_type available = size() + _cache.size();
+			if (count <= available)
+				return;
+
+			size_type missing = count - available;
+
+			while (node_batches::isWorthBatching(missing)) {
+				std::span<node_type> nodes = _batches.allocate(missing);
+				for (node_type& n : nodes)
+					(void)_cache.park(std::addressof(n), true);
+				missing -= nodes.size();
+			}
+
+			_batches.reset();
+
+			for (; missing > 0; --missing) {
+				node_type* n = node_alloc_traits::allocate(_allocator, 1);
+				(void)_cache.park(n, false);
+			}
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Frees the nodes parked for reuse. The reserved count is kept, so 
+		/// later removals park nodes again.
+		/// </summary> --------------------------------------------------------
+		void releaseNodes() noexcept {
+			_cache.release(_allocator, _batches);
+
+			if (isEmpty())
+				_batches.reset();
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Returns the number of elements contained by the list. This is 
+		/// constant time unless a splice with deferred_size has left the 
+		/// size to be recounted, in which case every call walks the list 
+		/// until recount() is called.
 		/// </summary>
 		/// 
 		/// <returns>
 		/// Returns the number of valid, constructed elements in the list.
 		/// </returns> --------------------------------------------------------
 		[[nodiscard]] size_type size() const noexcept {
+			if (_isSizeStale)
+				return static_cast<size_type>(std::distance(begin(), end()));
+
 			return _size;
 		}
 
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Walks the list once to restore a size left to be recounted by a
+		/// splice with deferred_size, making size() constant time again. 
+		/// Does nothing if the size is already known.
+		/// </summary> --------------------------------------------------------
+		void recount() noexcept {
+			if (_isSizeStale) {
+				_size = static_cast<size_type>(std::distance(begin(), end()));
+				_isSizeStale = false;
+			}
+		}
+
 		// --------------------------------------------------------------------
 		/// <summary>
 		/// Returns an iterator pointing to the beginning of the list.
@@ -469,7 +566,7 @@ namespace collections {
 		/// list.
 		/// </returns> --------------------------------------------------------
 		[[nodiscard]] iterator begin() noexcept {
-			return iterator(_sentinel.to(next));
+			return iterator(_sentinel->to(next));
 		}
 
 		// --------------------------------------------------------------------
@@ -482,7 +579,7 @@ namespace collections {
 		/// element in the list.
 		/// </returns> --------------------------------------------------------
 		[[nodiscard]] iterator end() noexcept {
-			return iterator(&_sentinel);
+			return iterator(_sentinel.get());
 		}
 
 		// --------------------------------------------------------------------
@@ -496,7 +593,7 @@ namespace collections {
 		/// the list.
 		/// </returns> --------------------------------------------------------
 		[[nodiscard]] const_iterator begin() const noexcept {
-			return const_iterator(_sentinel.to(next));
+			return const_iterator(_sentinel->to(next));
 		}
 
 		// --------------------------------------------------------------------
@@ -509,7 +606,7 @@ namespace collections {
 		/// the last element in the list.
 		/// </returns> --------------------------------------------------------
 		[[nodiscard]] const_iterator end() const noexcept {
-			return const_iterator(&_sentinel);
+			return const_iterator(_sentinel.get());
 		}
 
 		// --------------------------------------------------------------------
@@ -631,7 +728,7 @@ namespace collections {
 		/// Returns a reference to the first element in the list.
 		/// </returns> --------------------------------------------------------
 		[[nodiscard]] reference front() {
-			return _sentinel.to(next)->value();
+			return _sentinel->to(next)->value();
 		}
 
 		// --------------------------------------------------------------------
@@ -643,7 +740,7 @@ namespace collections {
 		/// Returns a constant reference to the first element in the list.
 		/// </returns> --------------------------------------------------------
 		[[nodiscard]] const_reference front() const {
-			return _sentinel.to(next)->value();
+			return _sentinel->to(next)->value();
 		}
 
 		// --------------------------------------------------------------------
@@ -655,7 +752,7 @@ namespace collections {
 		/// Returns a reference to the last element in the list.
 		/// </returns> --------------------------------------------------------
 		[[nodiscard]] reference back() {
-			return _sentinel.to(prev)->value();
+			return _sentinel->to(prev)->value();
 		}
 
 		// --------------------------------------------------------------------
@@ -667,7 +764,7 @@ namespace collections {
 		/// Returns a constant reference to the last element in the list.
 		/// </returns> --------------------------------------------------------
 		[[nodiscard]] const_reference back() const {
-			return _sentinel.to(prev)->value();
+			return _sentinel->to(prev)->value();
 		}
 
 		// --------------------------------------------------------------------
@@ -721,7 +818,7 @@ namespace collections {
 		/// Returns an iterator to the inserted element.
 		/// </returns> ---------------------------------------------------------
 		iterator insertFront(const_reference element) {
-			return insertAt(_sentinel.to(next), element);
+			return insertAt(_sentinel->to(next), element);
 		}
 
 		// --------------------------------------------------------------------
@@ -737,7 +834,7 @@ namespace collections {
 		/// Returns an iterator to the inserted element.
 		/// </returns> ---------------------------------------------------------
 		iterator insertFront(value_type&& element) {
-			return insertAt(_sentinel.to(next), std::move(element));
+			return insertAt(_sentinel->to(next), std::move(element));
 		}
 
 		// --------------------------------------------------------------------
@@ -753,7 +850,7 @@ namespace collections {
 		/// Returns an iterator to the inserted element.
 		/// </returns> ---------------------------------------------------------
 		iterator insertBack(const_reference element) {
-			return insertAt(&_sentinel, element);
+			return insertAt(_sentinel.get(), element);
 		}
 
 		// --------------------------------------------------------------------
@@ -769,7 +866,7 @@ namespace collections {
 		/// Returns an iterator to the inserted element.
 		/// </returns> ---------------------------------------------------------
 		iterator insertBack(value_type&& element) {
-			return insertAt(&_sentinel, std::move(element));
+			return insertAt(_sentinel.get(), std::move(element));
 		}
 
 		// --------------------------------------------------------------------
@@ -963,7 +1060,7 @@ namespace collections {
 		/// Removes the first element in the list.
 		/// </summary> --------------------------------------------------------
 		void removeFront() {
-			remove(_sentinel.to(next));
+			remove(_sentinel->to(next));
 		}
 
 		// --------------------------------------------------------------------
@@ -971,7 +1068,7 @@ namespace collections {
 		/// Removes the last element in the list.
 		/// </summary> --------------------------s------------------------------
 		void removeBack() {
-			remove(_sentinel.to(prev));
+			remove(_sentinel->to(prev));
 		}
 
 		// --------------------------------------------------------------------
@@ -1023,7 +1120,7 @@ namespace collections {
 		/// </returns> ---------------------------------------------------------
 		template <class ...Args>
 		iterator emplaceFront(Args&&... args) {
-			return insertAt(_sentinel.to(next), std::forward<Args>(args)...);
+			return insertAt(_sentinel->to(next), std::forward<Args>(args)...);
 		}
 
 		// --------------------------------------------------------------------
@@ -1041,7 +1138,7 @@ namespace collections {
 		/// </returns> ---------------------------------------------------------
 		template <class ...Args>
 		iterator emplaceBack(Args&&... args) {
-			return insertAt(&_sentinel, std::forward<Args>(args)...);
+			return insertAt(_sentinel.get(), std::forward<Args>(args)...);
 		}
 
 		// --------------------------------------------------------------------
@@ -1114,12 +1211,271 @@ namespace collections {
 			const_iterator begin, 
 			const_iterator end
 		) {
-			size_type dist = std::distance(begin, end);
-			auto tail = end.node()->to(prev);
+			size_type dist = 0;
+			if (&other != this)
+				dist = std::distance(begin, end);
+
+			splice(position, other, begin, end, Size(dist));
+		}
+
+		// ---------------------------------------------------------------------
+		/// <summary>
+		/// Splices nodes in the range [begin, end) before the node specified 
+		/// by position in constant time, using the caller's count of the 
+		/// range to update the sizes of both lists instead of walking it.
+		/// </summary>
+		/// 
+		/// <param name="position">
+		/// The postion in the list to splice the range before.
+		/// </param>
+		/// 
+		/// <param name="other">
+		/// A reference to the other list nodes are being taken from. This can
+		/// be equal to this list.
+		/// </param>
+		/// 
+		/// <param name="begin">
+		/// An iterator to the start position of the range being spliced.
+		/// </param>
+		/// 
+		/// <param name="end">
+		/// An iterator to the last position of he range being spliced.
+		/// </param>
+		/// 
+		/// <param name="count">
+		/// The number of elements in the range, which must equal
+		/// std::distance(begin, end).
+		/// </param> -----------------------------------------------------------
+		void splice(
+			const_iterator position,
+			LinkedList& other,
+			const_iterator begin, 
+			const_iterator end,
+			Size count
+		) noexcept {
+			if (begin == end)
+				return;
+
+
+			node_ptr tail = end.node()->to(prev);
 			other.snip(begin.node(), end.node());
 			splice(position.node(), begin.node(), tail);
-			other._size -= dist;
-			_size += dist;
+			other._size -= count.get();
+			_size += count.get();
+		}
+
+		// ---------------------------------------------------------------------
+		/// <summary>
+		/// Splices nodes in the range [begin, end) before the node specified 
+		/// by position in constant time when the length of the range is not
+		/// known. Both lists are marked to recount their size, so a run of 
+		/// splices pays for at most one walk of each list once recount() is
+		/// called after the last of them.
+		/// </summary>
+		/// 
+		/// <param name="position">
+		/// The postion in the list to splice the range before.
+		/// </param>
+		/// 
+		/// <param name="other">
+		/// A reference to the other list nodes are being taken from. This can
+		/// be equal to this list.
+		/// </param>
+		/// 
+		/// <param name="begin">
+		/// An iterator to the start position of the range being spliced.
+		/// </param>
+		/// 
+		/// <param name="end">
+		/// An iterator to the last position of he range being spliced.
+		/// </param> -----------------------------------------------------------
+		void splice(
+			const_iterator position,
+			LinkedList& other,
+			const_iterator begin, 
+			const_iterator end,
+			deferred_size_t
+		) noexcept {
+			splice(position, other, begin, end, Size(0));
+
+			if (&other != this) {
+				_isSizeStale = true;
+				other._isSizeStale = true;
+			}
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Sorts the list in place using a stable bottom-up merge sort. Only
+		/// node links are rewritten, so no elements are copied or moved, no
+		/// memory is allocated, and iterators remain valid. If the comparison
+		/// throws, every element is kept in the list in an unspecified order.
+		/// </summary>
+		/// 
+		/// <typeparam name="compare_t">
+		/// The type of the strict weak ordering used to compare elements.
+		/// </typeparam>
+		/// 
+		/// <param name="compare">
+		/// The ordering returning true if its first argument belongs before
+		/// its second.
+		/// </param> ----------------------------------------------------------
+		template <class compare_t = std::less<value_type>>
+			requires std::predicate<compare_t&, const_reference, const_reference>
+		void sort(compare_t compare = {}) {
+			if (_sentinel->to(next) == _sentinel->to(prev))
+				return;
+
+			node_ptr chain = _sentinel->to(next);
+			_sentinel->to(prev)->to(next) = nullptr;
+
+			try {
+				chain = sortChain(chain, compare);
+			}
+			catch (...) {
+				relinkChain(chain);
+				throw;
+			}
+
+			relinkChain(chain);
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Merges the given sorted list into this sorted list in linear time,
+		/// leaving the other list empty. Nodes are spliced rather than 
+		/// copied, and equal elements from this list stay ahead of those from
+		/// the other list. If the comparison throws, each element stays in 
+		/// one of the two lists and both remain sorted.
+		/// </summary>
+		/// 
+		/// <typeparam name="compare_t">
+		/// The type of the strict weak ordering both lists are sorted by.
+		/// </typeparam>
+		/// 
+		/// <param name="other">
+		/// The sorted list to merge into this one.
+		/// </param>
+		/// 
+		/// <param name="compare">
+		/// The ordering returning true if its first argument belongs before
+		/// its second.
+		/// </param>
+		/// 
+		/// <remarks>
+		/// Nodes can only be spliced between lists with equal allocators. 
+		/// Otherwise the elements of other are first moved into nodes from 
+		/// this list's allocator.
+		/// </remarks> --------------------------------------------------------
+		template <class compare_t = std::less<value_type>>
+			requires std::predicate<compare_t&, const_reference, const_reference>
+		void merge(LinkedList& other, compare_t compare = {}) {
+			if (&other == this)
+				return;
+
+			if constexpr (!alloc_traits::is_always_equal::value) {
+				if (_allocator != other._allocator) {
+					LinkedList moved(
+						std::make_move_iterator(other.begin()),
+						std::make_move_iterator(other.end()),
+						_allocator
+					);
+					other.clear();
+					merge(moved, compare);
+					return;
+				}
+			}
+
+			node_ptr position = _sentinel->to(next);
+			node_ptr first = other._sentinel->to(next);
+			node_ptr otherEnd = other._sentinel.get();
+
+			try {
+				while (first != otherEnd) {
+					while (position != _sentinel.get() && 
+						!compare(first->value(), position->value()))
+						position = position->to(next);
+
+					node_ptr last = first;
+					if (position == _sentinel.get())
+						last = other._sentinel->to(prev);
+					else {
+						while (last->to(next) != otherEnd && 
+							compare(last->to(next)->value(), position->value()))
+							last = last->to(next);
+					}
+
+					node_ptr after = last->to(next);
+					other.snip(first, after);
+					splice(position, first, last);
+					first = after;
+				}
+			}
+			catch (...) {
+				// the runs moved so far were not counted
+				_isSizeStale = true;
+				other._isSizeStale = true;
+				throw;
+			}
+
+			_size += other._size;
+			_isSizeStale |= other._isSizeStale;
+			other._size = 0;
+			other._isSizeStale = false;
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Removes all but the first element from every run of consecutive
+		/// equal elements in the list.
+		/// </summary>
+		/// 
+		/// <typeparam name="equality_t">
+		/// The type of the predicate used to compare elements.
+		/// </typeparam>
+		/// 
+		/// <param name="equal">
+		/// The predicate returning true if two elements are equal.
+		/// </param>
+		/// 
+		/// <returns>
+		/// Returns the number of elements removed.
+		/// </returns> --------------------------------------------------------
+		template <class equality_t = std::equal_to<value_type>>
+			requires std::predicate<equality_t&, const_reference, const_reference>
+		size_type unique(equality_t equal = {}) {
+			recount();
+
+			size_type initialSize = _size;
+			node_ptr n = _sentinel->to(next);
+
+			while (n != _sentinel.get()) {
+				node_ptr last = n->to(next);
+				while (last != _sentinel.get() && equal(n->value(), last->value()))
+					last = last->to(next);
+
+				if (n->to(next) != last)
+					remove(n->to(next), last);
+
+				n = last;
+			}
+
+			return initialSize - _size;
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Reverses the order of the elements in the list by swapping the
+		/// links of every node. Iterators remain valid.
+		/// </summary> --------------------------------------------------------
+		void reverse() noexcept {
+			using std::swap;
+			node_ptr n = _sentinel.get();
+
+			do {
+				swap(n->to(next), n->to(prev));
+				n = n->to(prev);
+			} while (n != _sentinel.get());
 		}
 
 		// --------------------------------------------------------------------
@@ -1291,8 +1647,11 @@ namespace collections {
 
 		[[no_unique_address, msvc::no_unique_address]] //TODO define macro for correct attr depending on compiler
 		node_allocator_type _allocator;
-		node_base _sentinel;
+		node_sentinel _sentinel;
 		size_type _size;
+		bool _isSizeStale = false;
+		node_batches _batches;
+		node_cache _cache;
 
 		struct node_chain {
 			size_type count = 0;
@@ -1302,17 +1661,37 @@ namespace collections {
 
 		template <class... Args>
 		[[nodiscard]] node_ptr createNode(Args&&... args) {
-			node_type* n = node_alloc_traits::allocate(_allocator, 1);
-			node_alloc_traits::construct(
-				_allocator, n, std::in_place_t{}, std::forward<Args>(args)...);
+			bool isBatched = false;
+			node_type* n = _cache.take(isBatched);
+			if (!n)
+				n = node_alloc_traits::allocate(_allocator, 1);
+
+			try {
+				node_alloc_traits::construct(
+					_allocator, n, std::in_place_t{}, std::forward<Args>(args)...);
+			}
+			catch (...) {
+				freeNode(n, isBatched);
+				throw;
+			}
+
+			if (isBatched)
+				node_batches::mark(n);
+
 			return n;
 		}
 
 		void destroyNode(node_ptr n) {
-			node_alloc_traits::destroy(
-				_allocator, static_cast<list_node_ptr>(n));
-			node_alloc_traits::deallocate(
-				_allocator, static_cast<list_node_ptr>(n), 1);
+			list_node_ptr node = static_cast<list_node_ptr>(n);
+			bool isBatched = node_batches::isBatched(node);
+			node_alloc_traits::destroy(_allocator, std::addressof(node->value()));
+			node_alloc_traits::destroy(_allocator, node);
+			freeNode(node, isBatched);
+		}
+
+		void freeNode(list_node_ptr node, bool isBatched) noexcept {
+			if (!_cache.park(node, isBatched))
+				_batches.deallocate(_allocator, node, isBatched);
 		}
 
 		template <
@@ -1322,6 +1701,12 @@ namespace collections {
 		node_chain createChain(in_iterator begin, sentinel end) {
 			if (begin == end)
 				return { 0, nullptr, nullptr };
+
+			if constexpr (std::forward_iterator<in_iterator>) {
+				auto count = static_cast<size_type>(std::ranges::distance(begin, end));
+				if (node_batches::isWorthBatching(count) && count > _cache.size())
+					return createBatchChain(begin, count);
+			}
 			
 			size_type count = 0;
 			node_ptr head = nullptr;
@@ -1341,35 +1726,238 @@ namespace collections {
 				}
 			}
 			catch (...) {
-				destroy(head, tail);
+				// the tail of a chain still has the null link it was built with
+				destroy(head, nullptr);
 				throw;
 			}
 
 			return { count, head, tail };
 		}
 
-		void fixLinkLoops(node_base& a, const node_base& b) {
-			if (a.to(next) == &b)
-				a.to(next) = &a;
+		// builds the chain from runs of nodes carved from blocks, so only
+		// chains longer than a block are split across blocks. The list stops
+		// carving once the chain is built, so it keeps no half empty block.
+		template <std::input_iterator in_iterator>
+		node_chain createBatchChain(in_iterator begin, size_type count) {
+			node_chain chain;
+
+			try {
+				while (node_batches::isWorthBatching(count - chain.count)) {
+					std::span<node_type> nodes = 
+						_batches.allocate(count - chain.count);
+					constructRun(nodes, begin);
+
+					for (size_type i = 1; i < nodes.size(); ++i) {
+						nodes[i - 1].to(next) = &nodes[i];
+						nodes[i].to(prev) = &nodes[i - 1];
+					}
+
+					if (chain.tail) {
+						chain.tail->to(next) = &nodes.front();
+						nodes.front().to(prev) = chain.tail;
+					}
+					else
+						chain.head = &nodes.front();
+
+					chain.tail = &nodes.back();
+					chain.count += nodes.size();
+				}
+
+				// a remainder too short to fill most of a block is allocated
+				// node by node.
+				for (; chain.count < count; ++chain.count) {
+					node_ptr n = createNode(*begin++);
+					n->to(prev) = chain.tail;
+					chain.tail->to(next) = n;
+					chain.tail = n;
+				}
+			}
+			catch (...) {
+				// the tail of a chain still has the null link it was built with
+				destroy(chain.head, nullptr);
+				_batches.reset();
+				throw;
+			}
+
+			_batches.reset();
+			return chain;
+		}
+
+		template <std::input_iterator in_iterator>
+		void constructRun(std::span<node_type> nodes, in_iterator& begin) {
+			size_type i = 0;
+
+			try {
+				for (; i < nodes.size(); ++i) {
+					node_alloc_traits::construct(
+						_allocator, &nodes[i], std::in_place_t{}, *begin++);
+					node_batches::mark(&nodes[i]);
+				}
+			}
+			catch (...) {
+				// the block is freed along with the last of its nodes
+				for (size_type j = 0; j < nodes.size(); ++j) {
+					if (j < i)
+						destroyNode(&nodes[j]);
+					else
+						freeNode(&nodes[j], true);
+				}
+				throw;
+			}
+		}
+
+		// merges the chains a and b, consuming both. If the comparison 
+		// throws, every node of both is left chained from a instead.
+		template <class compare_t>
+		[[nodiscard]] static node_ptr mergeChains(
+			node_ptr& a, 
+			node_ptr& b, 
+			compare_t& compare
+		) {
+			node_ptr head = nullptr;
+			node_ptr tail = nullptr;
+
+			try {
+				while (a && b) {
+					node_ptr n = nullptr;
+					if (compare(b->value(), a->value())) {
+						n = b;
+						b = b->to(next);
+					}
+					else {
+						n = a;
+						a = a->to(next);
+					}
+					append(head, tail, n);
+				}
+			}
+			catch (...) {
+				if (tail)
+					tail->to(next) = nullptr;
+
+				a = concatChains(head, concatChains(a, b));
+				b = nullptr;
+				throw;
+			}
+
+			append(head, tail, a ? a : b);
+			a = nullptr;
+			b = nullptr;
+			return head;
+		}
+
+		static node_ptr concatChains(node_ptr a, node_ptr b) noexcept {
+			if (!a)
+				return b;
+
+			node_ptr last = a;
+			while (last->to(next))
+				last = last->to(next);
+
+			last->to(next) = b;
+			return a;
+		}
+
+		static void append(node_ptr& head, node_ptr& tail, node_ptr n) noexcept {
+			if (tail)
+				tail->to(next) = n;
+			else
+				head = n;
+			tail = n;
+		}
+
+		// sorts the chain starting at head, consuming it. If the comparison
+		// throws, every node is chained back onto head in no particular 
+		// order, so the caller can put them back in the list.
+		template <class compare_t>
+		[[nodiscard]] static node_ptr sortChain(node_ptr& head, compare_t& compare) {
+			// bins[i] holds a sorted run of 2^i nodes, and runs in higher 
+			// bins hold earlier nodes, so merging them as the left operand
+			// keeps the sort stable.
+			constexpr auto MAX_BINS = std::numeric_limits<size_type>::digits;
+			node_ptr bins[MAX_BINS] = {};
+			node_ptr result = nullptr;
+			size_type filled = 0;
+
+			try {
+				while (head) {
+					node_ptr run = head;
+					head = head->to(next);
+					run->to(next) = nullptr;
+
+					size_type i = 0;
+					for (; i < filled && bins[i]; ++i)
+						run = mergeChains(bins[i], run, compare);
+
+					if (i == filled)
+						++filled;
+					bins[i] = run;
+				}
+
+				for (size_type i = 0; i < filled; ++i) {
+					if (!bins[i])
+						continue;
+
+					if (result)
+						result = mergeChains(bins[i], result, compare);
+					else
+						result = std::exchange(bins[i], nullptr);
+				}
+			}
+			catch (...) {
+				for (node_ptr bin : bins)
+					head = concatChains(bin, head);
+
+				head = concatChains(result, head);
+				throw;
+			}
+
+			return result;
+		}
+
+		void relinkChain(node_ptr head) noexcept {
+			node_ptr last = _sentinel.get();
+
+			while (head) {
+				last->to(next) = head;
+				head->to(prev) = last;
+				last = head;
+				head = head->to(next);
+			}
+
+			last->to(next) = _sentinel.get();
+			_sentinel->to(prev) = last;
+		}
+
+		void fixLinkLoops(node_ptr a, const_node_ptr b) {
+			if (a->to(next) == b)
+				a->to(next) = a;
 			else
-				a.to(next)->to(prev) = &a;
+				a->to(next)->to(prev) = a;
 
-			if (a.to(prev) == &b)
-				a.to(prev) = &a;
+			if (a->to(prev) == b)
+				a->to(prev) = a;
 			else
-				a.to(prev)->to(next) = &a;
+				a->to(prev)->to(next) = a;
 		}
 
 		void onMove(LinkedList&& other) noexcept {
-			fixLinkLoops(_sentinel, other._sentinel);
-			other._sentinel.to(prev) = &other._sentinel;
-			other._sentinel.to(next) = &other._sentinel;
+			fixLinkLoops(_sentinel.get(), other._sentinel.get());
+			other._sentinel->to(prev) = other._sentinel.get();
+			other._sentinel->to(next) = other._sentinel.get();
 			other._size = 0;
+			other._isSizeStale = false;
 		}
 
-		void moveMembers(LinkedList&& other) noexcept {
+		void moveMembers(LinkedList&& other) 
+			noexcept(std::is_nothrow_move_assignable_v<node_sentinel>) 
+		{
+			releaseNodes();
 			_sentinel = std::move(other._sentinel);
 			_size = std::move(other._size);
+			_isSizeStale = other._isSizeStale;
+			_batches = std::move(other._batches);
+			_cache = std::move(other._cache);
 			onMove(std::move(other));
 		}
 
@@ -1377,22 +1965,26 @@ namespace collections {
 			using std::swap;
 			swap(_sentinel, other._sentinel);
 			swap(_size, other._size);
-			fixLinkLoops(_sentinel, other._sentinel);
-			fixLinkLoops(other._sentinel, _sentinel);
+			swap(_isSizeStale, other._isSizeStale);
+			_batches.swap(other._batches);
+			_cache.swap(other._cache);
+			fixLinkLoops(_sentinel.get(), other._sentinel.get());
+			fixLinkLoops(other._sentinel.get(), _sentinel.get());
 		};
 
 		[[nodiscard]] node_ptr getNodeAt(size_type index) {
+			recount();
 			const_node_ptr n = std::as_const(*this).getNodeAt(index);
 			return const_cast<node_ptr>(n);
 		}
 
 		[[nodiscard]] const_node_ptr getNodeAt(size_type index) const {
-			size_type half_size = _size >> 1;
+			size_type count = size();
 
-			if (index <= half_size)
-				return traverseForwardFrom(_sentinel.to(next), index);
+			if (index <= (count >> 1))
+				return traverseForwardFrom(_sentinel->to(next), index);
 			else
-				return traverseBackwardFrom(&_sentinel, _size - index);
+				return traverseBackwardFrom(_sentinel.get(), count - index);
 		}
 
 		[[nodiscard]] const_node_ptr traverseForwardFrom(
@@ -1496,6 +2088,10 @@ namespace collections {
 		iterator remove(node_ptr head, node_ptr tail) {
 			snip(head, tail);
 			_size -= destroy(head, tail);
+
+			if (isEmpty())
+				_batches.reset();
+
 			return iterator(tail);
 		}
 
@@ -1665,6 +2261,15 @@ namespace collections {
 				return &_node->value();
 			}
 
+			// -----------------------------------------------------------------
+			/// <summary>
+			/// Prefetches the node the next increment will move to, so that
+			/// its load overlaps with work on the current element.
+			/// </summary> -----------------------------------------------------
+			void prefetch() const noexcept {
+				collections::prefetch(_node->to(next));
+			}
+
 			// -----------------------------------------------------------------
 			/// <summary>
 			/// ~~~ Pre-Increment Operator ~~~
@@ -18,6 +18,7 @@
 #pragma once
 
 #include <concepts>
+#include <cstdint>
 #include <cstdlib>
 #include <initializer_list>
 #include <memory>
@@ -28,10 +29,11 @@
 #include "DynamicArray.h"
 #include "../concepts/collection.h"
 #include "../util/CRTP.h"
+#include "../util/NodeArena.h"
 
 namespace collections {
 
-	template <class element_t, class allocator_t, int N>
+	template <class element_t, class allocator_t, int N, int tagged = -1>
 	class Node;
 
 	// -------------------------------------------------------------------------
@@ -47,22 +49,31 @@ namespace collections {
 	/// 
 	/// <typeparam name="allocator_t">
 	/// The allocator type used to define the node's pointer type using 
-	/// allocator traits.
+	/// allocator traits. When the allocator draws from a NodeArena and the
+	/// node has a fixed number of edges, each edge is stored as a 32-bit 
+	/// arena index and to() returns a link_reference that converts to and 
+	/// from base_ptr.
 	/// </typeparam>
 	/// 
 	/// <typeparam name="N">
 	/// The maximum number of edges allowed for the node. This template 
 	/// parameter must be a non-zero value. A negative value here, (N < 0), 
 	/// indicates that the node has dynamic size/number of edges.
+	/// </typeparam>
+	/// 
+	/// <typeparam name="tagged">
+	/// The index of the edge that also carries the node's one bit tag, or 
+	/// -1 if the node has no tag. The tag is packed into the low bit of 
+	/// that edge's pointer, or kept beside the edges for compact links.
 	/// </typeparam> -----------------------------------------------------------
-	template <class element_t, class allocator_t, int N>
+	template <class element_t, class allocator_t, int N, int tagged = -1>
 	class NodeBase : public CRTP<
-		Node<element_t, allocator_t, N>, 
-		NodeBase<element_t, allocator_t, N>
+		Node<element_t, allocator_t, N, tagged>, 
+		NodeBase<element_t, allocator_t, N, tagged>
 	> {
 	private:
-		using node_base	= NodeBase<element_t, allocator_t, N>;
-		using node		= Node<element_t, allocator_t, N>;
+		using node_base	= NodeBase<element_t, allocator_t, N, tagged>;
+		using node		= Node<element_t, allocator_t, N, tagged>;
 
 	protected:
 		using alloc_t			= rebind<allocator_t, element_t>;
@@ -88,16 +99,191 @@ namespace collections {
 
 	private:
 
-		using static_array	= StaticArray<base_ptr, N>;
+		template <class T>
+		struct arena_of {
+			using type		= NodeArena<>;
+			using link_type	= base_ptr;
+		};
+
+		template <arena_allocator T>
+		struct arena_of<T> {
+			using type		= T::arena_type;
+			using link_type	= type::index_type;
+		};
+
+		static constexpr bool has_compact_links = 
+			(N > 0) && arena_allocator<allocator_t>;
+
+		// nodes are at least pointer aligned, so the low bit of a pointer 
+		// edge is free for the tag. Compact links use every index bit.
+		static constexpr bool has_tag = tagged >= 0;
+		static constexpr bool packs_tag = 
+			has_tag && !has_compact_links && std::is_pointer_v<base_ptr>;
+		static constexpr std::uintptr_t TAG_BIT = 1;
+
+		using arena = arena_of<allocator_t>::type;
+
+		struct no_tag {};
+
+	public:
+
+		using link_type = std::conditional_t<
+			has_compact_links, 
+			typename arena_of<allocator_t>::link_type, 
+			std::conditional_t<packs_tag, std::uintptr_t, base_ptr>
+		>;
+
+	private:
+
+		using static_array	= StaticArray<link_type, N>;
 		using dynamic_array	= DynamicArray<base_ptr, allocator_type>;
 		using edges = std::conditional_t<(N > 0), static_array, dynamic_array>;
+		using tag_type = std::conditional_t<has_tag && !packs_tag, bool, no_tag>;
 
 		edges _edges = edges{};
 
+		[[no_unique_address, msvc::no_unique_address]]
+		tag_type _tag = tag_type{};
+
 		static_assert(N != 0, "Number of edges N must be non-zero");
+		static_assert(
+			!has_tag || (N > 0 && tagged < N), 
+			"The tagged edge must be one of a fixed number of edges"
+		);
 
 	public:
 
+		// ---------------------------------------------------------------------
+		/// <summary>
+		/// link_reference stands in for a reference to an edge stored as an 
+		/// arena index, reading and writing it as a base_ptr.
+		/// </summary> ---------------------------------------------------------
+		class link_reference {
+		public:
+
+			constexpr explicit link_reference(link_type& link) noexcept 
+				: _link(link) {}
+
+			constexpr link_reference(const link_reference&) noexcept = default;
+
+			// -----------------------------------------------------------------
+			/// <summary>
+			/// Points the edge at the node the other edge points to.
+			/// </summary> -----------------------------------------------------
+			link_reference& operator=(const link_reference& other) noexcept {
+				_link = other._link;
+				return *this;
+			}
+
+			// -----------------------------------------------------------------
+			/// <summary>
+			/// Points the edge at the given node, which must have been 
+			/// allocated from the arena, or null.
+			/// </summary> -----------------------------------------------------
+			link_reference& operator=(base_ptr node) noexcept {
+				_link = arena::indexOf(node);
+				return *this;
+			}
+
+			// -----------------------------------------------------------------
+			/// <summary>
+			/// Returns a pointer to the node the edge points to.
+			/// </summary> -----------------------------------------------------
+			operator base_ptr() const noexcept {
+				return static_cast<base_ptr>(
+					arena::addressOf(std::addressof(_link), _link));
+			}
+
+			// -----------------------------------------------------------------
+			/// <summary>
+			/// Returns a pointer to the node the edge points to.
+			/// </summary> -----------------------------------------------------
+			base_ptr operator->() const noexcept {
+				return *this;
+			}
+
+			// -----------------------------------------------------------------
+			/// <summary>
+			/// Swaps the nodes the given edges point to.
+			/// </summary> -----------------------------------------------------
+			friend void swap(link_reference a, link_reference b) noexcept {
+				std::swap(a._link, b._link);
+			}
+
+		private:
+
+			link_type& _link;
+		};
+
+		// ---------------------------------------------------------------------
+		/// <summary>
+		/// tagged_link_reference stands in for a reference to a pointer edge 
+		/// whose low bit may hold the node's tag, reading and writing only 
+		/// the pointer so the tag stays with the node that owns the edge.
+		/// </summary> ---------------------------------------------------------
+		class tagged_link_reference {
+		public:
+
+			constexpr explicit tagged_link_reference(link_type& link) noexcept 
+				: _link(link) {}
+
+			constexpr tagged_link_reference(
+				const tagged_link_reference&
+			) noexcept = default;
+
+			// -----------------------------------------------------------------
+			/// <summary>
+			/// Points the edge at the node the other edge points to.
+			/// </summary> -----------------------------------------------------
+			tagged_link_reference& operator=(
+				const tagged_link_reference& other
+			) noexcept {
+				return *this = static_cast<base_ptr>(other);
+			}
+
+			// -----------------------------------------------------------------
+			/// <summary>
+			/// Points the edge at the given node, or null.
+			/// </summary> -----------------------------------------------------
+			tagged_link_reference& operator=(base_ptr node) noexcept {
+				_link = reinterpret_cast<link_type>(node) | (_link & TAG_BIT);
+				return *this;
+			}
+
+			// -----------------------------------------------------------------
+			/// <summary>
+			/// Returns a pointer to the node the edge points to.
+			/// </summary> -----------------------------------------------------
+			operator base_ptr() const noexcept {
+				return reinterpret_cast<base_ptr>(_link & ~TAG_BIT);
+			}
+
+			// -----------------------------------------------------------------
+			/// <summary>
+			/// Returns a pointer to the node the edge points to.
+			/// </summary> -----------------------------------------------------
+			base_ptr operator->() const noexcept {
+				return *this;
+			}
+
+			// -----------------------------------------------------------------
+			/// <summary>
+			/// Swaps the nodes the given edges point to.
+			/// </summary> -----------------------------------------------------
+			friend void swap(
+				tagged_link_reference a, 
+				tagged_link_reference b
+			) noexcept {
+				base_ptr node = a;
+				a = b;
+				b = node;
+			}
+
+		private:
+
+			link_type& _link;
+		};
+
 		// deleted to prevent rval binding to const lval with access operations.
 		constexpr const value_type&& operator*() const&& = delete;
 		constexpr const value_type&& value() const&& = delete;
@@ -208,10 +394,17 @@ namespace collections {
 		/// </param>
 		/// 
 		/// <returns>
-		/// Returns a pointer to the node at the indexed edge.
+		/// Returns a reference to the pointer to the node at the indexed 
+		/// edge, or a link_reference for compact links and a 
+		/// tagged_link_reference for tagged nodes.
 		/// </returns> ---------------------------------------------------------
-		[[nodiscard]] constexpr base_ptr& to(size_t index) {
-			return _edges[index];
+		[[nodiscard]] constexpr decltype(auto) to(size_t index) {
+			if constexpr (has_compact_links)
+				return link_reference(_edges[index]);
+			else if constexpr (packs_tag)
+				return tagged_link_reference(_edges[index]);
+			else
+				return (_edges[index]);
 		}
 
 		// ---------------------------------------------------------------------
@@ -224,10 +417,18 @@ namespace collections {
 		/// </param>
 		/// 
 		/// <returns>
-		/// Returns a const_pointer to the node at the indexed edge.
+		/// Returns a const reference to the pointer to the node at the 
+		/// indexed edge, or the pointer itself for compact links and tagged
+		/// nodes.
 		/// </returns> ---------------------------------------------------------
-		[[nodiscard]] constexpr const base_ptr& to(size_t index) const {
-			return _edges[index];
+		[[nodiscard]] constexpr decltype(auto) to(size_t index) const {
+			if constexpr (has_compact_links)
+				return static_cast<base_ptr>(arena::addressOf(
+					std::addressof(_edges[index]), _edges[index]));
+			else if constexpr (packs_tag)
+				return reinterpret_cast<base_ptr>(_edges[index] & ~TAG_BIT);
+			else
+				return (_edges[index]);
 		}
 
 		// ---------------------------------------------------------------------
@@ -240,8 +441,12 @@ namespace collections {
 		/// </returns> ---------------------------------------------------------
 		[[nodiscard]] constexpr size_type degree() const {
 			size_type degree = 0;
-			for (auto& edge : _edges)
-				degree += (edge == nullptr) ? 0 : 1;
+			for (auto& edge : _edges) {
+				if constexpr (packs_tag)
+					degree += (edge & ~TAG_BIT) ? 1 : 0;
+				else
+					degree += (edge == link_type{}) ? 0 : 1;
+			}
 			return degree;
 		}
 
@@ -257,6 +462,34 @@ namespace collections {
 		[[nodiscard]] constexpr size_type max_degree() const {
 			return N;
 		}
+
+		// ---------------------------------------------------------------------
+		/// <summary>
+		/// Returns the one bit tag carried by the node, which is false for a 
+		/// newly constructed node.
+		/// </summary> ---------------------------------------------------------
+		[[nodiscard]] bool tag() const noexcept requires (has_tag) {
+			if constexpr (packs_tag)
+				return _edges[tagged] & TAG_BIT;
+			else
+				return _tag;
+		}
+
+		// ---------------------------------------------------------------------
+		/// <summary>
+		/// Sets the one bit tag carried by the node, leaving its edges as 
+		/// they are.
+		/// </summary>
+		/// 
+		/// <param name="value">
+		/// The new value of the tag.
+		/// </param> -----------------------------------------------------------
+		void setTag(bool value) noexcept requires (has_tag) {
+			if constexpr (packs_tag)
+				_edges[tagged] = (_edges[tagged] & ~TAG_BIT) | value;
+			else
+				_tag = value;
+		}
 	};
 	
 	// -------------------------------------------------------------------------
@@ -280,11 +513,17 @@ namespace collections {
 	/// The maximum number of edges allowed for the node. This template 
 	/// parameter must be a non-zero value. A negative value here, (N < 0), 
 	/// indicates that the node has dynamic size/number of edges.
+	/// </typeparam>
+	/// 
+	/// <typeparam name="tagged">
+	/// The index of the edge that also carries the node's one bit tag, or 
+	/// -1 if the node has no tag. The tag is packed into the low bit of 
+	/// that edge's pointer, or kept beside the edges for compact links.
 	/// </typeparam> -----------------------------------------------------------
-	template <class element_t, class allocator_t, int N>
-	class Node : public NodeBase<element_t, allocator_t, N> {
+	template <class element_t, class allocator_t, int N, int tagged>
+	class Node : public NodeBase<element_t, allocator_t, N, tagged> {
 	public:
-		using base = NodeBase<element_t, allocator_t, N>;
+		using base = NodeBase<element_t, allocator_t, N, tagged>;
 
 	private:
 		using alloc_traits	= base::alloc_traits;
@@ -467,5 +706,167 @@ namespace collections {
 
 		friend base;
 	};
+
+	// -------------------------------------------------------------------------
+	/// <summary>
+	/// Holds the sentinel node of a container whose other nodes link back to
+	/// it. By default the sentinel is stored inline. When the allocator draws
+	/// from a NodeArena the sentinel is allocated from the container's arena
+	/// instead, so compact links can address it like any other node.
+	///
+	/// <para>
+	/// Moving sentinels moves their links, never their addresses, exactly as
+	/// for an inline node. An arena sentinel moved into from another arena is
+	/// reallocated from that arena first, and swapping arena sentinels swaps
+	/// their nodes, so containers must relink loops through them afterwards.
+	/// </para>
+	/// </summary>
+	/// 
+	/// <typeparam name="node_t">
+	/// The type of the sentinel node.
+	/// </typeparam>
+	/// 
+	/// <typeparam name="allocator_t">
+	/// The allocator type of the owning container.
+	/// </typeparam> -----------------------------------------------------------
+	template <class node_t, class allocator_t>
+	class SentinelNode {
+	public:
+
+		// ---------------------------------------------------------------------
+		constexpr SentinelNode() noexcept = default;
+
+		// ---------------------------------------------------------------------
+		template <class alloc_t>
+		constexpr explicit SentinelNode(const alloc_t&) noexcept {
+
+		}
+
+		// ---------------------------------------------------------------------
+		[[nodiscard]] constexpr node_t* get() noexcept {
+			return std::addressof(_node);
+		}
+
+		// ---------------------------------------------------------------------
+		[[nodiscard]] constexpr const node_t* get() const noexcept {
+			return std::addressof(_node);
+		}
+
+		// ---------------------------------------------------------------------
+		[[nodiscard]] constexpr node_t* operator->() noexcept {
+			return get();
+		}
+
+		// ---------------------------------------------------------------------
+		[[nodiscard]] constexpr const node_t* operator->() const noexcept {
+			return get();
+		}
+
+		// ---------------------------------------------------------------------
+		friend constexpr void swap(SentinelNode& a, SentinelNode& b) noexcept {
+			using std::swap;
+			swap(a._node, b._node);
+		}
+
+	private:
+
+		node_t _node{};
+	};
+
+	// -------------------------------------------------------------------------
+	template <class node_t, arena_allocator allocator_t>
+	class SentinelNode<node_t, allocator_t> {
+	private:
+
+		using node_alloc_t		= rebind<allocator_t, node_t>;
+		using node_alloc_traits = std::allocator_traits<node_alloc_t>;
+
+	public:
+
+		// ---------------------------------------------------------------------
+		SentinelNode() : SentinelNode(node_alloc_t()) {
+
+		}
+
+		// ---------------------------------------------------------------------
+		template <class alloc_t>
+		explicit SentinelNode(const alloc_t& alloc) :
+			_allocator(alloc),
+			_node(create(_allocator))
+		{
+
+		}
+
+		// ---------------------------------------------------------------------
+		SentinelNode(SentinelNode&& other) :
+			_allocator(other._allocator),
+			_node(create(_allocator))
+		{
+			*_node = *other._node;
+		}
+
+		// ---------------------------------------------------------------------
+		SentinelNode& operator=(SentinelNode&& other) {
+			// links are indices into the sentinel's own arena, so they can 
+			// only be copied between sentinels of the same arena.
+			if (_allocator != other._allocator) {
+				node_t* n = create(other._allocator);
+				destroy(_allocator, _node);
+				_allocator = other._allocator;
+				_node = n;
+			}
+
+			*_node = *other._node;
+			return *this;
+		}
+
+		// ---------------------------------------------------------------------
+		~SentinelNode() {
+			destroy(_allocator, _node);
+		}
+
+		// ---------------------------------------------------------------------
+		[[nodiscard]] node_t* get() noexcept {
+			return _node;
+		}
+
+		// ---------------------------------------------------------------------
+		[[nodiscard]] const node_t* get() const noexcept {
+			return _node;
+		}
+
+		// ---------------------------------------------------------------------
+		[[nodiscard]] node_t* operator->() noexcept {
+			return _node;
+		}
+
+		// ---------------------------------------------------------------------
+		[[nodiscard]] const node_t* operator->() const noexcept {
+			return _node;
+		}
+
+		// ---------------------------------------------------------------------
+		friend void swap(SentinelNode& a, SentinelNode& b) noexcept {
+			using std::swap;
+			swap(a._allocator, b._allocator);
+			swap(a._node, b._node);
+		}
+
+	private:
+
+		node_alloc_t _allocator;
+		node_t* _node;
+
+		[[nodiscard]] static node_t* create(node_alloc_t& alloc) {
+			node_t* n = node_alloc_traits::allocate(alloc, 1);
+			node_alloc_traits::construct(alloc, n);
+			return n;
+		}
+
+		static void destroy(node_alloc_t& alloc, node_t* n) noexcept {
+			node_alloc_traits::destroy(alloc, n);
+			node_alloc_traits::deallocate(alloc, n, 1);
+		}
+	};
 }
 
@@ -0,0 +1,729 @@
+/* ============================================================================
+* Copyright (C) 2023 Ryan Eubank
+*
+* This program is free software: you can redistribute it and/or modify
+* it under the terms of the GNU General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License
+* along with this program.  If not, see <https://www.gnu.org/licenses/>.
+* ========================================================================= */
+
+#pragma once
+
+#include <bit>
+#include <compare>
+#include <cstdint>
+#include <cstdlib>
+#include <initializer_list>
+#include <istream>
+#include <iterator>
+#include <memory>
+#include <ostream>
+#include <ranges>
+#include <type_traits>
+#include <utility>
+
+#if defined(__BMI2__)
+#include <immintrin.h>
+#endif
+
+#include "../algorithms/stream.h"
+#include "../concepts/collection.h"
+#include "../concepts/iterable.h"
+#include "BitArray.h"
+#include "DynamicArray.h"
+
+namespace collections {
+
+	// -------------------------------------------------------------------------
+	/// <summary>
+	/// RankSelectBitVector is an immutable sequence of bits that answers rank
+	/// (number of set bits before a position) in constant time and select
+	/// (position of the k-th set bit) in near constant time.
+	///
+	/// <para>
+	/// Rank is served by a two-level directory: a 64-bit absolute count per
+	/// 4096-bit superblock and a 16-bit count relative to the superblock per
+	/// 256-bit block, leaving at most four word popcounts per query. Select
+	/// samples the superblock of every 4096th set bit to bound its search.
+	/// The directory costs roughly 9.5% on top of the packed bits.
+	/// </para>
+	/// </summary>
+	///
+	/// <typeparam name="allocator_t">
+	/// The type of the allocator responsible for allocating memory to the
+	/// vector and its directory.
+	/// </typeparam> -----------------------------------------------------------
+	template <class allocator_t = std::allocator<uint64_t>>
+	class RankSelectBitVector final {
+	private:
+
+		using bit_array			= BitArray<allocator_t>;
+		using word_type			= uint64_t;
+		using super_array		= DynamicArray<uint64_t, rebind<allocator_t, uint64_t>>;
+		using block_array		= DynamicArray<uint16_t, rebind<allocator_t, uint16_t>>;
+
+		static constexpr size_t BITS_PER_WORD		= 64;
+		static constexpr size_t WORDS_PER_BLOCK		= 4;
+		static constexpr size_t BLOCKS_PER_SUPER	= 16;
+		static constexpr size_t WORDS_PER_SUPER		= WORDS_PER_BLOCK * BLOCKS_PER_SUPER;
+		static constexpr size_t SELECT_SAMPLE_RATE	= 4096;
+
+	public:
+
+		using value_type		= bool;
+		using allocator_type	= allocator_t;
+		using reference			= bool;
+		using const_reference	= bool;
+		using size_type			= bit_array::size_type;
+		using difference_type	= bit_array::difference_type;
+		using pointer			= bit_array::const_pointer;
+		using const_pointer		= bit_array::const_pointer;
+
+		using iterator					= bit_array::const_iterator;
+		using const_iterator			= bit_array::const_iterator;
+		using reverse_iterator			= bit_array::const_reverse_iterator;
+		using const_reverse_iterator	= bit_array::const_reverse_iterator;
+
+		// ---------------------------------------------------------------------
+		/// <summary>
+		/// ~~~ Default Constructor ~~~
+		///
+		///	<para>
+		/// Constructs an empty bit vector.
+		/// </para></summary> --------------------------------------------------
+		RankSelectBitVector() = default;
+
+		// ---------------------------------------------------------------------
+		/// <summary>
+		/// ~~~ Allocator Constructor ~~~
+		///
+		///	<para>
+		/// Constructs an empty bit vector.
+		/// </para></summary>
+		///
+		/// <param name="alloc">
+		/// The allocator instance used by the vector.
+		/// </param> -----------------------------------------------------------
+		explicit RankSelectBitVector(const allocator_type& alloc) :
+			_bits(alloc),
+			_supers(rebind<allocator_t, uint64_t>(alloc)),
+			_blocks(rebind<allocator_t, uint16_t>(alloc)),
+			_samples(rebind<allocator_t, uint64_t>(alloc)),
+			_ones(0)
+		{
+
+		}
+
+		// ---------------------------------------------------------------------
+		/// <summary>
+		/// ~~~ BitArray Constructor ~~~
+		///
+		///	<para>
+		/// Takes ownership of the given bits and builds the rank and select
+		/// directory over them.
+		/// </para></summary>
+		///
+		/// <param name="bits">
+		/// The bits the vector will index.
+		/// </param> -----------------------------------------------------------
+		explicit RankSelectBitVector(bit_array bits) :
+			RankSelectBitVector(bits.allocator())
+		{
+			_bits = std::move(bits);
+			buildDirectory();
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// ~~~ Initialization Constructor ~~~
+		///
+		/// <para>
+		/// Constructs a bit vector from the bits in the specified
+		/// initialization list.
+		/// </para></summary>
+		///
+		/// <param name="init">
+		/// The initialization list to copy bits from.
+		/// </param>
+		/// <param name="alloc">
+		/// The allocator instance used by the vector. Default constructs the
+		/// allocator if unspecified.
+		/// </param> ----------------------------------------------------------
+		RankSelectBitVector(
+			std::initializer_list<value_type> init,
+			const allocator_type& alloc = allocator_type{}
+		) : RankSelectBitVector(init.begin(), init.end(), alloc) {
+
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// ~~~ Iterator Constructor ~~~
+		///
+		/// <para>
+		/// Constructs a bit vector from the values in the given
+		/// iterator/sentinel pair. The input is read once, then the directory
+		/// is built in a single pass over the packed words.
+		/// </para></summary>
+		///
+		/// <typeparam name="in_iterator">
+		/// The type of the beginning iterator to copy from.
+		/// </typeparam>
+		/// <typeparam name="sentinel">
+		/// The type of the end iterator or sentinel.
+		/// </typeparam>
+		///
+		/// <param name="begin">
+		/// The beginning of the range to copy from.
+		/// </param>
+		/// <param name="end">
+		/// The end of the range to copy from.
+		/// </param>
+		/// <param name="alloc">
+		/// The allocator instance used by the vector. Default constructs the
+		/// allocator if unspecified.
+		/// </param> ----------------------------------------------------------
+		template <
+			std::input_iterator in_iterator,
+			std::sentinel_for<in_iterator> sentinel
+		>
+		RankSelectBitVector(
+			in_iterator begin,
+			sentinel end,
+			const allocator_type& alloc = allocator_type{}
+		) : RankSelectBitVector(bit_array(begin, end, alloc)) {
+
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// ~~~ Range Constructor ~~~
+		///
+		/// <para>
+		/// Constructs a bit vector from the values in the given range.
+		/// </para></summary>
+		///
+		/// <typeparam name="range">
+		/// The type of the range being constructed from.
+		/// </typeparam>
+		///
+		/// <param name="tag">
+		/// Range construction tag to disabiguate this constructor from
+		/// construction with an initializer list.
+		/// </param>
+		/// <param name="rg">
+		/// The range to construct the vector with.
+		/// </param>
+		/// <param name="alloc">
+		/// The allocator instance for the vector. Default constructs the
+		/// allocator if unspecified.
+		/// </param> ----------------------------------------------------------
+		template <std::ranges::input_range range>
+		RankSelectBitVector(
+			from_range_t tag,
+			range&& rg,
+			const allocator_type& alloc = allocator_type{}
+		) : RankSelectBitVector(
+			std::ranges::begin(rg), std::ranges::end(rg), alloc)
+		{
+
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Returns the value of the bit at the given index.
+		/// </summary>
+		///
+		/// <param name="index">
+		/// The index of the bit to retrieve.
+		/// </param>
+		///
+		/// <returns>
+		/// Returns the value of the bit at the specified index.
+		/// </returns> --------------------------------------------------------
+		[[nodiscard]] const_reference operator[](size_type index) const noexcept {
+			return _bits.test(index);
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Performs safe indexing of the vector checking the bounds of the
+		/// requested index before returning the appropriate bit.
+		/// </summary>
+		///
+		/// <param name="index">
+		/// The index of the bit to retrieve.
+		/// </param>
+		///
+		/// <returns>
+		/// Returns the value of the bit at the specified index.
+		/// </returns> --------------------------------------------------------
+		[[nodiscard]] const_reference at(size_type index) const {
+			return _bits.at(index);
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Returns the number of set bits strictly before the given index.
+		/// </summary>
+		///
+		/// <param name="index">
+		/// The exclusive end of the prefix to count, at most size().
+		/// </param>
+		///
+		/// <returns>
+		/// Returns the number of ones in the bit range [0, index).
+		/// </returns> --------------------------------------------------------
+		[[nodiscard]] size_type rank1(size_type index) const noexcept {
+			size_type word = index / BITS_PER_WORD;
+			size_type block = word / WORDS_PER_BLOCK;
+			size_type super = word / WORDS_PER_SUPER;
+			const word_type* words = _bits.asRawPointer();
+
+			size_type rank = 0;
+			if (block < _blocks.size())
+				rank = _supers[super] + _blocks[block];
+			else
+				return _ones;
+
+			for (size_type i = block * WORDS_PER_BLOCK; i < word; ++i)
+				rank += std::popcount(words[i]);
+
+			size_type offset = index % BITS_PER_WORD;
+			if (offset)
+				rank += std::popcount(words[word] << (BITS_PER_WORD - offset));
+
+			return rank;
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Returns the number of cleared bits strictly before the given index.
+		/// </summary>
+		///
+		/// <param name="index">
+		/// The exclusive end of the prefix to count, at most size().
+		/// </param>
+		///
+		/// <returns>
+		/// Returns the number of zeros in the bit range [0, index).
+		/// </returns> --------------------------------------------------------
+		[[nodiscard]] size_type rank0(size_type index) const noexcept {
+			return index - rank1(index);
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Returns the position of the k-th set bit, counting from zero, so
+		/// that select1(rank1(i)) == i for every set bit i.
+		/// </summary>
+		///
+		/// <param name="k">
+		/// The zero based ordinal of the set bit to locate.
+		/// </param>
+		///
+		/// <returns>
+		/// Returns the index of the k-th set bit, or size() if the vector
+		/// holds k or fewer set bits.
+		/// </returns> --------------------------------------------------------
+		[[nodiscard]] size_type select1(size_type k) const noexcept {
+			if (k >= _ones)
+				return _bits.size();
+
+			size_type sample = k / SELECT_SAMPLE_RATE;
+			size_type low = _samples[sample];
+			size_type high = (sample + 1 < _samples.size()) ?
+				_samples[sample + 1] + 1 : _supers.size();
+
+			while (high - low > 1) {
+				size_type mid = low + (high - low) / 2;
+				if (_supers[mid] <= k)
+					low = mid;
+				else
+					high = mid;
+			}
+
+			size_type remaining = k - _supers[low];
+			size_type block = low * BLOCKS_PER_SUPER;
+			size_type lastBlock = std::min(
+				block + BLOCKS_PER_SUPER, _blocks.size());
+
+			while (block + 1 < lastBlock && _blocks[block + 1] <= remaining)
+				++block;
+
+			remaining -= _blocks[block];
+
+			const word_type* words = _bits.asRawPointer();
+			size_type word = block * WORDS_PER_BLOCK;
+
+			for (;;) {
+				size_type ones = std::popcount(words[word]);
+				if (remaining < ones)
+					break;
+				remaining -= ones;
+				++word;
+			}
+
+			return word * BITS_PER_WORD + selectInWord(words[word], remaining);
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Returns the total number of set bits in the vector.
+		/// </summary>
+		///
+		/// <returns>
+		/// Returns the population count of the vector.
+		/// </returns> --------------------------------------------------------
+		[[nodiscard]] size_type count() const noexcept {
+			return _ones;
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Returns the underlying bits indexed by the vector.
+		/// </summary>
+		///
+		/// <returns>
+		/// Returns a const reference to the packed bit array.
+		/// </returns> --------------------------------------------------------
+		[[nodiscard]] const bit_array& bits() const noexcept {
+			return _bits;
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Returns the allocator managing memory for the container.
+		/// </summary>
+		///
+		/// <returns>
+		/// Returns a copy of the allocator managing memory for the container.
+		/// </returns> --------------------------------------------------------
+		[[nodiscard]] allocator_type allocator() const noexcept {
+			return _bits.allocator();
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Returns the number of bits contained by the vector.
+		/// </summary>
+		///
+		/// <returns>
+		/// Returns the number of bits in the vector.
+		/// </returns> --------------------------------------------------------
+		[[nodiscard]] size_type size() const noexcept {
+			return _bits.size();
+		}
+
+		// ---------------------------------------------------------------------
+		/// <summary>
+		/// Returns the theoretical maximum size for the container.
+		/// </summary>
+		///
+		/// <returns>
+		/// Returns the size limit of the container type.
+		/// </returns> ---------------------------------------------------------
+		[[nodiscard]] size_type max_size() const noexcept {
+			return _bits.max_size();
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Returns whether the vector is empty and contains no bits.
+		/// </summary>
+		///
+		/// <returns>
+		/// Returns true is the vector contains zero bits, false otherwise.
+		/// </returns> --------------------------------------------------------
+		[[nodiscard]] bool isEmpty() const noexcept {
+			return _bits.isEmpty();
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Empties the vector and its directory.
+		/// </summary> --------------------------------------------------------
+		void clear() noexcept {
+			_bits.clear();
+			_supers.clear();
+			_blocks.clear();
+			_samples.clear();
+			_ones = 0;
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Returns an iterator pointing to the beginning of the vector.
+		/// </summary>
+		///
+		/// <returns>
+		/// Returns a constant random access iterator to the first bit.
+		/// </returns> --------------------------------------------------------
+		[[nodiscard]] const_iterator begin() const noexcept {
+			return _bits.begin();
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Returns an iterator pointing to the end of the vector.
+		/// </summary>
+		///
+		/// <returns>
+		/// Returns a constant random access iterator to the location after
+		/// the last bit.
+		/// </returns> --------------------------------------------------------
+		[[nodiscard]] const_iterator end() const noexcept {
+			return _bits.end();
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Returns an iterator pointing to the beginning of the vector.
+		/// </summary>
+		///
+		/// <returns>
+		/// Returns a constant random access iterator to the first bit.
+		/// </returns> --------------------------------------------------------
+		[[nodiscard]] const_iterator cbegin() const noexcept {
+			return _bits.cbegin();
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Returns an iterator pointing to the end of the vector.
+		/// </summary>
+		///
+		/// <returns>
+		/// Returns a constant random access iterator to the location after
+		/// the last bit.
+		/// </returns> --------------------------------------------------------
+		[[nodiscard]] const_iterator cend() const noexcept {
+			return _bits.cend();
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Returns a reverse iterator pointing to the end of the vector.
+		/// </summary>
+		///
+		/// <returns>
+		/// Returns a constant reverse iterator to the last bit.
+		/// </returns> --------------------------------------------------------
+		[[nodiscard]] const_reverse_iterator rbegin() const noexcept {
+			return _bits.rbegin();
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Returns a reverse iterator pointing to the beginning of the vector.
+		/// </summary>
+		///
+		/// <returns>
+		/// Returns a constant reverse iterator to the location before the
+		/// first bit.
+		/// </returns> --------------------------------------------------------
+		[[nodiscard]] const_reverse_iterator rend() const noexcept {
+			return _bits.rend();
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Returns a reverse iterator pointing to the end of the vector.
+		/// </summary>
+		///
+		/// <returns>
+		/// Returns a constant reverse iterator to the last bit.
+		/// </returns> --------------------------------------------------------
+		[[nodiscard]] const_reverse_iterator crbegin() const noexcept {
+			return _bits.crbegin();
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Returns a reverse iterator pointing to the beginning of the vector.
+		/// </summary>
+		///
+		/// <returns>
+		/// Returns a constant reverse iterator to the location before the
+		/// first bit.
+		/// </returns> --------------------------------------------------------
+		[[nodiscard]] const_reverse_iterator crend() const noexcept {
+			return _bits.crend();
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// ~~~ Equality Operator ~~~
+		/// </summary>
+		///
+		/// <returns>
+		/// Returns true if both vectors hold the same bits.
+		/// </returns> --------------------------------------------------------
+		friend bool operator==(
+			const RankSelectBitVector& lhs,
+			const RankSelectBitVector& rhs
+		) noexcept {
+			return lhs._bits == rhs._bits;
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// ~~~ Comparison Operator ~~~
+		/// </summary>
+		///
+		/// <returns>
+		/// Returns the lexicographic ordering of the vectors' bits.
+		/// </returns> --------------------------------------------------------
+		friend auto operator<=>(
+			const RankSelectBitVector& lhs,
+			const RankSelectBitVector& rhs
+		) noexcept {
+			return lhs._bits <=> rhs._bits;
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// ~~~ Output Stream Operator ~~~
+		/// </summary>
+		///
+		/// <typeparam name="char_t">
+		/// The type of the character stream written to by the operator.
+		/// </typeparam>
+		///
+		/// <param name="os">
+		/// The stream being written to.
+		/// </param>
+		/// <param name="vec">
+		/// The vector being read from.
+		/// </param>
+		///
+		/// <returns>
+		/// Returns the output stream after writing.
+		/// </returns> --------------------------------------------------------
+		template <typename char_t>
+		friend std::basic_ostream<char_t>& operator<<(
+			std::basic_ostream<char_t>& os,
+			const RankSelectBitVector& vec
+		) {
+			return os << vec._bits;
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// ~~~ Input Stream Operator ~~~
+		/// </summary>
+		///
+		/// <typeparam name="char_t">
+		/// The type of the character stream read by the operator.
+		/// </typeparam>
+		///
+		/// <param name="is">
+		/// The stream being read from.
+		/// </param>
+		/// <param name="vec">
+		/// The vector being written to. Its directory is rebuilt after
+		/// reading.
+		/// </param>
+		///
+		/// <returns>
+		/// Returns the input stream after reading.
+		/// </returns> --------------------------------------------------------
+		template <typename char_t>
+		friend std::basic_istream<char_t>& operator>>(
+			std::basic_istream<char_t>& is,
+			RankSelectBitVector& vec
+		) {
+			is >> vec._bits;
+			vec.buildDirectory();
+			return is;
+		}
+
+	private:
+
+		bit_array _bits;
+		super_array _supers;
+		block_array _blocks;
+		super_array _samples;
+		size_type _ones = 0;
+
+		void buildDirectory() {
+			const word_type* words = _bits.asRawPointer();
+			size_type wordCount = _bits.wordCount();
+			size_type blockCount =
+				(wordCount + WORDS_PER_BLOCK - 1) / WORDS_PER_BLOCK;
+			size_type superCount =
+				(blockCount + BLOCKS_PER_SUPER - 1) / BLOCKS_PER_SUPER;
+
+			_supers.clear();
+			_blocks.clear();
+			_samples.clear();
+			_ones = 0;
+
+			if (blockCount) {
+				_supers.reserve(superCount);
+				_blocks.reserve(blockCount);
+			}
+
+			size_type superBase = 0;
+			for (size_type i = 0; i < wordCount; ++i) {
+				if (i % WORDS_PER_SUPER == 0) {
+					superBase = _ones;
+					_supers.insertBack(superBase);
+				}
+
+				if (i % WORDS_PER_BLOCK == 0)
+					_blocks.insertBack(static_cast<uint16_t>(_ones - superBase));
+
+				size_type ones = std::popcount(words[i]);
+				size_type nextSample = _samples.size() * SELECT_SAMPLE_RATE;
+
+				if (_ones + ones > nextSample)
+					_samples.insertBack(_supers.size() - 1);
+
+				_ones += ones;
+			}
+		}
+
+		[[nodiscard]] static size_type selectInWord(
+			word_type word,
+			size_type k
+		) noexcept {
+		#if defined(__BMI2__)
+			return std::countr_zero(_pdep_u64(word_type(1) << k, word));
+		#else
+			size_type shift = 0;
+			for (;;) {
+				size_type ones = std::popcount(word & 0xff);
+				if (k < ones)
+					break;
+				k -= ones;
+				word >>= 8;
+				shift += 8;
+			}
+
+			while (k--)
+				word &= word - 1;
+
+			return shift + std::countr_zero(word);
+		#endif
+		}
+	};
+
+	static_assert(
+		collection<RankSelectBitVector<>>,
+		"RankSelectBitVector does not meet the requirements for a collection."
+	);
+
+	static_assert(
+		random_access_iterable<RankSelectBitVector<>>,
+		"RankSelectBitVector does not meet the requirements for random access iteration."
+	);
+}
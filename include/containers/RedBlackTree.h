@@ -0,0 +1,691 @@
+/* ============================================================================
+* Copyright (C) 2023 Ryan Eubank
+*
+* This program is free software: you can redistribute it and/or modify
+* it under the terms of the GNU General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License
+* along with this program.  If not, see <https://www.gnu.org/licenses/>.
+* ========================================================================= */
+
+#pragma once
+
+#include <bit>
+#include <cstdint>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <ranges>
+#include <type_traits>
+#include <utility>
+
+#include "base/BaseBST.h"
+#include "../concepts/associative.h"
+#include "../concepts/collection.h"
+#include "../concepts/iterable.h" 
+#include "../concepts/map.h"
+#include "../concepts/positional.h"
+#include "../util/key_value_pair.h"
+
+namespace collections {
+
+	// -------------------------------------------------------------------------
+	/// <summary>
+	/// RedBlackTree is a self balancing binary search tree that keeps every
+	/// path from the root to a leaf within twice the length of any other. Its
+	/// looser balance than AVLTree costs slightly longer searches but needs at
+	/// most two rotations per insert and three per delete, which favors write
+	/// heavy workloads.
+	/// </summary> -------------------------------------------------------------
+	template <
+		class element_t,
+		class compare_t,
+		class allocator_t,
+		bool hasDuplicates,
+		bool isRanked = false
+	> 
+	class RedBlackTree : public impl::BaseBST<
+		element_t, 
+		compare_t, 
+		allocator_t,
+		hasDuplicates,
+		isRanked,
+		false,
+		RedBlackTree<element_t, compare_t, allocator_t, hasDuplicates, isRanked>,
+		true>
+	{
+	private:
+
+		using tree		= RedBlackTree<element_t, compare_t, allocator_t, hasDuplicates, isRanked>;
+		using base_tree	= impl::BaseBST<
+			element_t, 
+			compare_t, 
+			allocator_t, 
+			hasDuplicates, 
+			isRanked, 
+			false, 
+			tree,
+			true
+		>;
+
+		using _node_type			= base_tree::node_type;
+		using alloc_traits			= base_tree::alloc_traits;
+		using node_allocator_type	= rebind<allocator_t, _node_type>;
+		using node_alloc_traits		= std::allocator_traits<node_allocator_type>;
+		using base_ptr				= base_tree::base_ptr;
+		using const_base_ptr		= base_tree::const_base_ptr;
+		using node_ptr				= base_tree::node_ptr;
+		using const_node_ptr		= base_tree::const_node_ptr;
+		using rb_ptr				= node_alloc_traits::pointer;
+		using const_rb_ptr			= node_alloc_traits::const_pointer;
+
+		friend class base_tree;
+
+		constexpr static auto left		= base_tree::left;
+		constexpr static auto right		= base_tree::right;
+		constexpr static auto parent	= base_tree::parent;
+
+	public:
+
+		using allocator_type			= base_tree::allocator_type;
+		using value_type				= base_tree::value_type;
+		using mapped_type				= base_tree::mapped_type;
+		using key_type					= base_tree::key_type;
+		using node_type					= _node_type;
+		using size_type					= base_tree::size_type;
+		using difference_type			= base_tree::difference_type;
+		using reference					= base_tree::reference;
+		using const_reference			= base_tree::const_reference;
+		using pointer					= base_tree::pointer;
+		using const_pointer				= base_tree::const_pointer;
+		using iterator					= base_tree::iterator;
+		using const_iterator			= base_tree::const_iterator;
+		using reverse_iterator			= base_tree::reverse_iterator;
+		using const_reverse_iterator	= base_tree::const_reverse_iterator;
+
+		static constexpr bool allow_duplicates = hasDuplicates;
+		static constexpr bool is_ranked = isRanked;
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// --- Default Constructor ---
+		/// 
+		///	<para>
+		/// Constructs an empty RedBlackTree.
+		/// </para></summary> -------------------------------------------------
+		constexpr RedBlackTree() 
+			noexcept(std::is_nothrow_default_constructible_v<node_allocator_type>) :
+			base_tree(),
+			_allocator(allocator_type{})
+		{
+
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// --- Allocator Constructor ---
+		/// 
+		///	<para>
+		/// Constructs an empty RedBlackTree.
+		/// </para></summary>
+		/// <param name="alloc">
+		/// The allocator instance used by the tree.
+		/// </param> ----------------------------------------------------------
+		constexpr explicit RedBlackTree(const allocator_type& alloc)
+			noexcept(std::is_nothrow_copy_constructible_v<node_allocator_type>) :
+			base_tree(), 
+			_allocator(alloc)
+		{
+
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// --- Copy Constructor ---
+		/// 
+		/// <para>
+		/// Constructs a deep copy of the specified RedBlackTree.
+		/// </para></summary> 
+		/// 
+		/// <param name="copy">
+		/// The RedBlackTree to be copied.
+		/// </param> ----------------------------------------------------------
+		RedBlackTree(const RedBlackTree& copy) : RedBlackTree(
+			alloc_traits::select_on_container_copy_construction(copy._allocator)
+		) {
+			this->cloneFrom(copy);
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// --- Move Constructor ---
+		/// 
+		/// <para>
+		/// Constructs a RedBlackTree by moving the data from the provided 
+		/// object into the new one.
+		/// </para></summary>
+		/// 
+		/// <param name="other">
+		/// The RedBlackTree to be moved into this one.
+		/// </param> ----------------------------------------------------------
+		RedBlackTree(RedBlackTree&& other)
+			noexcept(std::is_nothrow_move_constructible_v<node_allocator_type>) :
+			base_tree(std::move(other)),
+			_allocator(std::move(other._allocator))
+		{
+
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Constructs a RedBlackTree with the a copy of the elements in
+		/// the specified initialization list.
+		/// </summary>
+		/// 
+		/// <param name="init">
+		/// The initialization list to copy elements from.
+		/// </param> ----------------------------------------------------------
+		RedBlackTree(
+			std::initializer_list<value_type> init,
+			const allocator_type& alloc = allocator_type{}
+		) : RedBlackTree(init.begin(), init.end(), alloc) {
+
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// ~~~ Iterator Constructor ~~~
+		/// 
+		/// <para>
+		/// Constructs a RedBlackTree with the a copy of the elements from 
+		/// the given iterator pair.
+		/// </para></summary>
+		/// 
+		/// <typeparam name="iterator">
+		/// The type of the beginning iterator to copy from.
+		/// </typeparam>
+		/// <typeparam name="sentinel">
+		/// The type of the end iterator or sentinel.
+		/// </typeparam>
+		/// 
+		/// <param name="begin">
+		/// The beginning of the iterator pair to copy from.
+		/// </param>
+		/// <param name="end">
+		/// The end of the iterator pair to copy from.
+		/// </param>
+		/// <param name="alloc">
+		/// The allocator instance used by the tree. Default constructs the 
+		/// allocator_type if unspecified.
+		/// </param> ----------------------------------------------------------
+		template <
+			std::input_iterator in_iterator,
+			std::sentinel_for<in_iterator> sentinel
+		>
+		RedBlackTree(
+			in_iterator begin,
+			sentinel end,
+			const allocator_type& alloc = allocator_type{}
+		) : RedBlackTree(alloc) {
+			this->insert(begin, end);
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// ~~~ Range Constructor ~~~
+		/// 
+		/// <para>
+		/// Constructs a RedBlackTree array with a copy of the elements
+		/// from the given range.
+		/// </para></summary>
+		/// 
+		/// <typeparam name="range">
+		/// The type of the range being constructed from.
+		/// </typeparam>
+		/// 
+		/// <param name="r">
+		/// The range to construct the tree with.
+		/// </param>
+		/// <param name="alloc">
+		/// The allocator instance for the tree.
+		/// </param> ----------------------------------------------------------
+		template <std::ranges::input_range range>
+		RedBlackTree(
+			from_range_t tag,
+			range&& r,
+			const allocator_type& alloc = allocator_type{}
+		) : RedBlackTree(
+			std::ranges::begin(r), 
+			std::ranges::end(r), 
+			alloc
+		) {
+
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// ~~~ Copy Assignment Operator ~~~
+		/// 
+		/// <para>
+		/// Deep copies the data from the specified RedBlackTree to this one.
+		/// </para></summary>
+		/// 
+		/// <param name="other">
+		/// The RedBlackTree to copy from.
+		/// </param>
+		/// 
+		/// <returns>
+		/// Returns this BinarySearchTree with the copied data.
+		/// </returns> --------------------------------------------------------
+		RedBlackTree& operator=(const RedBlackTree& other) {
+			return this->copyAssign(other);
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// ~~~ Moves Assignment Operator ~~~
+		/// 
+		/// <para>
+		/// Moves the data from the specified RedBlackTree to this one.
+		/// </para></summary>
+		/// 
+		/// <param name="other">
+		/// The RedBlackTree to move from.
+		/// </param>
+		/// 
+		/// <returns>
+		/// Returns this RedBlackTree with the moved data.
+		/// </returns> --------------------------------------------------------
+		RedBlackTree& operator=(RedBlackTree&& other) 
+			noexcept(alloc_traits::is_always_equal::value) 
+		{
+			return this->moveAssign(std::move(other));
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Returns whether the node at the given position is colored red.
+		/// </summary>
+		/// 
+		/// <param name="position">
+		/// The position of the node to check.
+		/// </param> ----------------------------------------------------------
+		[[nodiscard]] bool isRed(const_iterator position) const noexcept {
+			return isRedNode(position._node);
+		}
+
+	private:
+
+		[[no_unique_address, msvc::no_unique_address]]
+		node_allocator_type _allocator;
+
+		template <class... Args>
+		[[nodiscard]] node_ptr createNode(Args&&... args) {
+			rb_ptr n = node_alloc_traits::allocate(_allocator, 1);
+			node_alloc_traits::construct(
+				_allocator, n, std::in_place_t{}, std::forward<Args>(args)...);
+			return n;
+		}
+
+		void destroyNode(base_ptr n) {
+			rb_ptr node = static_cast<rb_ptr>(n);
+			node_alloc_traits::destroy(_allocator, std::addressof(node->value()));
+			node_alloc_traits::destroy(_allocator, node);
+			node_alloc_traits::deallocate(_allocator, node, 1);
+		}
+
+		[[nodiscard]] size_type heightOfNode(const_base_ptr n) const noexcept {
+			return this->heightAt(n);
+		}
+
+		// the color is the node tag, packed into the low bit of the parent 
+		// link. A set tag marks a black node, so new nodes start red.
+		[[nodiscard]] static bool isRedNode(const_base_ptr n) noexcept {
+			return n && !n->tag();
+		}
+
+		static void setRed(base_ptr n, bool isRed) noexcept {
+			n->setTag(!isRed);
+		}
+
+		// ---------------------------------------------------------------------
+		// Red-black tree recolors and rotates after insert and delete, using 
+		// at most two rotations per insert and three per delete. Does not do 
+		// any work on search or element access.
+
+		iterator onInsert(base_ptr hint, const_reference element) {
+			base_ptr result = this->insertAt(hint, element);
+			rebalanceOnInsert(result);
+			return iterator(this, result); 
+		}
+
+		template <class... Args>
+		iterator onEmplace(base_ptr hint, Args&&... args) {
+			base_ptr result = this->emplaceAt(hint, std::forward<Args>(args)...);
+			rebalanceOnInsert(result);
+			return iterator(this, result); 
+		}
+
+		void onRemove(base_ptr n) {
+			// a node with two children is replaced by its predecessor, which 
+			// takes over its color, so the predecessor's old spot is the one
+			// that loses a node.
+			base_ptr spliced = this->degree(n) == 2 
+				? this->inOrderPredecessorOf(n) 
+				: n;
+
+			base_ptr child = spliced->to(left) 
+				? spliced->to(left) 
+				: spliced->to(right);
+
+			base_ptr childParent = spliced->to(parent) == n 
+				? spliced 
+				: spliced->to(parent);
+
+			bool removedBlack = !isRedNode(spliced);
+
+			if (spliced != n)
+				setRed(spliced, isRedNode(n));
+
+			this->removeAt(n);
+
+			if (removedBlack)
+				rebalanceOnRemove(child, childParent);
+		}
+
+		void onBuildNode(base_ptr n, const_base_ptr source) {
+			setRed(n, source && isRedNode(source));
+		}
+
+		void onAccessNode(base_ptr n) {}
+
+		// insertAt returns an existing duplicate unchanged, and it is never a 
+		// red child of a red node, so the loop leaves it alone.
+		void rebalanceOnInsert(base_ptr n) {
+			while (isRedNode(n) && isRedNode(n->to(parent))) {
+				base_ptr p = n->to(parent);
+				base_ptr grandparent = p->to(parent);
+				bool isLeftParent = grandparent->to(left) == p;
+				base_ptr uncle = isLeftParent 
+					? grandparent->to(right) 
+					: grandparent->to(left);
+
+				if (isRedNode(uncle)) {
+					setRed(p, false);
+					setRed(uncle, false);
+					setRed(grandparent, true);
+					n = grandparent;
+				}
+				else {
+					if (isLeftParent) {
+						if (p->to(right) == n) 
+							p = this->leftRotation(p);
+						this->rightRotation(grandparent);
+					}
+					else {
+						if (p->to(left) == n) 
+							p = this->rightRotation(p);
+						this->leftRotation(grandparent);
+					}
+
+					setRed(p, false);
+					setRed(grandparent, true);
+					break;
+				}
+			}
+
+			setRed(this->_root, false);
+		}
+
+		// n replaced a removed black node and is short one black node on 
+		// every path through it. n may be null, so its parent is passed too.
+		void rebalanceOnRemove(base_ptr n, base_ptr p) {
+			while (n != this->_root && !isRedNode(n)) {
+				if (p->to(left) == n) 
+					n = rebalanceLeftDeficit(p);
+				else 
+					n = rebalanceRightDeficit(p);
+
+				p = n->to(parent);
+			}
+
+			if (n)
+				setRed(n, false);
+		}
+
+		// the left subtree of p is one black node short. Returns the node 
+		// still short, or the root once the deficit is fixed.
+		base_ptr rebalanceLeftDeficit(base_ptr p) {
+			base_ptr sibling = p->to(right);
+
+			if (isRedNode(sibling)) {
+				setRed(sibling, false);
+				setRed(p, true);
+				this->leftRotation(p);
+				sibling = p->to(right);
+			}
+
+			bool isLeftRed = isRedNode(sibling->to(left));
+			bool isRightRed = isRedNode(sibling->to(right));
+
+			if (!isLeftRed && !isRightRed) {
+				setRed(sibling, true);
+				return p;
+			}
+
+			if (!isRightRed) 
+				sibling = this->rightRotation(sibling);
+
+			setRed(sibling, isRedNode(p));
+			setRed(p, false);
+			setRed(sibling->to(right), false);
+			this->leftRotation(p);
+			return this->_root;
+		}
+
+		// the right subtree of p is one black node short. Returns the node 
+		// still short, or the root once the deficit is fixed.
+		base_ptr rebalanceRightDeficit(base_ptr p) {
+			base_ptr sibling = p->to(left);
+
+			if (isRedNode(sibling)) {
+				setRed(sibling, false);
+				setRed(p, true);
+				this->rightRotation(p);
+				sibling = p->to(left);
+			}
+
+			bool isLeftRed = isRedNode(sibling->to(left));
+			bool isRightRed = isRedNode(sibling->to(right));
+
+			if (!isLeftRed && !isRightRed) {
+				setRed(sibling, true);
+				return p;
+			}
+
+			if (!isLeftRed) 
+				sibling = this->leftRotation(sibling);
+
+			setRed(sibling, isRedNode(p));
+			setRed(p, false);
+			setRed(sibling->to(left), false);
+			this->rightRotation(p);
+			return this->_root;
+		}
+
+		// ---------------------------------------------------------------------
+		// Sorted ranges are built bottom up into trees whose levels are all 
+		// full except perhaps the deepest. Every node is built black, and an
+		// incomplete deepest level is then colored red, which evens out the 
+		// black height of every path. The red level follows from the size 
+		// alone, so coloring it visits each node above it once and the build
+		// stays linear.
+
+		template <class forward_iterator>
+		void buildFromSorted(forward_iterator begin, size_type count) {
+			base_tree::buildFromSorted(begin, count);
+
+			if (!std::has_single_bit(count + 1))
+				colorLevelRed(this->_root, std::bit_width(count) - 1);
+		}
+
+		static void colorLevelRed(base_ptr n, size_type depth) noexcept {
+			if (!n)
+				return;
+
+			if (depth == 0)
+				setRed(n, true);
+			else {
+				colorLevelRed(n->to(left), depth - 1);
+				colorLevelRed(n->to(right), depth - 1);
+			}
+		}
+	};
+
+	template <
+		class element_t,
+		template <class> class compare_t = std::less,
+		template <class> class allocator_t = std::allocator
+	>
+	using SimpleRedBlackTree = RedBlackTree<
+		element_t, 
+		compare_t<element_t>, 
+		allocator_t<element_t>, 
+		false
+	>;
+
+	template <
+		class key_t,
+		class element_t,
+		template <class> class compare_t = std::less,
+		template <class> class allocator_t = std::allocator
+	>
+	using MapRedBlackTree = RedBlackTree<
+		key_value_pair<const key_t, element_t>,
+		compare_t<key_t>,
+		std::allocator<key_value_pair<key_t, element_t>>,
+		false
+	>;
+
+	template <
+		class element_t,
+		template <class> class compare_t = std::less,
+		template <class> class allocator_t = std::allocator
+	>
+	using MultiRedBlackTree = RedBlackTree<
+		element_t, 
+		compare_t<element_t>, 
+		allocator_t<element_t>, 
+		true
+	>;
+
+	template <
+		class key_t,
+		class element_t,
+		template <class> class compare_t = std::less,
+		template <class> class allocator_t = std::allocator
+	>
+	using MultiMapRedBlackTree = RedBlackTree<
+		key_value_pair<const key_t, element_t>,
+		compare_t<key_t>,
+		std::allocator<key_value_pair<key_t, element_t>>,
+		true
+	>;
+
+	template <
+		class element_t,
+		template <class> class compare_t = std::less,
+		template <class> class allocator_t = std::allocator
+	>
+	using RankedRedBlackTree = RedBlackTree<
+		element_t, 
+		compare_t<element_t>, 
+		allocator_t<element_t>, 
+		false,
+		true
+	>;
+
+	template <
+		class key_t,
+		class element_t,
+		template <class> class compare_t = std::less,
+		template <class> class allocator_t = std::allocator
+	>
+	using RankedMapRedBlackTree = RedBlackTree<
+		key_value_pair<const key_t, element_t>,
+		compare_t<key_t>,
+		std::allocator<key_value_pair<key_t, element_t>>,
+		false,
+		true
+	>;
+
+	template <
+		class element_t,
+		template <class> class compare_t = std::less,
+		template <class> class allocator_t = std::allocator
+	>
+	using RankedMultiRedBlackTree = RedBlackTree<
+		element_t, 
+		compare_t<element_t>, 
+		allocator_t<element_t>, 
+		true,
+		true
+	>;
+
+	template <
+		class key_t,
+		class element_t,
+		template <class> class compare_t = std::less,
+		template <class> class allocator_t = std::allocator
+	>
+	using RankedMultiMapRedBlackTree = RedBlackTree<
+		key_value_pair<const key_t, element_t>,
+		compare_t<key_t>,
+		std::allocator<key_value_pair<key_t, element_t>>,
+		true,
+		true
+	>;
+
+	static_assert(
+		collection<SimpleRedBlackTree<int>>,
+		"RedBlackTree does not meet the requirements for a collection."
+	);
+
+	static_assert(
+		associative<SimpleRedBlackTree<int>>,
+		"RedBlackTree does not meet the requirements for sequential access."
+	);
+
+	static_assert(
+		positional<SimpleRedBlackTree<int>>,
+		"RedBlackTree does not meet the requirements for positional access."
+	);
+
+	static_assert(
+		bidirectionally_iterable<SimpleRedBlackTree<int>>,
+		"RedBlackTree does not meet the requirements for bidirectional iteration."
+	);
+
+	static_assert(
+		map<MapRedBlackTree<int, int>>,
+		"RedBlackTree does not meet the requirements for a map."
+	);
+
+	static_assert(
+		multimap<MultiMapRedBlackTree<int, int >>,
+		"RedBlackTree does not meet the requirements for a multimap."
+	);
+
+	static_assert(
+		collection<RankedRedBlackTree<int>>,
+		"RedBlackTree does not meet the requirements for a collection when ranked."
+	);
+}
\ No newline at end of file
@@ -0,0 +1,1648 @@
+/* ============================================================================
+ * Copyright (C) 2023 Ryan Eubank
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ * ========================================================================= */
+
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <compare>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <initializer_list>
+#include <istream>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <ostream>
+#include <ranges>
+#include <sstream>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "../algorithms/compare.h"
+#include "../algorithms/stream.h"
+#include "../concepts/collection.h"
+#include "../concepts/indexable.h"
+#include "../concepts/iterable.h"
+#include "../concepts/positional.h"
+#include "../concepts/sequential.h"
+#include "../util/random_seed.h"
+#include "../util/types.h"
+
+namespace collections {
+
+	// -------------------------------------------------------------------------
+	/// <summary>
+	/// SkipList is an indexable sequence container built as a skip list whose
+	/// links record how many elements they span. Summing those widths while
+	/// descending the levels finds any index in O(log n) expected time, so
+	/// access, insertion and removal by Index are O(log n) rather than the
+	/// O(n) walk a linked list needs.
+	///
+	/// <para>
+	/// Each node is a single allocation holding its value and a tower of 
+	/// links whose height is drawn from a geometric distribution with 
+	/// p = 1/4. The bottom level is a doubly linked list for bidirectional
+	/// iteration. Ranges are spliced, inserted and removed as whole chains,
+	/// so moving m elements between lists costs O(log n) regardless of m, 
+	/// and inserting them costs O(m + log n).
+	/// </para>
+	/// </summary>
+	///
+	/// <typeparam name="element_t">
+	/// The type of the elements contained by the SkipList.
+	/// </typeparam> 
+	/// 
+	/// <typeparam name="allocator_t">
+	/// The type of the allocator responsible for allocating memory to the 
+	/// skip list.
+	/// </typeparam> -----------------------------------------------------------
+	template <class element_t, class allocator_t = std::allocator<element_t>>
+	class SkipList final {
+	private:
+
+		template <bool isConst>
+		class SkipListIterator;
+
+		using alloc_t		= rebind<allocator_t, element_t>;
+		using alloc_traits	= std::allocator_traits<alloc_t>;
+
+	public:
+
+		using value_type		= element_t;
+		using allocator_type	= allocator_t;
+		using size_type			= alloc_traits::size_type;
+		using difference_type	= alloc_traits::difference_type;
+		using pointer			= alloc_traits::pointer;
+		using const_pointer		= alloc_traits::const_pointer;
+		using reference			= value_type&;
+		using const_reference	= const value_type&;
+
+		using iterator					= SkipListIterator<false>;
+		using const_iterator			= SkipListIterator<true>;
+		using reverse_iterator			= std::reverse_iterator<iterator>;
+		using const_reverse_iterator	= std::reverse_iterator<const_iterator>;
+
+		static constexpr size_type MAX_LEVEL = 20;
+
+	private:
+
+		struct node_base;
+
+		struct link {
+			node_base* next;
+			size_type width;
+		};
+
+		struct node_base {
+			node_base* prev;
+			size_type height;
+
+			[[nodiscard]] link& to(size_type level) noexcept {
+				auto address = reinterpret_cast<std::byte*>(this) + sizeof(node_base);
+				return std::launder(reinterpret_cast<link*>(address))[level];
+			}
+
+			[[nodiscard]] const link& to(size_type level) const noexcept {
+				return const_cast<node_base*>(this)->to(level);
+			}
+		};
+
+		static constexpr size_type UNIT_SIZE = 
+			std::max(alignof(value_type), alignof(node_base));
+
+		struct alignas(UNIT_SIZE) unit {
+			std::byte bytes[UNIT_SIZE];
+		};
+
+		using unit_allocator_type	= rebind<allocator_t, unit>;
+		using unit_alloc_traits		= std::allocator_traits<unit_allocator_type>;
+
+		// A run of nodes cut out of, or not yet linked into, a list. Tails
+		// at each level have dangling links until the chain is attached.
+		struct chain {
+			size_type count = 0;
+			size_type height = 0;
+			node_base* heads[MAX_LEVEL];
+			node_base* tails[MAX_LEVEL];
+			size_type headOffsets[MAX_LEVEL];
+			size_type tailOffsets[MAX_LEVEL];
+		};
+
+	public:
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// ~~~ Default Constructor ~~~
+		/// 
+		/// <para>
+		/// Constructs an empty SkipList.
+		/// </para></summary> -------------------------------------------------
+		SkipList() noexcept(
+			std::is_nothrow_default_constructible_v<allocator_type>
+		) : SkipList(allocator_type{}) {
+
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// ~~~ Allocator Constructor ~~~
+		/// 
+		/// <para>
+		/// Constructs an empty SkipList with the given allocator.
+		/// </para></summary>
+		/// 
+		/// <param name="alloc">
+		/// The allocator instance used by the list.
+		/// </param> ----------------------------------------------------------
+		explicit SkipList(const allocator_type& alloc) noexcept(
+			std::is_nothrow_copy_constructible_v<allocator_type>
+		) : _allocator(alloc), _size(), _level(), _seed(fresh_seed()) {
+			initHead();
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// ~~~ Copy Constructor ~~~
+		/// 
+		/// <para>
+		/// Constructs a deep copy of the given SkipList.
+		/// </para></summary>
+		/// 
+		/// <param name="copy">
+		/// The list to copy.
+		/// </param> ----------------------------------------------------------
+		SkipList(const SkipList& copy) : SkipList(
+			copy.begin(),
+			copy.end(),
+			alloc_traits::select_on_container_copy_construction(copy.allocator())
+		) {
+
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// ~~~ Move Constructor ~~~
+		/// 
+		/// <para>
+		/// Takes over the nodes of the given SkipList, leaving it empty. The
+		/// links to the list's embedded head are redirected in O(log n).
+		/// </para></summary>
+		/// 
+		/// <param name="other">
+		/// The list to move from.
+		/// </param> ----------------------------------------------------------
+		SkipList(SkipList&& other) noexcept(
+			std::is_nothrow_move_constructible_v<allocator_type>
+		) : _allocator(std::move(other._allocator)), 
+			_size(), 
+			_level(), 
+			_seed(fresh_seed()) 
+		{
+			initHead();
+			adopt(other);
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// ~~~ Size Constructor ~~~
+		/// 
+		/// <para>
+		/// Constructs a SkipList with the given number of copies of value.
+		/// </para></summary>
+		/// 
+		/// <param name="size">
+		/// The number of elements to construct.
+		/// </param>
+		/// <param name="value">
+		/// The value to initialize every element to.
+		/// </param>
+		/// <param name="alloc">
+		/// The allocator instance used by the list.
+		/// </param> ----------------------------------------------------------
+		SkipList(
+			Size size,
+			const_reference value = value_type{},
+			const allocator_type& alloc = allocator_type{}
+		) : SkipList(alloc) {
+			for (size_type i = 0; i < size.get(); ++i)
+				insertBack(value);
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// ~~~ Initializer List Constructor ~~~
+		/// 
+		/// <para>
+		/// Constructs a SkipList with a copy of the elements in the given
+		/// initializer list.
+		/// </para></summary>
+		/// 
+		/// <param name="init">
+		/// The initialization list to copy elements from.
+		/// </param>
+		/// <param name="alloc">
+		/// The allocator instance used by the list.
+		/// </param> ----------------------------------------------------------
+		SkipList(
+			std::initializer_list<value_type> init,
+			const allocator_type& alloc = allocator_type{}
+		) : SkipList(init.begin(), init.end(), alloc) {
+
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// ~~~ Iterator Constructor ~~~
+		/// 
+		/// <para>
+		/// Constructs a SkipList with a copy of the elements from the given
+		/// iterator pair.
+		/// </para></summary>
+		/// 
+		/// <param name="begin">
+		/// The beginning of the iterator pair to copy from.
+		/// </param>
+		/// <param name="end">
+		/// The end of the iterator pair to copy from.
+		/// </param>
+		/// <param name="alloc">
+		/// The allocator instance used by the list.
+		/// </param> ----------------------------------------------------------
+		template <
+			std::input_iterator in_iterator,
+			std::sentinel_for<in_iterator> sentinel
+		>
+		SkipList(
+			in_iterator begin,
+			sentinel end,
+			const allocator_type& alloc = allocator_type{}
+		) : SkipList(alloc) {
+			insert(this->end(), begin, end);
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// ~~~ Range Constructor ~~~
+		/// 
+		/// <para>
+		/// Constructs a SkipList with a copy of the elements from the given
+		/// range.
+		/// </para></summary>
+		/// 
+		/// <param name="r">
+		/// The range to construct the list with.
+		/// </param>
+		/// <param name="alloc">
+		/// The allocator instance for the list.
+		/// </param> ----------------------------------------------------------
+		template <std::ranges::input_range range>
+		SkipList(
+			from_range_t tag,
+			range&& r,
+			const allocator_type& alloc = allocator_type{}
+		) : SkipList(std::ranges::begin(r), std::ranges::end(r), alloc) {
+
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// ~~~ Destructor ~~~
+		/// 
+		/// <para>
+		/// Destroys every element and releases the list's memory.
+		/// </para></summary> -------------------------------------------------
+		~SkipList() {
+			clear();
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// ~~~ Copy Assignment Operator ~~~
+		/// 
+		/// <para>
+		/// Replaces the contents of the list with a copy of the other list.
+		/// </para></summary>
+		/// 
+		/// <param name="other">
+		/// The list to copy.
+		/// </param> ----------------------------------------------------------
+		SkipList& operator=(const SkipList& other) {
+			static constexpr bool isAlwaysEqual = 
+				alloc_traits::is_always_equal::value;
+			static constexpr bool willPropagate = 
+				alloc_traits::propagate_on_container_copy_assignment::value;
+
+			if (&other == this)
+				return *this;
+
+			clear();
+
+			if (!isAlwaysEqual && willPropagate && _allocator != other._allocator)
+				_allocator = other._allocator;
+
+			insert(end(), other.begin(), other.end());
+			return *this;
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// ~~~ Move Assignment Operator ~~~
+		/// 
+		/// <para>
+		/// Replaces the contents of the list with those of the other list,
+		/// moving elements one by one only when the allocators are unequal 
+		/// and do not propagate.
+		/// </para></summary>
+		/// 
+		/// <param name="other">
+		/// The list to move from.
+		/// </param> ----------------------------------------------------------
+		SkipList& operator=(SkipList&& other) 
+			noexcept(alloc_traits::is_always_equal::value) 
+		{
+			static constexpr bool isAlwaysEqual =
+				alloc_traits::is_always_equal::value;
+			static constexpr bool willPropagate = 
+				alloc_traits::propagate_on_container_move_assignment::value;
+
+			if (&other == this)
+				return *this;
+
+			clear();
+
+			if (isAlwaysEqual || _allocator == other._allocator)
+				adopt(other);
+			else if (willPropagate) {
+				_allocator = std::move(other._allocator);
+				adopt(other);
+			}
+			else {
+				insert(
+					end(), 
+					std::move_iterator(other.begin()), 
+					std::move_iterator(other.end())
+				);
+				other.clear();
+			}
+
+			return *this;
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Returns the element at the given index in O(log n) without bounds
+		/// checking.
+		/// </summary>
+		/// 
+		/// <param name="index">
+		/// The index of the element to access.
+		/// </param> ----------------------------------------------------------
+		[[nodiscard]] reference operator[](size_type index) {
+			return value(nodeAt(index + 1));
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Returns the element at the given index in O(log n) without bounds
+		/// checking.
+		/// </summary>
+		/// 
+		/// <param name="index">
+		/// The index of the element to access.
+		/// </param> ----------------------------------------------------------
+		[[nodiscard]] const_reference operator[](size_type index) const {
+			return value(nodeAt(index + 1));
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Returns the element at the given index in O(log n).
+		/// </summary>
+		/// 
+		/// <param name="index">
+		/// The index of the element to access.
+		/// </param>
+		/// 
+		/// <exception cref="std::out_of_range">
+		/// Thrown if the index is not less than the size of the list.
+		/// </exception> ------------------------------------------------------
+		[[nodiscard]] reference at(size_type index) {
+			validateIndexExists(index);
+			return (*this)[index];
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Returns the element at the given index in O(log n).
+		/// </summary>
+		/// 
+		/// <param name="index">
+		/// The index of the element to access.
+		/// </param>
+		/// 
+		/// <exception cref="std::out_of_range">
+		/// Thrown if the index is not less than the size of the list.
+		/// </exception> ------------------------------------------------------
+		[[nodiscard]] const_reference at(size_type index) const {
+			validateIndexExists(index);
+			return (*this)[index];
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Returns the index of the element at the given position in O(log n)
+		/// expected time, or size() for the end iterator.
+		/// </summary>
+		/// 
+		/// <param name="position">
+		/// An iterator into this list.
+		/// </param> ----------------------------------------------------------
+		[[nodiscard]] size_type indexOf(const_iterator position) const noexcept {
+			return positionOf(position._node) - 1;
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Returns a copy of the allocator used by the list.
+		/// </summary> --------------------------------------------------------
+		[[nodiscard]] allocator_type allocator() const noexcept {
+			return static_cast<allocator_type>(_allocator);
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Returns the maximum number of elements the list can hold.
+		/// </summary> --------------------------------------------------------
+		[[nodiscard]] size_type max_size() const noexcept {
+			return unit_alloc_traits::max_size(_allocator) / 
+				unitsFor(1) / 2;
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Returns true if the list contains no elements.
+		/// </summary> --------------------------------------------------------
+		[[nodiscard]] bool isEmpty() const noexcept {
+			return !(_size);
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Returns the number of elements in the list.
+		/// </summary> --------------------------------------------------------
+		[[nodiscard]] size_type size() const noexcept {
+			return _size;
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Destroys every element in the list.
+		/// </summary> --------------------------------------------------------
+		void clear() noexcept {
+			node_base* n = head()->to(0).next;
+
+			for (size_type i = 0; i < _size; ++i) {
+				node_base* following = n->to(0).next;
+				destroyNode(n);
+				n = following;
+			}
+
+			_size = 0;
+			initHead();
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Returns an iterator to the first element in the list.
+		/// </summary> --------------------------------------------------------
+		[[nodiscard]] iterator begin() noexcept {
+			return iterator(head()->to(0).next);
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Returns a const iterator to the first element in the list.
+		/// </summary> --------------------------------------------------------
+		[[nodiscard]] const_iterator begin() const noexcept {
+			return const_iterator(head()->to(0).next);
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Returns a const iterator to the first element in the list.
+		/// </summary> --------------------------------------------------------
+		[[nodiscard]] const_iterator cbegin() const noexcept {
+			return begin();
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Returns an iterator past the last element in the list.
+		/// </summary> --------------------------------------------------------
+		[[nodiscard]] iterator end() noexcept {
+			return iterator(head());
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Returns a const iterator past the last element in the list.
+		/// </summary> --------------------------------------------------------
+		[[nodiscard]] const_iterator end() const noexcept {
+			return const_iterator(head());
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Returns a const iterator past the last element in the list.
+		/// </summary> --------------------------------------------------------
+		[[nodiscard]] const_iterator cend() const noexcept {
+			return end();
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Returns a reverse iterator to the last element in the list.
+		/// </summary> --------------------------------------------------------
+		[[nodiscard]] reverse_iterator rbegin() noexcept {
+			return std::make_reverse_iterator(end());
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Returns a reverse iterator before the first element in the list.
+		/// </summary> --------------------------------------------------------
+		[[nodiscard]] reverse_iterator rend() noexcept {
+			return std::make_reverse_iterator(begin());
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Returns a const reverse iterator to the last element in the list.
+		/// </summary> --------------------------------------------------------
+		[[nodiscard]] const_reverse_iterator rbegin() const noexcept {
+			return std::make_reverse_iterator(end());
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Returns a const reverse iterator before the first element in the
+		/// list.
+		/// </summary> --------------------------------------------------------
+		[[nodiscard]] const_reverse_iterator rend() const noexcept {
+			return std::make_reverse_iterator(begin());
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Returns a const reverse iterator to the last element in the list.
+		/// </summary> --------------------------------------------------------
+		[[nodiscard]] const_reverse_iterator crbegin() const noexcept {
+			return rbegin();
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Returns a const reverse iterator before the first element in the
+		/// list.
+		/// </summary> --------------------------------------------------------
+		[[nodiscard]] const_reverse_iterator crend() const noexcept {
+			return rend();
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Returns the first element in the list.
+		/// </summary> --------------------------------------------------------
+		[[nodiscard]] reference front() {
+			return value(head()->to(0).next);
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Returns the first element in the list.
+		/// </summary> --------------------------------------------------------
+		[[nodiscard]] const_reference front() const {
+			return value(head()->to(0).next);
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Returns the last element in the list.
+		/// </summary> --------------------------------------------------------
+		[[nodiscard]] reference back() {
+			return value(head()->prev);
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Returns the last element in the list.
+		/// </summary> --------------------------------------------------------
+		[[nodiscard]] const_reference back() const {
+			return value(head()->prev);
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Inserts a copy of the given element at the front of the list.
+		/// </summary>
+		/// 
+		/// <returns>
+		/// Returns an iterator to the inserted element.
+		/// </returns> --------------------------------------------------------
+		iterator insertFront(const_reference element) {
+			return emplaceFront(element);
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Moves the given element to the front of the list.
+		/// </summary>
+		/// 
+		/// <returns>
+		/// Returns an iterator to the inserted element.
+		/// </returns> --------------------------------------------------------
+		iterator insertFront(value_type&& element) {
+			return emplaceFront(std::move(element));
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Inserts a copy of the given element at the back of the list.
+		/// </summary>
+		/// 
+		/// <returns>
+		/// Returns an iterator to the inserted element.
+		/// </returns> --------------------------------------------------------
+		iterator insertBack(const_reference element) {
+			return emplaceBack(element);
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Moves the given element to the back of the list.
+		/// </summary>
+		/// 
+		/// <returns>
+		/// Returns an iterator to the inserted element.
+		/// </returns> --------------------------------------------------------
+		iterator insertBack(value_type&& element) {
+			return emplaceBack(std::move(element));
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Inserts a copy of the given element at the given index in 
+		/// O(log n).
+		/// </summary>
+		/// 
+		/// <exception cref="std::out_of_range">
+		/// Thrown if the index is greater than the size of the list.
+		/// </exception> ------------------------------------------------------
+		iterator insert(Index index, const_reference element) {
+			return emplace(index, element);
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Moves the given element to the given index in O(log n).
+		/// </summary>
+		/// 
+		/// <exception cref="std::out_of_range">
+		/// Thrown if the index is greater than the size of the list.
+		/// </exception> ------------------------------------------------------
+		iterator insert(Index index, value_type&& element) {
+			return emplace(index, std::move(element));
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Inserts a copy of the given element before the given position in
+		/// O(log n).
+		/// </summary>
+		/// 
+		/// <returns>
+		/// Returns an iterator to the inserted element.
+		/// </returns> --------------------------------------------------------
+		iterator insert(const_iterator position, const_reference element) {
+			return emplace(position, element);
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Moves the given element before the given position in O(log n).
+		/// </summary>
+		/// 
+		/// <returns>
+		/// Returns an iterator to the inserted element.
+		/// </returns> --------------------------------------------------------
+		iterator insert(const_iterator position, value_type&& element) {
+			return emplace(position, std::move(element));
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Inserts a copy of the elements in the given range before the 
+		/// given position. The elements are built into a detached chain that
+		/// is then linked in as a whole, costing O(m + log n).
+		/// </summary>
+		/// 
+		/// <param name="position">
+		/// The iterator position to insert the elements before.
+		/// </param>
+		/// <param name="begin">
+		/// The beginning iterator of the range to insert.
+		/// </param>
+		/// <param name="end">
+		/// The end iterator of the range to insert.
+		/// </param>
+		/// 
+		/// <returns>
+		/// Returns an iterator to the first element inserted, or position if
+		/// begin == end.
+		/// </returns> --------------------------------------------------------
+		template <
+			std::input_iterator in_iterator,
+			std::sentinel_for<in_iterator> sentinel
+		>
+		iterator insert(
+			const_iterator position, 
+			in_iterator begin, 
+			sentinel end
+		) {
+			return insertChain(
+				positionOf(position._node) - 1, buildChain(begin, end));
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Inserts a copy of the elements in the given range at the given
+		/// index in O(m + log n).
+		/// </summary>
+		/// 
+		/// <exception cref="std::out_of_range">
+		/// Thrown if the index is greater than the size of the list.
+		/// </exception> ------------------------------------------------------
+		template <
+			std::input_iterator in_iterator,
+			std::sentinel_for<in_iterator> sentinel
+		>
+		iterator insert(Index index, in_iterator begin, sentinel end) {
+			validateIndexInRange(index.get());
+			return insertChain(index.get(), buildChain(begin, end));
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Removes the element at the given index in O(log n).
+		/// </summary>
+		/// 
+		/// <returns>
+		/// Returns an iterator to the element following the removed one.
+		/// </returns>
+		/// 
+		/// <exception cref="std::out_of_range">
+		/// Thrown if the index is not less than the size of the list.
+		/// </exception> ------------------------------------------------------
+		iterator remove(Index index) {
+			validateIndexExists(index.get());
+			return removeAll(index.get(), index.get() + 1);
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Removes the element at the given position in O(log n).
+		/// </summary>
+		/// 
+		/// <returns>
+		/// Returns an iterator to the element following the removed one.
+		/// </returns> --------------------------------------------------------
+		iterator remove(const_iterator position) {
+			size_type index = indexOf(position);
+			return removeAll(index, index + 1);
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Removes the first element in the list.
+		/// </summary> --------------------------------------------------------
+		void removeFront() {
+			removeAll(0, 1);
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Removes the last element in the list.
+		/// </summary> --------------------------------------------------------
+		void removeBack() {
+			removeAll(_size - 1, _size);
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Removes all elements between the given indices [begin, end) in
+		/// O(m + log n).
+		/// </summary>
+		/// 
+		/// <returns>
+		/// Returns an iterator to the element at index range.end.
+		/// </returns>
+		/// 
+		/// <exception cref="std::out_of_range">
+		/// Thrown if the range does not lie within the list or begins after
+		/// it ends.
+		/// </exception> ------------------------------------------------------
+		iterator remove(IndexRange range) {
+			validateIndexExists(range.begin);
+			validateIndexInRange(range.end);
+
+			if (range.begin > range.end)
+				throw std::out_of_range("Begin index is greater than end.");
+
+			return removeAll(range.begin, range.end);
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Removes all elements in the given iterator range [begin, end) in
+		/// O(m + log n).
+		/// </summary>
+		/// 
+		/// <returns>
+		/// Returns an iterator to the element past end.
+		/// </returns> --------------------------------------------------------
+		iterator remove(const_iterator begin, const_iterator end) {
+			return removeAll(indexOf(begin), indexOf(end));
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Constructs an element in place at the front of the list.
+		/// </summary> --------------------------------------------------------
+		template <class... Args>
+		iterator emplaceFront(Args&&... args) {
+			return insertChain(0, chainOf(createNode(std::forward<Args>(args)...)));
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Constructs an element in place at the back of the list.
+		/// </summary> --------------------------------------------------------
+		template <class... Args>
+		iterator emplaceBack(Args&&... args) {
+			return insertChain(
+				_size, chainOf(createNode(std::forward<Args>(args)...)));
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Constructs an element in place at the given index in O(log n).
+		/// </summary>
+		/// 
+		/// <exception cref="std::out_of_range">
+		/// Thrown if the index is greater than the size of the list.
+		/// </exception> ------------------------------------------------------
+		template <class... Args>
+		iterator emplace(Index index, Args&&... args) {
+			validateIndexInRange(index.get());
+			return insertChain(
+				index.get(), chainOf(createNode(std::forward<Args>(args)...)));
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Constructs an element in place before the given position in 
+		/// O(log n).
+		/// </summary> --------------------------------------------------------
+		template <class... Args>
+		iterator emplace(const_iterator position, Args&&... args) {
+			return insertChain(
+				indexOf(position), 
+				chainOf(createNode(std::forward<Args>(args)...))
+			);
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Moves the elements in the range [begin, end) of the other list 
+		/// before the given position in this list. The range is cut out and
+		/// linked in as a whole, and only the links crossing its boundaries
+		/// are rewritten, so the splice costs O(log n) whatever the length of
+		/// the range. The position must not lie inside the range, and the 
+		/// lists must have equal allocators.
+		/// </summary>
+		/// 
+		/// <param name="position">
+		/// The position in this list to move the elements before.
+		/// </param>
+		/// <param name="other">
+		/// The list the range belongs to, which may be this list.
+		/// </param>
+		/// <param name="begin">
+		/// An iterator to the first element to move.
+		/// </param>
+		/// <param name="end">
+		/// An iterator past the last element to move.
+		/// </param> ----------------------------------------------------------
+		void splice(
+			const_iterator position,
+			SkipList& other,
+			const_iterator begin,
+			const_iterator end
+		) {
+			size_type first = other.indexOf(begin);
+			size_type last = other.indexOf(end);
+
+			if (first >= last)
+				return;
+
+			size_type index = indexOf(position);
+			if (&other == this && index >= last)
+				index -= last - first;
+
+			attach(index, other.detach(first + 1, last - first));
+		}
+
+		// ---------------------------------------------------------------------
+		/// <summary> 
+		/// Swaps the contents of the given SkipLists.
+		/// </summary> --------------------------------------------------------
+		friend void swap(SkipList& a, SkipList& b) 
+			noexcept(alloc_traits::is_always_equal::value) 
+		{
+			a.swap(b);
+		}
+
+		// ---------------------------------------------------------------------
+		/// <summary> 
+		/// Swaps the contents of this SkipList with the given list.
+		/// </summary> --------------------------------------------------------
+		void swap(SkipList& other) 
+			noexcept(alloc_traits::is_always_equal::value) 
+		{
+			static constexpr bool isAlwaysEqual = 
+				alloc_traits::is_always_equal::value;
+			static constexpr bool willPropagate = 
+				alloc_traits::propagate_on_container_swap::value;
+			bool isInstanceEqual = _allocator == other._allocator;
+
+			if (isAlwaysEqual || isInstanceEqual)
+				swapMembers(other);
+			else if (willPropagate) {
+				using std::swap;
+				swap(_allocator, other._allocator);
+				swapMembers(other);
+			}
+			else // Undefined behavior under STL specification
+				;
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// ~~~ Equality Operator ~~~
+		/// </summary>
+		/// 
+		/// <returns>
+		/// Returns true if the given lists share deep equality based
+		/// on contents and size.
+		/// </returns> --------------------------------------------------------
+		friend bool operator==(
+			const SkipList& lhs,
+			const SkipList& rhs
+		) noexcept {
+			bool isSizeEqual = (lhs.size() == rhs.size());
+			if (isSizeEqual)
+				return collections::lexicographic_compare(lhs, rhs) == 0;
+			return false;
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// ~~~ Comparison Operator ~~~
+		/// </summary>
+		/// 
+		/// <returns>
+		/// Returns the lexicographic ordering of the lists. Lists of 
+		/// different size are ordered by size.
+		/// </returns> --------------------------------------------------------
+		friend auto operator<=>(
+			const SkipList& lhs,
+			const SkipList& rhs
+		) noexcept requires std::three_way_comparable<value_type> {
+
+			auto compareSize = lhs.size() <=> rhs.size();
+			if (compareSize == 0)
+				return collections::lexicographic_compare(lhs, rhs);
+			return static_cast<decltype(value_type{} <=> value_type{})> (compareSize);
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// ~~~ Output Stream Operator ~~~
+		/// </summary>
+		/// 
+		/// <returns>
+		/// Returns the output stream after writing.
+		/// </returns> --------------------------------------------------------
+		template <typename char_t>
+		friend std::basic_ostream<char_t>& operator<<(
+			std::basic_ostream<char_t>& os,
+			const SkipList& list
+		) {
+			collections::stream(list, os);
+			return os;
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// ~~~ Input Stream Operator ~~~
+		/// </summary>
+		/// 
+		/// <returns>
+		/// Returns the input stream after reading.
+		/// </returns> --------------------------------------------------------
+		template <typename char_t>
+		friend std::basic_istream<char_t>& operator>>(
+			std::basic_istream<char_t>& is,
+			SkipList& list
+		) {
+			size_type size = 0;
+			is >> size;
+
+			list.clear();
+
+			for (size_type i = 0; i < size; ++i) {
+				value_type value;
+				is >> value;
+				list.insertBack(std::move(value));
+			}
+
+			return is;
+		}
+
+	private:
+
+		unit_allocator_type _allocator;
+		size_type _size;
+		size_type _level;
+		std::uint64_t _seed;
+
+		alignas(node_base) alignas(link) 
+		std::byte _head[sizeof(node_base) + MAX_LEVEL * sizeof(link)];
+
+		[[nodiscard]] node_base* head() noexcept {
+			return std::launder(reinterpret_cast<node_base*>(_head));
+		}
+
+		[[nodiscard]] node_base* head() const noexcept {
+			return const_cast<SkipList*>(this)->head();
+		}
+
+		void initHead() noexcept {
+			node_base* h = ::new (_head) node_base{ nullptr, MAX_LEVEL };
+			h->prev = h;
+
+			std::byte* links = _head + sizeof(node_base);
+			for (size_type i = 0; i < MAX_LEVEL; ++i)
+				::new (links + i * sizeof(link)) link{ h, 1 };
+
+			_level = 0;
+		}
+
+		[[nodiscard]] static constexpr size_type valueOffset(size_type height) {
+			size_type offset = sizeof(node_base) + height * sizeof(link);
+			size_type align = alignof(value_type);
+			return (offset + align - 1) / align * align;
+		}
+
+		[[nodiscard]] static constexpr size_type unitsFor(size_type height) {
+			size_type bytes = valueOffset(height) + sizeof(value_type);
+			return (bytes + UNIT_SIZE - 1) / UNIT_SIZE;
+		}
+
+		[[nodiscard]] static reference value(node_base* node) noexcept {
+			auto address = reinterpret_cast<std::byte*>(node) + 
+				valueOffset(node->height);
+			return *std::launder(reinterpret_cast<value_type*>(address));
+		}
+
+		[[nodiscard]] static const_reference value(const node_base* node) noexcept {
+			return value(const_cast<node_base*>(node));
+		}
+
+		[[nodiscard]] size_type randomHeight() noexcept {
+			_seed ^= _seed << 13;
+			_seed ^= _seed >> 7;
+			_seed ^= _seed << 17;
+
+			// each trailing pair of zero bits raises the node one level, 
+			// giving a promotion probability of 1/4.
+			size_type height = 1 + std::countr_zero(_seed) / 2;
+			return std::min(height, MAX_LEVEL);
+		}
+
+		template <class... Args>
+		[[nodiscard]] node_base* createNode(Args&&... args) {
+			size_type height = randomHeight();
+			size_type units = unitsFor(height);
+			unit* memory = std::to_address(
+				unit_alloc_traits::allocate(_allocator, units));
+
+			auto node = ::new (static_cast<void*>(memory)) node_base{ nullptr, height };
+			auto links = reinterpret_cast<std::byte*>(node) + sizeof(node_base);
+			for (size_type i = 0; i < height; ++i)
+				::new (links + i * sizeof(link)) link{ nullptr, 0 };
+
+			try {
+				alloc_t alloc(_allocator);
+				auto address = reinterpret_cast<std::byte*>(node) + 
+					valueOffset(height);
+				alloc_traits::construct(
+					alloc, 
+					reinterpret_cast<value_type*>(address), 
+					std::forward<Args>(args)...
+				);
+			}
+			catch (...) {
+				unit_alloc_traits::deallocate(_allocator, memory, units);
+				throw;
+			}
+
+			return node;
+		}
+
+		void destroyNode(node_base* node) noexcept {
+			size_type units = unitsFor(node->height);
+			alloc_t alloc(_allocator);
+			alloc_traits::destroy(alloc, std::addressof(value(node)));
+			unit_alloc_traits::deallocate(
+				_allocator, reinterpret_cast<unit*>(node), units);
+		}
+
+		void destroyChain(const chain& c) noexcept {
+			node_base* n = c.count ? c.heads[0] : nullptr;
+
+			for (size_type i = 0; i < c.count; ++i) {
+				node_base* following = n->to(0).next;
+				destroyNode(n);
+				n = following;
+			}
+		}
+
+		// Returns the node at the given 1-based position, with the head at 
+		// position 0 and n + 1.
+		[[nodiscard]] node_base* nodeAt(size_type position) const noexcept {
+			node_base* n = head();
+			size_type reached = 0;
+
+			for (size_type level = _level; level-- > 0;) {
+				while (reached + n->to(level).width <= position) {
+					reached += n->to(level).width;
+					n = n->to(level).next;
+				}
+			}
+
+			return n;
+		}
+
+		// Walks forward along the highest link of each node until reaching 
+		// the head, which mirrors a search from the head and so takes 
+		// expected O(log n) steps.
+		[[nodiscard]] size_type positionOf(const node_base* node) const noexcept {
+			size_type distance = 0;
+
+			while (node != head()) {
+				const link& top = node->to(node->height - 1);
+				distance += top.width;
+				node = top.next;
+			}
+
+			return _size + 1 - distance;
+		}
+
+		// Finds the last node before the given position at every level in 
+		// use, along with its position.
+		void locate(
+			size_type position, 
+			node_base** found, 
+			size_type* positions
+		) const noexcept {
+			node_base* n = head();
+			size_type reached = 0;
+
+			for (size_type level = _level; level-- > 0;) {
+				while (reached + n->to(level).width < position) {
+					reached += n->to(level).width;
+					n = n->to(level).next;
+				}
+
+				found[level] = n;
+				positions[level] = reached;
+			}
+		}
+
+		[[nodiscard]] static chain chainOf(node_base* node) noexcept {
+			chain c;
+			c.count = 1;
+			c.height = node->height;
+
+			for (size_type level = 0; level < c.height; ++level) {
+				c.heads[level] = node;
+				c.tails[level] = node;
+				c.headOffsets[level] = 0;
+				c.tailOffsets[level] = 0;
+			}
+
+			return c;
+		}
+
+		void append(chain& c, node_base* node) noexcept {
+			size_type offset = c.count;
+			node->prev = offset ? c.tails[0] : nullptr;
+
+			for (size_type level = 0; level < node->height; ++level) {
+				if (level < c.height) {
+					c.tails[level]->to(level) = { 
+						node, offset - c.tailOffsets[level] 
+					};
+				}
+				else {
+					c.heads[level] = node;
+					c.headOffsets[level] = offset;
+				}
+
+				c.tails[level] = node;
+				c.tailOffsets[level] = offset;
+			}
+
+			c.height = std::max(c.height, node->height);
+			++c.count;
+		}
+
+		template <
+			std::input_iterator in_iterator,
+			std::sentinel_for<in_iterator> sentinel
+		>
+		[[nodiscard]] chain buildChain(in_iterator begin, sentinel end) {
+			chain c;
+
+			try {
+				for (; begin != end; ++begin)
+					append(c, createNode(*begin));
+			}
+			catch (...) {
+				destroyChain(c);
+				throw;
+			}
+
+			return c;
+		}
+
+		// Cuts the count elements starting at the given 1-based position out
+		// of the list, leaving the links around the gap spanning it.
+		[[nodiscard]] chain detach(size_type position, size_type count) noexcept {
+			node_base* before[MAX_LEVEL];
+			node_base* last[MAX_LEVEL];
+			size_type beforePositions[MAX_LEVEL];
+			size_type lastPositions[MAX_LEVEL];
+
+			locate(position, before, beforePositions);
+			locate(position + count, last, lastPositions);
+
+			chain c;
+			c.count = count;
+
+			node_base* following = last[0]->to(0).next;
+
+			for (size_type level = 0; level < _level; ++level) {
+				link& gap = before[level]->to(level);
+
+				if (lastPositions[level] < position) {
+					gap.width -= count;
+					continue;
+				}
+
+				const link& exit = last[level]->to(level);
+				size_type afterPosition = lastPositions[level] + exit.width;
+
+				c.heads[level] = gap.next;
+				c.tails[level] = last[level];
+				c.headOffsets[level] = 
+					beforePositions[level] + gap.width - position;
+				c.tailOffsets[level] = lastPositions[level] - position;
+				c.height = level + 1;
+
+				gap = { exit.next, afterPosition - beforePositions[level] - count };
+			}
+
+			following->prev = before[0];
+			_size -= count;
+
+			while (_level && head()->to(_level - 1).next == head())
+				--_level;
+
+			return c;
+		}
+
+		// Links the chain in so that its first element lands at the given 
+		// 0-based index.
+		void attach(size_type index, const chain& c) noexcept {
+			while (_level < c.height) {
+				head()->to(_level) = { head(), _size + 1 };
+				++_level;
+			}
+
+			node_base* before[MAX_LEVEL];
+			size_type beforePositions[MAX_LEVEL];
+			locate(index + 1, before, beforePositions);
+
+			node_base* following = before[0]->to(0).next;
+
+			for (size_type level = 0; level < _level; ++level) {
+				link& gap = before[level]->to(level);
+
+				if (level >= c.height) {
+					gap.width += c.count;
+					continue;
+				}
+
+				size_type nextPosition = beforePositions[level] + gap.width;
+				size_type headPosition = index + 1 + c.headOffsets[level];
+				size_type tailPosition = index + 1 + c.tailOffsets[level];
+
+				c.tails[level]->to(level) = {
+					gap.next, nextPosition + c.count - tailPosition
+				};
+				gap = { c.heads[level], headPosition - beforePositions[level] };
+			}
+
+			c.heads[0]->prev = before[0];
+			following->prev = c.tails[0];
+			_size += c.count;
+		}
+
+		iterator insertChain(size_type index, const chain& c) noexcept {
+			if (!c.count)
+				return iterator(nodeAt(index + 1));
+
+			attach(index, c);
+			return iterator(c.heads[0]);
+		}
+
+		iterator removeAll(size_type first, size_type last) noexcept {
+			if (first < last)
+				destroyChain(detach(first + 1, last - first));
+
+			return iterator(nodeAt(first + 1));
+		}
+
+		// Takes over the nodes of the other list, which must use an equal 
+		// allocator, while this list is empty. Only the head, the first 
+		// node's back link and the last node on each level refer to the 
+		// other's head, so the hand-over costs O(log n).
+		void adopt(SkipList& other) noexcept {
+			if (other.isEmpty())
+				return;
+
+			node_base* last[MAX_LEVEL];
+			size_type lastPositions[MAX_LEVEL];
+			other.locate(other._size + 1, last, lastPositions);
+
+			for (size_type level = 0; level < other._level; ++level) {
+				head()->to(level) = other.head()->to(level);
+				last[level]->to(level).next = head();
+			}
+
+			head()->prev = other.head()->prev;
+			head()->to(0).next->prev = head();
+
+			_size = other._size;
+			_level = other._level;
+
+			other._size = 0;
+			other.initHead();
+		}
+
+		void swapMembers(SkipList& other) noexcept {
+			SkipList temp(allocator());
+			temp.adopt(*this);
+			adopt(other);
+			other.adopt(temp);
+			std::swap(_seed, other._seed);
+		}
+
+		void validateIndexExists(size_type index) const {
+			if (index >= size())
+				throwInvalidIndex(index);
+		}
+
+		void validateIndexInRange(size_type index) const {
+			if (index > size())
+				throwInvalidIndex(index);
+		}
+
+		[[noreturn]] void throwInvalidIndex(size_type index) const {
+			constexpr auto INVALID_INDEX = "Invalid Index: out of range.";
+			std::stringstream err{};
+
+			err << INVALID_INDEX << std::endl << "Index: " << index
+				<< " Size: " << size() << std::endl;
+			throw std::out_of_range(err.str().c_str());
+		}
+
+		// ---------------------------------------------------------------------
+		/// <summary>
+		/// SkipListIterator is a bidirectional iterator over the bottom level 
+		/// of the skip list.
+		/// </summary>
+		/// 
+		/// <typeparam name="isConst">
+		/// Whether the iterator gives const access to the elements.
+		/// </typeparam> -------------------------------------------------------
+		template <bool isConst>
+		class SkipListIterator {
+		private:
+			using pNode = std::conditional_t<isConst, const node_base*, node_base*>;
+
+			pNode _node = nullptr;
+
+			explicit SkipListIterator(pNode node) : _node(node) {}
+
+			friend class SkipList;
+
+		public:
+
+			using value_type = std::conditional_t<isConst, const element_t, element_t>;
+			using difference_type = std::ptrdiff_t;
+			using pointer = value_type*;
+			using reference = value_type&;
+			using iterator_category = std::bidirectional_iterator_tag;
+
+			// -----------------------------------------------------------------
+			/// <summary>
+			/// ~~~ Default Constructor ~~~
+			///
+			///	<para>
+			/// Constructs an empty SkipListIterator.
+			/// </para></summary> ----------------------------------------------
+			SkipListIterator() = default;
+
+			// -----------------------------------------------------------------
+			/// <summary>
+			/// ~~~ Implicit Conversion Constructor ~~~
+			///
+			/// <para>
+			/// Converts a non-const SkipListIterator to a const one.
+			/// </para></summary> ----------------------------------------------
+			template<
+				bool wasConst, 
+				class = std::enable_if_t<isConst && !wasConst>
+			>
+			SkipListIterator(SkipListIterator<wasConst> copy)
+				: SkipListIterator(copy._node) {}
+
+			// -----------------------------------------------------------------
+			/// <summary>
+			/// ~~~ Dereference Operator ~~~
+			/// </summary>
+			///
+			/// <returns>
+			/// Returns a reference to the element pointed to by the iterator.
+			///	</returns> -----------------------------------------------------
+			reference operator*() const {
+				return SkipList::value(_node);
+			}
+
+			// ----------------------------------------------------------------
+			/// <summary>
+			/// ~~~ Arrow Operator ~~~
+			/// </summary>
+			///
+			/// <returns>
+			/// Returns a pointer to the element pointed to by the iterator.
+			///	</returns> ----------------------------------------------------
+			pointer operator->() const {
+				return std::addressof(SkipList::value(_node));
+			}
+
+			// -----------------------------------------------------------------
+			/// <summary>
+			/// ~~~ Pre-Increment Operator ~~~
+			/// </summary>
+			///
+			/// <returns>
+			/// Moves the iterator to the next element and returns the iterator
+			/// after updating.
+			///	</returns> -----------------------------------------------------
+			SkipListIterator& operator++() {
+				_node = _node->to(0).next;
+				return *this;
+			}
+
+			// -----------------------------------------------------------------
+			/// <summary>
+			/// ~~~ Post-Increment Operator ~~~
+			/// </summary>
+			///
+			/// <returns>
+			/// Moves the iterator to the next element and returns a copy of
+			/// the iterator before updating.
+			///	</returns> -----------------------------------------------------
+			SkipListIterator operator++(int) {
+				auto copy = *this;
+				_node = _node->to(0).next;
+				return copy;
+			}
+
+			// -----------------------------------------------------------------
+			/// <summary>
+			/// ~~~ Pre-Decrement Operator ~~~
+			/// </summary>
+			///
+			/// <returns>
+			/// Moves the iterator to the previous element and returns the
+			/// iterator after updating.
+			///	</returns> -----------------------------------------------------
+			SkipListIterator& operator--() {
+				_node = _node->prev;
+				return *this;
+			}
+
+			// -----------------------------------------------------------------
+			/// <summary>
+			/// ~~~ Post-Decrement Operator ~~~
+			/// </summary>
+			///
+			/// <returns>
+			/// Moves the iterator to the previous element and returns a copy
+			/// of the iterator before updating.
+			///	</returns> -----------------------------------------------------
+			SkipListIterator operator--(int) {
+				auto copy = *this;
+				_node = _node->prev;
+				return copy;
+			}
+
+			// -----------------------------------------------------------------
+			/// <summary>
+			/// ~~~ Equality Operator ~~~
+			/// </summary>
+			///
+			/// <returns>
+			/// Returns true if the iterators point to the same element.
+			///	</returns> -----------------------------------------------------
+			friend bool operator==(
+				const SkipListIterator& lhs,
+				const SkipListIterator& rhs
+			) {
+				return lhs._node == rhs._node;
+			}
+		};
+
+		static_assert(
+			std::bidirectional_iterator<iterator>,
+			"SkipListIterator is not a valid bidirectional iterator."
+		);
+	};
+
+	static_assert(
+		collection<SkipList<int>>,
+		"SkipList does not meet the requirements for a collection."
+	);
+
+	static_assert(
+		sequential<SkipList<int>>,
+		"SkipList does not meet the requirements for sequential access."
+	);
+
+	static_assert(
+		indexable<SkipList<int>, size_t>,
+		"SkipList does not meet the requirements for indexed access."
+	);
+
+	static_assert(
+		positional<SkipList<int>>,
+		"SkipList does not meet the requirements for positional access."
+	);
+
+	static_assert(
+		bidirectionally_iterable<SkipList<int>>,
+		"SkipList does not meet the requirements for bidirectional iteration."
+	);
+}
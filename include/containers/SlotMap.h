@@ -0,0 +1,1039 @@
+/* ============================================================================
+* Copyright (C) 2023 Ryan Eubank
+*
+* This program is free software: you can redistribute it and/or modify
+* it under the terms of the GNU General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License
+* along with this program.  If not, see <https://www.gnu.org/licenses/>.
+* ========================================================================= */
+
+#pragma once
+
+#include <algorithm>
+#include <compare>
+#include <cstdint>
+#include <initializer_list>
+#include <istream>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <ostream>
+#include <ranges>
+#include <sstream>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "../algorithms/stream.h"
+#include "../concepts/collection.h"
+#include "../concepts/iterable.h"
+#include "DynamicArray.h"
+
+namespace collections {
+
+	// -------------------------------------------------------------------------
+	/// <summary>
+	/// A 64-bit handle to a value stored in a SlotMap. The index names the
+	/// slot and the generation names the occupant of that slot, so a handle
+	/// to a removed value is never mistaken for a later value reusing the
+	/// same slot.
+	/// </summary> -------------------------------------------------------------
+	struct SlotHandle {
+		uint32_t index;
+		uint32_t generation;
+
+		friend constexpr bool operator==(SlotHandle, SlotHandle) = default;
+		friend constexpr auto operator<=>(SlotHandle, SlotHandle) = default;
+	};
+
+	static_assert(sizeof(SlotHandle) == sizeof(uint64_t));
+
+	// -------------------------------------------------------------------------
+	/// <summary>
+	/// SlotMap is a collection that stores its values contiguously and hands
+	/// out stable generational handles to them. Insertion, lookup and
+	/// removal by handle are constant time. Removal moves the last value into
+	/// the hole so iteration always walks a dense array, while an
+	/// indirection table of slots keeps outstanding handles valid.
+	/// </summary>
+	///
+	/// <typeparam name="element_t">
+	/// The type of the values contained by the map.
+	/// </typeparam>
+	/// <typeparam name="allocator_t">
+	/// The type of the allocator responsible for allocating memory to the
+	/// map.
+	/// </typeparam> -----------------------------------------------------------
+	template <class element_t, class allocator_t = std::allocator<element_t>>
+	class SlotMap final {
+	private:
+
+		// A slot is occupied while its generation is odd. position is the
+		// index of the value in the dense array when occupied, or the next
+		// slot on the free list when not.
+		struct slot {
+			uint32_t position;
+			uint32_t generation;
+		};
+
+		using value_array	= DynamicArray<element_t, rebind<allocator_t, element_t>>;
+		using owner_array	= DynamicArray<uint32_t, rebind<allocator_t, uint32_t>>;
+		using slot_array	= DynamicArray<slot, rebind<allocator_t, slot>>;
+
+		static constexpr uint32_t NO_SLOT = std::numeric_limits<uint32_t>::max();
+
+	public:
+
+		using value_type		= element_t;
+		using allocator_type	= allocator_t;
+		using handle_type		= SlotHandle;
+		using reference			= value_type&;
+		using const_reference	= const value_type&;
+		using size_type			= value_array::size_type;
+		using difference_type	= value_array::difference_type;
+		using pointer			= value_array::pointer;
+		using const_pointer		= value_array::const_pointer;
+
+		using iterator					= value_array::iterator;
+		using const_iterator			= value_array::const_iterator;
+		using reverse_iterator			= std::reverse_iterator<iterator>;
+		using const_reverse_iterator	= std::reverse_iterator<const_iterator>;
+
+		// ---------------------------------------------------------------------
+		/// <summary>
+		/// ~~~ Default Constructor ~~~
+		///
+		///	<para>
+		/// Constructs an empty map.
+		/// </para></summary> --------------------------------------------------
+		SlotMap() :
+			_values(),
+			_owners(),
+			_slots(),
+			_free(NO_SLOT)
+		{
+
+		}
+
+		// ---------------------------------------------------------------------
+		/// <summary>
+		/// ~~~ Allocator Constructor ~~~
+		///
+		///	<para>
+		/// Constructs an empty map.
+		/// </para></summary>
+		///
+		/// <param name="alloc">
+		/// The allocator instance used by the map.
+		/// </param> -----------------------------------------------------------
+		explicit SlotMap(const allocator_type& alloc) :
+			_values(rebind<allocator_t, element_t>(alloc)),
+			_owners(rebind<allocator_t, uint32_t>(alloc)),
+			_slots(rebind<allocator_t, slot>(alloc)),
+			_free(NO_SLOT)
+		{
+
+		}
+
+		// ---------------------------------------------------------------------
+		/// <summary>
+		/// ~~~ Copy Constructor ~~~
+		///
+		/// <para>
+		/// Constructs a deep copy of the specified map. Handles issued by the
+		/// copied map are valid for the copy.
+		/// </para></summary>
+		///
+		/// <param name="copy">
+		/// The map to be copied.
+		/// </param> -----------------------------------------------------------
+		SlotMap(const SlotMap& copy) = default;
+
+		// ---------------------------------------------------------------------
+		/// <summary>
+		/// ~~~ Move Constructor ~~~
+		///
+		/// <para>
+		/// Constructs a map by moving the data from the provided map into
+		/// this one.
+		/// </para></summary>
+		///
+		/// <param name="other">
+		/// The map to be moved into this one.
+		/// </param> -----------------------------------------------------------
+		SlotMap(SlotMap&& other) noexcept :
+			_values(std::move(other._values)),
+			_owners(std::move(other._owners)),
+			_slots(std::move(other._slots)),
+			_free(std::exchange(other._free, NO_SLOT))
+		{
+
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// ~~~ Initialization Constructor ~~~
+		///
+		/// <para>
+		/// Constructs a map containing the values in the specified
+		/// initialization list.
+		/// </para></summary>
+		///
+		/// <param name="init">
+		/// The initialization list to copy values from.
+		/// </param>
+		/// <param name="alloc">
+		/// The allocator instance used by the map. Default constructs the
+		/// allocator if unspecified.
+		/// </param> ----------------------------------------------------------
+		SlotMap(
+			std::initializer_list<value_type> init,
+			const allocator_type& alloc = allocator_type{}
+		) : SlotMap(init.begin(), init.end(), alloc) {
+
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// ~~~ Iterator Constructor ~~~
+		///
+		/// <para>
+		/// Constructs a map containing the values from the given
+		/// iterator/sentinel pair.
+		/// </para></summary>
+		///
+		/// <typeparam name="in_iterator">
+		/// The type of the beginning iterator to copy from.
+		/// </typeparam>
+		/// <typeparam name="sentinel">
+		/// The type of the end iterator or sentinel.
+		/// </typeparam>
+		///
+		/// <param name="begin">
+		/// The beginning of the range to copy from.
+		/// </param>
+		/// <param name="end">
+		/// The end of the range to copy from.
+		/// </param>
+		/// <param name="alloc">
+		/// The allocator instance used by the map. Default constructs the
+		/// allocator if unspecified.
+		/// </param> ----------------------------------------------------------
+		template <
+			std::input_iterator in_iterator,
+			std::sentinel_for<in_iterator> sentinel
+		>
+		SlotMap(
+			in_iterator begin,
+			sentinel end,
+			const allocator_type& alloc = allocator_type{}
+		) : SlotMap(alloc) {
+			while (begin != end)
+				insert(*begin++);
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// ~~~ Range Constructor ~~~
+		///
+		/// <para>
+		/// Constructs a map containing the values from the given range.
+		/// </para></summary>
+		///
+		/// <typeparam name="range">
+		/// The type of the range being constructed from.
+		/// </typeparam>
+		///
+		/// <param name="tag">
+		/// Range construction tag to disabiguate this constructor from
+		/// construction with an initializer list.
+		/// </param>
+		/// <param name="rg">
+		/// The range to construct the map with.
+		/// </param>
+		/// <param name="alloc">
+		/// The allocator instance for the map. Default constructs the
+		/// allocator if unspecified.
+		/// </param> ----------------------------------------------------------
+		template <std::ranges::input_range range>
+		SlotMap(
+			from_range_t tag,
+			range&& rg,
+			const allocator_type& alloc = allocator_type{}
+		) : SlotMap(std::ranges::begin(rg), std::ranges::end(rg), alloc) {
+
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// ~~~ Destructor ~~~
+		///
+		/// <para>
+		/// Destructs the map safely releasing its memory.
+		/// </para></summary> -------------------------------------------------
+		~SlotMap() = default;
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// ~~~ Copy Assignment Operator ~~~
+		///
+		/// <para>
+		/// Copies the data from the given argument to this map.
+		/// </para></summary>
+		///
+		/// <param name="other">
+		/// The map to copy from.
+		/// </param>
+		///
+		/// <returns>
+		/// Returns the caller with the copied data.
+		/// </returns> --------------------------------------------------------
+		SlotMap& operator=(const SlotMap& other) = default;
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// ~~~ Move Assignment Operator ~~~
+		///
+		/// <para>
+		/// Moves the data from the given argument to this map.
+		/// </para></summary>
+		///
+		/// <param name="other">
+		/// The map to move from.
+		/// </param>
+		///
+		/// <returns>
+		/// Returns the caller with the moved data.
+		/// </returns> --------------------------------------------------------
+		SlotMap& operator=(SlotMap&& other) {
+			_values = std::move(other._values);
+			_owners = std::move(other._owners);
+			_slots = std::move(other._slots);
+			_free = std::exchange(other._free, NO_SLOT);
+			return *this;
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Performs unchecked lookup of the value named by the given handle.
+		/// </summary>
+		///
+		/// <param name="handle">
+		/// A valid handle issued by this map.
+		/// </param>
+		///
+		/// <returns>
+		/// Returns a reference to the value named by the handle.
+		/// </returns> --------------------------------------------------------
+		[[nodiscard]] reference operator[](handle_type handle) noexcept {
+			return _values[_slots[handle.index].position];
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Performs unchecked lookup of the value named by the given handle.
+		/// </summary>
+		///
+		/// <param name="handle">
+		/// A valid handle issued by this map.
+		/// </param>
+		///
+		/// <returns>
+		/// Returns a const reference to the value named by the handle.
+		/// </returns> --------------------------------------------------------
+		[[nodiscard]] const_reference operator[](handle_type handle) const noexcept {
+			return _values[_slots[handle.index].position];
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Performs checked lookup of the value named by the given handle.
+		/// Throws std::out_of_range if the handle is stale or was not issued
+		/// by this map.
+		/// </summary>
+		///
+		/// <param name="handle">
+		/// The handle of the value to return.
+		/// </param>
+		///
+		/// <returns>
+		/// Returns a reference to the value named by the handle.
+		/// </returns> --------------------------------------------------------
+		[[nodiscard]] reference at(handle_type handle) {
+			validateHandle(handle);
+			return (*this)[handle];
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Performs checked lookup of the value named by the given handle.
+		/// Throws std::out_of_range if the handle is stale or was not issued
+		/// by this map.
+		/// </summary>
+		///
+		/// <param name="handle">
+		/// The handle of the value to return.
+		/// </param>
+		///
+		/// <returns>
+		/// Returns a const reference to the value named by the handle.
+		/// </returns> --------------------------------------------------------
+		[[nodiscard]] const_reference at(handle_type handle) const {
+			validateHandle(handle);
+			return (*this)[handle];
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Returns the internal array of values managed by the map.
+		/// </summary>
+		///
+		/// <returns>
+		/// Returns a pointer to the first of size() contiguous values.
+		/// </returns> --------------------------------------------------------
+		[[nodiscard]] pointer asRawPointer() noexcept {
+			return _values.asRawPointer();
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Returns the internal array of values managed by the map.
+		/// </summary>
+		///
+		/// <returns>
+		/// Returns a const pointer to the first of size() contiguous values.
+		/// </returns> --------------------------------------------------------
+		[[nodiscard]] const_pointer asRawPointer() const noexcept {
+			return _values.asRawPointer();
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Returns the allocator managing memory for the container.
+		/// </summary>
+		///
+		/// <returns>
+		/// Returns a copy of the allocator managing memory for the container.
+		/// </returns> --------------------------------------------------------
+		[[nodiscard]] allocator_type allocator() const noexcept {
+			return static_cast<allocator_type>(_values.allocator());
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Returns the number of values contained by the map.
+		/// </summary>
+		///
+		/// <returns>
+		/// Returns the number of values in the map.
+		/// </returns> --------------------------------------------------------
+		[[nodiscard]] size_type size() const noexcept {
+			return _values.size();
+		}
+
+		// ---------------------------------------------------------------------
+		/// <summary>
+		/// Returns the theoretical maximum size for the container.
+		/// </summary>
+		///
+		/// <returns>
+		/// Returns the maximum number of values addressable by a handle.
+		/// </returns> ---------------------------------------------------------
+		[[nodiscard]] size_type max_size() const noexcept {
+			return std::min<size_type>(_values.max_size(), NO_SLOT);
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Returns the number of values the map can hold without allocating.
+		/// </summary>
+		///
+		/// <returns>
+		/// Returns the capacity of the dense value array.
+		/// </returns> --------------------------------------------------------
+		[[nodiscard]] size_type capacity() const noexcept {
+			return _values.capacity();
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Returns whether the map is empty and contains no values.
+		/// </summary>
+		///
+		/// <returns>
+		/// Returns true is the map contains zero values, false otherwise.
+		/// </returns> --------------------------------------------------------
+		[[nodiscard]] bool isEmpty() const noexcept {
+			return _values.isEmpty();
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Reserves memory for the given number of values. Throws an
+		/// exception if memory cannot be reserved.
+		/// </summary>
+		///
+		/// <param name="capacity">
+		/// The number of values to reserve space for.
+		/// </param> ----------------------------------------------------------
+		void reserve(size_type capacity) {
+			if (capacity > _values.capacity()) {
+				_values.reserve(capacity);
+				_owners.reserve(capacity);
+			}
+			if (capacity > _slots.capacity())
+				_slots.reserve(capacity);
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Empties and clears the map of all values. Every outstanding handle
+		/// becomes stale and the slots are kept for reuse.
+		/// </summary> --------------------------------------------------------
+		void clear() noexcept {
+			for (auto index : _owners)
+				releaseSlot(index);
+
+			_values.clear();
+			_owners.clear();
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Returns an iterator to the first value in the dense array.
+		/// </summary>
+		///
+		/// <returns>
+		/// Returns a random access iterator over the values of the map.
+		/// </returns> --------------------------------------------------------
+		[[nodiscard]] iterator begin() noexcept {
+			return _values.begin();
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Returns an iterator past the last value in the dense array.
+		/// </summary>
+		///
+		/// <returns>
+		/// Returns the end iterator of the map.
+		/// </returns> --------------------------------------------------------
+		[[nodiscard]] iterator end() noexcept {
+			return _values.end();
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Returns a const iterator to the first value in the dense array.
+		/// </summary>
+		///
+		/// <returns>
+		/// Returns a random access iterator over the values of the map.
+		/// </returns> --------------------------------------------------------
+		[[nodiscard]] const_iterator begin() const noexcept {
+			return _values.begin();
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Returns a const iterator past the last value in the dense array.
+		/// </summary>
+		///
+		/// <returns>
+		/// Returns the end iterator of the map.
+		/// </returns> --------------------------------------------------------
+		[[nodiscard]] const_iterator end() const noexcept {
+			return _values.end();
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Returns a const iterator to the first value in the dense array.
+		/// </summary>
+		///
+		/// <returns>
+		/// Returns a random access iterator over the values of the map.
+		/// </returns> --------------------------------------------------------
+		[[nodiscard]] const_iterator cbegin() const noexcept {
+			return begin();
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Returns a const iterator past the last value in the dense array.
+		/// </summary>
+		///
+		/// <returns>
+		/// Returns the end iterator of the map.
+		/// </returns> --------------------------------------------------------
+		[[nodiscard]] const_iterator cend() const noexcept {
+			return end();
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Returns a reverse iterator to the last value in the dense array.
+		/// </summary>
+		///
+		/// <returns>
+		/// Returns a reverse iterator over the values of the map.
+		/// </returns> --------------------------------------------------------
+		[[nodiscard]] reverse_iterator rbegin() noexcept {
+			return reverse_iterator(end());
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Returns a reverse iterator before the first value in the dense
+		/// array.
+		/// </summary>
+		///
+		/// <returns>
+		/// Returns the reverse end iterator of the map.
+		/// </returns> --------------------------------------------------------
+		[[nodiscard]] reverse_iterator rend() noexcept {
+			return reverse_iterator(begin());
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Returns a const reverse iterator to the last value in the dense
+		/// array.
+		/// </summary>
+		///
+		/// <returns>
+		/// Returns a reverse iterator over the values of the map.
+		/// </returns> --------------------------------------------------------
+		[[nodiscard]] const_reverse_iterator rbegin() const noexcept {
+			return const_reverse_iterator(end());
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Returns a const reverse iterator before the first value in the
+		/// dense array.
+		/// </summary>
+		///
+		/// <returns>
+		/// Returns the reverse end iterator of the map.
+		/// </returns> --------------------------------------------------------
+		[[nodiscard]] const_reverse_iterator rend() const noexcept {
+			return const_reverse_iterator(begin());
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Returns a const reverse iterator to the last value in the dense
+		/// array.
+		/// </summary>
+		///
+		/// <returns>
+		/// Returns a reverse iterator over the values of the map.
+		/// </returns> --------------------------------------------------------
+		[[nodiscard]] const_reverse_iterator crbegin() const noexcept {
+			return rbegin();
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Returns a const reverse iterator before the first value in the
+		/// dense array.
+		/// </summary>
+		///
+		/// <returns>
+		/// Returns the reverse end iterator of the map.
+		/// </returns> --------------------------------------------------------
+		[[nodiscard]] const_reverse_iterator crend() const noexcept {
+			return rend();
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Returns whether the given handle names a value in the map.
+		/// </summary>
+		///
+		/// <param name="handle">
+		/// The handle to check.
+		/// </param>
+		///
+		/// <returns>
+		/// Returns true if the handle is live, false if it is stale or was
+		/// not issued by this map.
+		/// </returns> --------------------------------------------------------
+		[[nodiscard]] bool contains(handle_type handle) const noexcept {
+			return handle.index < _slots.size() &&
+				(handle.generation & 1) &&
+				_slots[handle.index].generation == handle.generation;
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Searches the map for the value named by the given handle.
+		/// </summary>
+		///
+		/// <param name="handle">
+		/// The handle of the value to search for.
+		/// </param>
+		///
+		/// <returns>
+		/// Returns an iterator to the value, or end() if the handle is stale.
+		/// </returns> --------------------------------------------------------
+		[[nodiscard]] iterator find(handle_type handle) noexcept {
+			return contains(handle) ? begin() + positionOf(handle) : end();
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Searches the map for the value named by the given handle.
+		/// </summary>
+		///
+		/// <param name="handle">
+		/// The handle of the value to search for.
+		/// </param>
+		///
+		/// <returns>
+		/// Returns an iterator to the value, or end() if the handle is stale.
+		/// </returns> --------------------------------------------------------
+		[[nodiscard]] const_iterator find(handle_type handle) const noexcept {
+			return contains(handle) ? begin() + positionOf(handle) : end();
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Returns the handle naming the value at the given position.
+		/// </summary>
+		///
+		/// <param name="position">
+		/// An iterator to a value in the map.
+		/// </param>
+		///
+		/// <returns>
+		/// Returns the live handle of the value.
+		/// </returns> --------------------------------------------------------
+		[[nodiscard]] handle_type handleOf(const_iterator position) const noexcept {
+			uint32_t index = _owners[position - begin()];
+			return handle_type{ index, _slots[index].generation };
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Inserts the given value into the map.
+		/// </summary>
+		///
+		/// <param name="element">
+		/// The value to be inserted.
+		/// </param>
+		///
+		/// <returns>
+		/// Returns the handle naming the inserted value.
+		/// </returns> --------------------------------------------------------
+		handle_type insert(const_reference element) {
+			return emplace(element);
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Inserts the given value into the map.
+		/// </summary>
+		///
+		/// <param name="element">
+		/// The value to be inserted.
+		/// </param>
+		///
+		/// <returns>
+		/// Returns the handle naming the inserted value.
+		/// </returns> --------------------------------------------------------
+		handle_type insert(value_type&& element) {
+			return emplace(std::move(element));
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Constructs a value in place at the back of the dense array.
+		/// </summary>
+		///
+		/// <param name="args">
+		/// The arguments to construct the new value with.
+		/// </param>
+		///
+		/// <returns>
+		/// Returns the handle naming the inserted value.
+		/// </returns> --------------------------------------------------------
+		template <class ...Args>
+		handle_type emplace(Args&&... args) {
+			uint32_t index = acquireSlot();
+			slot& s = _slots[index];
+
+			try {
+				_values.emplaceBack(std::forward<Args>(args)...);
+				_owners.insertBack(index);
+			}
+			catch (...) {
+				if (_values.size() > _owners.size())
+					_values.removeBack();
+				releaseSlot(index);
+				throw;
+			}
+
+			s.position = static_cast<uint32_t>(_values.size() - 1);
+			return handle_type{ index, s.generation };
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Removes the value named by the given handle. Stale handles are
+		/// ignored.
+		/// </summary>
+		///
+		/// <param name="handle">
+		/// The handle of the value to remove.
+		/// </param>
+		///
+		/// <returns>
+		/// Returns true if a value was removed, false otherwise.
+		/// </returns> --------------------------------------------------------
+		bool remove(handle_type handle) {
+			if (!contains(handle))
+				return false;
+
+			remove(begin() + positionOf(handle));
+			return true;
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Removes the value at the given position by moving the last value
+		/// of the dense array into its place.
+		/// </summary>
+		///
+		/// <param name="position">
+		/// The iterator position of the value to be removed.
+		/// </param>
+		///
+		/// <returns>
+		/// Returns an iterator to the same position, which now holds the
+		/// value previously at the back of the map, or end() if the removed
+		/// value was last.
+		/// </returns> --------------------------------------------------------
+		iterator remove(const_iterator position) {
+			size_type offset = position - begin();
+			size_type last = _values.size() - 1;
+
+			releaseSlot(_owners[offset]);
+
+			if (offset != last) {
+				_values[offset] = std::move(_values[last]);
+				_owners[offset] = _owners[last];
+				_slots[_owners[offset]].position = static_cast<uint32_t>(offset);
+			}
+
+			_values.removeBack();
+			_owners.removeBack();
+			return begin() + offset;
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Removes all values in the given iterator range [begin, end).
+		/// </summary>
+		///
+		/// <returns>
+		/// Returns an iterator to the position of begin, which now holds the
+		/// first value moved into the removed range, or end().
+		/// </returns> --------------------------------------------------------
+		iterator remove(const_iterator begin, const_iterator end) {
+			size_type offset = begin - this->begin();
+			size_type count = end - begin;
+
+			for (size_type i = offset + count; i > offset; --i)
+				remove(this->begin() + (i - 1));
+
+			return this->begin() + offset;
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Swaps the contents of the given maps.
+		/// </summary>
+		///
+		/// <param name="a">
+		/// The first map to be swapped.
+		/// </param>
+		///
+		/// <param name="b">
+		/// The second map to be swapped.
+		/// </param> ----------------------------------------------------------
+		friend void swap(SlotMap& a, SlotMap& b) noexcept {
+			a.swap(b);
+		}
+
+		// ---------------------------------------------------------------------
+		/// <summary>
+		/// Swaps the contents of this map with the given map.
+		/// </summary>
+		///
+		/// <param name="other">
+		/// The container to be swapped with.
+		/// </param> -----------------------------------------------------------
+		void swap(SlotMap& other) noexcept {
+			_values.swap(other._values);
+			_owners.swap(other._owners);
+			_slots.swap(other._slots);
+			std::swap(_free, other._free);
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// ~~~ Equality Operator ~~~
+		/// </summary>
+		///
+		/// <param name="lhs">
+		/// The map appearing on the left side of the operator.
+		/// </param>
+		/// <param name="rhs">
+		/// The map appearing on the right side of the operator.
+		/// </param>
+		///
+		/// <returns>
+		/// Returns true if both maps hold equal values in the same dense
+		/// order, false otherwise.
+		/// </returns> --------------------------------------------------------
+		friend bool operator==(
+			const SlotMap& lhs,
+			const SlotMap& rhs
+		) noexcept {
+			return lhs._values == rhs._values;
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// ~~~ Output Stream Operator ~~~
+		/// </summary>
+		///
+		/// <typeparam name="char_t">
+		/// The type of the character stream written to by the operator.
+		/// </typeparam>
+		///
+		/// <param name="os">
+		/// The stream being written to.
+		/// </param>
+		/// <param name="map">
+		/// The map being read from.
+		/// </param>
+		///
+		/// <returns>
+		/// Returns the output stream after writing.
+		/// </returns> --------------------------------------------------------
+		template <typename char_t>
+		friend std::basic_ostream<char_t>& operator<<(
+			std::basic_ostream<char_t>& os,
+			const SlotMap& map
+		) {
+			collections::stream(map, os);
+			return os;
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// ~~~ Input Stream Operator ~~~
+		/// </summary>
+		///
+		/// <typeparam name="char_t">
+		/// The type of the character stream read by the operator.
+		/// </typeparam>
+		///
+		/// <param name="is">
+		/// The stream being read from.
+		/// </param>
+		/// <param name="map">
+		/// The map being written to.
+		/// </param>
+		///
+		/// <returns>
+		/// Returns the input stream after reading.
+		/// </returns> --------------------------------------------------------
+		template <typename char_t>
+		friend std::basic_istream<char_t>& operator>>(
+			std::basic_istream<char_t>& is,
+			SlotMap& map
+		) {
+			value_type value{};
+			size_type size = 0;
+			is >> size;
+
+			map.clear();
+			for (size_type i = 0; i < size; ++i) {
+				is >> value;
+				map.insert(value);
+			}
+
+			return is;
+		}
+
+	private:
+
+		value_array _values;
+		owner_array _owners;
+		slot_array _slots;
+		uint32_t _free;
+
+		[[nodiscard]] size_type positionOf(handle_type handle) const noexcept {
+			return _slots[handle.index].position;
+		}
+
+		uint32_t acquireSlot() {
+			if (_free == NO_SLOT) {
+				if (_slots.size() >= max_size())
+					throw std::length_error("Allocation failed: SlotMap is full.\n");
+
+				_slots.insertBack(slot{ 0, 1 });
+				return static_cast<uint32_t>(_slots.size() - 1);
+			}
+
+			uint32_t index = _free;
+			slot& s = _slots[index];
+			_free = s.position;
+			++s.generation;
+			return index;
+		}
+
+		void releaseSlot(uint32_t index) noexcept {
+			slot& s = _slots[index];
+			++s.generation;
+			s.position = _free;
+			_free = index;
+		}
+
+		void validateHandle(handle_type handle) const {
+			if (!contains(handle))
+				invalidHandle(handle);
+		}
+
+		[[noreturn]] void invalidHandle(handle_type handle) const {
+			constexpr auto INVALID_HANDLE = "Invalid Handle: stale or foreign.";
+			std::stringstream err{};
+
+			err << INVALID_HANDLE << std::endl << "Index: " << handle.index
+				<< " Generation: " << handle.generation << std::endl;
+			throw std::out_of_range(err.str().c_str());
+		}
+	};
+
+	static_assert(
+		collection<SlotMap<int>>,
+		"SlotMap does not meet the requirements for a collection."
+	);
+
+	static_assert(
+		random_access_iterable<SlotMap<int>>,
+		"SlotMap does not meet the requirements for random access iteration."
+	);
+}
@@ -0,0 +1,818 @@
+/* ============================================================================
+* Copyright (C) 2023 Ryan Eubank
+*
+* This program is free software: you can redistribute it and/or modify
+* it under the terms of the GNU General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License
+* along with this program.  If not, see <https://www.gnu.org/licenses/>.
+* ========================================================================= */
+
+#pragma once
+
+#include <algorithm>
+#include <concepts>
+#include <initializer_list>
+#include <istream>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <ostream>
+#include <ranges>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "../algorithms/stream.h"
+#include "../concepts/associative.h"
+#include "../concepts/collection.h"
+#include "../concepts/iterable.h"
+#include "DynamicArray.h"
+
+namespace collections {
+
+	// -------------------------------------------------------------------------
+	/// <summary>
+	/// SparseSet is a set of bounded integer keys built from two arrays. The
+	/// dense array holds the keys contiguously in insertion order, and the
+	/// sparse array maps each key to its position in the dense array.
+	/// Insertion, lookup and removal are constant time, clear only resets
+	/// the dense array, and iteration walks the dense array directly.
+	///
+	/// The sparse array grows to the largest key inserted, so the set is
+	/// intended for small, densely packed keys such as entity ids. Negative
+	/// keys cannot be inserted.
+	/// </summary>
+	///
+	/// <typeparam name="key_t">
+	/// The integer type of the keys contained by the set.
+	/// </typeparam>
+	/// <typeparam name="allocator_t">
+	/// The type of the allocator responsible for allocating memory to the
+	/// set.
+	/// </typeparam> -----------------------------------------------------------
+	template <std::integral key_t, class allocator_t = std::allocator<key_t>>
+	class SparseSet final {
+	private:
+
+		using index_t		= std::make_unsigned_t<key_t>;
+		using dense_array	= DynamicArray<key_t, rebind<allocator_t, key_t>>;
+		using sparse_array	= DynamicArray<index_t, rebind<allocator_t, index_t>>;
+
+	public:
+
+		using value_type		= key_t;
+		using key_type			= key_t;
+		using allocator_type	= allocator_t;
+		using reference			= const value_type&;
+		using const_reference	= const value_type&;
+		using size_type			= dense_array::size_type;
+		using difference_type	= dense_array::difference_type;
+		using pointer			= dense_array::const_pointer;
+		using const_pointer		= dense_array::const_pointer;
+
+		using iterator					= dense_array::const_iterator;
+		using const_iterator			= dense_array::const_iterator;
+		using reverse_iterator			= std::reverse_iterator<iterator>;
+		using const_reverse_iterator	= std::reverse_iterator<const_iterator>;
+
+		// ---------------------------------------------------------------------
+		/// <summary>
+		/// ~~~ Default Constructor ~~~
+		///
+		///	<para>
+		/// Constructs an empty set.
+		/// </para></summary> --------------------------------------------------
+		SparseSet() = default;
+
+		// ---------------------------------------------------------------------
+		/// <summary>
+		/// ~~~ Allocator Constructor ~~~
+		///
+		///	<para>
+		/// Constructs an empty set.
+		/// </para></summary>
+		///
+		/// <param name="alloc">
+		/// The allocator instance used by the set.
+		/// </param> -----------------------------------------------------------
+		explicit SparseSet(const allocator_type& alloc) :
+			_dense(rebind<allocator_t, key_t>(alloc)),
+			_sparse(rebind<allocator_t, index_t>(alloc))
+		{
+
+		}
+
+		// ---------------------------------------------------------------------
+		/// <summary>
+		/// ~~~ Copy Constructor ~~~
+		///
+		/// <para>
+		/// Constructs a deep copy of the specified set.
+		/// </para></summary>
+		///
+		/// <param name="copy">
+		/// The set to be copied.
+		/// </param> -----------------------------------------------------------
+		SparseSet(const SparseSet& copy) = default;
+
+		// ---------------------------------------------------------------------
+		/// <summary>
+		/// ~~~ Move Constructor ~~~
+		///
+		/// <para>
+		/// Constructs a set by moving the data from the provided set into
+		/// this one.
+		/// </para></summary>
+		///
+		/// <param name="other">
+		/// The set to be moved into this one.
+		/// </param> -----------------------------------------------------------
+		SparseSet(SparseSet&& other) noexcept = default;
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// ~~~ Initialization Constructor ~~~
+		///
+		/// <para>
+		/// Constructs a set containing the keys in the specified
+		/// initialization list.
+		/// </para></summary>
+		///
+		/// <param name="init">
+		/// The initialization list to copy keys from.
+		/// </param>
+		/// <param name="alloc">
+		/// The allocator instance used by the set. Default constructs the
+		/// allocator if unspecified.
+		/// </param> ----------------------------------------------------------
+		SparseSet(
+			std::initializer_list<value_type> init,
+			const allocator_type& alloc = allocator_type{}
+		) : SparseSet(init.begin(), init.end(), alloc) {
+
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// ~~~ Iterator Constructor ~~~
+		///
+		/// <para>
+		/// Constructs a set containing the keys from the given
+		/// iterator/sentinel pair.
+		/// </para></summary>
+		///
+		/// <typeparam name="in_iterator">
+		/// The type of the beginning iterator to copy from.
+		/// </typeparam>
+		/// <typeparam name="sentinel">
+		/// The type of the end iterator or sentinel.
+		/// </typeparam>
+		///
+		/// <param name="begin">
+		/// The beginning of the range to copy from.
+		/// </param>
+		/// <param name="end">
+		/// The end of the range to copy from.
+		/// </param>
+		/// <param name="alloc">
+		/// The allocator instance used by the set. Default constructs the
+		/// allocator if unspecified.
+		/// </param> ----------------------------------------------------------
+		template <
+			std::input_iterator in_iterator,
+			std::sentinel_for<in_iterator> sentinel
+		>
+		SparseSet(
+			in_iterator begin,
+			sentinel end,
+			const allocator_type& alloc = allocator_type{}
+		) : SparseSet(alloc) {
+			insert(begin, end);
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// ~~~ Range Constructor ~~~
+		///
+		/// <para>
+		/// Constructs a set containing the keys from the given range.
+		/// </para></summary>
+		///
+		/// <typeparam name="range">
+		/// The type of the range being constructed from.
+		/// </typeparam>
+		///
+		/// <param name="tag">
+		/// Range construction tag to disabiguate this constructor from
+		/// construction with an initializer list.
+		/// </param>
+		/// <param name="rg">
+		/// The range to construct the set with.
+		/// </param>
+		/// <param name="alloc">
+		/// The allocator instance for the set. Default constructs the
+		/// allocator if unspecified.
+		/// </param> ----------------------------------------------------------
+		template <std::ranges::input_range range>
+		SparseSet(
+			from_range_t tag,
+			range&& rg,
+			const allocator_type& alloc = allocator_type{}
+		) : SparseSet(std::ranges::begin(rg), std::ranges::end(rg), alloc) {
+
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// ~~~ Destructor ~~~
+		///
+		/// <para>
+		/// Destructs the set safely releasing its memory.
+		/// </para></summary> -------------------------------------------------
+		~SparseSet() = default;
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// ~~~ Copy Assignment Operator ~~~
+		///
+		/// <para>
+		/// Copies the data from the given argument to this set.
+		/// </para></summary>
+		///
+		/// <param name="other">
+		/// The set to copy from.
+		/// </param>
+		///
+		/// <returns>
+		/// Returns the caller with the copied data.
+		/// </returns> --------------------------------------------------------
+		SparseSet& operator=(const SparseSet& other) = default;
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// ~~~ Move Assignment Operator ~~~
+		///
+		/// <para>
+		/// Moves the data from the given argument to this set.
+		/// </para></summary>
+		///
+		/// <param name="other">
+		/// The set to move from.
+		/// </param>
+		///
+		/// <returns>
+		/// Returns the caller with the moved data.
+		/// </returns> --------------------------------------------------------
+		SparseSet& operator=(SparseSet&& other) = default;
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Returns the allocator managing memory for the container.
+		/// </summary>
+		///
+		/// <returns>
+		/// Returns a copy of the allocator managing memory for the container.
+		/// </returns> --------------------------------------------------------
+		[[nodiscard]] allocator_type allocator() const noexcept {
+			return static_cast<allocator_type>(_dense.allocator());
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Returns the number of keys contained by the set.
+		/// </summary>
+		///
+		/// <returns>
+		/// Returns the number of keys in the set.
+		/// </returns> --------------------------------------------------------
+		[[nodiscard]] size_type size() const noexcept {
+			return _dense.size();
+		}
+
+		// ---------------------------------------------------------------------
+		/// <summary>
+		/// Returns the theoretical maximum size for the container.
+		/// </summary>
+		///
+		/// <returns>
+		/// Returns the maximum number of keys the set can hold.
+		/// </returns> ---------------------------------------------------------
+		[[nodiscard]] size_type max_size() const noexcept {
+			return std::min<size_type>(
+				_sparse.max_size(),
+				std::numeric_limits<index_t>::max()
+			);
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Returns the number of keys the sparse array can map without
+		/// growing, i.e. one past the largest key that can be inserted
+		/// without allocating.
+		/// </summary>
+		///
+		/// <returns>
+		/// Returns the size of the sparse array.
+		/// </returns> --------------------------------------------------------
+		[[nodiscard]] size_type universe() const noexcept {
+			return _sparse.size();
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Returns whether the set is empty and contains no keys.
+		/// </summary>
+		///
+		/// <returns>
+		/// Returns true is the set contains zero keys, false otherwise.
+		/// </returns> --------------------------------------------------------
+		[[nodiscard]] bool isEmpty() const noexcept {
+			return _dense.isEmpty();
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Empties and clears the set of all keys in constant time. The
+		/// sparse array is left untouched, since its stale entries are
+		/// rejected by the membership check.
+		/// </summary> --------------------------------------------------------
+		void clear() noexcept {
+			_dense.clear();
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Reserves memory so that every key in [0, universe) can be inserted
+		/// without further allocation. Throws an exception if memory cannot
+		/// be reserved.
+		/// </summary>
+		///
+		/// <param name="universe">
+		/// One past the largest key expected in the set.
+		/// </param> ----------------------------------------------------------
+		void reserve(size_type universe) {
+			if (universe > _dense.capacity())
+				_dense.reserve(universe);
+			if (universe > _sparse.size())
+				growSparse(universe);
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Returns an iterator to the first key in the dense array.
+		/// </summary>
+		///
+		/// <returns>
+		/// Returns a random access iterator over the keys of the set.
+		/// </returns> --------------------------------------------------------
+		[[nodiscard]] const_iterator begin() const noexcept {
+			return _dense.begin();
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Returns an iterator past the last key in the dense array.
+		/// </summary>
+		///
+		/// <returns>
+		/// Returns the end iterator of the set.
+		/// </returns> --------------------------------------------------------
+		[[nodiscard]] const_iterator end() const noexcept {
+			return _dense.end();
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Returns an iterator to the first key in the dense array.
+		/// </summary>
+		///
+		/// <returns>
+		/// Returns a random access iterator over the keys of the set.
+		/// </returns> --------------------------------------------------------
+		[[nodiscard]] const_iterator cbegin() const noexcept {
+			return begin();
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Returns an iterator past the last key in the dense array.
+		/// </summary>
+		///
+		/// <returns>
+		/// Returns the end iterator of the set.
+		/// </returns> --------------------------------------------------------
+		[[nodiscard]] const_iterator cend() const noexcept {
+			return end();
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Returns a reverse iterator to the last key in the dense array.
+		/// </summary>
+		///
+		/// <returns>
+		/// Returns a reverse iterator over the keys of the set.
+		/// </returns> --------------------------------------------------------
+		[[nodiscard]] const_reverse_iterator rbegin() const noexcept {
+			return const_reverse_iterator(end());
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Returns a reverse iterator before the first key in the dense
+		/// array.
+		/// </summary>
+		///
+		/// <returns>
+		/// Returns the reverse end iterator of the set.
+		/// </returns> --------------------------------------------------------
+		[[nodiscard]] const_reverse_iterator rend() const noexcept {
+			return const_reverse_iterator(begin());
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Returns a reverse iterator to the last key in the dense array.
+		/// </summary>
+		///
+		/// <returns>
+		/// Returns a reverse iterator over the keys of the set.
+		/// </returns> --------------------------------------------------------
+		[[nodiscard]] const_reverse_iterator crbegin() const noexcept {
+			return rbegin();
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Returns a reverse iterator before the first key in the dense
+		/// array.
+		/// </summary>
+		///
+		/// <returns>
+		/// Returns the reverse end iterator of the set.
+		/// </returns> --------------------------------------------------------
+		[[nodiscard]] const_reverse_iterator crend() const noexcept {
+			return rend();
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Returns a pointer to the dense array of keys.
+		/// </summary>
+		///
+		/// <returns>
+		/// Returns a pointer to the first of size() contiguous keys.
+		/// </returns> --------------------------------------------------------
+		[[nodiscard]] const_pointer asRawPointer() const noexcept {
+			return _dense.asRawPointer();
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Searches the set for the given key.
+		/// </summary>
+		///
+		/// <param name="key">
+		/// The key to search for.
+		/// </param>
+		///
+		/// <returns>
+		/// Returns an iterator to the key, or end() if it is not present.
+		/// </returns> --------------------------------------------------------
+		[[nodiscard]] const_iterator find(key_type key) const noexcept {
+			return contains(key) ? begin() + _sparse[indexOf(key)] : end();
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Returns whether the set contains the given key.
+		/// </summary>
+		///
+		/// <param name="key">
+		/// The key to search for.
+		/// </param>
+		///
+		/// <returns>
+		/// Returns true if the key is in the set, false otherwise.
+		/// </returns> --------------------------------------------------------
+		[[nodiscard]] bool contains(key_type key) const noexcept {
+			index_t index = indexOf(key);
+			if (index >= _sparse.size())
+				return false;
+
+			index_t position = _sparse[index];
+			return position < _dense.size() && _dense[position] == key;
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Inserts the given key into the set.
+		/// </summary>
+		///
+		/// <param name="element">
+		/// The key to be inserted.
+		/// </param>
+		///
+		/// <returns>
+		/// Returns an iterator to the inserted key, or the existing key
+		/// preventing insertion.
+		/// </returns>
+		///
+		/// <exception cref="std::out_of_range">
+		/// Thrown if the key is negative or too large to index the set.
+		/// </exception> ------------------------------------------------------
+		iterator insert(const_reference element) {
+			return insertKey(element);
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Inserts the given key into the set.
+		/// </summary>
+		///
+		/// <param name="element">
+		/// The key to be inserted.
+		/// </param>
+		///
+		/// <returns>
+		/// Returns an iterator to the inserted key, or the existing key
+		/// preventing insertion.
+		/// </returns>
+		///
+		/// <exception cref="std::out_of_range">
+		/// Thrown if the key is negative or too large to index the set.
+		/// </exception> ------------------------------------------------------
+		iterator insert(value_type&& element) {
+			return insertKey(element);
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Inserts the given range of keys into the set.
+		/// </summary>
+		///
+		/// <param name="begin">
+		/// The beginning iterator of the range to insert.
+		/// </param>
+		/// <param name="end">
+		/// The end iterator of the range to insert.
+		/// </param>
+		///
+		/// <returns>
+		/// Returns an iterator to the last key inserted, or end() if
+		/// begin == end.
+		/// </returns> --------------------------------------------------------
+		template <
+			std::input_iterator in_iterator,
+			std::sentinel_for<in_iterator> sentinel
+		>
+		iterator insert(in_iterator begin, sentinel end) {
+			iterator result = this->end();
+			while (begin != end)
+				result = insertKey(static_cast<key_type>(*begin++));
+			return result;
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Constructs a key from the given arguments and inserts it.
+		/// </summary>
+		///
+		/// <param name="args">
+		/// The arguments to construct the new key with.
+		/// </param>
+		///
+		/// <returns>
+		/// Returns an iterator to the inserted key.
+		/// </returns> --------------------------------------------------------
+		template <class T, class ...Args>
+			requires (!std::convertible_to<T, const_iterator>)
+		iterator emplace(T&& arg1, Args&&... args) {
+			return insertKey(
+				key_type(std::forward<T>(arg1), std::forward<Args>(args)...));
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Removes the key at the given position in constant time by moving
+		/// the last key of the dense array into its place.
+		/// </summary>
+		///
+		/// <param name="position">
+		/// The iterator position of the key to be removed.
+		/// </param>
+		///
+		/// <returns>
+		/// Returns an iterator to the same position, which now holds the key
+		/// previously at the back of the set, or end() if the removed key was
+		/// last.
+		/// </returns> --------------------------------------------------------
+		iterator remove(const_iterator position) {
+			size_type offset = position - begin();
+			key_type last = _dense.back();
+
+			_dense[offset] = last;
+			_sparse[indexOf(last)] = static_cast<index_t>(offset);
+			_dense.removeBack();
+
+			return begin() + offset;
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Removes all keys in the given iterator range [begin, end).
+		/// </summary>
+		///
+		/// <returns>
+		/// Returns an iterator to the position of begin, which now holds the
+		/// first key moved into the removed range, or end().
+		/// </returns> --------------------------------------------------------
+		iterator remove(const_iterator begin, const_iterator end) {
+			size_type offset = begin - this->begin();
+			while (end != begin)
+				remove(--end);
+			return this->begin() + offset;
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Swaps the contents of the given sets.
+		/// </summary>
+		///
+		/// <param name="a">
+		/// The first set to be swapped.
+		/// </param>
+		///
+		/// <param name="b">
+		/// The second set to be swapped.
+		/// </param> ----------------------------------------------------------
+		friend void swap(SparseSet& a, SparseSet& b) noexcept {
+			a.swap(b);
+		}
+
+		// ---------------------------------------------------------------------
+		/// <summary>
+		/// Swaps the contents of this set with the given set.
+		/// </summary>
+		///
+		/// <param name="other">
+		/// The container to be swapped with.
+		/// </param> -----------------------------------------------------------
+		void swap(SparseSet& other) noexcept {
+			_dense.swap(other._dense);
+			_sparse.swap(other._sparse);
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// ~~~ Equality Operator ~~~
+		/// </summary>
+		///
+		/// <param name="lhs">
+		/// The set appearing on the left side of the operator.
+		/// </param>
+		/// <param name="rhs">
+		/// The set appearing on the right side of the operator.
+		/// </param>
+		///
+		/// <returns>
+		/// Returns true if both sets contain the same keys, regardless of
+		/// the order they were inserted in.
+		/// </returns> --------------------------------------------------------
+		friend bool operator==(
+			const SparseSet& lhs,
+			const SparseSet& rhs
+		) noexcept {
+			if (lhs.size() != rhs.size())
+				return false;
+
+			for (auto key : lhs)
+				if (!rhs.contains(key))
+					return false;
+
+			return true;
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// ~~~ Output Stream Operator ~~~
+		/// </summary>
+		///
+		/// <typeparam name="char_t">
+		/// The type of the character stream written to by the operator.
+		/// </typeparam>
+		///
+		/// <param name="os">
+		/// The stream being written to.
+		/// </param>
+		/// <param name="set">
+		/// The set being read from.
+		/// </param>
+		///
+		/// <returns>
+		/// Returns the output stream after writing.
+		/// </returns> --------------------------------------------------------
+		template <typename char_t>
+		friend std::basic_ostream<char_t>& operator<<(
+			std::basic_ostream<char_t>& os,
+			const SparseSet& set
+		) {
+			collections::stream(set, os);
+			return os;
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// ~~~ Input Stream Operator ~~~
+		/// </summary>
+		///
+		/// <typeparam name="char_t">
+		/// The type of the character stream read by the operator.
+		/// </typeparam>
+		///
+		/// <param name="is">
+		/// The stream being read from.
+		/// </param>
+		/// <param name="set">
+		/// The set being written to.
+		/// </param>
+		///
+		/// <returns>
+		/// Returns the input stream after reading.
+		/// </returns> --------------------------------------------------------
+		template <typename char_t>
+		friend std::basic_istream<char_t>& operator>>(
+			std::basic_istream<char_t>& is,
+			SparseSet& set
+		) {
+			key_type key{};
+			size_type size = 0;
+			is >> size;
+
+			set.clear();
+			for (size_type i = 0; i < size; ++i) {
+				is >> key;
+				set.insert(key);
+			}
+
+			return is;
+		}
+
+	private:
+
+		dense_array _dense;
+		sparse_array _sparse;
+
+		[[nodiscard]] static constexpr index_t indexOf(key_type key) noexcept {
+			return static_cast<index_t>(key);
+		}
+
+		void growSparse(size_type universe) {
+			_sparse.resize(universe, index_t{});
+		}
+
+		iterator insertKey(key_type key) {
+			index_t index = indexOf(key);
+
+			// negative keys would wrap to huge indices, and the largest keys 
+			// cannot be covered by any sparse array.
+			[[unlikely]] if (
+				std::cmp_less(key, 0) || 
+				static_cast<size_type>(index) >= _sparse.max_size()
+			)
+				throw std::out_of_range("Invalid Key: out of range.");
+
+			if (index >= _sparse.size())
+				growSparse(std::max<size_type>(
+					static_cast<size_type>(index) + 1, _sparse.size() * 2));
+			else if (contains(key))
+				return begin() + _sparse[index];
+
+			_sparse[index] = static_cast<index_t>(_dense.size());
+			return _dense.insertBack(key);
+		}
+	};
+
+	static_assert(
+		collection<SparseSet<int>>,
+		"SparseSet does not meet the requirements for a collection."
+	);
+
+	static_assert(
+		associative<SparseSet<int>>,
+		"SparseSet does not meet the requirements for associative access."
+	);
+
+	static_assert(
+		random_access_iterable<SparseSet<int>>,
+		"SparseSet does not meet the requirements for random access iteration."
+	);
+}
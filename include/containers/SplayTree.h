@@ -17,11 +17,13 @@
 
 #pragma once
 
+#include <cstddef>
 #include <functional>
 #include <initializer_list>
 #include <iterator>
 #include <memory>
 #include <ranges>
+#include <tuple>
 #include <type_traits>
 #include <utility>
 
@@ -35,22 +37,107 @@
 
 namespace collections {
 
+	// -------------------------------------------------------------------------
+	/// <summary>
+	/// Splay policy that fully splays the node reached by every non-const 
+	/// lookup. Const lookups leave the tree unchanged.
+	/// </summary> -------------------------------------------------------------
+	struct full_splay {
+		static constexpr bool splays_reads = false;
+		static constexpr bool is_semi = false;
+		static constexpr std::size_t period = 1;
+	};
+
+	// -------------------------------------------------------------------------
+	/// <summary>
+	/// Splay policy that fully splays on every lookup, const lookups included,
+	/// so read-only users still adapt the tree. Const lookups then restructure
+	/// the tree and are no longer safe to run concurrently, and a tree using
+	/// this policy must not be defined const.
+	/// </summary> -------------------------------------------------------------
+	struct always_splay {
+		static constexpr bool splays_reads = true;
+		static constexpr bool is_semi = false;
+		static constexpr std::size_t period = 1;
+	};
+
+	// -------------------------------------------------------------------------
+	/// <summary>
+	/// Splay policy that semi-splays the node reached by non-const lookups. 
+	/// Each zig-zig step rotates only the parent over the grandparent and 
+	/// carries on from the parent, so the accessed path is roughly halved in
+	/// depth with about half the rotations, while the node itself moves only
+	/// part of the way to the root.
+	/// </summary> -------------------------------------------------------------
+	struct semi_splay {
+		static constexpr bool splays_reads = false;
+		static constexpr bool is_semi = true;
+		static constexpr std::size_t period = 1;
+	};
+
+	// -------------------------------------------------------------------------
+	/// <summary>
+	/// Splay policy that fully splays on one out of every splayPeriod 
+	/// non-const lookups and leaves the tree unchanged on the rest.
+	/// </summary> -------------------------------------------------------------
+	template <std::size_t splayPeriod>
+	struct periodic_splay {
+		static_assert(splayPeriod > 0, "The splay period must be positive.");
+
+		static constexpr bool splays_reads = false;
+		static constexpr bool is_semi = false;
+		static constexpr std::size_t period = splayPeriod;
+	};
+
 	template <
 		class element_t, 
 		class compare_t, 
 		class allocator_t, 
-		bool hasDuplicates
+		bool hasDuplicates,
+		bool isRanked = false,
+		bool cachesHeights = false,
+		bool splaysTopDown = false,
+		class splay_policy = full_splay
 	>
 	class SplayTree : public impl::BaseBST<
 		element_t,
 		compare_t,
 		allocator_t,
 		hasDuplicates,
-		SplayTree<element_t, compare_t, allocator_t, hasDuplicates>>
+		isRanked,
+		cachesHeights,
+		SplayTree<
+			element_t, 
+			compare_t, 
+			allocator_t, 
+			hasDuplicates, 
+			isRanked, 
+			cachesHeights,
+			splaysTopDown,
+			splay_policy
+		>
+	>
 	{
 	private:
-		using tree		= SplayTree<element_t, compare_t, allocator_t, hasDuplicates>;
-		using base_tree = impl::BaseBST<element_t, compare_t, allocator_t, hasDuplicates, tree>;
+		using tree		= SplayTree<
+			element_t, 
+			compare_t, 
+			allocator_t, 
+			hasDuplicates, 
+			isRanked, 
+			cachesHeights,
+			splaysTopDown,
+			splay_policy
+		>;
+		using base_tree = impl::BaseBST<
+			element_t, 
+			compare_t, 
+			allocator_t, 
+			hasDuplicates, 
+			isRanked, 
+			cachesHeights, 
+			tree
+		>;
 
 		using alloc_traits			= base_tree::alloc_traits;
 		using node_allocator_type	= base_tree::node_allocator_type;
@@ -59,6 +146,8 @@ namespace collections {
 		using const_base_ptr		= base_tree::const_base_ptr;
 		using node_ptr				= base_tree::node_ptr;
 		using const_node_ptr		= base_tree::const_node_ptr;
+		using split_result			= base_tree::split_result;
+		using alloc_ptr				= node_alloc_traits::pointer;
 
 		friend class base_tree;
 
@@ -84,6 +173,14 @@ namespace collections {
 		using const_reverse_iterator	= base_tree::const_reverse_iterator;
 	
 		static constexpr bool allow_duplicates = hasDuplicates;
+		static constexpr bool is_ranked = isRanked;
+		static constexpr bool caches_heights = cachesHeights;
+		static constexpr bool splays_top_down = splaysTopDown;
+
+		static_assert(
+			!(splaysTopDown && splay_policy::is_semi),
+			"Semi-splaying is only supported when splaying bottom up."
+		);
 
 		// --------------------------------------------------------------------
 		/// <summary>
@@ -130,11 +227,9 @@ namespace collections {
 		/// The SplayTree to be copied.
 		/// </param> ----------------------------------------------------------
 		SplayTree(const SplayTree& copy) : SplayTree(
-			copy.begin<traversal_order::POST_ORDER>(),
-			copy.end<traversal_order::POST_ORDER>(),
 			alloc_traits::select_on_container_copy_construction(copy._allocator)
 		) {
-
+			this->cloneFrom(copy);
 		}
 
 		// --------------------------------------------------------------------
@@ -285,12 +380,19 @@ namespace collections {
 
 	private:
 		
+		// only periodic policies count lookups between splays.
+		using access_counter = std::conditional_t<
+			(splay_policy::period > 1), std::size_t, std::tuple<>
+		>;
+
 		[[no_unique_address, msvc::no_unique_address]]
 		node_allocator_type _allocator;
+		[[no_unique_address, msvc::no_unique_address]]
+		access_counter _accesses{};
 
 		template <class... Args>
 		[[nodiscard]] node_ptr createNode(Args&&... args) {
-			node_ptr n = node_alloc_traits::allocate(_allocator, 1);
+			alloc_ptr n = node_alloc_traits::allocate(_allocator, 1);
 			node_alloc_traits::construct(
 				_allocator, n, std::in_place_t{}, std::forward<Args>(args)...
 			);
@@ -298,8 +400,8 @@ namespace collections {
 		}
 
 		void destroyNode(base_ptr n) {
-			node_alloc_traits::destroy(_allocator, static_cast<node_ptr>(n));
-			node_alloc_traits::deallocate(_allocator, static_cast<node_ptr>(n), 1);
+			node_alloc_traits::destroy(_allocator, static_cast<alloc_ptr>(n));
+			node_alloc_traits::deallocate(_allocator, static_cast<alloc_ptr>(n), 1);
 		}
 
 		[[nodiscard]] size_type heightOfNode(const_base_ptr n) const noexcept {
@@ -308,19 +410,50 @@ namespace collections {
 
 		// ---------------------------------------------------------------------
 		// Splay tree will rotate accessed nodes to the root on all operations -
-		// insert, delete, and search (unless const to preserve contract).
+		// insert, delete, and search (const searches only if the policy splays
+		// reads). When splaying top down, find, lowerBound and insert splay on
+		// the way down to the key instead of descending first and rotating 
+		// back up. The splay policy decides how lookups restructure the tree;
+		// inserts and removals always splay fully.
 
 		iterator onInsert(base_ptr hint, const_reference element) {
-			base_ptr result = this->insertAt(hint, element);
-			splay(result);
-			return iterator(this, result); 
+			if constexpr (splaysTopDown) {
+				base_ptr bound = splayTopDown(base_tree::keyOf(element));
+
+				if constexpr (!hasDuplicates) {
+					if (bound && !this->compare(base_tree::keyOf(element), bound->value()))
+						return iterator(this, bound);
+				}
+
+				return iterator(this, insertAtRoot(createNode(element)));
+			}
+			else {
+				base_ptr result = this->insertAt(hint, element);
+				splay(result);
+				return iterator(this, result); 
+			}
 		}
 
 		template <class... Args>
 		iterator onEmplace(base_ptr hint, Args&&... args) {
-			base_ptr result = this->emplaceAt(hint, std::forward<Args>(args)...);
-			splay(result);
-			return iterator(this, result); 
+			if constexpr (splaysTopDown) {
+				base_ptr n = createNode(std::forward<Args>(args)...);
+				base_ptr bound = splayTopDown(base_tree::keyOfNode(n));
+
+				if constexpr (!hasDuplicates) {
+					if (bound && !this->compare(base_tree::keyOfNode(n), bound->value())) {
+						destroyNode(n);
+						return iterator(this, bound);
+					}
+				}
+
+				return iterator(this, insertAtRoot(n));
+			}
+			else {
+				base_ptr result = this->emplaceAt(hint, std::forward<Args>(args)...);
+				splay(result);
+				return iterator(this, result); 
+			}
 		}
 
 		void onRemove(base_ptr n) {
@@ -329,14 +462,61 @@ namespace collections {
 			if (n == this->_max)
 				this->_max = this->inOrderPredecessorOf(n);
 
-			std::pair<base_ptr, base_ptr> subtrees = split(n);
+			split_result subtrees = split(n);
 			join(subtrees);
 			destroyNode(n);
 			this->_size--;
 		}
 
+		void onBuildNode(base_ptr n, const_base_ptr source) {}
+
 		void onAccessNode(base_ptr n) {
-			splay(n);
+			if (!isSplayTurn())
+				return;
+
+			if constexpr (splay_policy::is_semi)
+				semiSplay(n);
+			else
+				splay(n);
+		}
+
+		// the only place a const tree is restructured. Lookups on a tree 
+		// defined const must therefore not use a policy that splays reads.
+		void onReadNode(const_base_ptr n) const {
+			if constexpr (splay_policy::splays_reads)
+				const_cast<tree*>(this)->onAccessNode(const_cast<base_ptr>(n));
+		}
+
+		base_ptr accessFind(key_type key) {
+			if constexpr (splaysTopDown)
+				return accessTopDown(key);
+			else
+				return base_tree::accessFind(key);
+		}
+
+		base_ptr accessLowerBound(key_type key) {
+			if constexpr (splaysTopDown)
+				return accessTopDown(key);
+			else
+				return base_tree::accessLowerBound(key);
+		}
+
+		base_ptr accessTopDown(key_type key) {
+			if (isSplayTurn())
+				return splayTopDown(key);
+			else
+				return this->lowerBound_(key).limit();
+		}
+
+		[[nodiscard]] bool isSplayTurn() noexcept {
+			if constexpr (splay_policy::period > 1) {
+				if (++_accesses < splay_policy::period)
+					return false;
+
+				_accesses = 0;
+			}
+
+			return true;
 		}
 
 		void splay(base_ptr n) {
@@ -346,9 +526,31 @@ namespace collections {
 			}
 		}
 
+		// semi-splaying lifts the parent instead of n on zig-zig steps and 
+		// carries on from there, so n rises only part of the way.
+		void semiSplay(base_ptr n) {
+			while (n && n->to(parent)) {
+				base_ptr parent_ptr = n->to(parent);
+				base_ptr grandparent = parent_ptr->to(parent);
+
+				if (!grandparent)
+					rotateUp(n);
+				else if (this->isLeftChild(n) == this->isLeftChild(parent_ptr)) {
+					if (this->isLeftChild(parent_ptr))
+						this->rightRotation(grandparent);
+					else
+						this->leftRotation(grandparent);
+
+					n = parent_ptr;
+				}
+				else
+					rotateUp(n);
+			}
+		}
+
 		void rotateUp(base_ptr n) {
 			base_ptr parent_ptr = n->to(parent);
-			base_ptr grandparent = parent_ptr ? parent_ptr->to(parent) : nullptr;
+			base_ptr grandparent = parent_ptr ? parent_ptr->to(parent) : base_ptr{};
 
 			if (this->isLeftChild(n)) {
 				if (!grandparent)
@@ -376,7 +578,156 @@ namespace collections {
 			}
 		}
 
-		const std::pair<base_ptr, base_ptr> split(base_ptr n) {
+		// ---------------------------------------------------------------------
+		// Top down splaying (Sleator and Tarjan) walks the search path once. 
+		// Nodes passed on the way down are hung off a lower tree of smaller 
+		// keys and an upper tree of larger keys, which become the subtrees of
+		// the last node reached once it is lifted to the root. Duplicates 
+		// descend past equal keys so the lower bound is always found.
+
+		[[nodiscard]] static bool isLeftOf(key_type key, const_base_ptr n) {
+			if constexpr (hasDuplicates)
+				return !base_tree::compare(n->value(), key);
+			else
+				return base_tree::compare(key, n->value());
+		}
+
+		// returns the lower bound of key, which is the new root unless every 
+		// element in the root's left subtree and the root are less than key.
+		base_ptr splayTopDown(key_type key) {
+			base_ptr n = this->_root;
+
+			if (!n)
+				return nullptr;
+
+			base_ptr lower = nullptr;
+			base_ptr lowerMax = nullptr;
+			base_ptr upper = nullptr;
+			base_ptr upperMin = nullptr;
+
+			while (true) {
+				if (isLeftOf(key, n)) {
+					base_ptr child = n->to(left);
+
+					if (!child)
+						break;
+
+					if (isLeftOf(key, child)) {
+						link(n, left, child->to(right));
+						this->updateNode(n);
+						link(child, right, n);
+						n = child;
+
+						if (!n->to(left))
+							break;
+					}
+
+					base_ptr next = n->to(left);
+
+					if (upperMin)
+						link(upperMin, left, n);
+					else
+						upper = n;
+
+					upperMin = n;
+					n = next;
+				}
+				else if (this->compare(n->value(), key)) {
+					base_ptr child = n->to(right);
+
+					if (!child)
+						break;
+
+					if (this->compare(child->value(), key)) {
+						link(n, right, child->to(left));
+						this->updateNode(n);
+						link(child, left, n);
+						n = child;
+
+						if (!n->to(right))
+							break;
+					}
+
+					base_ptr next = n->to(right);
+
+					if (lowerMax)
+						link(lowerMax, right, n);
+					else
+						lower = n;
+
+					lowerMax = n;
+					n = next;
+				}
+				else 
+					break;
+			}
+
+			if (lowerMax) {
+				link(lowerMax, right, n->to(left));
+				link(n, left, lower);
+			}
+
+			if (upperMin) {
+				link(upperMin, left, n->to(right));
+				link(n, right, upper);
+			}
+
+			// only the spines the passed nodes were hung on have changed.
+			updateSpine(lowerMax, n);
+			updateSpine(upperMin, n);
+			this->updateNode(n);
+
+			n->to(parent) = nullptr;
+			this->_root = n;
+
+			return this->compare(n->value(), key) ? upperMin : n;
+		}
+
+		// lifts a new node above the root, which must already be splayed to
+		// the node's lower bound.
+		base_ptr insertAtRoot(base_ptr n) {
+			base_ptr root = this->_root;
+
+			if (root) {
+				if (this->compare(root->value(), base_tree::keyOfNode(n))) {
+					link(n, right, root->to(right));
+					root->to(right) = nullptr;
+					link(n, left, root);
+				}
+				else {
+					link(n, left, root->to(left));
+					root->to(left) = nullptr;
+					link(n, right, root);
+				}
+
+				this->updateNode(root);
+			}
+
+			n->to(parent) = nullptr;
+			this->updateNode(n);
+			this->_root = n;
+
+			if (!n->to(left))
+				this->_min = n;
+			if (!n->to(right))
+				this->_max = n;
+
+			this->_size++;
+			return n;
+		}
+
+		void updateSpine(base_ptr n, base_ptr top) {
+			for (; n && n != top; n = n->to(parent))
+				this->updateNode(n);
+		}
+
+		static void link(base_ptr n, auto side, base_ptr child) {
+			n->to(side) = child;
+			if (child)
+				child->to(parent) = n;
+		}
+
+		const split_result split(base_ptr n) {
 			base_ptr predecessor = this->inOrderPredecessorOf(n);
 			splay(n);
 
@@ -389,12 +740,13 @@ namespace collections {
 			return { predecessor, n->to(right) };
 		}
 
-		void join(const std::pair<base_ptr, base_ptr>& subtrees) {
+		void join(const split_result& subtrees) {
 			if (subtrees.first) {
 				splay(subtrees.first);
 				subtrees.first->to(right) = subtrees.second;
 				if (subtrees.second)
 					subtrees.second->to(parent) = subtrees.first;
+				this->updateNode(subtrees.first);
 			}
 			else
 				this->_root = subtrees.second;
@@ -451,6 +803,106 @@ namespace collections {
 		true
 	>;
 
+	template <
+		class element_t,
+		template <class> class compare_t = std::less,
+		template <class> class allocator_t = std::allocator
+	>
+	using RankedSplayTree = SplayTree<
+		element_t, 
+		compare_t<element_t>, 
+		allocator_t<element_t>, 
+		false,
+		true
+	>;
+
+	template <
+		class key_t,
+		class element_t,
+		template <class> class compare_t = std::less,
+		template <class> class allocator_t = std::allocator
+	>
+	using RankedMapSplayTree = SplayTree<
+		key_value_pair<const key_t, element_t>,
+		compare_t<key_t>,
+		std::allocator<key_value_pair<key_t, element_t>>,
+		false,
+		true
+	>;
+
+	template <
+		class element_t,
+		template <class> class compare_t = std::less,
+		template <class> class allocator_t = std::allocator
+	>
+	using RankedMultiSplayTree = SplayTree<
+		element_t, 
+		compare_t<element_t>, 
+		allocator_t<element_t>, 
+		true,
+		true
+	>;
+
+	template <
+		class key_t,
+		class element_t,
+		template <class> class compare_t = std::less,
+		template <class> class allocator_t = std::allocator
+	>
+	using RankedMultiMapSplayTree = SplayTree<
+		key_value_pair<const key_t, element_t>,
+		compare_t<key_t>,
+		std::allocator<key_value_pair<key_t, element_t>>,
+		true,
+		true
+	>;
+
+	template <
+		class element_t,
+		template <class> class compare_t = std::less,
+		template <class> class allocator_t = std::allocator
+	>
+	using TopDownSplayTree = SplayTree<
+		element_t, 
+		compare_t<element_t>, 
+		allocator_t<element_t>, 
+		false,
+		false,
+		false,
+		true
+	>;
+
+	template <
+		class key_t,
+		class element_t,
+		template <class> class compare_t = std::less,
+		template <class> class allocator_t = std::allocator
+	>
+	using TopDownMapSplayTree = SplayTree<
+		key_value_pair<const key_t, element_t>,
+		compare_t<key_t>,
+		std::allocator<key_value_pair<key_t, element_t>>,
+		false,
+		false,
+		false,
+		true
+	>;
+
+	template <
+		class element_t,
+		template <class> class compare_t = std::less,
+		template <class> class allocator_t = std::allocator
+	>
+	using TopDownMultiSplayTree = SplayTree<
+		element_t, 
+		compare_t<element_t>, 
+		allocator_t<element_t>, 
+		true,
+		false,
+		false,
+		true
+	>;
+
 	static_assert(
 		collection<SimpleSplayTree<int>>,
 		"SplayTree does not meet the requirements for a collection."
@@ -480,4 +932,14 @@ namespace collections {
 		multimap<MultiMapSplayTree<int, int >>,
 		"SplayTree does not meet the requirements for a multimap."
 	);
+
+	static_assert(
+		collection<RankedSplayTree<int>>,
+		"SplayTree does not meet the requirements for a collection when ranked."
+	);
+
+	static_assert(
+		collection<TopDownSplayTree<int>>,
+		"SplayTree does not meet the requirements for a collection when splaying top down."
+	);
 }
\ No newline at end of file
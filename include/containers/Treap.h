@@ -0,0 +1,693 @@
+/* ============================================================================
+* Copyright (C) 2023 Ryan Eubank
+*
+* This program is free software: you can redistribute it and/or modify
+* it under the terms of the GNU General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License
+* along with this program.  If not, see <https://www.gnu.org/licenses/>.
+* ========================================================================= */
+
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <ranges>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "base/BaseBST.h"
+#include "../concepts/associative.h"
+#include "../concepts/collection.h"
+#include "../concepts/iterable.h" 
+#include "../concepts/map.h"
+#include "../concepts/positional.h"
+#include "../util/key_value_pair.h"
+#include "../util/random_seed.h"
+
+namespace collections {
+
+	// -------------------------------------------------------------------------
+	/// <summary>
+	/// Treap is a randomized binary search tree that gives every node a 
+	/// random priority and keeps the tree heap ordered by priority, giving 
+	/// expected O(log n) depth. Splitting the tree at a key and joining two 
+	/// trees are expected O(log n), so whole key ranges can be cut out at 
+	/// once.
+	/// </summary>
+	/// 
+	/// <remarks>
+	/// Every Treap keeps subtree sizes so a split can count the elements it 
+	/// moves without walking them, which also makes the rank queries always
+	/// available.
+	/// </remarks> -------------------------------------------------------------
+	template <
+		class element_t,
+		class compare_t,
+		class allocator_t,
+		bool hasDuplicates
+	> 
+	class Treap : public impl::BaseBST<
+		element_t, 
+		compare_t, 
+		allocator_t,
+		hasDuplicates,
+		true,
+		false,
+		Treap<element_t, compare_t, allocator_t, hasDuplicates>>
+	{
+	private:
+
+		using tree		= Treap<element_t, compare_t, allocator_t, hasDuplicates>;
+		using base_tree	= impl::BaseBST<
+			element_t, 
+			compare_t, 
+			allocator_t, 
+			hasDuplicates, 
+			true, 
+			false, 
+			tree
+		>;
+
+		struct treap_node;
+
+		using _node_type			= treap_node;
+		using alloc_traits			= base_tree::alloc_traits;
+		using node_allocator_type	= rebind<allocator_t, _node_type>;
+		using node_alloc_traits		= std::allocator_traits<node_allocator_type>;
+		using base_ptr				= base_tree::base_ptr;
+		using const_base_ptr		= base_tree::const_base_ptr;
+		using node_ptr				= base_tree::node_ptr;
+		using const_node_ptr		= base_tree::const_node_ptr;
+		using split_result			= base_tree::split_result;
+		using treap_ptr				= node_alloc_traits::pointer;
+		using const_treap_ptr			= node_alloc_traits::const_pointer;
+
+		friend class base_tree;
+
+		constexpr static auto left		= base_tree::left;
+		constexpr static auto right		= base_tree::right;
+		constexpr static auto parent	= base_tree::parent;
+
+	public:
+
+		using allocator_type			= base_tree::allocator_type;
+		using value_type				= base_tree::value_type;
+		using mapped_type				= base_tree::mapped_type;
+		using key_type					= base_tree::key_type;
+		using node_type					= _node_type;
+		using size_type					= base_tree::size_type;
+		using difference_type			= base_tree::difference_type;
+		using reference					= base_tree::reference;
+		using const_reference			= base_tree::const_reference;
+		using pointer					= base_tree::pointer;
+		using const_pointer				= base_tree::const_pointer;
+		using iterator					= base_tree::iterator;
+		using const_iterator			= base_tree::const_iterator;
+		using reverse_iterator			= base_tree::reverse_iterator;
+		using const_reverse_iterator	= base_tree::const_reverse_iterator;
+
+		static constexpr bool allow_duplicates = hasDuplicates;
+		static constexpr bool is_ranked = true;
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// --- Default Constructor ---
+		/// 
+		///	<para>
+		/// Constructs an empty Treap.
+		/// </para></summary> -------------------------------------------------
+		constexpr Treap() 
+			noexcept(std::is_nothrow_default_constructible_v<node_allocator_type>) :
+			base_tree(),
+			_allocator(allocator_type{})
+		{
+
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// --- Allocator Constructor ---
+		/// 
+		///	<para>
+		/// Constructs an empty Treap.
+		/// </para></summary>
+		/// <param name="alloc">
+		/// The allocator instance used by the tree.
+		/// </param> ----------------------------------------------------------
+		constexpr explicit Treap(const allocator_type& alloc)
+			noexcept(std::is_nothrow_copy_constructible_v<node_allocator_type>) :
+			base_tree(), 
+			_allocator(alloc)
+		{
+
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// --- Copy Constructor ---
+		/// 
+		/// <para>
+		/// Constructs a deep copy of the specified Treap.
+		/// </para></summary> 
+		/// 
+		/// <param name="copy">
+		/// The Treap to be copied.
+		/// </param> ----------------------------------------------------------
+		Treap(const Treap& copy) : Treap(
+			alloc_traits::select_on_container_copy_construction(copy._allocator)
+		) {
+			this->cloneFrom(copy);
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// --- Move Constructor ---
+		/// 
+		/// <para>
+		/// Constructs a Treap by moving the data from the provided 
+		/// object into the new one.
+		/// </para></summary>
+		/// 
+		/// <param name="other">
+		/// The Treap to be moved into this one.
+		/// </param> ----------------------------------------------------------
+		Treap(Treap&& other)
+			noexcept(std::is_nothrow_move_constructible_v<node_allocator_type>) :
+			base_tree(std::move(other)),
+			_allocator(std::move(other._allocator))
+		{
+
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Constructs a Treap with the a copy of the elements in
+		/// the specified initialization list.
+		/// </summary>
+		/// 
+		/// <param name="init">
+		/// The initialization list to copy elements from.
+		/// </param> ----------------------------------------------------------
+		Treap(
+			std::initializer_list<value_type> init,
+			const allocator_type& alloc = allocator_type{}
+		) : Treap(init.begin(), init.end(), alloc) {
+
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// ~~~ Iterator Constructor ~~~
+		/// 
+		/// <para>
+		/// Constructs a Treap with the a copy of the elements from 
+		/// the given iterator pair.
+		/// </para></summary>
+		/// 
+		/// <typeparam name="iterator">
+		/// The type of the beginning iterator to copy from.
+		/// </typeparam>
+		/// <typeparam name="sentinel">
+		/// The type of the end iterator or sentinel.
+		/// </typeparam>
+		/// 
+		/// <param name="begin">
+		/// The beginning of the iterator pair to copy from.
+		/// </param>
+		/// <param name="end">
+		/// The end of the iterator pair to copy from.
+		/// </param>
+		/// <param name="alloc">
+		/// The allocator instance used by the tree. Default constructs the 
+		/// allocator_type if unspecified.
+		/// </param> ----------------------------------------------------------
+		template <
+			std::input_iterator in_iterator,
+			std::sentinel_for<in_iterator> sentinel
+		>
+		Treap(
+			in_iterator begin,
+			sentinel end,
+			const allocator_type& alloc = allocator_type{}
+		) : Treap(alloc) {
+			this->insert(begin, end);
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// ~~~ Range Constructor ~~~
+		/// 
+		/// <para>
+		/// Constructs a Treap array with a copy of the elements
+		/// from the given range.
+		/// </para></summary>
+		/// 
+		/// <typeparam name="range">
+		/// The type of the range being constructed from.
+		/// </typeparam>
+		/// 
+		/// <param name="r">
+		/// The range to construct the tree with.
+		/// </param>
+		/// <param name="alloc">
+		/// The allocator instance for the tree.
+		/// </param> ----------------------------------------------------------
+		template <std::ranges::input_range range>
+		Treap(
+			from_range_t tag,
+			range&& r,
+			const allocator_type& alloc = allocator_type{}
+		) : Treap(
+			std::ranges::begin(r), 
+			std::ranges::end(r), 
+			alloc
+		) {
+
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// ~~~ Copy Assignment Operator ~~~
+		/// 
+		/// <para>
+		/// Deep copies the data from the specified Treap to this one.
+		/// </para></summary>
+		/// 
+		/// <param name="other">
+		/// The Treap to copy from.
+		/// </param>
+		/// 
+		/// <returns>
+		/// Returns this BinarySearchTree with the copied data.
+		/// </returns> --------------------------------------------------------
+		Treap& operator=(const Treap& other) {
+			return this->copyAssign(other);
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// ~~~ Moves Assignment Operator ~~~
+		/// 
+		/// <para>
+		/// Moves the data from the specified Treap to this one.
+		/// </para></summary>
+		/// 
+		/// <param name="other">
+		/// The Treap to move from.
+		/// </param>
+		/// 
+		/// <returns>
+		/// Returns this Treap with the moved data.
+		/// </returns> --------------------------------------------------------
+		Treap& operator=(Treap&& other) 
+			noexcept(alloc_traits::is_always_equal::value) 
+		{
+			return this->moveAssign(std::move(other));
+		}
+
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Moves every element not ordered before the given key out of this 
+		/// tree and into the returned tree.
+		/// </summary>
+		/// 
+		/// <param name="key">
+		/// The element or key to split the tree at.
+		/// </param>
+		/// 
+		/// <returns>
+		/// Returns a tree holding the elements greater than or equivalent to 
+		/// key.
+		/// </returns>
+		/// 
+		/// <remarks>
+		/// Splitting relinks the existing nodes and counts the moved 
+		/// elements in expected O(log n).
+		/// </remarks> --------------------------------------------------------
+		[[nodiscard]] Treap split(key_type key) {
+			Treap result(_allocator);
+			result._seed = forkSeed();
+			this->splitInto(result, key);
+			return result;
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Joins two trees into a single tree in expected O(log n), reusing 
+		/// the nodes of both trees.
+		/// </summary>
+		/// 
+		/// <param name="lower">
+		/// The tree holding the elements ordered first.
+		/// </param>
+		/// <param name="upper">
+		/// The tree holding the elements ordered last.
+		/// </param>
+		/// 
+		/// <returns>
+		/// Returns the joined tree, which uses the allocator of lower.
+		/// </returns>
+		/// 
+		/// <exception cref="std::invalid_argument">
+		/// Thrown if every element of lower is not ordered before upper.
+		/// </exception> ------------------------------------------------------
+		[[nodiscard]] static Treap join(Treap lower, Treap upper) {
+			return base_tree::joinTrees(std::move(lower), std::move(upper));
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Removes every element ordered in the key range [first, last) by 
+		/// splitting the range out of the tree and joining what remains.
+		/// </summary>
+		/// 
+		/// <param name="first">
+		/// The first key in the range to remove.
+		/// </param>
+		/// <param name="last">
+		/// The key ending the range to remove, which is itself kept.
+		/// </param>
+		/// 
+		/// <returns>
+		/// Returns the number of elements removed.
+		/// </returns>
+		/// 
+		/// <remarks>
+		/// Cutting the range out takes expected O(log n) and destroying it 
+		/// O(k) for k removed elements, rather than rebalancing after each 
+		/// of the k removals.
+		/// </remarks> --------------------------------------------------------
+		size_type removeRange(key_type first, key_type last) {
+			if (!compare_t{}(first, last))
+				return 0;
+
+			size_type total = this->size();
+
+			// splitNodes only relinks once every comparison below it is done,
+			// so a throwing first split leaves the tree as it was, and the
+			// halves of the first are joined back if the second throws.
+			auto [lower, rest] = splitNodes(this->_root, first);
+			split_result cut;
+
+			try {
+				cut = splitNodes(rest, last);
+			}
+			catch (...) {
+				this->resetRoot(joinNodes(lower, rest), total);
+				throw;
+			}
+
+			auto [middle, upper] = cut;
+			size_type removed = this->destroySubtree(middle);
+			this->resetRoot(joinNodes(lower, upper), total - removed);
+			return removed;
+		}
+
+	private:
+
+		struct treap_node : base_tree::node_type {
+			using base_tree::node_type::node_type;
+
+			std::uint32_t _priority = 0;
+		};
+
+		[[no_unique_address, msvc::no_unique_address]]
+		node_allocator_type _allocator;
+		std::uint64_t _seed = fresh_seed();
+
+		template <class... Args>
+		[[nodiscard]] node_ptr createNode(Args&&... args) {
+			treap_ptr n = node_alloc_traits::allocate(_allocator, 1);
+			node_alloc_traits::construct(
+				_allocator, n, std::in_place_t{}, std::forward<Args>(args)...);
+			n->_priority = randomPriority();
+			return n;
+		}
+
+		void destroyNode(base_ptr n) {
+			treap_ptr node = static_cast<treap_ptr>(n);
+			node_alloc_traits::destroy(_allocator, std::addressof(node->value()));
+			node_alloc_traits::destroy(_allocator, node);
+			node_alloc_traits::deallocate(_allocator, node, 1);
+		}
+
+		[[nodiscard]] size_type heightOfNode(const_base_ptr n) const noexcept {
+			return this->heightAt(n);
+		}
+
+		[[nodiscard]] std::uint32_t randomPriority() noexcept {
+			_seed ^= _seed << 13;
+			_seed ^= _seed >> 7;
+			_seed ^= _seed << 17;
+			return static_cast<std::uint32_t>(_seed >> 32);
+		}
+
+		// derives the seed of a tree split off from this one from the 
+		// current state, carrying the generator forward.
+		[[nodiscard]] std::uint64_t forkSeed() noexcept {
+			std::uint32_t step = randomPriority();
+			return mix_seed(_seed + step);
+		}
+
+		[[nodiscard]] static std::uint32_t priorityOf(const_base_ptr n) noexcept {
+			return static_cast<const_treap_ptr>(n)->_priority;
+		}
+
+		// ---------------------------------------------------------------------
+		// Treap keeps each node's priority above its children's, so the tree 
+		// has the shape a random insertion order would give. Inserted nodes 
+		// rotate up past lower priorities and removed nodes rotate down until 
+		// they have at most one child.
+
+		iterator onInsert(base_ptr hint, const_reference element) {
+			base_ptr result = this->insertAt(hint, element);
+			rotateUp(result);
+			return iterator(this, result); 
+		}
+
+		template <class... Args>
+		iterator onEmplace(base_ptr hint, Args&&... args) {
+			base_ptr result = this->emplaceAt(hint, std::forward<Args>(args)...);
+			rotateUp(result);
+			return iterator(this, result); 
+		}
+
+		void onRemove(base_ptr n) {
+			while (this->degree(n) == 2) {
+				if (priorityOf(n->to(left)) > priorityOf(n->to(right)))
+					this->rightRotation(n);
+				else
+					this->leftRotation(n);
+			}
+
+			this->removeAt(n);
+		}
+
+		// sorted ranges are built by buildFromSorted below, so only clones 
+		// reach here and they keep the priorities of the copied nodes.
+		void onBuildNode(base_ptr n, const_base_ptr source) {
+			if (source)
+				static_cast<treap_ptr>(n)->_priority = priorityOf(source);
+		}
+
+		void onAccessNode(base_ptr n) {}
+
+		void rotateUp(base_ptr n) {
+			while (n->to(parent) && priorityOf(n) > priorityOf(n->to(parent))) {
+				// copied out first: the rotation rewrites n's parent link
+				// while it still works on the pivot
+				base_ptr pivot = n->to(parent);
+
+				if (this->isLeftChild(n))
+					this->rightRotation(pivot);
+				else
+					this->leftRotation(pivot);
+			}
+		}
+
+		// ---------------------------------------------------------------------
+		// Replaces the balanced build of BaseBST for sorted ranges with a 
+		// Cartesian tree build, so the result obeys the random priorities. 
+		// Each new node climbs the right spine of the tree built so far past 
+		// any lower priorities, which it adopts as its left subtree. Every 
+		// node leaves the spine at most once, so the build is O(n).
+
+		template <class forward_iterator>
+		void buildFromSorted(forward_iterator begin, size_type count) {
+			base_ptr root = nullptr;
+			base_ptr last = nullptr;
+
+			try {
+				for (size_type i = 0; i < count; ++i) {
+					base_ptr n = createNode(*begin);
+					base_ptr below = nullptr;
+					base_ptr above = last;
+
+					++begin;
+
+					while (above && priorityOf(above) < priorityOf(n)) {
+						base_tree::updateNode(above);
+						below = above;
+						above = above->to(parent);
+					}
+
+					n->to(left) = below;
+					if (below)
+						below->to(parent) = n;
+
+					n->to(parent) = above;
+					if (above)
+						above->to(right) = n;
+					else
+						root = n;
+
+					last = n;
+				}
+			}
+			catch (...) {
+				this->destroySubtree(root);
+				throw;
+			}
+
+			for (base_ptr n = last; n; n = n->to(parent))
+				base_tree::updateNode(n);
+
+			this->resetRoot(root, count);
+		}
+
+		// ---------------------------------------------------------------------
+		// Split and join work on detached subtrees. Only the parent links 
+		// below each subtree root are kept valid; roots are relinked by 
+		// whichever call consumes them.
+
+		static split_result splitNodes(base_ptr n, const key_type& key) {
+			if (!n)
+				return { nullptr, nullptr };
+
+			if (compare_t{}(base_tree::keyOfNode(n), key)) {
+				auto [lower, upper] = splitNodes(n->to(right), key);
+				attach(n, right, lower);
+				return { n, upper };
+			}
+
+			auto [lower, upper] = splitNodes(n->to(left), key);
+			attach(n, left, upper);
+			return { lower, n };
+		}
+
+		static base_ptr joinNodes(base_ptr l, base_ptr r) {
+			if (!l)
+				return r;
+			if (!r)
+				return l;
+
+			if (priorityOf(l) > priorityOf(r)) {
+				attach(l, right, joinNodes(l->to(right), r));
+				return l;
+			}
+
+			attach(r, left, joinNodes(l, r->to(left)));
+			return r;
+		}
+
+		static void attach(base_ptr n, auto side, base_ptr child) {
+			n->to(side) = child;
+			if (child)
+				child->to(parent) = n;
+			base_tree::updateNode(n);
+		}
+	};
+
+	template <
+		class element_t,
+		template <class> class compare_t = std::less,
+		template <class> class allocator_t = std::allocator
+	>
+	using SimpleTreap = Treap<
+		element_t, 
+		compare_t<element_t>, 
+		allocator_t<element_t>, 
+		false
+	>;
+
+	template <
+		class key_t,
+		class element_t,
+		template <class> class compare_t = std::less,
+		template <class> class allocator_t = std::allocator
+	>
+	using MapTreap = Treap<
+		key_value_pair<const key_t, element_t>,
+		compare_t<key_t>,
+		std::allocator<key_value_pair<key_t, element_t>>,
+		false
+	>;
+
+	template <
+		class element_t,
+		template <class> class compare_t = std::less,
+		template <class> class allocator_t = std::allocator
+	>
+	using MultiTreap = Treap<
+		element_t, 
+		compare_t<element_t>, 
+		allocator_t<element_t>, 
+		true
+	>;
+
+	template <
+		class key_t,
+		class element_t,
+		template <class> class compare_t = std::less,
+		template <class> class allocator_t = std::allocator
+	>
+	using MultiMapTreap = Treap<
+		key_value_pair<const key_t, element_t>,
+		compare_t<key_t>,
+		std::allocator<key_value_pair<key_t, element_t>>,
+		true
+	>;
+
+	static_assert(
+		collection<SimpleTreap<int>>,
+		"Treap does not meet the requirements for a collection."
+	);
+
+	static_assert(
+		associative<SimpleTreap<int>>,
+		"Treap does not meet the requirements for sequential access."
+	);
+
+	static_assert(
+		positional<SimpleTreap<int>>,
+		"Treap does not meet the requirements for positional access."
+	);
+
+	static_assert(
+		bidirectionally_iterable<SimpleTreap<int>>,
+		"Treap does not meet the requirements for bidirectional iteration."
+	);
+
+	static_assert(
+		map<MapTreap<int, int>>,
+		"Treap does not meet the requirements for a map."
+	);
+
+	static_assert(
+		multimap<MultiMapTreap<int, int >>,
+		"Treap does not meet the requirements for a multimap."
+	);
+}
\ No newline at end of file
@@ -17,22 +17,25 @@
 
 #pragma once
 
+#include <algorithm>
 #include <concepts>
 #include <istream>
 #include <iterator>
+#include <limits>
 #include <memory>
 #include <ostream>
+#include <stdexcept>
 #include <type_traits>
 #include <utility>
 
 #include "../Node.h"
 #include "../../adapters/TreeTraversalAdapters.h"
-#include "../../adapters/Queue.h"
 #include "../../algorithms/compare.h"
 #include "../../algorithms/stream.h"
 #include "../../concepts/map.h"
 #include "../../util/CRTP.h"
 #include "../../util/key_value_pair.h"
+#include "../../util/prefetch.h"
 
 
 namespace collections::impl {
@@ -42,7 +45,10 @@ namespace collections::impl {
 		class compare_t, 
 		class allocator_t,
 		bool hasDuplicates,
-		class derived_t
+		bool isRanked,
+		bool cachesHeights,
+		class derived_t,
+		bool tagsNodes = false
 	> requires std::predicate<
 		compare_t, 
 		typename key_traits<element_t>::key_type, 
@@ -51,7 +57,16 @@ namespace collections::impl {
 	class BaseBST : 
 		public CRTP<
 			derived_t, 
-			BaseBST<element_t, compare_t, allocator_t, hasDuplicates, derived_t>
+			BaseBST<
+				element_t, 
+				compare_t, 
+				allocator_t, 
+				hasDuplicates, 
+				isRanked, 
+				cachesHeights,
+				derived_t,
+				tagsNodes
+			>
 		> 
 	{
 	protected:
@@ -59,9 +74,43 @@ namespace collections::impl {
 		template <bool isConst>
 		class BinaryTreeIterator;
 
+		template <bool isConst>
+		class LevelOrderIterator;
+
 		using alloc_t		= rebind<allocator_t, element_t>;
 		using alloc_traits	= std::allocator_traits<alloc_t>;
 
+		// trees that tag their nodes keep the tag in the parent edge.
+		using tree_node = Node<element_t, allocator_t, 3, tagsNodes ? 2 : -1>;
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Tree node augmented with the number of nodes in its subtree for
+		/// order statistic queries.
+		/// </summary> --------------------------------------------------------
+		struct ranked_node : tree_node {
+			using tree_node::tree_node;
+
+			alloc_traits::size_type _count = 1;
+		};
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Tree node augmented with the cached height of its subtree.
+		/// </summary> --------------------------------------------------------
+		template <class base_node>
+		struct height_node : base_node {
+			using base_node::base_node;
+
+			alloc_traits::size_type _height = 0;
+		};
+
+		using plain_node = std::conditional_t<
+			isRanked, 
+			ranked_node, 
+			tree_node
+		>;
+
 	public:
 
 		using value_type		= element_t;
@@ -69,7 +118,11 @@ namespace collections::impl {
 		using mapped_type		= key_traits<element_t>::mapped_type;
 
 		using allocator_type	= allocator_t;
-		using node_type			= Node<element_t, allocator_t, 3>;
+		using node_type			= std::conditional_t<
+			cachesHeights, 
+			height_node<plain_node>, 
+			plain_node
+		>;
 		using size_type			= alloc_traits::size_type;
 		using difference_type	= alloc_traits::difference_type;
 		using pointer			= alloc_traits::pointer;
@@ -82,8 +135,13 @@ namespace collections::impl {
 		using reverse_iterator			= std::reverse_iterator<iterator>;
 		using const_reverse_iterator	= std::reverse_iterator<const_iterator>;
 
+		using level_order_iterator			= LevelOrderIterator<false>;
+		using const_level_order_iterator	= LevelOrderIterator<true>;
+
 		static constexpr bool allow_duplicates	= hasDuplicates;
 		static constexpr bool is_map			= pair_type<element_t>;
+		static constexpr bool is_ranked			= isRanked;
+		static constexpr bool caches_heights	= cachesHeights;
 
 	protected:
 
@@ -94,11 +152,21 @@ namespace collections::impl {
 		using const_base_ptr		= node_type::const_base_ptr;
 		using node_ptr				= node_type::node_ptr;
 		using const_node_ptr		= node_type::const_node_ptr;
+		using split_result			= std::pair<base_ptr, base_ptr>;
+
+		template <traversal_order order, bool isConst>
+		using traversal_iterator = std::conditional_t<
+			order == traversal_order::LEVEL_ORDER,
+			LevelOrderIterator<isConst>,
+			BinaryTreeIterator<isConst>
+		>;
 
 		constexpr static auto left = 0u;
 		constexpr static auto right = 1u;
 		constexpr static auto parent = 2u;
 
+		constexpr static bool is_augmented = isRanked || cachesHeights;
+
 	public:
 
 		// --------------------------------------------------------------------
@@ -260,6 +328,19 @@ namespace collections::impl {
 			return this->self().heightOfNode(position._node);
 		}
 
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Returns the height of the tree, which is constant time for trees
+		/// that track node heights.
+		/// </summary>
+		/// 
+		/// <returns>
+		/// Returns the height of the root node, or zero if the tree is empty.
+		/// </returns> --------------------------------------------------------
+		[[nodiscard]] size_type height() const noexcept {
+			return _root ? this->self().heightOfNode(_root) : 0;
+		}
+
 		// --------------------------------------------------------------------
 		/// <summary>
 		/// Returns an iterator pointing to the first element in the tree's
@@ -275,8 +356,11 @@ namespace collections::impl {
 		/// the traversal order.
 		/// </returns> --------------------------------------------------------
 		template <traversal_order order = traversal_order::IN_ORDER>
-		[[nodiscard]] iterator begin() noexcept {
-			return iterator(this, firstNodeIn(order), order);
+		[[nodiscard]] traversal_iterator<order, false> begin() noexcept {
+			if constexpr (order == traversal_order::LEVEL_ORDER)
+				return level_order_iterator(this, _root);
+			else
+				return iterator(this, firstNodeIn(order), order);
 		}
 
 		// --------------------------------------------------------------------
@@ -294,8 +378,11 @@ namespace collections::impl {
 		/// the traversal order.
 		/// </returns> --------------------------------------------------------
 		template <traversal_order order = traversal_order::IN_ORDER>
-		[[nodiscard]] iterator end() noexcept {
-			return iterator(this, nullptr, order);
+		[[nodiscard]] traversal_iterator<order, false> end() noexcept {
+			if constexpr (order == traversal_order::LEVEL_ORDER)
+				return level_order_iterator(this, nullptr);
+			else
+				return iterator(this, nullptr, order);
 		}
 
 		// --------------------------------------------------------------------
@@ -313,8 +400,11 @@ namespace collections::impl {
 		/// according to the traversal order.
 		/// </returns> --------------------------------------------------------
 		template <traversal_order order = traversal_order::IN_ORDER>
-		[[nodiscard]] const_iterator begin() const noexcept {
-			return const_iterator(this, firstNodeIn(order), order);
+		[[nodiscard]] traversal_iterator<order, true> begin() const noexcept {
+			if constexpr (order == traversal_order::LEVEL_ORDER)
+				return const_level_order_iterator(this, _root);
+			else
+				return const_iterator(this, firstNodeIn(order), order);
 		}
 
 		// --------------------------------------------------------------------
@@ -332,8 +422,11 @@ namespace collections::impl {
 		/// according to the traversal order.
 		/// </returns> --------------------------------------------------------
 		template <traversal_order order = traversal_order::IN_ORDER>
-		[[nodiscard]] const_iterator end() const noexcept {
-			return const_iterator(this, nullptr, order);
+		[[nodiscard]] traversal_iterator<order, true> end() const noexcept {
+			if constexpr (order == traversal_order::LEVEL_ORDER)
+				return const_level_order_iterator(this, nullptr);
+			else
+				return const_iterator(this, nullptr, order);
 		}
 
 		// --------------------------------------------------------------------
@@ -351,8 +444,11 @@ namespace collections::impl {
 		/// according to the traversal order.
 		/// </returns> --------------------------------------------------------
 		template <traversal_order order = traversal_order::IN_ORDER>
-		[[nodiscard]] const_iterator cbegin() const noexcept {
-			return const_iterator(this, firstNodeIn(order), order);
+		[[nodiscard]] traversal_iterator<order, true> cbegin() const noexcept {
+			if constexpr (order == traversal_order::LEVEL_ORDER)
+				return const_level_order_iterator(this, _root);
+			else
+				return const_iterator(this, firstNodeIn(order), order);
 		}
 
 		// --------------------------------------------------------------------
@@ -370,8 +466,11 @@ namespace collections::impl {
 		/// according to the traversal order.
 		/// </returns> --------------------------------------------------------
 		template <traversal_order order = traversal_order::IN_ORDER>
-		[[nodiscard]] const_iterator cend() const noexcept {
-			return const_iterator(this, nullptr, order);
+		[[nodiscard]] traversal_iterator<order, true> cend() const noexcept {
+			if constexpr (order == traversal_order::LEVEL_ORDER)
+				return const_level_order_iterator(this, nullptr);
+			else
+				return const_iterator(this, nullptr, order);
 		}
 
 		// --------------------------------------------------------------------
@@ -389,7 +488,8 @@ namespace collections::impl {
 		/// the reverse traversal order.
 		/// </returns> --------------------------------------------------------
 		template <traversal_order order = traversal_order::IN_ORDER>
-		[[nodiscard]] reverse_iterator rbegin() noexcept {
+		[[nodiscard]] std::reverse_iterator<traversal_iterator<order, false>> 
+		rbegin() noexcept {
 			return std::make_reverse_iterator(end<order>());
 		}
 
@@ -408,7 +508,8 @@ namespace collections::impl {
 		/// reverse traversal order.
 		/// </returns> --------------------------------------------------------
 		template <traversal_order order = traversal_order::IN_ORDER>
-		[[nodiscard]] reverse_iterator rend() noexcept {
+		[[nodiscard]] std::reverse_iterator<traversal_iterator<order, false>> 
+		rend() noexcept {
 			return std::make_reverse_iterator(begin<order>());
 		}
 
@@ -427,7 +528,8 @@ namespace collections::impl {
 		/// the reverse traversal order.
 		/// </returns> --------------------------------------------------------
 		template <traversal_order order = traversal_order::IN_ORDER>
-		[[nodiscard]] const_reverse_iterator rbegin() const noexcept {
+		[[nodiscard]] std::reverse_iterator<traversal_iterator<order, true>> 
+		rbegin() const noexcept {
 			return std::make_reverse_iterator(end<order>());
 		}
 
@@ -446,7 +548,8 @@ namespace collections::impl {
 		/// the reverse traversal order.
 		/// </returns> --------------------------------------------------------
 		template <traversal_order order = traversal_order::IN_ORDER>
-		[[nodiscard]] const_reverse_iterator rend() const noexcept {
+		[[nodiscard]] std::reverse_iterator<traversal_iterator<order, true>> 
+		rend() const noexcept {
 			return std::make_reverse_iterator(begin<order>());
 		}
 
@@ -465,8 +568,9 @@ namespace collections::impl {
 		/// the reverse traversal order.
 		/// </returns> --------------------------------------------------------
 		template <traversal_order order = traversal_order::IN_ORDER>
-		[[nodiscard]] const_reverse_iterator crbegin() const noexcept {
-			return std::make_reverse_iterator(end());
+		[[nodiscard]] std::reverse_iterator<traversal_iterator<order, true>> 
+		crbegin() const noexcept {
+			return std::make_reverse_iterator(end<order>());
 		}
 
 		// --------------------------------------------------------------------
@@ -484,7 +588,8 @@ namespace collections::impl {
 		/// the reverse traversal order.
 		/// </returns> --------------------------------------------------------
 		template <traversal_order order = traversal_order::IN_ORDER>
-		[[nodiscard]] const_reverse_iterator crend() const noexcept {
+		[[nodiscard]] std::reverse_iterator<traversal_iterator<order, true>> 
+		crend() const noexcept {
 			return std::make_reverse_iterator(begin<order>());
 		}
 
@@ -502,12 +607,9 @@ namespace collections::impl {
 		/// tree, otherwise end() is returned.
 		/// </returns> --------------------------------------------------------
 		[[nodiscard]] iterator find(key_type key) {
-			TreeBoundResult lookup = lowerBound_(key);
+			base_ptr bound = this->self().accessFind(key);
 
-			this->self().onAccessNode(lookup._location.parent());
-			base_ptr bound = lookup.limit();
-
-			if (bound) 
+			if (bound && !compare(key, bound->value())) 
 				return iterator(this, bound);
 			else 
 				return end();
@@ -547,7 +649,9 @@ namespace collections::impl {
 			TreeBoundResult lookup = lowerBound_(key);
 			const_base_ptr bound = lookup._limit;
 
-			if (bound) 
+			this->self().onReadNode(lookup._location._parent);
+
+			if (bound && !compare(key, bound->value())) 
 				return const_iterator(this, bound);
 			else 
 				return end();
@@ -585,15 +689,7 @@ namespace collections::impl {
 		/// end() is returned.
 		/// </returns> ---------------------------------------------------------
 		[[nodiscard]] iterator lowerBound(key_type key) {
-			TreeBoundResult lookup = lowerBound_(key);
-			base_ptr result = lookup.limit();
-
-			if (result)
-				this->self().onAccessNode(result);
-			else
-				this->self().onAccessNode(_max);
-
-			return iterator(this, result);
+			return iterator(this, this->self().accessLowerBound(key));
 		}
 
 		// ---------------------------------------------------------------------
@@ -611,7 +707,9 @@ namespace collections::impl {
 		/// otherwise end() is returned.
 		/// </returns> ---------------------------------------------------------
 		[[nodiscard]] const_iterator lowerBound(key_type key) const {
-			return const_iterator(this, lowerBound_(key)._limit);
+			const_base_ptr result = lowerBound_(key)._limit;
+			this->self().onReadNode(result ? result : _max);
+			return const_iterator(this, result);
 		}
 
 		// ---------------------------------------------------------------------
@@ -655,7 +753,9 @@ namespace collections::impl {
 		/// otherwise end() is returned.
 		/// </returns> ---------------------------------------------------------
 		[[nodiscard]] const_iterator upperBound(key_type key) const {
-			return const_iterator(this, upperBound_(key)._limit);
+			const_base_ptr result = upperBound_(key)._limit;
+			this->self().onReadNode(result ? result : _max);
+			return const_iterator(this, result);
 		}
 
 		// ---------------------------------------------------------------------
@@ -673,7 +773,100 @@ namespace collections::impl {
 		[[nodiscard]] size_type count(key_type key) 
 			const requires allow_duplicates 
 		{
-			return std::distance(lowerBound(key), upperBound(key)); //TODO - use custom implementation of distance.
+			if constexpr (isRanked)
+				return countInRange(key, key);
+			else
+				return std::distance(lowerBound(key), upperBound(key)); //TODO - use custom implementation of distance.
+		}
+
+		// ---------------------------------------------------------------------
+		/// <summary>
+		/// Returns an iterator to the element at the given position in sorted
+		/// order. Requires the tree to be ranked.
+		/// </summary>
+		/// 
+		/// <param name="index">
+		/// The zero-based in-order position of the element.
+		/// </param>
+		/// 
+		/// <returns>
+		/// Returns an iterator to the element with exactly index elements 
+		/// ordered before it.
+		/// </returns>
+		/// 
+		/// <exception cref="std::out_of_range">
+		/// Throws if the index is not less than the size of the tree.
+		/// </exception> -------------------------------------------------------
+		[[nodiscard]] iterator nth(size_type index) requires isRanked {
+			base_ptr n = const_cast<base_ptr>(nodeAt(index));
+			this->self().onAccessNode(n);
+			return iterator(this, n);
+		}
+
+		// ---------------------------------------------------------------------
+		/// <summary>
+		/// Returns an iterator to the element at the given position in sorted
+		/// order. Requires the tree to be ranked.
+		/// </summary>
+		/// 
+		/// <param name="index">
+		/// The zero-based in-order position of the element.
+		/// </param>
+		/// 
+		/// <returns>
+		/// Returns a const_iterator to the element with exactly index 
+		/// elements ordered before it.
+		/// </returns>
+		/// 
+		/// <exception cref="std::out_of_range">
+		/// Throws if the index is not less than the size of the tree.
+		/// </exception> -------------------------------------------------------
+		[[nodiscard]] const_iterator nth(size_type index) const requires isRanked {
+			return const_iterator(this, nodeAt(index));
+		}
+
+		// ---------------------------------------------------------------------
+		/// <summary>
+		/// Counts the elements ordered before the given key in O(log n). 
+		/// Requires the tree to be ranked.
+		/// </summary>
+		/// 
+		/// <param name="key">
+		/// The element or key to rank.
+		/// </param>
+		/// 
+		/// <returns>
+		/// Returns the number of elements less than the given key, which is 
+		/// the in-order position of lowerBound(key).
+		/// </returns> ---------------------------------------------------------
+		[[nodiscard]] size_type rankOf(key_type key) const requires isRanked {
+			return countBelow<false>(key);
+		}
+
+		// ---------------------------------------------------------------------
+		/// <summary>
+		/// Counts the elements within the closed range [lo, hi] in O(log n). 
+		/// Requires the tree to be ranked.
+		/// </summary>
+		/// 
+		/// <param name="lo">
+		/// The element or key at the bottom of the range.
+		/// </param>
+		/// <param name="hi">
+		/// The element or key at the top of the range.
+		/// </param>
+		/// 
+		/// <returns>
+		/// Returns the number of elements not less than lo and not greater
+		/// than hi, or zero if hi is less than lo.
+		/// </returns> ---------------------------------------------------------
+		[[nodiscard]] size_type countInRange(key_type lo, key_type hi) 
+			const requires isRanked 
+		{
+			if (compare(hi, lo))
+				return 0;
+
+			return countBelow<true>(hi) - countBelow<false>(lo);
 		}
 
 		// --------------------------------------------------------------------
@@ -726,12 +919,28 @@ namespace collections::impl {
 		/// Returns an iterator to the last element inserted, or the element
 		/// preventing its insertion. Returns the end() iterator for the tree
 		/// if begin == end.
-		/// </returns> --------------------------------------------------------
+		/// </returns>
+		/// 
+		/// <remarks>
+		/// A strictly ascending forward range inserted into an empty tree is 
+		/// built bottom-up into a balanced tree in O(n).
+		/// </remarks> --------------------------------------------------------
 		template <
 			std::input_iterator in_iterator,
 			std::sentinel_for<in_iterator> sentinel
 		>
 		iterator insert(in_iterator begin, sentinel end) {
+			constexpr bool isBuildable = std::forward_iterator<in_iterator> &&
+				std::convertible_to<std::iter_reference_t<in_iterator>, const_reference>;
+
+			if constexpr (isBuildable) {
+				if (isEmpty() && isStrictlyAscending(begin, end)) {
+					auto count = std::ranges::distance(begin, end);
+					this->self().buildFromSorted(begin, static_cast<size_type>(count));
+					return iterator(this, _max);
+				}
+			}
+
 			iterator result = this->end();
 			while (begin != end) 
 				result = this->self().onInsert(_root, *begin++);
@@ -1089,6 +1298,11 @@ namespace collections::impl {
 		struct TreeInsertLocation {
 			TreeLookup _location = {};
 			bool isDuplicate = false;
+			const_base_ptr _match = nullptr;
+
+			base_ptr match() {
+				return const_cast<base_ptr>(_match);
+			}
 		};
 
 		// TODO make compare_t an empty member like allocator
@@ -1130,12 +1344,15 @@ namespace collections::impl {
 			bool isInstanceEqual = 
 				this->self()._allocator == other.self()._allocator;
 
+			if (this == std::addressof(other))
+				return this->self();
+
 			clear();
 
 			if (!isAlwaysEqual && !isInstanceEqual && willPropagate) 
 				this->self()._allocator = other.self()._allocator;
 
-			insert(other.begin(), other.end());
+			cloneFrom(other);
 
 			return this->self();
 		}
@@ -1167,6 +1384,232 @@ namespace collections::impl {
 			return this->self();
 		}
 
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Copies the structure of the given tree into this empty tree in 
+		/// O(n) without comparing or rebalancing.
+		/// </summary> --------------------------------------------------------
+		void cloneFrom(const BaseBST& other) {
+			const_base_ptr source = other._root;
+
+			if (!source)
+				return;
+
+			auto attachCopy = [this](base_ptr to, auto side, const_base_ptr n) {
+				base_ptr copy = this->self().createNode(n->value());
+				copy->to(parent) = to;
+				to->to(side) = copy;
+				return copy;
+			};
+
+			try {
+				_root = this->self().createNode(source->value());
+				base_ptr copy = _root;
+
+				while (true) {
+					if (source->to(left) && !copy->to(left)) {
+						source = source->to(left);
+						copy = attachCopy(copy, left, source);
+					}
+					else if (source->to(right) && !copy->to(right)) {
+						source = source->to(right);
+						copy = attachCopy(copy, right, source);
+					}
+					else {
+						finishNode(copy, source);
+
+						if (source == other._root)
+							break;
+
+						source = source->to(parent);
+						copy = copy->to(parent);
+					}
+				}
+			}
+			catch (...) {
+				destroySubtree(_root);
+				_root = nullptr;
+				throw;
+			}
+
+			_min = const_cast<base_ptr>(leftMostChildOf(_root));
+			_max = const_cast<base_ptr>(rightMostChildOf(_root));
+			_size = other._size;
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Detaches every node from the tree and returns its root, leaving 
+		/// the tree empty without destroying anything.
+		/// </summary> --------------------------------------------------------
+		[[nodiscard]] base_ptr releaseRoot() noexcept {
+			base_ptr root = _root;
+			_root = nullptr;
+			_min = nullptr;
+			_max = nullptr;
+			_size = 0;
+			return root;
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Takes ownership of a detached subtree holding size elements and 
+		/// makes it the content of this empty tree.
+		/// </summary> --------------------------------------------------------
+		void resetRoot(base_ptr root, size_type size) noexcept {
+			_root = root;
+			_size = size;
+
+			if (root) {
+				root->to(parent) = nullptr;
+				_min = const_cast<base_ptr>(leftMostChildOf(root));
+				_max = const_cast<base_ptr>(rightMostChildOf(root));
+			}
+			else {
+				_min = nullptr;
+				_max = nullptr;
+			}
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Moves every element not ordered before key into the given empty 
+		/// tree, cutting the nodes apart with the splitNodes of the derived 
+		/// tree. Ranked trees size both halves from the subtree counts, and 
+		/// unranked trees walk the smaller half once to count it.
+		/// </summary> --------------------------------------------------------
+		void splitInto(derived_t& result, const key_type& key) {
+			size_type kept = 0;
+
+			if constexpr (isRanked)
+				kept = rankOf(key);
+
+			// splitNodes only relinks once every comparison below it is done,
+			// so a throwing comparison leaves the tree as it was.
+			auto [lower, upper] = derived_t::splitNodes(_root, key);
+
+			if constexpr (!isRanked)
+				kept = countLower(lower, upper, _size);
+
+			size_type moved = _size - kept;
+			(void)releaseRoot();
+
+			resetRoot(lower, kept);
+			result.resetRoot(upper, moved);
+		}
+
+		// counts the nodes of lower given the total of both subtrees. Both 
+		// are walked in step, so the walk stops once the smaller is counted.
+		// The roots may still point at their old parents after a split, so 
+		// they are detached first, as resetRoot would do.
+		[[nodiscard]] static size_type countLower(
+			base_ptr lower, 
+			base_ptr upper, 
+			size_type total
+		) noexcept {
+			size_type count = 0;
+
+			if (lower)
+				lower->to(parent) = nullptr;
+			if (upper)
+				upper->to(parent) = nullptr;
+
+			while (lower && upper) {
+				lower = nextInPreorder(lower);
+				upper = nextInPreorder(upper);
+				++count;
+			}
+
+			return lower ? total - count : count;
+		}
+
+		// steps through a detached subtree in preorder, returning null once 
+		// every node has been visited.
+		[[nodiscard]] static base_ptr nextInPreorder(base_ptr n) noexcept {
+			if (n->to(left))
+				return n->to(left);
+			if (n->to(right))
+				return n->to(right);
+
+			for (base_ptr p = n->to(parent); p; n = p, p = p->to(parent)) {
+				if (p->to(left) == n && p->to(right))
+					return p->to(right);
+			}
+
+			return nullptr;
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Joins two trees whose elements are in order, relinking the nodes 
+		/// with the joinNodes of the derived tree. Throws 
+		/// std::invalid_argument if lower is not ordered before upper.
+		/// </summary> --------------------------------------------------------
+		[[nodiscard]] static derived_t joinTrees(
+			derived_t lower, 
+			derived_t upper
+		) {
+			bool isOrdered = lower.isEmpty() || upper.isEmpty() || 
+				isInOrder(keyOfNode(lower._max), keyOfNode(upper._min));
+
+			[[unlikely]] if (!isOrdered)
+				throw std::invalid_argument("Joined trees are not in order.");
+
+			size_type size = lower.size() + upper.size();
+			base_ptr higher = lower.adopt(upper);
+
+			lower.resetRoot(derived_t::joinNodes(lower.releaseRoot(), higher), size);
+			return lower;
+		}
+
+		// takes the nodes of other, copying them into this tree's allocator 
+		// first if the two allocators cannot free each other's nodes.
+		[[nodiscard]] base_ptr adopt(derived_t& other) {
+			if constexpr (!alloc_traits::is_always_equal::value) {
+				if (!(this->self()._allocator == other._allocator)) {
+					derived_t copy(this->self()._allocator);
+					copy.cloneFrom(other);
+					other.clear();
+					return copy.releaseRoot();
+				}
+			}
+
+			return other.releaseRoot();
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Destroys every node below and including n, returning how many 
+		/// were destroyed.
+		/// </summary> --------------------------------------------------------
+		size_type destroySubtree(base_ptr n) noexcept {
+			size_type count = 0;
+			base_ptr top = n ? base_ptr(n->to(parent)) : base_ptr{};
+
+			while (n) {
+				if (n->to(left))
+					n = n->to(left);
+				else if (n->to(right))
+					n = n->to(right);
+				else {
+					base_ptr p = n->to(parent);
+
+					if (p != top) {
+						if (p->to(left) == n)
+							p->to(left) = nullptr;
+						else
+							p->to(right) = nullptr;
+					}
+
+					this->self().destroyNode(n);
+					n = p != top ? p : base_ptr{};
+					++count;
+				}
+			}
+
+			return count;
+		}
+
 		template <class... Args>
 		base_ptr emplaceAt(base_ptr hint, Args&&... args) {
 			TreeInsertLocation result;
@@ -1187,7 +1630,7 @@ namespace collections::impl {
 			}
 			else {
 				this->self().destroyNode(n);
-				return result._location.parent();
+				return result.match();
 			}
 		}
 
@@ -1210,38 +1653,146 @@ namespace collections::impl {
 				return n;
 			}
 			else 
-				return result._location.parent();
+				return result.match();
 		}
 
 		base_ptr removeAt(base_ptr n) {
+			[[maybe_unused]] base_ptr lowest = nullptr;
+
+			if constexpr (is_augmented) {
+				// a node with two children is replaced by its predecessor, so
+				// the subtrees change from the predecessor's old parent up.
+				base_ptr spliced = degree(n) == 2 ? inOrderPredecessorOf(n) : n;
+				lowest = spliced->to(parent) == n ? spliced : spliced->to(parent);
+			}
+
 			base_ptr result = remove(n);
+
+			if constexpr (is_augmented) {
+				for (base_ptr p = lowest; p; p = p->to(parent))
+					updateNode(p);
+			}
+
 			this->self().destroyNode(n);
 			this->_size--;
 			return result;
 		}
 
 		size_type heightAt(const_base_ptr n) const noexcept {
-			Queue<const_base_ptr> queue { n };
-			size_type level = 0;
-			size_type count = 0;
+			if constexpr (cachesHeights)
+				return static_cast<typename node_alloc_traits::const_pointer>(n)->_height;
+			else {
+				// depth first walk over the parent links, no allocation needed.
+				const_base_ptr current = n;
+				size_type depth = 0;
+				size_type height = 0;
+
+				while (true) {
+					height = std::max(height, depth);
+
+					if (current->to(left) || current->to(right)) {
+						current = current->to(left) 
+							? current->to(left) 
+							: current->to(right);
+						depth++;
+						continue;
+					}
+
+					while (true) {
+						if (current == n)
+							return height;
+
+						const_base_ptr p = current->to(parent);
+						depth--;
+
+						if (current == p->to(left) && p->to(right)) {
+							current = p->to(right);
+							depth++;
+							break;
+						}
+
+						current = p;
+					}
+				}
+			}
+		}
 
-			while (!queue.isEmpty()) {
-				level++;
-				count = queue.size();
+		[[nodiscard]] static size_type& countOf(base_ptr n) noexcept 
+			requires isRanked 
+		{
+			return static_cast<typename node_alloc_traits::pointer>(n)->_count;
+		}
+
+		[[nodiscard]] static size_type sizeOf(const_base_ptr n) noexcept 
+			requires isRanked 
+		{
+			return n ? static_cast<typename node_alloc_traits::const_pointer>(n)->_count : 0;
+		}
+
+		[[nodiscard]] static size_type levelsOf(const_base_ptr n) noexcept 
+			requires cachesHeights 
+		{
+			using const_height_ptr = node_alloc_traits::const_pointer;
+			return n ? static_cast<const_height_ptr>(n)->_height + 1 : 0;
+		}
 
-				while (count--) {
-					const_base_ptr next = queue.front();
-					queue.dequeue_front();
+		static void updateNode(base_ptr n) noexcept {
+			if constexpr (isRanked)
+				countOf(n) = sizeOf(n->to(left)) + sizeOf(n->to(right)) + 1;
 
-					if (next->to(left))
-						queue.enqueue_back(next->to(left));
-					if (next->to(right))
-						queue.enqueue_back(next->to(right));
+			if constexpr (cachesHeights) {
+				using height_ptr = node_alloc_traits::pointer;
+				size_type levels = std::max(
+					levelsOf(n->to(left)), 
+					levelsOf(n->to(right))
+				);
+				static_cast<height_ptr>(n)->_height = levels;
+			}
+		}
+
+		[[nodiscard]] const_base_ptr nodeAt(size_type index) const 
+			requires isRanked 
+		{
+			[[unlikely]] if (index >= _size)
+				throw std::out_of_range("Invalid Index: out of range.");
+
+			const_base_ptr n = _root;
+
+			while (true) {
+				size_type leftCount = sizeOf(n->to(left));
+
+				if (index < leftCount)
+					n = n->to(left);
+				else if (index > leftCount) {
+					index -= leftCount + 1;
+					n = n->to(right);
 				}
+				else 
+					return n;
+			}
+		}
+
+		template <bool inclusive>
+		[[nodiscard]] size_type countBelow(key_type key) const 
+			requires isRanked 
+		{
+			const_base_ptr n = _root;
+			size_type count = 0;
 
+			while (n) {
+				bool isBelow = inclusive 
+					? !compare(key, n->value()) 
+					: compare(n->value(), key);
+
+				if (isBelow) {
+					count += sizeOf(n->to(left)) + 1;
+					n = n->to(right);
+				}
+				else
+					n = n->to(left);
 			}
 
-			return level - 1;
+			return count;
 		}
 
 		[[nodiscard]] TreeBoundResult lowerBound_(key_type key) const {
@@ -1267,6 +1818,31 @@ namespace collections::impl {
 			return { bound, { parent, direction } };
 		}
 
+		// non-const searches are called through self() so a derived tree can
+		// restructure while it descends instead of after, such as a splay 
+		// tree splaying top down.
+		base_ptr accessFind(key_type key) {
+			TreeBoundResult lookup = lowerBound_(key);
+			this->self().onAccessNode(lookup._location.parent());
+			return lookup.limit();
+		}
+
+		base_ptr accessLowerBound(key_type key) {
+			TreeBoundResult lookup = lowerBound_(key);
+			base_ptr result = lookup.limit();
+
+			if (result)
+				this->self().onAccessNode(result);
+			else
+				this->self().onAccessNode(_max);
+
+			return result;
+		}
+
+		// const searches report the node they reached through self(), so a 
+		// tree that restructures on reads too can splay it.
+		void onReadNode(const_base_ptr n) const {}
+
 		[[nodiscard]] TreeBoundResult upperBound_(key_type key) const {
 			const_base_ptr current = _root;
 			const_base_ptr parent = nullptr;
@@ -1351,7 +1927,7 @@ namespace collections::impl {
 				return n->to(right);
 			else {
 				auto root = rightMostAncestorOf(n);
-				return root ? root->to(right) : nullptr;
+				return root ? root->to(right) : base_ptr{};
 			}
 		}
 
@@ -1370,39 +1946,6 @@ namespace collections::impl {
 			return findNextLeftSubtree(n->to(parent)->to(right));
 		}
 
-		[[nodiscard]] base_ptr levelOrderSuccessorOf(const_base_ptr n) {
-			const_base_ptr result = std::as_const(*this).levelOrderSuccessorOf(n);
-			return const_cast<base_ptr>(result);
-		}
-
-		[[nodiscard]] const_base_ptr levelOrderSuccessorOf(const_base_ptr n) const {
-			if (!n)
-				return nullptr;
-
-			Queue<const_base_ptr> queue{ _root };
-			const_base_ptr next = nullptr;
-
-			while (!queue.isEmpty()) {
-				size_type count = queue.size();
-
-				while (count--) {
-					next = queue.front();
-
-					if (next->to(left))
-						queue.enqueue_back(next->to(left));
-					if (next->to(right))
-						queue.enqueue_back(next->to(right));
-
-					queue.dequeue_front();
-
-					if (next == n) 
-						return queue.isEmpty() ? nullptr : queue.front();
-				}
-			}
-
-			return n;
-		}
-
 		[[nodiscard]] base_ptr inOrderPredecessorOf(const_base_ptr n) {
 			const_base_ptr result = std::as_const(*this).inOrderPredecessorOf(n);
 			return const_cast<base_ptr>(result);
@@ -1454,54 +1997,17 @@ namespace collections::impl {
 				return n->to(left);
 			else {
 				const_base_ptr root = leftMostAncestorOf(n);
-				return root ? root->to(left) : nullptr;
+				return root ? root->to(left) : base_ptr{};
 			}
 		}
 
-		[[nodiscard]] base_ptr levelOrderPredecessorOf(const_base_ptr n) {
-			const_base_ptr result = std::as_const(*this).levelOrderPredecessorOf(n);
-			return const_cast<base_ptr>(result);
+		[[nodiscard]] static bool isLeftChild(const_base_ptr n) {
+			return n->to(parent) && n == n->to(parent)->to(left);
 		}
 
-		[[nodiscard]] const_base_ptr levelOrderPredecessorOf(const_base_ptr n) const {
-			if (!n)
-				return lastNodeIn(traversal_order::LEVEL_ORDER);
-			if (n == _root)
-				return nullptr;
-
-			Queue<const_base_ptr> queue{ _root };
-			Queue<const_base_ptr> reverse{};
-			const_base_ptr next = nullptr;
-
-			while (!queue.isEmpty()) {
-				size_type count = queue.size();
-
-				while (count--) {
-					next = queue.front();
-					queue.dequeue_front();
-
-					if (next == n) 
-						return reverse.back();
-
-					if (next->to(left))
-						queue.enqueue_back(next->to(left));
-					if (next->to(right))
-						queue.enqueue_back(next->to(right));
-
-					reverse.enqueue_back(next);
-				}
-			}
-
-			return n;
-		}
-
-		[[nodiscard]] static bool isLeftChild(const_base_ptr n) {
-			return n->to(parent) && n == n->to(parent)->to(left);
-		}
-
-		[[nodiscard]] static bool isRightChild(const_base_ptr n) {
-			return n->to(parent) && n == n->to(parent)->to(right);
-		}
+		[[nodiscard]] static bool isRightChild(const_base_ptr n) {
+			return n->to(parent) && n == n->to(parent)->to(right);
+		}
 
 		[[nodiscard]] static size_type degree(const_base_ptr n) {
 			// seperate method required because node.degree() counts parent node
@@ -1559,6 +2065,11 @@ namespace collections::impl {
 				_root = n;
 			}
 
+			if constexpr (is_augmented) {
+				for (base_ptr p = n; p; p = p->to(parent))
+					updateNode(p);
+			}
+
 			_size++;
 		}
 
@@ -1571,17 +2082,17 @@ namespace collections::impl {
 			else if (compare(key, _min->value()))
 				return { { _min, Direction::LEFT }, false };
 			else if (!compare(_min->value(), key)) 
-				return { { _min, Direction::LEFT }, true };
+				return { { _min, Direction::LEFT }, true, _min };
 			else if (compare(_max->value(), key))
 				return { { _max, Direction::RIGHT }, false };
 			else if (!compare(key, _max->value()))
-				return { lowerBound_(key)._location, true };
+				return findInsertBound(key);
 			else if (compare(key, hint->value()))
 				return checkInsertHintPredecessor(hint, key);
 			else if (compare(hint->value(), key))
 				return checkInsertHintSuccessor(hint, key);
 			else
-				return { lowerBound_(key)._location, true };
+				return findInsertBound(key);
 		}
 
 		[[nodiscard]] TreeInsertLocation checkInsertHintPredecessor(
@@ -1623,10 +2134,97 @@ namespace collections::impl {
 				TreeBoundResult bound = lowerBound_(key);
 				bool isDuplicate =
 					bound._limit && !compare(key, bound._limit->value());
-				return { bound._location, isDuplicate };
+				return { bound._location, isDuplicate, bound._limit };
 			}
 		}
 
+		template <class forward_iterator, class sentinel>
+		[[nodiscard]] static bool isStrictlyAscending(
+			forward_iterator begin, 
+			sentinel end
+		) {
+			if (begin == end)
+				return true;
+
+			for (forward_iterator next = std::next(begin); next != end; ++next) {
+				const_reference current = *begin++;
+				const_reference following = *next;
+
+				if constexpr (is_map) {
+					if (!compare_t{}(current.key(), following.key()))
+						return false;
+				}
+				else if (!compare_t{}(current, following))
+					return false;
+			}
+
+			return true;
+		}
+
+	protected:
+
+		// called through self() so a derived tree can replace the balanced 
+		// build with its own, such as one that must honor node priorities, or
+		// finish it off, such as one that colors the built levels.
+		template <class forward_iterator>
+		void buildFromSorted(forward_iterator begin, size_type count) {
+			_root = buildSubtree(begin, count);
+
+			if (_root) {
+				_min = const_cast<base_ptr>(leftMostChildOf(_root));
+				_max = const_cast<base_ptr>(rightMostChildOf(_root));
+			}
+
+			_size = count;
+		}
+
+	private:
+
+		// builds the next count elements of the range into a balanced subtree 
+		// in order, so each element is read exactly once. Any odd element goes
+		// to the right, matching the shape sequential insertion would produce
+		// for small ranges.
+		template <class forward_iterator>
+		[[nodiscard]] base_ptr buildSubtree(
+			forward_iterator& it, 
+			size_type count
+		) {
+			if (count == 0)
+				return nullptr;
+
+			base_ptr leftChild = buildSubtree(it, (count - 1) / 2);
+			base_ptr n = nullptr;
+
+			try {
+				n = this->self().createNode(*it);
+				++it;
+
+				n->to(left) = leftChild;
+				if (leftChild)
+					leftChild->to(parent) = n;
+
+				base_ptr rightChild = buildSubtree(it, count / 2);
+
+				n->to(right) = rightChild;
+				if (rightChild)
+					rightChild->to(parent) = n;
+			}
+			catch (...) {
+				destroySubtree(n ? n : leftChild);
+				throw;
+			}
+
+			finishNode(n);
+			return n;
+		}
+
+		// source is the node copied into n when cloning, or null when n was
+		// built from a sorted range.
+		void finishNode(base_ptr n, const_base_ptr source = nullptr) {
+			updateNode(n);
+			this->self().onBuildNode(n, source);
+		}
+
 		// ----------------------- DELETION HELPERS ------------------------ //
 
 		base_ptr remove(base_ptr n) {
@@ -1674,10 +2272,17 @@ namespace collections::impl {
 		void updateLinksOnRemove(base_ptr n, base_ptr replacement) {
 			swapChild(n, replacement);
 
-			if (_min == n)
-				_min = replacement ? replacement : n->to(parent);
-			if (_max == n)
-				_max = replacement ? replacement : n->to(parent);
+			// the subtree replacing an extreme node may extend past it
+			if (_min == n) {
+				_min = replacement 
+					? const_cast<base_ptr>(leftMostChildOf(replacement)) 
+					: n->to(parent);
+			}
+			if (_max == n) {
+				_max = replacement 
+					? const_cast<base_ptr>(rightMostChildOf(replacement)) 
+					: n->to(parent);
+			}
 		}
 
 		// ----------------------------- UTILS ----------------------------- //
@@ -1697,8 +2302,16 @@ namespace collections::impl {
 		void onRotation(base_ptr pivot, base_ptr child) {
 			swapChild(pivot, child);
 			pivot->to(parent) = child;
+
+			if constexpr (is_augmented) {
+				updateNode(pivot);
+				updateNode(child);
+			}
 		}
 
+	protected:
+
+		// derived trees order their own searches with the same comparator.
 		[[nodiscard]] static bool compare(
 			key_type e1, 
 			key_type e2
@@ -1724,6 +2337,28 @@ namespace collections::impl {
 			return compare(e1, e2.key());
 		}
 
+		[[nodiscard]] static const key_type& keyOf(const_reference element) {
+			if constexpr (is_map)
+				return element.key();
+			else
+				return element;
+		}
+
+		[[nodiscard]] static const key_type& keyOfNode(const_base_ptr n) {
+			return keyOf(n->value());
+		}
+
+		// whether a may come before b, allowing equivalent keys only when 
+		// the tree holds duplicates.
+		[[nodiscard]] static bool isInOrder(const key_type& a, const key_type& b) {
+			if constexpr (hasDuplicates)
+				return !compare_t{}(b, a);
+			else
+				return compare_t{}(a, b);
+		}
+
+	private:
+
 		// ----------------------- TRAVERSAL HELPERS ----------------------- //
 
 		[[nodiscard]] static const_base_ptr leftMostChildOf(const_base_ptr n) {
@@ -1799,35 +2434,11 @@ namespace collections::impl {
 				return findNextRightSubtree(_root);
 			case collections::traversal_order::POST_ORDER:
 				return _root;
-			case collections::traversal_order::LEVEL_ORDER:
-				return lastNodeLevelOrder();
 			default:
 				return nullptr;
 			}
 		}
 
-		[[nodiscard]] const_base_ptr lastNodeLevelOrder() const {
-			Queue<const_base_ptr> queue { _root };
-			const_base_ptr n = nullptr;
-
-			while (!queue.isEmpty()) {
-				size_type count = queue.size();
-
-				while (count--) {
-					n = queue.front();
-
-					if (n->to(left))
-						queue.enqueue_back(n->to(left));
-					if (n->to(right))
-						queue.enqueue_back(n->to(right));
-
-					queue.dequeue_front();
-				}
-			}
-
-			return n;
-		}
-
 		[[nodiscard]] base_ptr successorOf(const_base_ptr n, traversal_order order) {
 			const_base_ptr result =  std::as_const(*this).successorOf(n, order);
 			return const_cast<base_ptr>(result);
@@ -1844,8 +2455,6 @@ namespace collections::impl {
 				return preOrderSuccessorOf(n);
 			case collections::traversal_order::POST_ORDER:
 				return postOrderSuccessorOf(n);
-			case collections::traversal_order::LEVEL_ORDER:
-				return levelOrderSuccessorOf(n);
 			default:
 				return n;
 			}
@@ -1867,8 +2476,6 @@ namespace collections::impl {
 				return preOrderPredecessorOf(n);
 			case collections::traversal_order::POST_ORDER:
 				return postOrderPredecessorOf(n);
-			case collections::traversal_order::LEVEL_ORDER:
-				return levelOrderPredecessorOf(n);
 			default:
 				return n;
 			}
@@ -1916,6 +2523,8 @@ namespace collections::impl {
 				return const_cast<base_ptr>(_node);
 			}
 
+			template <bool>
+			friend class LevelOrderIterator;
 			friend derived_t;
 			friend class BaseBST;
 
@@ -2034,6 +2643,22 @@ namespace collections::impl {
 				return &_node->value();
 			}
 
+			// -----------------------------------------------------------------
+			/// <summary>
+			/// Prefetches the child the next increment descends into for in 
+			/// order and pre order traversals, so that its load overlaps 
+			/// with work on the current element.
+			/// </summary> -----------------------------------------------------
+			void prefetch() const noexcept {
+				if (!_node)
+					return;
+
+				if (_order == traversal_order::IN_ORDER)
+					collections::prefetch(_node->to(right));
+				else if (_order == traversal_order::PRE_ORDER)
+					collections::prefetch(_node->to(left));
+			}
+
 			// ----------------------------------------------------------------
 			/// <summary>
 			/// ~~~ Pre-Increment Operator ~~~
@@ -2122,5 +2747,407 @@ namespace collections::impl {
 			std::bidirectional_iterator<iterator>,
 			"BinaryTreeIterator is not a valid bidirectional iterator."
 		);
+
+	protected:
+
+		// ----------------------------------------------------------------
+		/// <summary>
+		/// The state of a level order traversal. Moving forward, 'nodes' 
+		/// from 'head' on is a FIFO queue of discovered nodes whose front 
+		/// is the current node, and expanded nodes are discarded. A 
+		/// complete frontier instead holds every node of the tree in level
+		/// order and is never modified.
+		/// </summary> ----------------------------------------------------
+		struct level_order_frontier {
+			using storage = DynamicArray<
+				base_ptr, storage_allocator<allocator_t, base_ptr>
+			>;
+
+			storage nodes;
+			size_type head = 0;
+			bool isComplete = false;
+
+			explicit level_order_frontier(
+				const typename storage::allocator_type& alloc
+			) : nodes(alloc) {
+
+			}
+
+			// drops the front node in favor of its children, discarding 
+			// the expanded prefix once it makes up most of the storage.
+			void advance() {
+				base_ptr n = nodes[head++];
+
+				if (n->to(left))
+					nodes.insertBack(n->to(left));
+				if (n->to(right))
+					nodes.insertBack(n->to(right));
+
+				if (head > nodes.size() / 2) {
+					nodes.remove(nodes.begin(), nodes.begin() + head);
+					head = 0;
+				}
+			}
+		};
+
+		// ----------------------------------------------------------------
+		/// <summary>
+		/// Creates an empty level order frontier whose memory comes from 
+		/// the tree's allocator.
+		/// </summary> ----------------------------------------------------
+		[[nodiscard]] std::shared_ptr<level_order_frontier> makeFrontier() const {
+			const auto& alloc = this->self()._allocator;
+
+			return std::allocate_shared<level_order_frontier>(
+				storage_allocator_for<level_order_frontier>(alloc),
+				storage_allocator_for<base_ptr>(alloc)
+			);
+		}
+
+		// ----------------------------------------------------------------
+		/// <summary>
+		/// Creates the frontier of a traversal that has advanced the given
+		/// number of times from the root.
+		/// </summary> ----------------------------------------------------
+		[[nodiscard]] std::shared_ptr<level_order_frontier> makeFrontierAt(
+			size_type index
+		) const {
+			auto frontier = makeFrontier();
+			frontier->nodes.insertBack(_root);
+
+			while (index--)
+				frontier->advance();
+
+			return frontier;
+		}
+
+		// ----------------------------------------------------------------
+		/// <summary>
+		/// Creates a complete frontier holding every node of the tree in 
+		/// level order.
+		/// </summary> ----------------------------------------------------
+		[[nodiscard]] std::shared_ptr<level_order_frontier> makeCompleteFrontier() const {
+			auto frontier = makeFrontier();
+			auto& nodes = frontier->nodes;
+
+			if (_root)
+				nodes.insertBack(_root);
+
+			for (size_type i = 0; i < nodes.size(); i++) {
+				base_ptr n = nodes[i];
+
+				if (n->to(left))
+					nodes.insertBack(n->to(left));
+				if (n->to(right))
+					nodes.insertBack(n->to(right));
+			}
+
+			frontier->isComplete = true;
+			return frontier;
+		}
+
+		// ----------------------------------------------------------------
+		/// <summary>
+		/// LevelOrderIterator walks a binary tree breadth first. Moving 
+		/// forward it keeps a FIFO queue of the nodes discovered but not 
+		/// yet visited, so a traversal holds at most about two levels of 
+		/// the tree. Copies share the queue until one of them advances, 
+		/// while the copy returned by post-increment holds only its 
+		/// position and rebuilds a queue if it is ever advanced itself. 
+		/// The first step backward builds the complete level order once, 
+		/// which copies then share.
+		/// </summary>
+		///
+		/// <typeparam name="isConst">
+		/// Whether the iterator is a const_iterator (iterates over const 
+		/// elements) or not.
+		/// </typeparam> --------------------------------------------------
+		template <bool isConst>
+		class LevelOrderIterator {
+		private:
+
+			using pNode = std::conditional_t<isConst, const_base_ptr, base_ptr>;
+
+			const BaseBST* _tree;
+			std::shared_ptr<level_order_frontier> _frontier;
+			size_type _index;
+			pNode _node;
+
+			explicit LevelOrderIterator(const BaseBST* tree, pNode n) : 
+				_tree(tree), _frontier(), _index(0), _node(n) {
+
+			}
+
+			level_order_frontier& ownQueue() {
+				if (!_frontier && _index > 0)
+					_frontier = _tree->makeFrontierAt(_index);
+				else if (!_frontier) {
+					_frontier = _tree->makeFrontier();
+					_frontier->nodes.insertBack(node());
+				}
+				else if (_frontier.use_count() > 1) {
+					const auto& shared = *_frontier;
+					_frontier = _tree->makeFrontier();
+
+					auto& nodes = _frontier->nodes;
+					nodes.reserve(shared.nodes.size() - shared.head);
+					for (size_type i = shared.head; i < shared.nodes.size(); i++)
+						nodes.insertBack(shared.nodes[i]);
+				}
+
+				return *_frontier;
+			}
+
+			void increment() {
+				if (_frontier && _frontier->isComplete) {
+					const auto& nodes = _frontier->nodes;
+					_node = ++_index < nodes.size() ? nodes[_index] : nullptr;
+					return;
+				}
+
+				auto& queue = ownQueue();
+				queue.advance();
+
+				_index++;
+				_node = queue.head < queue.nodes.size() ? 
+					queue.nodes[queue.head] : nullptr;
+			}
+
+			// a copy of the current position that leaves the queue to this
+			// iterator, rebuilding its own only if it is advanced later.
+			[[nodiscard]] LevelOrderIterator snapshot() const {
+				LevelOrderIterator copy(_tree, _node);
+				copy._index = _index;
+
+				if (_frontier && _frontier->isComplete)
+					copy._frontier = _frontier;
+
+				return copy;
+			}
+
+			void decrement() {
+				if (!_frontier || !_frontier->isComplete)
+					_frontier = _tree->makeCompleteFrontier();
+
+				if (!_node)
+					_index = _frontier->nodes.size();
+
+				_node = _frontier->nodes[--_index];
+			}
+
+			[[nodiscard]] constexpr base_ptr node() const {
+				return const_cast<base_ptr>(_node);
+			}
+
+			template <bool otherConst>
+			[[nodiscard]] bool isAt(const BinaryTreeIterator<otherConst>& it) const {
+				return _tree == it._tree && node() == it.node();
+			}
+
+			template <bool>
+			friend class LevelOrderIterator;
+			friend derived_t;
+			friend class BaseBST;
+
+		public:
+
+			// set values must be const to preserve ordering
+			using value_type = std::conditional_t<
+				is_map, element_t, const element_t
+			>;
+
+			using difference_type = std::ptrdiff_t;
+
+			using pointer = std::conditional_t<
+				isConst, const value_type*, value_type*
+			>;
+
+			using reference = std::conditional_t<
+				isConst, const value_type&, value_type&
+			>;
+
+			using iterator_category = std::bidirectional_iterator_tag;
+
+			// ----------------------------------------------------------------
+			/// <summary>
+			/// ~~~ Default Constructor ~~~
+			///
+			///	<para>
+			/// Constructs an empty LevelOrderIterator.
+			/// </para></summary> ---------------------------------------------
+			LevelOrderIterator() = default;
+
+			// ----------------------------------------------------------------
+			/// <summary>
+			/// ~~~ Implicit Conversion Constructor ~~~
+			///
+			/// <para>
+			/// Constructs a copy of the given LevelOrderIterator for 
+			/// implicit conversion from non-const version to a const 
+			/// LevelOrderIterator. The copy shares the frontier.
+			/// </para></summary>
+			///
+			/// <param name="other">
+			/// The non-const LevelOrderIterator to copy from.
+			/// </param>
+			///
+			/// <typeparam name="wasConst">
+			/// The 'const'-ness of the provided LevelOrderIterator to copy.
+			/// </typeparam> --------------------------------------------------
+			template<
+				bool wasConst, 
+				class = std::enable_if_t<isConst && !wasConst>
+			>
+			LevelOrderIterator(LevelOrderIterator<wasConst> copy) : 
+				_tree(copy._tree), 
+				_frontier(std::move(copy._frontier)), 
+				_index(copy._index), 
+				_node(copy._node)
+			{
+
+			}
+
+			// ----------------------------------------------------------------
+			/// <summary>
+			/// ~~~ Dereference Operator ~~~
+			/// </summary>
+			///
+			/// <returns>
+			/// Returns a reference to the element pointed to by the 
+			/// iterator in its current state.
+			///	</returns> ----------------------------------------------------
+			reference operator*() const {
+				return _node->value();
+			}
+
+			// ----------------------------------------------------------------
+			/// <summary>
+			/// ~~~ Arrow Operator ~~~
+			/// </summary>
+			///
+			/// <returns>
+			/// Returns a pointer to the element pointed to by the iterator in 
+			/// its current state.
+			///	</returns> ----------------------------------------------------
+			pointer operator->() const {
+				return &_node->value();
+			}
+
+			// -----------------------------------------------------------------
+			/// <summary>
+			/// Prefetches the next node in level order if it has already been
+			/// discovered.
+			/// </summary> -----------------------------------------------------
+			void prefetch() const noexcept {
+				if (!_frontier)
+					return;
+
+				size_type next = (_frontier->isComplete ? _index : _frontier->head) + 1;
+				if (next < _frontier->nodes.size())
+					collections::prefetch(_frontier->nodes[next]);
+			}
+
+			// ----------------------------------------------------------------
+			/// <summary>
+			/// ~~~ Pre-Increment Operator ~~~
+			/// </summary>
+			///
+			/// <returns>
+			/// Moves the iterator to the next element and returns the 
+			/// iterator after updating.
+			///	</returns> ----------------------------------------------------
+			LevelOrderIterator& operator++() {
+				increment();
+				return *this;
+			}
+
+			// ----------------------------------------------------------------
+			/// <summary>
+			/// ~~~ Post-Increment Operator ~~~
+			/// </summary>
+			///
+			/// <returns>
+			/// Moves the iterator to the next element and returns a copy 
+			/// of the iterator before updating.
+			///	</returns> ----------------------------------------------------
+			LevelOrderIterator operator++(int) {
+				auto copy = snapshot();
+				increment();
+				return copy;
+			}
+
+			// ----------------------------------------------------------------
+			/// <summary>
+			/// ~~~ Pre-Decrement Operator ~~~
+			/// </summary>
+			///
+			/// <returns>
+			/// Moves the iterator to the previous element and returns the
+			/// iterator after updating.
+			///	</returns> ----------------------------------------------------
+			LevelOrderIterator& operator--() {
+				decrement();
+				return *this;
+			}
+
+			// ----------------------------------------------------------------
+			/// <summary>
+			/// ~~~ Post-Decrement Operator ~~~
+			/// </summary>
+			///
+			/// <returns>
+			/// Moves the iterator to the previous element and returns a 
+			/// copy of the iterator before updating.
+			///	</returns> ----------------------------------------------------
+			LevelOrderIterator operator--(int) {
+				auto copy = *this;
+				decrement();
+				return copy;
+			}
+
+			// ----------------------------------------------------------------
+			/// <summary>
+			/// ~~~ Equality Operator ~~~
+			/// </summary>
+			///
+			/// <returns>
+			/// Returns true if the LevelOrderIterators are both pointing to 
+			/// the same element, false otherwise.
+			///	</returns> ----------------------------------------------------
+			friend bool operator==(
+				const LevelOrderIterator& lhs,
+				const LevelOrderIterator& rhs
+			) {
+				return lhs._tree == rhs._tree && lhs._node == rhs._node;
+			}
+
+			// ----------------------------------------------------------------
+			/// <summary>
+			/// ~~~ Equality Operator ~~~
+			/// </summary>
+			///
+			/// <returns>
+			/// Returns true if the LevelOrderIterator points to the same 
+			/// element as the BinaryTreeIterator, so the tree's end() can 
+			/// terminate a level order traversal.
+			///	</returns> ----------------------------------------------------
+			template <bool otherConst>
+			friend bool operator==(
+				const LevelOrderIterator& lhs,
+				const BinaryTreeIterator<otherConst>& rhs
+			) {
+				return lhs.isAt(rhs);
+			}
+		};
+
+		static_assert(
+			std::bidirectional_iterator<level_order_iterator>,
+			"LevelOrderIterator is not a valid bidirectional iterator."
+		);
+
+		static_assert(
+			std::sentinel_for<iterator, level_order_iterator>,
+			"BinaryTreeIterator cannot terminate a level order traversal."
+		);
 	};
 }
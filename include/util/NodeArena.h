@@ -0,0 +1,492 @@
+/* ============================================================================
+* Copyright (C) 2023 Ryan Eubank
+*
+* This program is free software: you can redistribute it and/or modify
+* it under the terms of the GNU General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License
+* along with this program.  If not, see <https://www.gnu.org/licenses/>.
+* ========================================================================= */
+
+#pragma once
+
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <type_traits>
+
+namespace collections {
+
+	// -------------------------------------------------------------------------
+	/// <summary>
+	/// NodeArena is a memory source whose blocks are addressed by 32-bit 
+	/// indices as well as by pointer. Nodes allocated from it can store their
+	/// edges as indices, halving the size of each link on 64-bit targets.
+	///
+	/// <para>
+	/// Memory is reserved in 8 MB segments aligned to their own size. The 
+	/// first 16 bytes of each segment record the arena owning it and its 
+	/// number there, so a pointer is turned into an index by masking it down
+	/// to the segment start. An index is turned back into a pointer from the
+	/// address of any block of the same arena, such as the node holding the
+	/// link, with one lookup in the owner's segment table. Index 0 falls on 
+	/// the header of the first segment and stands for null. Blocks are 
+	/// rounded up to 8 bytes, carved from the newest segment and reused 
+	/// through per size free lists. At most 32 GB can be addressed, and the
+	/// segments are freed when the arena is destroyed.
+	/// </para>
+	/// 
+	/// <para>
+	/// Allocation and deallocation are synchronized. Default constructed 
+	/// ArenaAllocators draw from the arena of the thread that constructed 
+	/// them, shared between the allocators using it, so the arena lives 
+	/// until its thread has exited and its last container is destroyed. 
+	/// Each tag type has its own thread arenas.
+	/// </para>
+	/// </summary>
+	/// 
+	/// <typeparam name="tag">
+	/// A type distinguishing independent arenas.
+	/// </typeparam> -----------------------------------------------------------
+	template <class tag = void>
+	class NodeArena final {
+	public:
+
+		using index_type = std::uint32_t;
+
+		static constexpr size_t GRANULE			= 8;
+		static constexpr size_t MAX_BLOCK		= 512;
+
+	private:
+
+		static constexpr size_t SEGMENT_SHIFT		= 20;
+		static constexpr size_t SEGMENT_GRANULES	= size_t(1) << SEGMENT_SHIFT;
+		static constexpr size_t SEGMENT_BYTES		= SEGMENT_GRANULES * GRANULE;
+		static constexpr size_t MAX_SEGMENTS		= size_t(1) << (32 - SEGMENT_SHIFT);
+		static constexpr size_t CLASS_COUNT			= MAX_BLOCK / GRANULE;
+		static constexpr index_type OFFSET_MASK		= SEGMENT_GRANULES - 1;
+
+		struct header {
+			NodeArena* owner;
+			index_type number;
+		};
+
+		static constexpr index_type HEADER_GRANULES = 
+			(sizeof(header) + GRANULE - 1) / GRANULE;
+
+	public:
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// ~~~ Default Constructor ~~~
+		///
+		///	<para>
+		/// Constructs an empty arena that has not yet reserved any segments.
+		/// </para></summary> -------------------------------------------------
+		NodeArena() noexcept = default;
+
+		NodeArena(const NodeArena&) = delete;
+		NodeArena& operator=(const NodeArena&) = delete;
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// ~~~ Destructor ~~~
+		///
+		/// <para>
+		/// Frees every segment of the arena. Blocks still held by containers
+		/// are invalidated, so the arena must outlive every container using 
+		/// it.
+		/// </para></summary> -------------------------------------------------
+		~NodeArena() {
+			for (index_type i = 0; i < _count; ++i)
+				::operator delete(_table[i], std::align_val_t(SEGMENT_BYTES));
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Returns the arena of the calling thread, used by default 
+		/// constructed ArenaAllocators.
+		/// </summary>
+		///
+		/// <returns>
+		/// Returns shared ownership of the thread's arena.
+		/// </returns> --------------------------------------------------------
+		[[nodiscard]] static std::shared_ptr<NodeArena> local() {
+			thread_local std::shared_ptr<NodeArena> arena =
+				std::make_shared<NodeArena>();
+			return arena;
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Allocates a block of at least the given size, aligned to 8 bytes.
+		/// Throws std::bad_alloc if the size is zero or larger than 
+		/// MAX_BLOCK, or if the arena is exhausted.
+		/// </summary>
+		///
+		/// <param name="bytes">
+		/// The size of the block in bytes.
+		/// </param>
+		///
+		/// <returns>
+		/// Returns a pointer to the allocated block.
+		/// </returns> --------------------------------------------------------
+		[[nodiscard]] void* allocate(size_t bytes) {
+			if (bytes == 0 || bytes > MAX_BLOCK)
+				throw std::bad_alloc();
+
+			std::lock_guard<std::mutex> lock(_mutex);
+
+			size_t granules = granulesFor(bytes);
+			index_type& free = _free[granules - 1];
+
+			if (free) {
+				void* block = blockAt(free);
+				free = *static_cast<index_type*>(block);
+				return block;
+			}
+
+			if (_cursor + granules > SEGMENT_GRANULES)
+				addSegment();
+
+			index_type index = ((_count - 1) << SEGMENT_SHIFT) | _cursor;
+			_cursor += static_cast<index_type>(granules);
+			return blockAt(index);
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Returns a block previously obtained from allocate with the same 
+		/// size to the arena.
+		/// </summary>
+		///
+		/// <param name="block">
+		/// The block to deallocate.
+		/// </param>
+		/// <param name="bytes">
+		/// The size the block was allocated with.
+		/// </param> ----------------------------------------------------------
+		void deallocate(void* block, size_t bytes) noexcept {
+			std::lock_guard<std::mutex> lock(_mutex);
+
+			index_type& free = _free[granulesFor(bytes) - 1];
+			*static_cast<index_type*>(block) = free;
+			free = indexOf(block);
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Returns the index of a block allocated from an arena, or 0 for 
+		/// null.
+		/// </summary>
+		///
+		/// <param name="block">
+		/// The start of a block allocated from an arena, or null.
+		/// </param> ----------------------------------------------------------
+		[[nodiscard]] static index_type indexOf(const void* block) noexcept {
+			if (!block)
+				return 0;
+
+			auto address = reinterpret_cast<std::uintptr_t>(block);
+			auto start = address & ~std::uintptr_t(SEGMENT_BYTES - 1);
+
+			return (headerOf(block)->number << SEGMENT_SHIFT) | 
+				static_cast<index_type>((address - start) / GRANULE);
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Returns the address of the block with the given index, or null 
+		/// for index 0.
+		/// </summary>
+		///
+		/// <param name="from">
+		/// Any address within a block of the arena the index belongs to, 
+		/// such as the address of the link storing the index.
+		/// </param>
+		/// <param name="index">
+		/// An index returned by indexOf.
+		/// </param> ----------------------------------------------------------
+		[[nodiscard]] static void* addressOf(
+			const void* from, 
+			index_type index
+		) noexcept {
+			if (!index)
+				return nullptr;
+
+			return headerOf(from)->owner->blockAt(index);
+		}
+
+	private:
+
+		// segments are only appended while the mutex is held, and a block is
+		// handed out after its segment is recorded, so anyone holding an 
+		// index can read the table without locking.
+		std::byte* _table[MAX_SEGMENTS] = {};
+		index_type _count = 0;
+		index_type _cursor = SEGMENT_GRANULES;
+		index_type _free[CLASS_COUNT] = {};
+		std::mutex _mutex;
+
+		[[nodiscard]] static constexpr size_t granulesFor(size_t bytes) noexcept {
+			return (bytes + GRANULE - 1) / GRANULE;
+		}
+
+		[[nodiscard]] static header* headerOf(const void* p) noexcept {
+			auto address = reinterpret_cast<std::uintptr_t>(p);
+			return reinterpret_cast<header*>(
+				address & ~std::uintptr_t(SEGMENT_BYTES - 1));
+		}
+
+		[[nodiscard]] void* blockAt(index_type index) const noexcept {
+			std::byte* start = _table[index >> SEGMENT_SHIFT];
+			return start + size_t(index & OFFSET_MASK) * GRANULE;
+		}
+
+		void addSegment() {
+			if (_count == MAX_SEGMENTS)
+				throw std::bad_alloc();
+
+			auto start = static_cast<std::byte*>(::operator new(
+				SEGMENT_BYTES, std::align_val_t(SEGMENT_BYTES)));
+
+			::new (static_cast<void*>(start)) header{ this, _count };
+			_table[_count++] = start;
+
+			// the first granules hold the header, which also keeps index 0 
+			// free to stand for null.
+			_cursor = HEADER_GRANULES;
+		}
+	};
+
+	// -------------------------------------------------------------------------
+	/// <summary>
+	/// ArenaAllocator is an allocator drawing from a NodeArena. Node based 
+	/// containers given an ArenaAllocator store their links as 32-bit arena
+	/// indices instead of pointers. Every allocation must fit within
+	/// NodeArena::MAX_BLOCK bytes, which suits containers allocating one node
+	/// at a time.
+	///
+	/// <para>
+	/// Default constructed allocators share the arena of the thread that 
+	/// constructed them, keeping it alive while in use, and compare equal to
+	/// other default allocators of the same thread. Allocators built from a 
+	/// caller owned arena compare equal only to allocators using the same 
+	/// arena, and the arena must outlive every container using it.
+	/// </para>
+	/// </summary>
+	///
+	/// <typeparam name="element_t">
+	/// The type of object allocated by the allocator.
+	/// </typeparam>
+	/// 
+	/// <typeparam name="tag">
+	/// A type naming the kind of arena to allocate from.
+	/// </typeparam> -----------------------------------------------------------
+	template <class element_t, class tag = void>
+	class ArenaAllocator {
+	public:
+
+		using value_type		= element_t;
+		using size_type			= size_t;
+		using difference_type	= std::ptrdiff_t;
+		using arena_type		= NodeArena<tag>;
+
+		using propagate_on_container_copy_assignment	= std::true_type;
+		using propagate_on_container_move_assignment	= std::true_type;
+		using propagate_on_container_swap				= std::true_type;
+		using is_always_equal							= std::false_type;
+
+		// ---------------------------------------------------------------------
+		/// <summary>
+		/// ~~~ Default Constructor ~~~
+		///
+		///	<para>
+		/// Constructs an allocator using the arena of the calling thread.
+		/// </para></summary> --------------------------------------------------
+		ArenaAllocator() : _arena(arena_type::local()) {
+
+		}
+
+		// ---------------------------------------------------------------------
+		/// <summary>
+		/// ~~~ Arena Constructor ~~~
+		///
+		///	<para>
+		/// Constructs an allocator drawing from the given arena.
+		/// </para></summary>
+		///
+		/// <param name="arena">
+		/// The arena to allocate from, which must outlive the allocator and
+		/// every block allocated through it.
+		/// </param> -----------------------------------------------------------
+		ArenaAllocator(arena_type& arena) noexcept : 
+			_arena(std::shared_ptr<arena_type>(), &arena) 
+		{
+
+		}
+
+		// ---------------------------------------------------------------------
+		/// <summary>
+		/// ~~~ Rebind Constructor ~~~
+		///
+		///	<para>
+		/// Constructs an allocator for the same arena from an allocator of 
+		/// another type.
+		/// </para></summary> --------------------------------------------------
+		template <class U>
+		ArenaAllocator(const ArenaAllocator<U, tag>& other) noexcept :
+			_arena(other._arena)
+		{
+
+		}
+
+		ArenaAllocator(const ArenaAllocator&) noexcept = default;
+		ArenaAllocator& operator=(const ArenaAllocator&) noexcept = default;
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Allocates uninitialized storage for n objects from the arena.
+		/// </summary>
+		///
+		/// <param name="n">
+		/// The number of objects to allocate storage for.
+		/// </param>
+		///
+		/// <returns>
+		/// Returns a pointer to the allocated storage.
+		/// </returns> --------------------------------------------------------
+		[[nodiscard]] value_type* allocate(size_type n) {
+			static_assert(
+				alignof(value_type) <= arena_type::GRANULE,
+				"ArenaAllocator cannot allocate over-aligned types."
+			);
+
+			if (n > arena_type::MAX_BLOCK / sizeof(value_type))
+				throw std::bad_alloc();
+
+			return static_cast<value_type*>(
+				_arena->allocate(n * sizeof(value_type)));
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Returns storage for n objects previously obtained from allocate.
+		/// </summary>
+		///
+		/// <param name="pointer">
+		/// The storage to deallocate.
+		/// </param>
+		/// <param name="n">
+		/// The number of objects the storage was allocated for.
+		/// </param> ----------------------------------------------------------
+		void deallocate(value_type* pointer, size_type n) noexcept {
+			_arena->deallocate(pointer, n * sizeof(value_type));
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Returns the arena backing the allocator.
+		/// </summary>
+		///
+		/// <returns>
+		/// Returns a pointer to the arena.
+		/// </returns> --------------------------------------------------------
+		[[nodiscard]] arena_type* arena() const noexcept {
+			return _arena.get();
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// ~~~ Equality Operator ~~~
+		/// </summary>
+		///
+		/// <returns>
+		/// Returns true if both allocators share an arena.
+		/// </returns> --------------------------------------------------------
+		template <class U>
+		friend bool operator==(
+			const ArenaAllocator& lhs,
+			const ArenaAllocator<U, tag>& rhs
+		) noexcept {
+			return lhs.arena() == rhs.arena();
+		}
+
+	private:
+
+		template <class, class>
+		friend class ArenaAllocator;
+
+		// caller owned arenas are held without ownership, so only allocators
+		// over thread arenas keep theirs alive.
+		std::shared_ptr<arena_type> _arena;
+	};
+
+	// -------------------------------------------------------------------------
+	/// <summary>
+	/// Concept for allocators whose memory comes from a NodeArena, letting 
+	/// nodes link to one another by arena index.
+	/// </summary>
+	/// 
+	/// <typeparam name="T">
+	/// The type of the allocator.
+	/// </typeparam> -----------------------------------------------------------
+	template <class T>
+	concept arena_allocator = requires (void* block) {
+		typename T::arena_type;
+		{ T::arena_type::indexOf(block) } noexcept 
+			-> std::same_as<typename T::arena_type::index_type>;
+	};
+
+	// -------------------------------------------------------------------------
+	/// <summary>
+	/// The allocator a node based container uses for bookkeeping arrays, 
+	/// such as arrays of node pointers. Arena allocators only serve blocks up
+	/// to NodeArena::MAX_BLOCK bytes, so their containers fall back to the
+	/// default allocator. Any other allocator is rebound.
+	/// </summary>
+	/// 
+	/// <typeparam name="allocator_t">
+	/// The allocator type of the owning container.
+	/// </typeparam>
+	/// 
+	/// <typeparam name="T">
+	/// The type of value to allocate.
+	/// </typeparam> -----------------------------------------------------------
+	template <class allocator_t, class T>
+	using storage_allocator = std::conditional_t<
+		arena_allocator<allocator_t>,
+		std::allocator<T>,
+		typename std::allocator_traits<allocator_t>::template rebind_alloc<T>
+	>;
+
+	// -------------------------------------------------------------------------
+	/// <summary>
+	/// Returns the storage_allocator for T matching the given container 
+	/// allocator.
+	/// </summary>
+	/// 
+	/// <param name="alloc">
+	/// The allocator of the owning container.
+	/// </param> ---------------------------------------------------------------
+	template <class T, class allocator_t>
+	[[nodiscard]] constexpr storage_allocator<allocator_t, T> 
+		storage_allocator_for(const allocator_t& alloc) noexcept 
+	{
+		if constexpr (arena_allocator<allocator_t>)
+			return storage_allocator<allocator_t, T>{};
+		else
+			return static_cast<storage_allocator<allocator_t, T>>(alloc);
+	}
+}
@@ -0,0 +1,366 @@
+/* ============================================================================
+* Copyright (C) 2023 Ryan Eubank
+*
+* This program is free software: you can redistribute it and/or modify
+* it under the terms of the GNU General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License
+* along with this program.  If not, see <https://www.gnu.org/licenses/>.
+* ========================================================================= */
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <span>
+#include <type_traits>
+#include <utility>
+
+#include "../concepts/collection.h"
+#include "NodeArena.h"
+
+namespace collections {
+
+	// -------------------------------------------------------------------------
+	/// <summary>
+	/// The edge of a list node that carries the tag marking nodes carved
+	/// from a NodeBatches block, or -1 for arena allocators, which never
+	/// batch.
+	/// </summary>
+	///
+	/// <typeparam name="allocator_t">
+	/// The allocator type of the owning container.
+	/// </typeparam> -----------------------------------------------------------
+	template <class allocator_t>
+	inline constexpr int batch_tag_edge = arena_allocator<allocator_t> ? -1 : 0;
+
+	// -------------------------------------------------------------------------
+	/// <summary>
+	/// NodeBatches carves the contiguous node runs a node based container
+	/// allocates when it bulk loads a sized range. Nodes built from one run
+	/// sit next to each other in memory, so the first traversal after a bulk
+	/// load walks memory sequentially instead of chasing scattered heap
+	/// allocations.
+	///
+	/// <para>
+	/// Runs are carved from blocks of BLOCK_BYTES aligned to their size, and
+	/// only runs of at least MIN_BATCH nodes, enough to fill three quarters 
+	/// of a block, are batched, so a short list never pays for a block it 
+	/// mostly leaves empty. Containers stop carving from a block once their
+	/// bulk load is done, so none holds on to a half empty block between
+	/// bulk loads.
+	/// </para>
+	///
+	/// <para>
+	/// Each block starts with a header counting its nodes in use, including
+	/// nodes parked for reuse and the container still carving from it, so
+	/// the header of any node is found by masking the node's address. A
+	/// block is returned as soon as its count drops to zero, whichever
+	/// container frees the last node, and nodes spliced between containers
+	/// need no bookkeeping at all.
+	/// </para>
+	///
+	/// <para>
+	/// Containers mark each node carved from a block with the node tag, so
+	/// deallocate() can tell it from a node allocated on its own. The tag
+	/// is cleared whenever a node is constructed, so containers carry it
+	/// over themselves when they reuse parked node memory.
+	/// </para>
+	/// </summary>
+	///
+	/// <typeparam name="node_t">
+	/// The type of node stored in the blocks.
+	/// </typeparam>
+	///
+	/// <typeparam name="allocator_t">
+	/// The allocator type of the owning container, rebound to allocate the
+	/// blocks.
+	/// </typeparam> -----------------------------------------------------------
+	template <class node_t, class allocator_t>
+	class NodeBatches {
+	private:
+
+		using node_alloc_t			= rebind<allocator_t, node_t>;
+		using node_alloc_traits		= std::allocator_traits<node_alloc_t>;
+
+	public:
+
+		using size_type = node_alloc_traits::size_type;
+
+		static constexpr size_type BLOCK_BYTES	= 4096;
+
+	private:
+
+		// the count is atomic because the nodes of one block may be spread
+		// over containers used from different threads.
+		struct header {
+			std::atomic<size_type> live;
+		};
+
+		struct alignas(BLOCK_BYTES) block {
+			std::byte bytes[BLOCK_BYTES];
+		};
+
+		using block_alloc_t			= storage_allocator<allocator_t, block>;
+		using block_alloc_traits	= std::allocator_traits<block_alloc_t>;
+
+		static constexpr size_type NODE_OFFSET =
+			(sizeof(header) + alignof(node_t) - 1) / alignof(node_t) * alignof(node_t);
+
+		static constexpr size_type NODES_PER_BLOCK =
+			sizeof(node_t) <= BLOCK_BYTES - NODE_OFFSET
+				? (BLOCK_BYTES - NODE_OFFSET) / sizeof(node_t)
+				: 0;
+
+		// blocks holding fewer nodes than this save too few allocations to be
+		// worth carving.
+		static constexpr size_type MIN_NODES_PER_BLOCK = 8;
+
+		static constexpr bool can_batch =
+			!arena_allocator<allocator_t> && 
+			NODES_PER_BLOCK >= MIN_NODES_PER_BLOCK;
+
+	public:
+
+		static constexpr size_type MIN_BATCH = 
+			NODES_PER_BLOCK - NODES_PER_BLOCK / 4;
+
+		// ---------------------------------------------------------------------
+		/// <summary>
+		/// Returns true if count nodes should be carved from blocks. Arena
+		/// allocators never batch, since they cannot allocate blocks larger
+		/// than NodeArena::MAX_BLOCK and already carve consecutive nodes from
+		/// the same segment, and nodes too large to fit several to a block 
+		/// are always allocated on their own. Shorter runs are allocated node
+		/// by node, since they would leave most of a block unused.
+		/// </summary>
+		///
+		/// <param name="count">
+		/// The number of nodes about to be allocated.
+		/// </param> -----------------------------------------------------------
+		[[nodiscard]] static constexpr bool isWorthBatching(
+			size_type count
+		) noexcept {
+			return can_batch && count >= MIN_BATCH;
+		}
+
+		// ---------------------------------------------------------------------
+		/// <summary>
+		/// ~~~ Default Constructor ~~~
+		///
+		///	<para>
+		/// Constructs a handle that is not carving from any block.
+		/// </para></summary> --------------------------------------------------
+		NodeBatches() = default;
+
+		// ---------------------------------------------------------------------
+		/// <summary>
+		/// ~~~ Allocator Constructor ~~~
+		///
+		///	<para>
+		/// Constructs a handle that is not carving from any block. Blocks are
+		/// allocated from a rebound copy of the given allocator.
+		/// </para></summary>
+		///
+		/// <param name="alloc">
+		/// The allocator of the owning container.
+		/// </param> -----------------------------------------------------------
+		template <class alloc_t>
+		explicit NodeBatches(const alloc_t& alloc) noexcept :
+			_allocator(storage_allocator_for<block>(alloc))
+		{
+
+		}
+
+		NodeBatches(const NodeBatches&) = delete;
+		NodeBatches& operator=(const NodeBatches&) = delete;
+
+		// ---------------------------------------------------------------------
+		NodeBatches(NodeBatches&& other) noexcept :
+			_allocator(other._allocator),
+			_block(std::exchange(other._block, nullptr)),
+			_next(std::exchange(other._next, nullptr)),
+			_end(std::exchange(other._end, nullptr))
+		{
+
+		}
+
+		// ---------------------------------------------------------------------
+		NodeBatches& operator=(NodeBatches&& other) noexcept {
+			if (this != std::addressof(other)) {
+				reset();
+				_allocator = other._allocator;
+				_block = std::exchange(other._block, nullptr);
+				_next = std::exchange(other._next, nullptr);
+				_end = std::exchange(other._end, nullptr);
+			}
+			return *this;
+		}
+
+		// ---------------------------------------------------------------------
+		~NodeBatches() {
+			reset();
+		}
+
+		// ---------------------------------------------------------------------
+		/// <summary>
+		/// Carves uninitialized storage for up to count contiguous nodes. A
+		/// new block is started when the current one cannot hold the whole
+		/// run, so a run is only cut short when it is larger than a block.
+		/// </summary>
+		///
+		/// <param name="count">
+		/// The number of nodes wanted.
+		/// </param>
+		///
+		/// <returns>
+		/// Returns the carved nodes, at least one and at most count.
+		/// </returns> ---------------------------------------------------------
+		[[nodiscard]] std::span<node_t> allocate(size_type count) {
+			size_type wanted = std::min(count, NODES_PER_BLOCK);
+
+			if (static_cast<size_type>(_end - _next) < wanted)
+				startBlock();
+
+			size_type carved = std::min(count, static_cast<size_type>(_end - _next));
+			node_t* nodes = _next;
+
+			_next += carved;
+			headerOf(_block)->live.fetch_add(carved, std::memory_order_relaxed);
+			return { nodes, carved };
+		}
+
+		// ---------------------------------------------------------------------
+		/// <summary>
+		/// Deallocates a node whose value has been destroyed. A node from a
+		/// block only drops the block's count, and the block is freed with
+		/// its last node in use. Any other node is returned to the allocator.
+		/// </summary>
+		///
+		/// <param name="alloc">
+		/// The node allocator of the owning container.
+		/// </param>
+		///
+		/// <param name="n">
+		/// The node to deallocate.
+		/// </param>
+		///
+		/// <param name="isBatched">
+		/// Whether the node was carved from a block, read from its tag before
+		/// it was destroyed.
+		/// </param> -----------------------------------------------------------
+		void deallocate(
+			node_alloc_t& alloc,
+			node_t* n,
+			bool isBatched
+		) noexcept {
+			if (isBatched)
+				release(headerOf(n));
+			else
+				node_alloc_traits::deallocate(alloc, n, 1);
+		}
+
+		// ---------------------------------------------------------------------
+		/// <summary>
+		/// Marks a node constructed in carved storage, so it is returned to
+		/// its block when deallocated.
+		/// </summary>
+		///
+		/// <param name="n">
+		/// The node to mark.
+		/// </param> -----------------------------------------------------------
+		static void mark(node_t* n) noexcept {
+			if constexpr (can_batch)
+				n->setTag(true);
+		}
+
+		// ---------------------------------------------------------------------
+		/// <summary>
+		/// Returns true if the given constructed node was carved from a
+		/// block.
+		/// </summary>
+		///
+		/// <param name="n">
+		/// The node to check.
+		/// </param> -----------------------------------------------------------
+		[[nodiscard]] static bool isBatched(const node_t* n) noexcept {
+			if constexpr (can_batch)
+				return n->tag();
+			else
+				return false;
+		}
+
+		// ---------------------------------------------------------------------
+		/// <summary>
+		/// Stops carving from the current block, so an empty container does
+		/// not keep the block alive.
+		/// </summary> ---------------------------------------------------------
+		void reset() noexcept {
+			if (_block)
+				release(headerOf(_block));
+
+			_block = nullptr;
+			_next = nullptr;
+			_end = nullptr;
+		}
+
+		// ---------------------------------------------------------------------
+		/// <summary>
+		/// Swaps the blocks two containers are carving from.
+		/// </summary>
+		///
+		/// <param name="other">
+		/// The batches to swap with.
+		/// </param> -----------------------------------------------------------
+		void swap(NodeBatches& other) noexcept {
+			std::swap(_allocator, other._allocator);
+			std::swap(_block, other._block);
+			std::swap(_next, other._next);
+			std::swap(_end, other._end);
+		}
+
+	private:
+
+		[[no_unique_address, msvc::no_unique_address]]
+		block_alloc_t _allocator;
+		block* _block = nullptr;
+		node_t* _next = nullptr;
+		node_t* _end = nullptr;
+
+		// the carving container holds one count on its block until it moves
+		// on, so a block is never freed while nodes are still carved from it.
+		void startBlock() {
+			block* b = std::to_address(block_alloc_traits::allocate(_allocator, 1));
+			::new (static_cast<void*>(b)) header{ 1 };
+
+			reset();
+			_block = b;
+			_next = reinterpret_cast<node_t*>(b->bytes + NODE_OFFSET);
+			_end = _next + NODES_PER_BLOCK;
+		}
+
+		void release(header* h) noexcept {
+			if (h->live.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+				block* b = reinterpret_cast<block*>(h);
+				h->~header();
+				block_alloc_traits::deallocate(_allocator, b, 1);
+			}
+		}
+
+		[[nodiscard]] static header* headerOf(const void* p) noexcept {
+			auto address = reinterpret_cast<std::uintptr_t>(p);
+			return reinterpret_cast<header*>(address & ~(BLOCK_BYTES - 1));
+		}
+	};
+}
@@ -0,0 +1,227 @@
+/* ============================================================================
+* Copyright (C) 2023 Ryan Eubank
+*
+* This program is free software: you can redistribute it and/or modify
+* it under the terms of the GNU General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License
+* along with this program.  If not, see <https://www.gnu.org/licenses/>.
+* ========================================================================= */
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+
+#include "../concepts/collection.h"
+#include "../containers/DynamicArray.h"
+#include "NodeArena.h"
+#include "NodeBatch.h"
+
+namespace collections {
+
+	// -------------------------------------------------------------------------
+	/// <summary>
+	/// NodeCache parks the memory of destroyed nodes so a node based 
+	/// container can reuse it for later inserts instead of returning it to
+	/// the allocator. The cache is bounded and starts with no room, so it 
+	/// only holds nodes once a container reserves space for them.
+	///
+	/// <para>
+	/// Parked nodes are raw memory: the container destroys a node before 
+	/// parking it and constructs a new node in place after taking it. Nodes
+	/// from a NodeBatches block may be parked like any other and keep their
+	/// block alive until the cache is released. Constructing a node clears 
+	/// its tag, so the cache remembers which nodes came from a block in the
+	/// low bit of each parked address.
+	/// </para>
+	/// </summary>
+	/// 
+	/// <typeparam name="node_t">
+	/// The type of node stored in the cache.
+	/// </typeparam>
+	/// 
+	/// <typeparam name="allocator_t">
+	/// The allocator type of the owning container, rebound to allocate the
+	/// nodes and the cache's own storage.
+	/// </typeparam> -----------------------------------------------------------
+	template <class node_t, class allocator_t>
+	class NodeCache {
+	private:
+
+		using node_alloc_t		= rebind<allocator_t, node_t>;
+		using node_alloc_traits	= std::allocator_traits<node_alloc_t>;
+		using batches			= NodeBatches<node_t, allocator_t>;
+		using storage_alloc_t	= storage_allocator<allocator_t, std::uintptr_t>;
+		using storage			= DynamicArray<std::uintptr_t, storage_alloc_t>;
+
+		static constexpr std::uintptr_t BATCHED_BIT = 1;
+
+	public:
+
+		using size_type = node_alloc_traits::size_type;
+
+		// ---------------------------------------------------------------------
+		/// <summary>
+		/// Constructs an empty cache with no room for nodes.
+		/// </summary> ---------------------------------------------------------
+		NodeCache() = default;
+
+		// ---------------------------------------------------------------------
+		/// <summary>
+		/// Constructs an empty cache whose storage uses a rebound copy of the
+		/// given allocator. Arena allocators only serve nodes, so the storage
+		/// of caches for arena nodes comes from the default allocator.
+		/// </summary>
+		/// 
+		/// <param name="alloc">
+		/// The allocator of the owning container.
+		/// </param> -----------------------------------------------------------
+		template <class alloc_t>
+		explicit NodeCache(const alloc_t& alloc) : 
+			_nodes(storage_allocator_for<std::uintptr_t>(alloc)) 
+		{
+
+		}
+
+		NodeCache(const NodeCache&) = delete;
+		NodeCache(NodeCache&&) = default;
+		NodeCache& operator=(const NodeCache&) = delete;
+		NodeCache& operator=(NodeCache&&) = default;
+
+		// ---------------------------------------------------------------------
+		/// <summary>
+		/// Returns the number of nodes currently parked in the cache.
+		/// </summary> ---------------------------------------------------------
+		[[nodiscard]] size_type size() const noexcept {
+			return _nodes.size();
+		}
+
+		// ---------------------------------------------------------------------
+		/// <summary>
+		/// Returns the maximum number of nodes the cache will hold.
+		/// </summary> ---------------------------------------------------------
+		[[nodiscard]] size_type capacity() const noexcept {
+			return _nodes.capacity();
+		}
+
+		// ---------------------------------------------------------------------
+		/// <summary>
+		/// Returns true if no nodes are parked in the cache.
+		/// </summary> ---------------------------------------------------------
+		[[nodiscard]] bool isEmpty() const noexcept {
+			return _nodes.isEmpty();
+		}
+
+		// ---------------------------------------------------------------------
+		/// <summary>
+		/// Grows the cache so it can hold at least the given number of nodes.
+		/// The cache never shrinks, so parking a node never allocates.
+		/// </summary>
+		/// 
+		/// <param name="count">
+		/// The number of nodes the cache should be able to hold.
+		/// </param> -----------------------------------------------------------
+		void reserve(size_type count) {
+			if (count > capacity())
+				_nodes.reserve(count);
+		}
+
+		// ---------------------------------------------------------------------
+		/// <summary>
+		/// Parks the memory of a destroyed node if the cache has room.
+		/// </summary>
+		/// 
+		/// <param name="n">
+		/// The node memory to park.
+		/// </param>
+		/// 
+		/// <param name="isBatched">
+		/// Whether the node was carved from a NodeBatches block.
+		/// </param>
+		/// 
+		/// <returns>
+		/// Returns false if the cache is full and the caller must free the 
+		/// node itself.
+		/// </returns> ---------------------------------------------------------
+		[[nodiscard]] bool park(node_t* n, bool isBatched) noexcept {
+			if (size() == capacity())
+				return false;
+
+			_nodes.insertBack(reinterpret_cast<std::uintptr_t>(n) | isBatched);
+			return true;
+		}
+
+		// ---------------------------------------------------------------------
+		/// <summary>
+		/// Takes the most recently parked node out of the cache.
+		/// </summary>
+		/// 
+		/// <param name="isBatched">
+		/// Set to whether the taken node was carved from a NodeBatches block.
+		/// </param>
+		/// 
+		/// <returns>
+		/// Returns the memory of a parked node, or nullptr if the cache is
+		/// empty.
+		/// </returns> ---------------------------------------------------------
+		[[nodiscard]] node_t* take(bool& isBatched) noexcept {
+			if (isEmpty())
+				return nullptr;
+
+			std::uintptr_t parked = _nodes.back();
+			_nodes.removeBack();
+
+			isBatched = parked & BATCHED_BIT;
+			return reinterpret_cast<node_t*>(parked & ~BATCHED_BIT);
+		}
+
+		// ---------------------------------------------------------------------
+		/// <summary>
+		/// Frees every parked node through the given batches and empties the
+		/// cache. The cache keeps its capacity.
+		/// </summary>
+		/// 
+		/// <param name="alloc">
+		/// The node allocator of the owning container.
+		/// </param>
+		/// 
+		/// <param name="owner">
+		/// The batches of the owning container.
+		/// </param> -----------------------------------------------------------
+		void release(node_alloc_t& alloc, batches& owner) noexcept {
+			for (std::uintptr_t parked : _nodes) {
+				owner.deallocate(
+					alloc, 
+					reinterpret_cast<node_t*>(parked & ~BATCHED_BIT), 
+					parked & BATCHED_BIT
+				);
+			}
+
+			_nodes.clear();
+		}
+
+		// ---------------------------------------------------------------------
+		/// <summary>
+		/// Swaps the contents and capacity of two caches.
+		/// </summary>
+		/// 
+		/// <param name="other">
+		/// The cache to swap with.
+		/// </param> -----------------------------------------------------------
+		void swap(NodeCache& other) noexcept {
+			_nodes.swap(other._nodes);
+		}
+
+	private:
+
+		storage _nodes;
+	};
+}
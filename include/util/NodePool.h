@@ -0,0 +1,428 @@
+/* ============================================================================
+* Copyright (C) 2023 Ryan Eubank
+*
+* This program is free software: you can redistribute it and/or modify
+* it under the terms of the GNU General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License
+* along with this program.  If not, see <https://www.gnu.org/licenses/>.
+* ========================================================================= */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdlib>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <type_traits>
+
+namespace collections {
+
+	// -------------------------------------------------------------------------
+	/// <summary>
+	/// NodePoolResource is the memory source behind NodePool allocators. Small
+	/// requests are rounded up to an 8 byte size class and carved from large
+	/// slabs; freed blocks go onto a per class free list and are reused
+	/// before the slab is advanced. Slabs are 16 byte aligned and a type's
+	/// size is a multiple of its alignment, so blocks of any class stay
+	/// suitably aligned. Requests larger than 512 bytes or with extended
+	/// alignment go straight to the global operator new.
+	///
+	/// Slabs are only returned to the system by release() or when the
+	/// resource is destroyed. A resource is not thread safe unless it is
+	/// constructed as synchronized.
+	///
+	/// Default constructed NodePool allocators draw from the resource of
+	/// the thread that constructed them. Each allocator shares ownership of
+	/// it, so the resource and its slabs are freed once the thread has 
+	/// exited and the last container using it is destroyed.
+	/// </summary> -------------------------------------------------------------
+	class NodePoolResource final {
+	private:
+
+		static constexpr size_t GRANULE				= 8;
+		static constexpr size_t MAX_ALIGN			= 16;
+		static constexpr size_t MAX_BLOCK			= 512;
+		static constexpr size_t CLASS_COUNT			= MAX_BLOCK / GRANULE;
+		static constexpr size_t MIN_SLAB_BYTES		= 4096;
+		static constexpr size_t MAX_SLAB_BYTES		= 65536;
+
+		struct block {
+			block* next;
+		};
+
+		struct alignas(MAX_ALIGN) slab {
+			slab* next;
+		};
+
+		struct pool {
+			block* free = nullptr;
+			std::byte* cursor = nullptr;
+			std::byte* limit = nullptr;
+			size_t slabBytes = MIN_SLAB_BYTES;
+		};
+
+	public:
+
+		// ---------------------------------------------------------------------
+		/// <summary>
+		/// ~~~ Default Constructor ~~~
+		///
+		///	<para>
+		/// Constructs an empty resource that has not yet allocated any slabs.
+		/// </para></summary>
+		///
+		/// <param name="synchronized">
+		/// Whether allocation and deallocation are guarded by a mutex so the
+		/// resource may be shared between threads.
+		/// </param> -----------------------------------------------------------
+		explicit NodePoolResource(bool synchronized = false) noexcept :
+			_pools(),
+			_slabs(nullptr),
+			_mutex(),
+			_synchronized(synchronized)
+		{
+
+		}
+
+		NodePoolResource(const NodePoolResource&) = delete;
+		NodePoolResource& operator=(const NodePoolResource&) = delete;
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// ~~~ Destructor ~~~
+		///
+		/// <para>
+		/// Releases every slab owned by the resource.
+		/// </para></summary> -------------------------------------------------
+		~NodePoolResource() {
+			release();
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Returns the resource of the calling thread, used by default 
+		/// constructed NodePool allocators. Containers on different threads
+		/// allocate from different resources, so they do not contend for a 
+		/// lock. The resource is still synchronized, since a container may
+		/// outlive the thread or be handed to another one.
+		/// </summary>
+		///
+		/// <returns>
+		/// Returns shared ownership of the thread's resource.
+		/// </returns> --------------------------------------------------------
+		[[nodiscard]] static std::shared_ptr<NodePoolResource> local() {
+			thread_local std::shared_ptr<NodePoolResource> resource =
+				std::make_shared<NodePoolResource>(true);
+			return resource;
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Allocates a block of at least the given size and alignment.
+		/// Throws std::bad_alloc if memory cannot be obtained.
+		/// </summary>
+		///
+		/// <param name="bytes">
+		/// The size of the block in bytes.
+		/// </param>
+		/// <param name="alignment">
+		/// The required alignment of the block.
+		/// </param>
+		///
+		/// <returns>
+		/// Returns a pointer to the allocated block.
+		/// </returns> --------------------------------------------------------
+		[[nodiscard]] void* allocate(size_t bytes, size_t alignment) {
+			if (!isPooled(bytes, alignment))
+				return ::operator new(bytes, std::align_val_t(alignment));
+
+			std::unique_lock<std::mutex> lock(_mutex, std::defer_lock);
+			if (_synchronized)
+				lock.lock();
+
+			size_t index = classOf(bytes);
+			pool& p = _pools[index];
+
+			if (p.free) {
+				block* b = p.free;
+				p.free = b->next;
+				return b;
+			}
+
+			size_t blockSize = (index + 1) * GRANULE;
+			if (p.cursor == p.limit)
+				addSlab(p, blockSize);
+
+			void* result = p.cursor;
+			p.cursor += blockSize;
+			return result;
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Returns a block previously obtained from allocate with the same
+		/// size and alignment to the resource.
+		/// </summary>
+		///
+		/// <param name="pointer">
+		/// The block to deallocate.
+		/// </param>
+		/// <param name="bytes">
+		/// The size the block was allocated with.
+		/// </param>
+		/// <param name="alignment">
+		/// The alignment the block was allocated with.
+		/// </param> ----------------------------------------------------------
+		void deallocate(void* pointer, size_t bytes, size_t alignment) noexcept {
+			if (!isPooled(bytes, alignment)) {
+				::operator delete(pointer, bytes, std::align_val_t(alignment));
+				return;
+			}
+
+			std::unique_lock<std::mutex> lock(_mutex, std::defer_lock);
+			if (_synchronized)
+				lock.lock();
+
+			pool& p = _pools[classOf(bytes)];
+			block* b = static_cast<block*>(pointer);
+			b->next = p.free;
+			p.free = b;
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Returns every slab to the system. Any block still held by a
+		/// container is invalidated, so this should only be called once all
+		/// containers using the resource are empty or destroyed.
+		/// </summary> --------------------------------------------------------
+		void release() noexcept {
+			std::unique_lock<std::mutex> lock(_mutex, std::defer_lock);
+			if (_synchronized)
+				lock.lock();
+
+			while (_slabs) {
+				slab* next = _slabs->next;
+				::operator delete(_slabs);
+				_slabs = next;
+			}
+
+			_pools = {};
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// ~~~ Equality Operator ~~~
+		/// </summary>
+		///
+		/// <returns>
+		/// Returns true if both operands are the same resource.
+		/// </returns> --------------------------------------------------------
+		friend bool operator==(
+			const NodePoolResource& lhs,
+			const NodePoolResource& rhs
+		) noexcept {
+			return &lhs == &rhs;
+		}
+
+	private:
+
+		std::array<pool, CLASS_COUNT> _pools;
+		slab* _slabs;
+		std::mutex _mutex;
+		bool _synchronized;
+
+		[[nodiscard]] static constexpr bool isPooled(
+			size_t bytes,
+			size_t alignment
+		) noexcept {
+			return bytes != 0 && bytes <= MAX_BLOCK &&
+				alignment <= MAX_ALIGN && bytes % alignment == 0;
+		}
+
+		[[nodiscard]] static constexpr size_t classOf(size_t bytes) noexcept {
+			return (bytes + GRANULE - 1) / GRANULE - 1;
+		}
+
+		void addSlab(pool& p, size_t blockSize) {
+			size_t usable = std::max(p.slabBytes, blockSize);
+			auto* s = static_cast<slab*>(::operator new(sizeof(slab) + usable));
+
+			s->next = _slabs;
+			_slabs = s;
+
+			p.cursor = reinterpret_cast<std::byte*>(s + 1);
+			p.limit = p.cursor + usable / blockSize * blockSize;
+			p.slabBytes = std::min(p.slabBytes * 2, MAX_SLAB_BYTES);
+		}
+	};
+
+	// -------------------------------------------------------------------------
+	/// <summary>
+	/// NodePool is an allocator that draws memory from a NodePoolResource,
+	/// turning the one-node-at-a-time allocations of linked containers into
+	/// pointer bumps and free list pops. Rebound copies share the resource,
+	/// so a container rebinding its allocator to its node type allocates
+	/// nodes from the same pool.
+	///
+	/// Default constructed pools share the resource of the thread that 
+	/// constructed them, keeping it alive while in use, and compare equal 
+	/// to other default pools of the same thread. Pools built from a caller
+	/// owned resource compare equal only to pools using the same resource, 
+	/// and the resource must outlive every container using it.
+	/// </summary>
+	///
+	/// <typeparam name="element_t">
+	/// The type of object allocated by the allocator.
+	/// </typeparam> -----------------------------------------------------------
+	template <class element_t>
+	class NodePool {
+	public:
+
+		using value_type		= element_t;
+		using size_type			= size_t;
+		using difference_type	= std::ptrdiff_t;
+
+		using propagate_on_container_copy_assignment	= std::false_type;
+		using propagate_on_container_move_assignment	= std::true_type;
+		using propagate_on_container_swap				= std::true_type;
+		using is_always_equal							= std::false_type;
+
+		// ---------------------------------------------------------------------
+		/// <summary>
+		/// ~~~ Default Constructor ~~~
+		///
+		///	<para>
+		/// Constructs an allocator using the resource of the calling thread.
+		/// </para></summary> --------------------------------------------------
+		NodePool() : _resource(NodePoolResource::local()) {
+
+		}
+
+		// ---------------------------------------------------------------------
+		/// <summary>
+		/// ~~~ Resource Constructor ~~~
+		///
+		///	<para>
+		/// Constructs an allocator drawing from the given resource.
+		/// </para></summary>
+		///
+		/// <param name="resource">
+		/// The resource to allocate from, which must outlive the allocator
+		/// and every block allocated through it.
+		/// </param> -----------------------------------------------------------
+		NodePool(NodePoolResource& resource) noexcept : 
+			_resource(std::shared_ptr<NodePoolResource>(), &resource) 
+		{
+
+		}
+
+		// ---------------------------------------------------------------------
+		/// <summary>
+		/// ~~~ Rebind Constructor ~~~
+		///
+		///	<para>
+		/// Constructs an allocator sharing the resource of the given
+		/// allocator of another type.
+		/// </para></summary>
+		///
+		/// <param name="other">
+		/// The allocator to share the resource of.
+		/// </param> -----------------------------------------------------------
+		template <class U>
+		NodePool(const NodePool<U>& other) noexcept :
+			_resource(other._resource)
+		{
+
+		}
+
+		NodePool(const NodePool&) noexcept = default;
+		NodePool& operator=(const NodePool&) noexcept = default;
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Allocates uninitialized storage for n objects. Throws
+		/// std::bad_array_new_length if the request overflows.
+		/// </summary>
+		///
+		/// <param name="n">
+		/// The number of objects to allocate storage for.
+		/// </param>
+		///
+		/// <returns>
+		/// Returns a pointer to the allocated storage.
+		/// </returns> --------------------------------------------------------
+		[[nodiscard]] value_type* allocate(size_type n) {
+			if (n > std::numeric_limits<size_type>::max() / sizeof(value_type))
+				throw std::bad_array_new_length();
+
+			return static_cast<value_type*>(_resource->allocate(
+				n * sizeof(value_type), alignof(value_type)));
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Returns storage for n objects previously obtained from allocate.
+		/// </summary>
+		///
+		/// <param name="pointer">
+		/// The storage to deallocate.
+		/// </param>
+		/// <param name="n">
+		/// The number of objects the storage was allocated for.
+		/// </param> ----------------------------------------------------------
+		void deallocate(value_type* pointer, size_type n) noexcept {
+			_resource->deallocate(
+				pointer, n * sizeof(value_type), alignof(value_type));
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Returns the resource backing the allocator.
+		/// </summary>
+		///
+		/// <returns>
+		/// Returns a pointer to the resource.
+		/// </returns> --------------------------------------------------------
+		[[nodiscard]] NodePoolResource* resource() const noexcept {
+			return _resource.get();
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// ~~~ Equality Operator ~~~
+		/// </summary>
+		///
+		/// <returns>
+		/// Returns true if memory allocated by one allocator can be
+		/// deallocated by the other, i.e. both share a resource.
+		/// </returns> --------------------------------------------------------
+		template <class U>
+		friend bool operator==(
+			const NodePool& lhs,
+			const NodePool<U>& rhs
+		) noexcept {
+			return lhs.resource() == rhs.resource();
+		}
+
+	private:
+
+		template <class U>
+		friend class NodePool;
+
+		// caller owned resources are held without ownership, so only pools
+		// over thread resources keep theirs alive.
+		std::shared_ptr<NodePoolResource> _resource;
+	};
+}
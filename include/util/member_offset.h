@@ -0,0 +1,53 @@
+/* ============================================================================
+ * Copyright (C) 2023 Ryan Eubank
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ * ========================================================================= */
+#pragma once
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+namespace collections {
+
+	// ------------------------------------------------------------------------
+	/// <summary>
+	/// Returns the byte offset of a data member within its enclosing class.
+	/// Supported ABIs store a data member pointer as that offset, so this 
+	/// reads the bits of a constant and compiles down to an immediate, 
+	/// without touching an object or any static state.
+	/// </summary>
+	/// 
+	/// <typeparam name="member">
+	/// Pointer to the data member, which must not be declared in a virtual 
+	/// base.
+	/// </typeparam> ----------------------------------------------------------
+	template <auto member>
+		requires std::is_member_object_pointer_v<decltype(member)>
+	[[nodiscard]] inline std::ptrdiff_t member_offset() noexcept {
+		using member_pointer = decltype(member);
+#if defined(_MSC_VER) && !defined(__clang__)
+		// wider member pointers carry a virtual base adjustment
+		static_assert(sizeof(member_pointer) == sizeof(std::int32_t),
+			"member_offset does not support members of virtual bases");
+		return std::bit_cast<std::int32_t>(member);
+#else
+		static_assert(sizeof(member_pointer) == sizeof(std::ptrdiff_t),
+			"member_offset requires the Itanium data member pointer layout");
+		return std::bit_cast<std::ptrdiff_t>(member);
+#endif
+	}
+}
@@ -0,0 +1,90 @@
+/* ============================================================================
+ * Copyright (C) 2023 Ryan Eubank
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ * ========================================================================= */
+
+#pragma once
+
+#include <type_traits>
+
+#if defined(_MSC_VER) && !defined(__clang__) && (defined(_M_X64) || defined(_M_IX86))
+#include <xmmintrin.h>
+#endif
+
+namespace collections {
+
+	// ------------------------------------------------------------------------
+	/// <summary>
+	/// Hints to the processor that the memory at the given address will be
+	/// read soon, so the cache line can be fetched while other work proceeds.
+	/// The hint never faults and is a no-op on unsupported targets.
+	/// </summary>
+	/// 
+	/// <param name="address">
+	/// The address to prefetch, which may be null.
+	/// </param> --------------------------------------------------------------
+	inline void prefetch(const void* address) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+		__builtin_prefetch(address);
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+		_mm_prefetch(static_cast<const char*>(address), _MM_HINT_T0);
+#else
+		static_cast<void>(address);
+#endif
+	}
+
+	// ------------------------------------------------------------------------
+	/// <summary>
+	/// Concept for node based iterators that can prefetch the node their 
+	/// next increment will move to.
+	/// </summary>
+	/// 
+	/// <typeparam name="T">
+	/// The type of the iterator.
+	/// </typeparam> ----------------------------------------------------------
+	template <class T>
+	concept prefetchable = requires(const T& it) {
+		{ it.prefetch() } noexcept;
+	};
+
+	// ------------------------------------------------------------------------
+	/// <summary>
+	/// Prefetches the node following the given iterator if the iterator 
+	/// supports it, letting the load overlap with work on the current 
+	/// element. Does nothing for other iterators or in constant evaluation.
+	/// </summary>
+	/// 
+	/// <typeparam name="iterator">
+	/// The type of the iterator.
+	/// </typeparam>
+	/// 
+	/// <param name="it">
+	/// The iterator whose successor should be prefetched.
+	/// </param> --------------------------------------------------------------
+	template <class iterator>
+	constexpr void prefetch_next(const iterator& it) noexcept {
+		if constexpr (prefetchable<iterator>) {
+			if (!std::is_constant_evaluated())
+				it.prefetch();
+		}
+	}
+
+	/// <summary>
+	/// Tag selecting algorithm overloads that prefetch the next node of node
+	/// based iterators while the current element is processed.
+	/// </summary>
+	struct prefetching_t { explicit prefetching_t() = default; };
+	inline constexpr prefetching_t prefetching{};
+}
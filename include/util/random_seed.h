@@ -0,0 +1,69 @@
+/* ============================================================================
+ * Copyright (C) 2023 Ryan Eubank
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ * ========================================================================= */
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <random>
+
+namespace collections {
+
+	/// <summary>
+	/// Odd 64-bit constant derived from the golden ratio, used to step and
+	/// stand in for seeds.
+	/// </summary>
+	inline constexpr std::uint64_t golden_gamma = 0x9E3779B97F4A7C15ull;
+
+	// ------------------------------------------------------------------------
+	/// <summary>
+	/// Scrambles the given value with the splitmix64 finalizer, so that 
+	/// nearby inputs give unrelated seeds. Never returns zero, which would
+	/// lock an xorshift generator.
+	/// </summary>
+	/// 
+	/// <param name="x">
+	/// The value to mix.
+	/// </param> --------------------------------------------------------------
+	[[nodiscard]] constexpr std::uint64_t mix_seed(std::uint64_t x) noexcept {
+		x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ull;
+		x = (x ^ (x >> 27)) * 0x94D049BB133111EBull;
+		x ^= x >> 31;
+		return x ? x : golden_gamma;
+	}
+
+	// ------------------------------------------------------------------------
+	/// <summary>
+	/// Returns a new nonzero seed for a randomized container. Seeds mix 
+	/// process entropy with a shared counter, so containers neither repeat
+	/// each other's sequences nor follow one known before the program runs.
+	/// </summary> ------------------------------------------------------------
+	[[nodiscard]] inline std::uint64_t fresh_seed() noexcept {
+		static const std::uint64_t entropy = []() noexcept {
+			try {
+				std::random_device device;
+				return (std::uint64_t(device()) << 32) ^ device();
+			}
+			catch (...) {
+				return std::uint64_t(0);
+			}
+		}();
+		static std::atomic<std::uint64_t> counter = 0;
+
+		return mix_seed(
+			entropy + counter.fetch_add(golden_gamma, std::memory_order_relaxed));
+	}
+}
@@ -37,4 +37,25 @@ namespace collections {
 	/// </summary>
 	using Size = NamedType<size_t, struct SizeType>;
 
+	/// <summary>
+	/// Tag selecting operations that leave a container's size to be 
+	/// recounted the next time it is requested.
+	/// </summary>
+	struct deferred_size_t { explicit deferred_size_t() = default; };
+	inline constexpr deferred_size_t deferred_size{};
+
+	/// <summary>
+	/// Tag selecting the single threaded form of an operation that can also
+	/// run in parallel.
+	/// </summary>
+	struct serial_t { explicit serial_t() = default; };
+	inline constexpr serial_t serial{};
+
+	/// <summary>
+	/// Tag selecting operations that may run independent parts of their 
+	/// work on separate threads.
+	/// </summary>
+	struct parallel_t { explicit parallel_t() = default; };
+	inline constexpr parallel_t parallel{};
+
 }
\ No newline at end of file
@@ -0,0 +1,190 @@
+/* ============================================================================
+* Copyright (C) 2023 Ryan Eubank
+*
+* This program is free software: you can redistribute it and/or modify
+* it under the terms of the GNU General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License
+* along with this program.  If not, see <https://www.gnu.org/licenses/>.
+* ========================================================================= */
+
+#pragma once
+
+#include <algorithm>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "../collection_test_fixture.h"
+
+namespace collection_tests {
+
+	template <class T>
+	class OrderStatisticTests : public CollectionTest<T> {
+	protected:
+
+		using collection_type	= T;
+		using value_type		= T::value_type;
+		using key_type			= T::key_type;
+		using sorted_keys		= std::vector<std::remove_cvref_t<key_type>>;
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Returns the key the collection orders the given element by.
+		/// </summary> --------------------------------------------------------
+		static key_type keyOf(const value_type& element) {
+			if constexpr (map<collection_type>)
+				return element.key();
+			else
+				return element;
+		}
+
+		// --------------------------------------------------------------------
+		/// <summary>
+		/// Checks nth, rankOf and countInRange on the collection against the 
+		/// sorted keys of its contents.
+		/// </summary> --------------------------------------------------------
+		void expectOrderStatistics(
+			const collection_type& obj, 
+			const sorted_keys& sorted
+		) {
+			ASSERT_EQ(obj.size(), sorted.size());
+
+			for (size_t index = 0; index < sorted.size(); ++index) {
+				const auto& key = sorted[index];
+				size_t first = index;
+				size_t last = index;
+
+				while (first > 0 && sorted[first - 1] == key)
+					--first;
+				while (last + 1 < sorted.size() && sorted[last + 1] == key)
+					++last;
+
+				EXPECT_EQ(keyOf(*obj.nth(index)), key);
+				EXPECT_EQ(obj.rankOf(key), first);
+				EXPECT_EQ(obj.countInRange(sorted.front(), key), last + 1);
+				EXPECT_EQ(obj.countInRange(key, key), last - first + 1);
+			}
+		}
+	};
+
+	TYPED_TEST_SUITE_P(OrderStatisticTests);
+
+	// ------------------------------------------------------------------------
+	/// <summary>
+	/// Tests that nth returns the elements in sorted order and throws for 
+	/// positions past the end.
+	/// </summary> ------------------------------------------------------------
+	TYPED_TEST_P(OrderStatisticTests, NthReturnsElementsInSortedOrder) {
+		FORWARD_TEST_TYPES();
+		DECLARE_TEST_DATA();
+
+		collection_type obj{ f, c, i, a, h, b, j, e, g, d };
+		auto expected = { a, b, c, d, e, f, g, h, i, j };
+		size_type index = 0;
+
+		for (const auto& element : expected) {
+			EXPECT_EQ(*obj.nth(index), element);
+			EXPECT_EQ(*std::as_const(obj).nth(index), element);
+			++index;
+		}
+
+		EXPECT_THROW(static_cast<void>(obj.nth(obj.size())), std::out_of_range);
+	}
+
+	// ------------------------------------------------------------------------
+	/// <summary>
+	/// Tests that rankOf counts the elements ordered before a key whether or
+	/// not the key is present.
+	/// </summary> ------------------------------------------------------------
+	TYPED_TEST_P(OrderStatisticTests, RankOfCountsLesserElements) {
+		FORWARD_TEST_TYPES();
+		DECLARE_TEST_DATA();
+
+		const collection_type obj{ h, b, f, d };
+
+		EXPECT_EQ(obj.rankOf(this->keyOf(a)), 0);
+		EXPECT_EQ(obj.rankOf(this->keyOf(b)), 0);
+		EXPECT_EQ(obj.rankOf(this->keyOf(c)), 1);
+		EXPECT_EQ(obj.rankOf(this->keyOf(f)), 2);
+		EXPECT_EQ(obj.rankOf(this->keyOf(g)), 3);
+		EXPECT_EQ(obj.rankOf(this->keyOf(j)), 4);
+	}
+
+	// ------------------------------------------------------------------------
+	/// <summary>
+	/// Tests that countInRange counts the elements within a closed interval.
+	/// </summary> ------------------------------------------------------------
+	TYPED_TEST_P(OrderStatisticTests, CountInRangeCountsClosedInterval) {
+		FORWARD_TEST_TYPES();
+		DECLARE_TEST_DATA();
+
+		const collection_type obj{ j, a, e, c, g, i };
+
+		EXPECT_EQ(obj.countInRange(this->keyOf(a), this->keyOf(j)), 6);
+		EXPECT_EQ(obj.countInRange(this->keyOf(b), this->keyOf(g)), 3);
+		EXPECT_EQ(obj.countInRange(this->keyOf(c), this->keyOf(c)), 1);
+		EXPECT_EQ(obj.countInRange(this->keyOf(d), this->keyOf(d)), 0);
+		EXPECT_EQ(obj.countInRange(this->keyOf(g), this->keyOf(b)), 0);
+	}
+
+	// ------------------------------------------------------------------------
+	/// <summary>
+	/// Tests that the statistics stay correct after every insertion and 
+	/// removal, including those that rebalance or restructure the tree.
+	/// </summary> ------------------------------------------------------------
+	TYPED_TEST_P(OrderStatisticTests, StatisticsAreMaintainedOnInsertAndRemove) {
+		FORWARD_TEST_TYPES();
+		DECLARE_TEST_DATA();
+
+		typename TestFixture::sorted_keys sorted;
+		collection_type obj{};
+
+		auto insertEach = [&](auto elements) {
+			for (const auto& element : elements) {
+				auto key = this->keyOf(element);
+				obj.insert(element);
+				sorted.insert(std::ranges::upper_bound(sorted, key), key);
+				this->expectOrderStatistics(obj, sorted);
+			}
+		};
+
+		auto removeEach = [&](auto elements) {
+			for (const auto& element : elements) {
+				auto key = this->keyOf(element);
+				obj.remove(obj.lowerBound(key));
+				sorted.erase(std::ranges::lower_bound(sorted, key));
+				this->expectOrderStatistics(obj, sorted);
+			}
+		};
+
+		auto duplicates = { c, h, c };
+
+		insertEach(std::initializer_list{ e, b, h, a, c, g, i, d, f, j });
+		if constexpr (collection_type::allow_duplicates)
+			insertEach(duplicates);
+
+		if constexpr (collection_type::allow_duplicates)
+			removeEach(duplicates);
+		removeEach(std::initializer_list{ e, a, h, d, j, b, g, c, i, f });
+
+		EXPECT_TRUE(obj.isEmpty());
+	}
+
+	REGISTER_TYPED_TEST_SUITE_P(
+		OrderStatisticTests,
+		NthReturnsElementsInSortedOrder,
+		RankOfCountsLesserElements,
+		CountInRangeCountsClosedInterval,
+		StatisticsAreMaintainedOnInsertAndRemove
+	);
+}
@@ -61,6 +61,26 @@ namespace collection_tests {
 		EXPECT_EQ(*result, a);
 	}
 
+	// -------------------------------------------------------------------------
+	/// <summary>
+	/// Tests that the insert method returns an iterator to the existing 
+	/// element when inserting a duplicate of any element in a set, not only
+	/// the first or last.
+	/// </summary> -------------------------------------------------------------
+	TYPED_TEST_P(SetInsertionTests, InsertReturnsIteratorToAnyDuplicate) {
+		FORWARD_TEST_TYPES();
+		DECLARE_TEST_DATA();
+
+		collection_type obj{ d, b, f, a, c, e, g };
+
+		for (const auto& element : { a, b, c, d, e, f, g }) {
+			auto result = obj.insert(element);
+			EXPECT_EQ(*result, element);
+		}
+
+		EXPECT_EQ(obj.size(), 7);
+	}
+
 	// -------------------------------------------------------------------------
 	/// <summary>
 	/// Tests that the insert method has no effect when inserting a range 
@@ -118,6 +138,7 @@ namespace collection_tests {
 		SetInsertionTests,
 		InsertFailsOnDuplicateElement,
 		InsertReturnsIteratorToDuplicateOnFailure,
+		InsertReturnsIteratorToAnyDuplicate,
 		InsertFailsOnDuplicateRange,
 		InsertRangeReturnsIteratorToLastDuplicateElement,
 		InsertRangeConstructsUnionOfBothSets
@@ -0,0 +1,279 @@
+/* ============================================================================
+* Copyright (C) 2023 Ryan Eubank
+*
+* This program is free software: you can redistribute it and/or modify
+* it under the terms of the GNU General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License
+* along with this program.  If not, see <https://www.gnu.org/licenses/>.
+* ========================================================================= */
+
+
+#pragma once
+
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <stdexcept>
+#include <vector>
+#include <gtest/gtest.h>
+#include "collection_test_fixture.h"
+
+namespace collection_tests {
+
+	template <class T>
+	using ListAlgorithmTests = CollectionTest<T>;
+
+	TYPED_TEST_SUITE_P(ListAlgorithmTests);
+
+	// -------------------------------------------------------------------------
+	/// <summary>
+	/// Tests that sorting a list orders its elements ascending by default.
+	/// </summary> -------------------------------------------------------------
+	TYPED_TEST_P(ListAlgorithmTests, SortOrdersElementsAscending) {
+		FORWARD_TEST_TYPES();
+		DECLARE_TEST_DATA();
+
+		collection_type list{ h, c, j, a, e, b, i, d, g, f };
+		auto expected = { a, b, c, d, e, f, g, h, i, j };
+
+		list.sort();
+
+		this->expectSequence(list.begin(), list.end(), expected);
+		EXPECT_EQ(list.size(), expected.size());
+	}
+
+	// -------------------------------------------------------------------------
+	/// <summary>
+	/// Tests that sorting a list with a custom comparator orders elements by
+	/// that comparator and preserves the relative order of equal elements.
+	/// </summary> -------------------------------------------------------------
+	TYPED_TEST_P(ListAlgorithmTests, SortWithComparatorIsStable) {
+		FORWARD_TEST_TYPES();
+		DECLARE_TEST_DATA();
+
+		collection_type list{ h, a, i, b, f, c, j, d };
+		auto expected = { a, b, c, d, h, i, f, j };
+		auto byGroup = [&](const_reference x, const_reference y) {
+			return (x < e) > (y < e);
+		};
+
+		list.sort(byGroup);
+
+		this->expectSequence(list.begin(), list.end(), expected);
+	}
+
+	// -------------------------------------------------------------------------
+	/// <summary>
+	/// Tests that sorting empty and single element lists leaves them intact
+	/// and that a sorted list remains usable for further insertions.
+	/// </summary> -------------------------------------------------------------
+	TYPED_TEST_P(ListAlgorithmTests, SortHandlesTrivialListsAndKeepsListUsable) {
+		FORWARD_TEST_TYPES();
+		DECLARE_TEST_DATA();
+
+		collection_type empty{};
+		empty.sort();
+		EXPECT_TRUE(empty.isEmpty());
+
+		collection_type list{ c, b };
+		list.sort(std::greater<value_type>{});
+		list.insertBack(a);
+		list.insertFront(d);
+
+		auto expected = { d, c, b, a };
+		this->expectSequence(list.begin(), list.end(), expected);
+	}
+
+	// -------------------------------------------------------------------------
+	/// <summary>
+	/// Tests that sorting a large list produces a sorted permutation of the
+	/// original elements.
+	/// </summary> -------------------------------------------------------------
+	TYPED_TEST_P(ListAlgorithmTests, SortProducesSortedPermutationOfLargeList) {
+		FORWARD_TEST_TYPES();
+		DECLARE_TEST_DATA();
+
+		std::vector<value_type> data;
+		const value_type values[] = { a, b, c, d, e, f, g, h, i, j };
+		for (size_type n = 0; n < 1000; ++n)
+			data.push_back(values[(n * 7919) % 10]);
+
+		collection_type list(data.begin(), data.end());
+		std::stable_sort(data.begin(), data.end());
+
+		list.sort();
+
+		EXPECT_EQ(list.size(), data.size());
+		this->expectSequence(list.begin(), list.end(), data);
+	}
+
+	// -------------------------------------------------------------------------
+	/// <summary>
+	/// Tests that merging two sorted lists interleaves their elements in
+	/// order and leaves the merged list empty.
+	/// </summary> -------------------------------------------------------------
+	TYPED_TEST_P(ListAlgorithmTests, MergeCombinesSortedListsAndEmptiesOther) {
+		FORWARD_TEST_TYPES();
+		DECLARE_TEST_DATA();
+
+		collection_type list_1{ b, c, f, i };
+		collection_type list_2{ a, d, e, g, h, j };
+		auto expected = { a, b, c, d, e, f, g, h, i, j };
+
+		list_1.merge(list_2);
+
+		this->expectSequence(list_1.begin(), list_1.end(), expected);
+		EXPECT_EQ(list_1.size(), expected.size());
+		EXPECT_TRUE(list_2.isEmpty());
+
+		list_2.insertBack(a);
+		list_1.insertBack(a);
+		EXPECT_EQ(list_2.size(), 1);
+		EXPECT_EQ(list_1.size(), expected.size() + 1);
+	}
+
+	// -------------------------------------------------------------------------
+	/// <summary>
+	/// Tests that merging into and from empty lists moves every element and
+	/// that lists sharing equal elements merge all of them.
+	/// </summary> -------------------------------------------------------------
+	TYPED_TEST_P(ListAlgorithmTests, MergeHandlesEmptyListsAndEqualElements) {
+		FORWARD_TEST_TYPES();
+		DECLARE_TEST_DATA();
+
+		collection_type list_1{};
+		collection_type list_2{ a, c };
+		collection_type list_3{};
+
+		list_1.merge(list_2);
+		list_1.merge(list_3);
+
+		auto expected_1 = { a, c };
+		this->expectSequence(list_1.begin(), list_1.end(), expected_1);
+
+		collection_type list_4{ a, c, e };
+		collection_type list_5{ c, e, e };
+		list_4.merge(list_5, std::less<value_type>{});
+
+		auto expected_2 = { a, c, c, e, e, e };
+		this->expectSequence(list_4.begin(), list_4.end(), expected_2);
+		EXPECT_EQ(list_4.size(), expected_2.size());
+		EXPECT_TRUE(list_5.isEmpty());
+	}
+
+	// -------------------------------------------------------------------------
+	/// <summary>
+	/// Tests that unique removes consecutive duplicates and returns the number
+	/// of elements removed.
+	/// </summary> -------------------------------------------------------------
+	TYPED_TEST_P(ListAlgorithmTests, UniqueRemovesConsecutiveDuplicates) {
+		FORWARD_TEST_TYPES();
+		DECLARE_TEST_DATA();
+
+		collection_type list{ a, a, b, c, c, c, a, d, d };
+		auto expected = { a, b, c, a, d };
+
+		EXPECT_EQ(list.unique(), 4);
+		this->expectSequence(list.begin(), list.end(), expected);
+		EXPECT_EQ(list.size(), expected.size());
+
+		list.insertBack(e);
+		EXPECT_EQ(list.back(), e);
+	}
+
+	// -------------------------------------------------------------------------
+	/// <summary>
+	/// Tests that reversing a list reverses the order of its elements and 
+	/// keeps the list usable at both ends.
+	/// </summary> -------------------------------------------------------------
+	TYPED_TEST_P(ListAlgorithmTests, ReverseReversesElementOrder) {
+		FORWARD_TEST_TYPES();
+		DECLARE_TEST_DATA();
+
+		collection_type list{ a, b, c, d, e };
+		auto expected = { f, e, d, c, b, a, g };
+
+		list.reverse();
+		list.insertFront(f);
+		list.insertBack(g);
+
+		this->expectSequence(list.begin(), list.end(), expected);
+
+		collection_type single{ a };
+		single.reverse();
+		EXPECT_EQ(single.front(), a);
+		EXPECT_EQ(single.back(), a);
+	}
+
+	// -------------------------------------------------------------------------
+	/// <summary>
+	/// Tests that a comparator throwing partway through a sort or a merge 
+	/// leaves every element in the lists, with sizes matching their contents.
+	/// </summary> -------------------------------------------------------------
+	TYPED_TEST_P(ListAlgorithmTests, ThrowingComparisonKeepsEveryElement) {
+		FORWARD_TEST_TYPES();
+		DECLARE_TEST_DATA();
+
+		std::vector<value_type> data;
+		const value_type values[] = { a, b, c, d, e, f, g, h, i, j };
+		for (size_type n = 0; n < 300; ++n)
+			data.push_back(values[(n * 7919) % 10]);
+
+		int calls = 0;
+		int budget = 0;
+		auto limited = [&](const_reference x, const_reference y) {
+			if (calls++ == budget)
+				throw std::runtime_error("comparison failed");
+			return x < y;
+		};
+
+		for (int limit : { 0, 1, 7, 150, 1000 }) {
+			calls = 0;
+			budget = limit;
+
+			collection_type list(data.begin(), data.end());
+			EXPECT_THROW(list.sort(limited), std::runtime_error);
+
+			EXPECT_EQ(list.size(), data.size());
+			EXPECT_EQ(std::distance(list.begin(), list.end()), data.size());
+			EXPECT_TRUE(std::is_permutation(
+				list.begin(), list.end(), data.begin(), data.end()));
+		}
+
+		for (int limit : { 0, 1, 4, 7 }) {
+			calls = 0;
+			budget = limit;
+
+			collection_type list_1{ a, c, e, g, i };
+			collection_type list_2{ b, d, f, h, j };
+			EXPECT_THROW(list_1.merge(list_2, limited), std::runtime_error);
+
+			EXPECT_EQ(list_1.size() + list_2.size(), 10);
+			EXPECT_EQ(std::distance(list_1.begin(), list_1.end()), list_1.size());
+			EXPECT_EQ(std::distance(list_2.begin(), list_2.end()), list_2.size());
+			EXPECT_TRUE(std::is_sorted(list_1.begin(), list_1.end()));
+			EXPECT_TRUE(std::is_sorted(list_2.begin(), list_2.end()));
+		}
+	}
+
+	REGISTER_TYPED_TEST_SUITE_P(
+		ListAlgorithmTests,
+		SortOrdersElementsAscending,
+		SortWithComparatorIsStable,
+		SortHandlesTrivialListsAndKeepsListUsable,
+		SortProducesSortedPermutationOfLargeList,
+		MergeCombinesSortedListsAndEmptiesOther,
+		MergeHandlesEmptyListsAndEqualElements,
+		UniqueRemovesConsecutiveDuplicates,
+		ReverseReversesElementOrder,
+		ThrowingComparisonKeepsEveryElement
+	);
+}
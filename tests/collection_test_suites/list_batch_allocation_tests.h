@@ -0,0 +1,267 @@
+/* ============================================================================
+* Copyright (C) 2023 Ryan Eubank
+*
+* This program is free software: you can redistribute it and/or modify
+* it under the terms of the GNU General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License
+* along with this program.  If not, see <https://www.gnu.org/licenses/>.
+* ========================================================================= */
+
+
+#pragma once
+
+#include <algorithm>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <thread>
+#include <vector>
+#include <gtest/gtest.h>
+#include "collection_test_fixture.h"
+
+namespace collection_tests {
+
+	template <class T>
+	using ListBatchAllocationTests = CollectionTest<T>;
+
+	TYPED_TEST_SUITE_P(ListBatchAllocationTests);
+
+	// -------------------------------------------------------------------------
+	/// <summary>
+	/// Returns true if the elements of the given list are laid out one node 
+	/// after another in memory.
+	/// </summary> -------------------------------------------------------------
+	template <class list_t>
+	bool isContiguous(const list_t& list) {
+		using node_type = list_t::node_type;
+		const char* last = nullptr;
+
+		for (const auto& element : list) {
+			auto address = reinterpret_cast<const char*>(std::addressof(element));
+			if (last && address - last != sizeof(node_type))
+				return false;
+			last = address;
+		}
+
+		return true;
+	}
+
+	// -------------------------------------------------------------------------
+	/// <summary>
+	/// Returns the shortest run of elements the given list type allocates as
+	/// one batch, cycling through the given values.
+	/// </summary> -------------------------------------------------------------
+	template <class list_t>
+	std::vector<typename list_t::value_type> batchOf(
+		std::initializer_list<typename list_t::value_type> values
+	) {
+		using batches = NodeBatches<
+			typename list_t::node_type, 
+			typename list_t::allocator_type
+		>;
+
+		std::vector<typename list_t::value_type> batch;
+		while (batch.size() < batches::MIN_BATCH)
+			batch.push_back(values.begin()[batch.size() % values.size()]);
+
+		return batch;
+	}
+
+	// -------------------------------------------------------------------------
+	/// <summary>
+	/// Tests that constructing a list from a sized range or copying a list 
+	/// places its nodes contiguously in memory, while shorter ranges are 
+	/// still built correctly from nodes allocated one at a time.
+	/// </summary> -------------------------------------------------------------
+	TYPED_TEST_P(
+		ListBatchAllocationTests, 
+		RangeConstructionAllocatesNodesContiguously
+	) {
+		FORWARD_TEST_TYPES();
+		DECLARE_TEST_DATA();
+
+		auto data = batchOf<collection_type>({ a, b, c, d, e, f, g, h, i, j });
+		collection_type list(data.begin(), data.end());
+		collection_type copy(list);
+
+		EXPECT_TRUE(isContiguous(list));
+		EXPECT_TRUE(isContiguous(copy));
+		this->expectSequence(copy.begin(), copy.end(), data);
+
+		data.push_back(a);
+		collection_type longer(data.begin(), data.end());
+		this->expectSequence(longer.begin(), longer.end(), data);
+
+		auto few = { a, b, c, d, e, f, g, h, i, j };
+		collection_type shorter(few.begin(), few.end());
+		this->expectSequence(shorter.begin(), shorter.end(), few);
+	}
+
+	// -------------------------------------------------------------------------
+	/// <summary>
+	/// Tests that elements of a batch allocated list can be removed one at a
+	/// time and replaced with individually allocated elements.
+	/// </summary> -------------------------------------------------------------
+	TYPED_TEST_P(
+		ListBatchAllocationTests, 
+		BatchAllocatedElementsCanBeRemovedIndividually
+	) {
+		FORWARD_TEST_TYPES();
+		DECLARE_TEST_DATA();
+
+		auto expected = batchOf<collection_type>({ a, b, c, d, e, f, g, h, i, j });
+		collection_type list(expected.begin(), expected.end());
+
+		list.removeFront();
+		list.remove(std::next(list.begin(), 3));
+		list.removeBack();
+		list.insertFront(j);
+		list.insertBack(a);
+
+		expected.erase(expected.begin());
+		expected.erase(std::next(expected.begin(), 3));
+		expected.pop_back();
+		expected.insert(expected.begin(), j);
+		expected.push_back(a);
+		this->expectSequence(list.begin(), list.end(), expected);
+
+		while (!list.isEmpty())
+			list.removeFront();
+
+		list.insert(list.end(), expected.begin(), expected.end());
+		this->expectSequence(list.begin(), list.end(), expected);
+	}
+
+	// -------------------------------------------------------------------------
+	/// <summary>
+	/// Tests that nodes spliced and merged out of a batch allocated list stay
+	/// valid after the source list is destroyed.
+	/// </summary> -------------------------------------------------------------
+	TYPED_TEST_P(
+		ListBatchAllocationTests, 
+		BatchAllocatedNodesOutliveTheirSourceList
+	) {
+		FORWARD_TEST_TYPES();
+		DECLARE_TEST_DATA();
+
+		auto data = batchOf<collection_type>({ a, b, c, d, e, f, g, h, i, j });
+		auto sorted = batchOf<collection_type>({ b, d, f, h, i, j, j, j });
+		std::sort(sorted.begin(), sorted.end());
+
+		collection_type spliced{ a };
+		collection_type merged{ c, e };
+
+		{
+			collection_type source(data.begin(), data.end());
+			spliced.splice(
+				spliced.begin(), 
+				source, 
+				source.begin(), 
+				std::next(source.begin(), 3)
+			);
+
+			collection_type remainder(sorted.begin(), sorted.end());
+			merged.merge(remainder);
+		}
+
+		std::vector<value_type> expected_1(data.begin(), data.begin() + 3);
+		expected_1.push_back(a);
+
+		std::vector<value_type> expected_2;
+		auto initial = { c, e };
+		std::merge(
+			initial.begin(), initial.end(), 
+			sorted.begin(), sorted.end(), 
+			std::back_inserter(expected_2)
+		);
+
+		this->expectSequence(spliced.begin(), spliced.end(), expected_1);
+		this->expectSequence(merged.begin(), merged.end(), expected_2);
+
+		spliced.removeFront();
+		merged.clear();
+		merged = spliced;
+
+		expected_1.erase(expected_1.begin());
+		this->expectSequence(merged.begin(), merged.end(), expected_1);
+	}
+
+	// -------------------------------------------------------------------------
+	/// <summary>
+	/// Tests that moving and swapping batch allocated lists transfers the 
+	/// ownership of their nodes.
+	/// </summary> -------------------------------------------------------------
+	TYPED_TEST_P(
+		ListBatchAllocationTests, 
+		MoveAndSwapTransferBatchAllocatedNodes
+	) {
+		FORWARD_TEST_TYPES();
+		DECLARE_TEST_DATA();
+
+		auto values = batchOf<collection_type>({ a, b, c, d, e, f, g, h, i, j });
+		collection_type list_1(values.begin(), values.end());
+		collection_type list_2{ j };
+
+		swap(list_1, list_2);
+		collection_type list_3(std::move(list_2));
+		list_2 = std::move(list_1);
+		list_3.removeFront();
+
+		values.erase(values.begin());
+		this->expectSequence(list_3.begin(), list_3.end(), values);
+		EXPECT_EQ(list_2.size(), 1);
+	}
+
+	// -------------------------------------------------------------------------
+	/// <summary>
+	/// Tests that lists splitting the nodes of one batch can release them 
+	/// from different threads.
+	/// </summary> -------------------------------------------------------------
+	TYPED_TEST_P(
+		ListBatchAllocationTests, 
+		SplitBatchesCanBeReleasedFromSeveralThreads
+	) {
+		FORWARD_TEST_TYPES();
+		DECLARE_TEST_DATA();
+
+		auto data = batchOf<collection_type>({ a, b, c, d, e, f, g, h, i, j });
+
+		for (int round = 0; round < 100; ++round) {
+			collection_type source(data.begin(), data.end());
+			collection_type front;
+			collection_type back;
+
+			front.splice(
+				front.begin(), 
+				source, 
+				source.begin(), 
+				std::next(source.begin(), 5)
+			);
+			back.splice(back.begin(), source, source.begin(), source.end());
+
+			std::thread worker([&front]() { front.clear(); });
+			back.clear();
+			worker.join();
+
+			EXPECT_TRUE(front.isEmpty());
+			EXPECT_TRUE(back.isEmpty());
+		}
+	}
+
+	REGISTER_TYPED_TEST_SUITE_P(
+		ListBatchAllocationTests,
+		RangeConstructionAllocatesNodesContiguously,
+		BatchAllocatedElementsCanBeRemovedIndividually,
+		BatchAllocatedNodesOutliveTheirSourceList,
+		MoveAndSwapTransferBatchAllocatedNodes,
+		SplitBatchesCanBeReleasedFromSeveralThreads
+	);
+}
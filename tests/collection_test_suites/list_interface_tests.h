@@ -18,6 +18,11 @@
 #pragma once
 
 #include <gtest/gtest.h>
+
+#include "algorithms/copy.h"
+#include "algorithms/index.h"
+#include "algorithms/search.h"
+#include "util/prefetch.h"
 #include "collection_test_fixture.h"
 
 namespace collection_tests {
@@ -186,6 +191,46 @@ namespace collection_tests {
 		this->expectSequence(list.begin(), list.end(), expected);
 	}
 
+	// -------------------------------------------------------------------------
+	/// <summary>
+	/// Tests that the prefetching search and copy algorithms return the same
+	/// results over the list's iterators as a plain traversal would.
+	/// </summary> -------------------------------------------------------------
+	TYPED_TEST_P(
+		ListInterfaceTests, 
+		PrefetchingAlgorithmsTraverseListCorrectly
+	) {
+		FORWARD_TEST_TYPES();
+		DECLARE_TEST_DATA();
+
+		static_assert(prefetchable<typename collection_type::iterator>);
+		static_assert(prefetchable<typename collection_type::const_iterator>);
+
+		collection_type list{a, b, c, d, e};
+		auto expected = { a, b, c, d, e };
+		auto isD = [&](const value_type& value) { return value == d; };
+		auto third = std::next(list.begin(), 2);
+		auto fourth = std::next(list.begin(), 3);
+
+		EXPECT_EQ(collections::find(prefetching, list, c), third);
+		EXPECT_EQ(collections::find(prefetching, list, f), list.end());
+		EXPECT_EQ(collections::find_if(prefetching, list, isD), fourth);
+		EXPECT_EQ(collections::index_of(prefetching, list, e), 4);
+		EXPECT_EQ(collections::index_of(prefetching, list, f), -1);
+
+		EXPECT_EQ(collections::find(list, c), third);
+		EXPECT_EQ(collections::find_if(list, isD), fourth);
+		EXPECT_EQ(collections::index_of(list, e), 4);
+
+		std::vector<value_type> copied;
+		collections::copy(prefetching, list, std::back_inserter(copied));
+		this->expectSequence(copied.begin(), copied.end(), expected);
+
+		copied.clear();
+		collections::copy(list, std::back_inserter(copied));
+		this->expectSequence(copied.begin(), copied.end(), expected);
+	}
+
 	REGISTER_TYPED_TEST_SUITE_P(
 		ListInterfaceTests,
 		SpliceFromDifferentListCorrectlySplicesAtBeginningOfTargetList,
@@ -193,6 +238,7 @@ namespace collection_tests {
 		SpliceFromDifferentListCorrectlySplicesAtEndOfTargetList,
 		SpliceFromSameListCorrectlySplicesAtBeginningOfList,
 		SpliceFromSameListCorrectlySplicesIntoMiddleOfList,
-		SpliceFromSameListCorrectlySplicesAtEndOfList
+		SpliceFromSameListCorrectlySplicesAtEndOfList,
+		PrefetchingAlgorithmsTraverseListCorrectly
 	);
 }
\ No newline at end of file
@@ -0,0 +1,150 @@
+/* ============================================================================
+* Copyright (C) 2023 Ryan Eubank
+*
+* This program is free software: you can redistribute it and/or modify
+* it under the terms of the GNU General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License
+* along with this program.  If not, see <https://www.gnu.org/licenses/>.
+* ========================================================================= */
+
+
+#pragma once
+
+#include <algorithm>
+#include <memory>
+#include <vector>
+#include <gtest/gtest.h>
+#include "collection_test_fixture.h"
+
+namespace collection_tests {
+
+	template <class T>
+	using ListNodeRecyclingTests = CollectionTest<T>;
+
+	TYPED_TEST_SUITE_P(ListNodeRecyclingTests);
+
+	// -------------------------------------------------------------------------
+	/// <summary>
+	/// Returns the sorted addresses of the elements in the given list.
+	/// </summary> -------------------------------------------------------------
+	template <class list_t>
+	std::vector<const void*> elementAddresses(const list_t& list) {
+		std::vector<const void*> addresses;
+
+		for (const auto& element : list)
+			addresses.push_back(std::addressof(element));
+
+		std::ranges::sort(addresses);
+		return addresses;
+	}
+
+	// -------------------------------------------------------------------------
+	/// <summary>
+	/// Tests that once nodes are reserved, clearing and refilling the list 
+	/// reuses the same nodes for both single and range inserts.
+	/// </summary> -------------------------------------------------------------
+	TYPED_TEST_P(
+		ListNodeRecyclingTests, 
+		ClearedNodesAreReusedByLaterInserts
+	) {
+		FORWARD_TEST_TYPES();
+		DECLARE_TEST_DATA();
+
+		auto values = { a, b, c, d, e, f, g, h, i, j };
+		collection_type list;
+		list.reserveNodes(values.size());
+
+		for (const auto& value : values)
+			list.insertBack(value);
+
+		auto reserved = elementAddresses(list);
+		list.clear();
+
+		list.insert(list.end(), values.begin(), values.end());
+		EXPECT_EQ(elementAddresses(list), reserved);
+		this->expectSequence(list.begin(), list.end(), values);
+
+		while (!list.isEmpty())
+			list.removeFront();
+
+		for (const auto& value : values)
+			list.insertFront(value);
+
+		EXPECT_EQ(elementAddresses(list), reserved);
+	}
+
+	// -------------------------------------------------------------------------
+	/// <summary>
+	/// Tests that the cache parks no more nodes than were reserved and that 
+	/// released nodes are not handed out again.
+	/// </summary> -------------------------------------------------------------
+	TYPED_TEST_P(
+		ListNodeRecyclingTests, 
+		RecyclingIsBoundedByTheReservedCount
+	) {
+		FORWARD_TEST_TYPES();
+		DECLARE_TEST_DATA();
+
+		collection_type list{ a, b };
+		list.reserveNodes(2);
+
+		list.insertBack(c);
+		list.insertBack(d);
+		list.clear();
+
+		list.insertBack(e);
+		list.insertBack(f);
+		list.insertBack(g);
+		list.releaseNodes();
+		list.removeFront();
+
+		auto expected = { f, g };
+		this->expectSequence(list.begin(), list.end(), expected);
+	}
+
+	// -------------------------------------------------------------------------
+	/// <summary>
+	/// Tests that parked nodes move and swap together with the list's own
+	/// nodes.
+	/// </summary> -------------------------------------------------------------
+	TYPED_TEST_P(
+		ListNodeRecyclingTests, 
+		MoveAndSwapTransferParkedNodes
+	) {
+		FORWARD_TEST_TYPES();
+		DECLARE_TEST_DATA();
+
+		auto values = { a, b, c, d, e, f, g, h, i, j };
+		collection_type list_1;
+		collection_type list_2{ j };
+
+		list_1.reserveNodes(values.size());
+		list_1.insert(list_1.end(), values.begin(), values.end());
+		list_1.clear();
+
+		swap(list_1, list_2);
+		collection_type list_3(std::move(list_2));
+		list_2 = std::move(list_1);
+
+		list_3.insert(list_3.end(), values.begin(), values.end());
+		list_2.clear();
+
+		this->expectSequence(list_3.begin(), list_3.end(), values);
+		EXPECT_TRUE(list_2.isEmpty());
+	}
+
+	REGISTER_TYPED_TEST_SUITE_P(
+		ListNodeRecyclingTests,
+		ClearedNodesAreReusedByLaterInserts,
+		RecyclingIsBoundedByTheReservedCount,
+		MoveAndSwapTransferParkedNodes
+	);
+}
@@ -25,6 +25,7 @@
 #include "../../collection_test_suites/access_tests/associative_search_tests.h"
 #include "../../collection_test_suites/access_tests/bag_tests.h"
 #include "../../collection_test_suites/access_tests/map_tests.h"
+#include "../../collection_test_suites/access_tests/order_statistic_tests.h"
 
 namespace collection_tests {
 
@@ -45,6 +46,13 @@ namespace collection_tests {
 		MultiMapAVL<uint8_t, std::string>
 	>;
 
+	using ranked_test_params = testing::Types<
+		RankedAVL<std::string>,
+		RankedMapAVL<uint8_t, std::string>,
+		RankedMultiAVL<std::string>,
+		RankedMultiMapAVL<uint8_t, std::string>
+	>;
+
 	INSTANTIATE_TYPED_TEST_SUITE_P(
 		AVLTreeTest,
 		AssociativeSearchTests,
@@ -69,4 +77,10 @@ namespace collection_tests {
 		MapTests,
 		map_test_params
 	);
+
+	INSTANTIATE_TYPED_TEST_SUITE_P(
+		AVLTreeTest,
+		OrderStatisticTests,
+		ranked_test_params
+	);
 }
\ No newline at end of file
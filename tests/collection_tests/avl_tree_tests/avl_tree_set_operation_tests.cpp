@@ -0,0 +1,379 @@
+/* ============================================================================
+* Copyright (C) 2023 Ryan Eubank
+*
+* This program is free software: you can redistribute it and/or modify
+* it under the terms of the GNU General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License
+* along with this program.  If not, see <https://www.gnu.org/licenses/>.
+* ========================================================================= */
+
+#include <algorithm>
+#include <atomic>
+#include <climits>
+#include <cmath>
+#include <iterator>
+#include <numeric>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "containers/AVLTree.h"
+
+#include "../../collection_test_suites/collection_test_fixture.h"
+
+namespace collection_tests {
+
+	using namespace collections;
+
+	// orders ints until the shared budget of comparisons runs out, then 
+	// throws from every comparison.
+	struct budgeted_less {
+		static inline std::atomic<long> budget = LONG_MAX;
+
+		bool operator()(int a, int b) const {
+			if (budget.fetch_sub(1, std::memory_order_relaxed) <= 0)
+				throw std::runtime_error("Out of comparisons.");
+			return a < b;
+		}
+	};
+
+	using BudgetedAVL = AVLTree<int, budgeted_less, std::allocator<int>, false>;
+
+	class AVLTreeSetOperationTest : public CollectionTest<SimpleAVL<int>> {
+	protected:
+		std::vector<int> randomElements(std::size_t count, int max, unsigned seed) {
+			std::mt19937 rng(seed);
+			std::uniform_int_distribution<int> dist(0, max);
+			std::vector<int> elements(count);
+
+			for (int& element : elements)
+				element = dist(rng);
+
+			std::ranges::sort(elements);
+			auto duplicates = std::ranges::unique(elements);
+			elements.erase(duplicates.begin(), duplicates.end());
+
+			std::ranges::shuffle(elements, rng);
+			return elements;
+		}
+
+		template <class tree_t>
+		void expectBalanced(const tree_t& tree) {
+			auto limit = 1.4405 * std::log2(static_cast<double>(tree.size() + 2));
+			EXPECT_LE(static_cast<double>(tree.height()), limit);
+			EXPECT_TRUE(std::is_sorted(tree.begin(), tree.end()));
+			EXPECT_EQ(std::distance(tree.begin(), tree.end()), tree.size());
+
+			if (!tree.isEmpty()) {
+				EXPECT_EQ(*tree.minimum(), *tree.begin());
+				EXPECT_EQ(*tree.maximum(), *std::prev(tree.end()));
+			}
+		}
+
+		void expectElements(const auto& tree, const std::vector<int>& expected) {
+			expectBalanced(tree);
+			EXPECT_TRUE(std::equal(
+				tree.begin(), tree.end(), expected.begin(), expected.end()));
+		}
+	};
+
+	TEST_F(AVLTreeSetOperationTest, SplitMovesElementsFromKeyOnwards) {
+		std::vector<int> elements(100);
+		std::iota(elements.begin(), elements.end(), 0);
+		std::ranges::shuffle(elements, std::mt19937(7));
+
+		SimpleAVL<int> tree(elements.begin(), elements.end());
+		SimpleAVL<int> upper = tree.split(40);
+
+		std::vector<int> expectedLower(40), expectedUpper(60);
+		std::iota(expectedLower.begin(), expectedLower.end(), 0);
+		std::iota(expectedUpper.begin(), expectedUpper.end(), 40);
+
+		expectElements(tree, expectedLower);
+		expectElements(upper, expectedUpper);
+
+		// both halves keep working as ordinary trees
+		tree.insert(100);
+		upper.remove(upper.find(40));
+		upper.insert(-1);
+
+		EXPECT_EQ(tree.size(), 41);
+		EXPECT_EQ(*tree.maximum(), 100);
+		EXPECT_EQ(upper.size(), 60);
+		EXPECT_EQ(*upper.minimum(), -1);
+		expectBalanced(tree);
+		expectBalanced(upper);
+	}
+
+	TEST_F(AVLTreeSetOperationTest, SplitHandlesKeysOutsideTheTree) {
+		SimpleAVL<int> tree{ 2, 4, 6, 8 };
+
+		SimpleAVL<int> all = tree.split(0);
+		EXPECT_TRUE(tree.isEmpty());
+		expectElements(all, { 2, 4, 6, 8 });
+
+		SimpleAVL<int> none = all.split(9);
+		EXPECT_TRUE(none.isEmpty());
+		expectElements(all, { 2, 4, 6, 8 });
+
+		SimpleAVL<int> missing = all.split(5);
+		expectElements(all, { 2, 4 });
+		expectElements(missing, { 6, 8 });
+	}
+
+	TEST_F(AVLTreeSetOperationTest, SplitMovesEveryDuplicateOfKey) {
+		MultiAVL<int> tree{ 1, 3, 3, 3, 2, 5, 3, 4 };
+		MultiAVL<int> upper = tree.split(3);
+
+		EXPECT_EQ(tree.size(), 2);
+		EXPECT_EQ(upper.size(), 6);
+		EXPECT_EQ(upper.count(3), 4);
+		EXPECT_EQ(*tree.maximum(), 2);
+		EXPECT_EQ(*upper.minimum(), 3);
+	}
+
+	TEST_F(AVLTreeSetOperationTest, SplitKeepsRanksOfBothHalves) {
+		std::vector<int> elements(64);
+		std::iota(elements.begin(), elements.end(), 0);
+
+		RankedAVL<int> tree(elements.begin(), elements.end());
+		RankedAVL<int> upper = tree.split(20);
+
+		ASSERT_EQ(tree.size(), 20);
+		ASSERT_EQ(upper.size(), 44);
+
+		for (int i = 0; i < 20; ++i)
+			EXPECT_EQ(*tree.nth(i), i);
+
+		for (int i = 0; i < 44; ++i)
+			EXPECT_EQ(*upper.nth(i), i + 20);
+	}
+
+	TEST_F(AVLTreeSetOperationTest, ThrowingSplitKeepsTree) {
+		std::vector<int> ordered(200);
+		std::iota(ordered.begin(), ordered.end(), 0);
+
+		std::vector<int> elements = ordered;
+		std::ranges::shuffle(elements, std::mt19937(13));
+
+		for (long budget : { 0L, 3L, 6L }) {
+			BudgetedAVL tree(elements.begin(), elements.end());
+
+			budgeted_less::budget = budget;
+			EXPECT_THROW(static_cast<void>(tree.split(150)), std::runtime_error);
+			budgeted_less::budget = LONG_MAX;
+
+			expectElements(tree, ordered);
+
+			BudgetedAVL upper = tree.split(150);
+			EXPECT_EQ(tree.size(), 150);
+			EXPECT_EQ(upper.size(), 50);
+		}
+	}
+
+	TEST_F(AVLTreeSetOperationTest, JoinLinksTreesOfDifferentHeights) {
+		std::vector<int> large(1000);
+		std::iota(large.begin(), large.end(), 11);
+
+		SimpleAVL<int> lower{ 3, 1, 2 };
+		SimpleAVL<int> upper(large.begin(), large.end());
+		SimpleAVL<int> joined = SimpleAVL<int>::join(lower, 10, upper);
+
+		std::vector<int> expected = { 1, 2, 3, 10 };
+		expected.insert(expected.end(), large.begin(), large.end());
+		expectElements(joined, expected);
+
+		SimpleAVL<int> mirrored = SimpleAVL<int>::join(
+			SimpleAVL<int>(large.begin(), large.end() - 1),
+			2000,
+			SimpleAVL<int>{ 2001 }
+		);
+
+		EXPECT_EQ(mirrored.size(), 1001);
+		EXPECT_EQ(*mirrored.maximum(), 2001);
+		expectBalanced(mirrored);
+	}
+
+	TEST_F(AVLTreeSetOperationTest, JoinWithoutElementConcatenatesTrees) {
+		SimpleAVL<int> lower{ 1, 2, 3, 4, 5, 6, 7 };
+		SimpleAVL<int> joined = SimpleAVL<int>::join(std::move(lower), SimpleAVL<int>{ 9 });
+
+		expectElements(joined, { 1, 2, 3, 4, 5, 6, 7, 9 });
+		expectElements(SimpleAVL<int>::join(SimpleAVL<int>{}, SimpleAVL<int>{ 1 }), { 1 });
+		expectElements(SimpleAVL<int>::join(SimpleAVL<int>{ 1 }, SimpleAVL<int>{}), { 1 });
+	}
+
+	TEST_F(AVLTreeSetOperationTest, JoinRejectsTreesOutOfOrder) {
+		SimpleAVL<int> lower{ 1, 5 };
+		SimpleAVL<int> upper{ 3, 9 };
+
+		EXPECT_THROW(SimpleAVL<int>::join(lower, 2, upper), std::invalid_argument);
+		EXPECT_THROW(SimpleAVL<int>::join(lower, 5, SimpleAVL<int>{}), std::invalid_argument);
+		EXPECT_THROW(SimpleAVL<int>::join(lower, upper), std::invalid_argument);
+
+		MultiAVL<int> joined = MultiAVL<int>::join(MultiAVL<int>{ 1, 5 }, 5, MultiAVL<int>{ 5 });
+		EXPECT_EQ(joined.count(5), 3);
+	}
+
+	TEST_F(AVLTreeSetOperationTest, SetOperationsMatchSortedSetAlgorithms) {
+		auto first = randomElements(3000, 10000, 1);
+		auto second = randomElements(500, 10000, 2);
+
+		SimpleAVL<int> a(first.begin(), first.end());
+		SimpleAVL<int> b(second.begin(), second.end());
+
+		std::ranges::sort(first);
+		std::ranges::sort(second);
+
+		std::vector<int> unionOf, intersectionOf, differenceOf, reverseDifferenceOf;
+		std::ranges::set_union(first, second, std::back_inserter(unionOf));
+		std::ranges::set_intersection(first, second, std::back_inserter(intersectionOf));
+		std::ranges::set_difference(first, second, std::back_inserter(differenceOf));
+		std::ranges::set_difference(second, first, std::back_inserter(reverseDifferenceOf));
+
+		SimpleAVL<int> united = a;
+		united.unionWith(SimpleAVL<int>(b));
+		expectElements(united, unionOf);
+
+		SimpleAVL<int> reverseUnited = b;
+		reverseUnited.unionWith(SimpleAVL<int>(a));
+		expectElements(reverseUnited, unionOf);
+
+		SimpleAVL<int> intersected = a;
+		intersected.intersectionWith(SimpleAVL<int>(b));
+		expectElements(intersected, intersectionOf);
+
+		SimpleAVL<int> subtracted = a;
+		subtracted.differenceWith(SimpleAVL<int>(b));
+		expectElements(subtracted, differenceOf);
+
+		SimpleAVL<int> reverseSubtracted = b;
+		reverseSubtracted.differenceWith(std::move(a));
+		expectElements(reverseSubtracted, reverseDifferenceOf);
+
+		// the originals are untouched when copies are passed as the argument
+		expectElements(b, second);
+	}
+
+	TEST_F(AVLTreeSetOperationTest, SetOperationsHandleEmptyTrees) {
+		SimpleAVL<int> tree{ 1, 2, 3 };
+
+		tree.unionWith(SimpleAVL<int>{});
+		expectElements(tree, { 1, 2, 3 });
+
+		tree.differenceWith(SimpleAVL<int>{});
+		expectElements(tree, { 1, 2, 3 });
+
+		tree.intersectionWith(SimpleAVL<int>{});
+		expectElements(tree, {});
+
+		tree.unionWith(SimpleAVL<int>{ 4, 5 });
+		expectElements(tree, { 4, 5 });
+	}
+
+	TEST_F(AVLTreeSetOperationTest, UnionKeepsExistingMappedValues) {
+		MapAVL<int, std::string> tree{ {1, "a"}, {2, "b"}, {3, "c"} };
+		tree.unionWith(MapAVL<int, std::string>{ {2, "x"}, {4, "d"} });
+
+		ASSERT_EQ(tree.size(), 4);
+		EXPECT_EQ(tree.find(2)->value(), "b");
+		EXPECT_EQ(tree.find(4)->value(), "d");
+	}
+
+	TEST_F(AVLTreeSetOperationTest, UnionOfMultiTreesKeepsEveryElement) {
+		RankedMultiAVL<int> tree{ 1, 2, 2, 3 };
+		tree.unionWith(RankedMultiAVL<int>{ 2, 3, 3, 4 });
+
+		auto expected = { 1, 2, 2, 2, 3, 3, 3, 4 };
+
+		ASSERT_EQ(tree.size(), 8);
+		EXPECT_TRUE(std::equal(tree.begin(), tree.end(), expected.begin(), expected.end()));
+		EXPECT_EQ(tree.countInRange(2, 3), 6);
+		expectBalanced(tree);
+	}
+
+	TEST_F(AVLTreeSetOperationTest, ParallelSetOperationsMatchSequentialResults) {
+		auto first = randomElements(200000, 1000000, 3);
+		auto second = randomElements(150000, 1000000, 4);
+
+		RankedAVL<int> a(first.begin(), first.end());
+		RankedAVL<int> b(second.begin(), second.end());
+
+		auto expectSame = [&](const RankedAVL<int>& parallel, const RankedAVL<int>& sequential) {
+			ASSERT_EQ(parallel.size(), sequential.size());
+			EXPECT_TRUE(std::equal(
+				parallel.begin(), parallel.end(), sequential.begin(), sequential.end()));
+			expectBalanced(parallel);
+
+			for (std::size_t i = 0; i < parallel.size(); i += 997)
+				EXPECT_EQ(*parallel.nth(i), *sequential.nth(i));
+		};
+
+		RankedAVL<int> united = a, unitedInParallel = a;
+		united.unionWith(RankedAVL<int>(b));
+		unitedInParallel.unionWith(collections::parallel, RankedAVL<int>(b));
+		expectSame(unitedInParallel, united);
+
+		RankedAVL<int> intersected = a, intersectedInParallel = a;
+		intersected.intersectionWith(RankedAVL<int>(b));
+		intersectedInParallel.intersectionWith(collections::parallel, RankedAVL<int>(b));
+		expectSame(intersectedInParallel, intersected);
+
+		RankedAVL<int> subtracted = a, subtractedInParallel = a;
+		subtracted.differenceWith(RankedAVL<int>(b));
+		subtractedInParallel.differenceWith(collections::parallel, RankedAVL<int>(b));
+		expectSame(subtractedInParallel, subtracted);
+
+		RankedAVL<int> sequenced = a;
+		sequenced.unionWith(collections::serial, RankedAVL<int>(b));
+		expectSame(sequenced, united);
+	}
+
+	TEST_F(AVLTreeSetOperationTest, SetOperationsDestroyBothTreesWhenComparisonThrows) {
+		auto first = randomElements(20000, 100000, 5);
+		auto second = randomElements(20000, 100000, 6);
+
+		using operation = void (*)(BudgetedAVL&, BudgetedAVL&&);
+		operation operations[] = {
+			[](BudgetedAVL& t, BudgetedAVL&& o) { t.unionWith(std::move(o)); },
+			[](BudgetedAVL& t, BudgetedAVL&& o) { t.intersectionWith(std::move(o)); },
+			[](BudgetedAVL& t, BudgetedAVL&& o) { t.differenceWith(std::move(o)); },
+			[](BudgetedAVL& t, BudgetedAVL&& o) { 
+				t.unionWith(collections::parallel, std::move(o)); },
+			[](BudgetedAVL& t, BudgetedAVL&& o) { 
+				t.intersectionWith(collections::parallel, std::move(o)); },
+			[](BudgetedAVL& t, BudgetedAVL&& o) { 
+				t.differenceWith(collections::parallel, std::move(o)); },
+		};
+
+		for (operation op : operations) {
+			for (long budget : { 0L, 1L, 50L, 5000L }) {
+				BudgetedAVL tree(first.begin(), first.end());
+				BudgetedAVL other(second.begin(), second.end());
+
+				budgeted_less::budget = budget;
+				EXPECT_THROW(op(tree, std::move(other)), std::runtime_error);
+				budgeted_less::budget = LONG_MAX;
+
+				// the nodes of both trees are destroyed, which the leak 
+				// checks of sanitized builds also confirm.
+				EXPECT_TRUE(tree.isEmpty());
+				EXPECT_TRUE(other.isEmpty());
+
+				tree.insert(1);
+				EXPECT_EQ(tree.size(), 1);
+			}
+		}
+	}
+}
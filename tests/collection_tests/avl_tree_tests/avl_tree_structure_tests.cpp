@@ -15,8 +15,11 @@
 * along with this program.  If not, see <https://www.gnu.org/licenses/>.
 * ========================================================================= */
 
+#include <algorithm>
+#include <numeric>
 #include <string>
 #include <utility>
+#include <vector>
 #include <gtest/gtest.h>
 
 #include "adapters/TreeTraversalAdapters.h"
@@ -752,4 +755,103 @@ namespace collection_tests {
 		this->expectSequence(tree.begin<traversal_order::PRE_ORDER>(), tree.end(), preOrder);
 	}
 
-}
\ No newline at end of file
+	TEST_F(AVLTreeStructureTest, SortedRangeBuildsBalancedTree) {
+
+		// Expected Structure:
+		//
+		//          (3)
+		//        /     \
+		//      (1)     (5)
+		//        \    /   \
+		//        (2) (4)  (6)
+
+		std::vector<int> elements = { 1, 2, 3, 4, 5, 6 };
+		SimpleAVL<int> tree(elements.begin(), elements.end());
+
+		EXPECT_EQ(*tree.root(), 3);
+		EXPECT_EQ(*tree.minimum(), 1);
+		EXPECT_EQ(*tree.maximum(), 6);
+
+		auto preOrder = { 3, 1, 2, 5, 4, 6 };
+		auto inOrderHeights = { 1, 0, 2, 0, 1, 0 };
+
+		this->expectSequence(tree.begin<traversal_order::PRE_ORDER>(), tree.end(), preOrder);
+		this->expectInOrderNodeHeights(tree, inOrderHeights);
+
+		// the built tree must keep rebalancing correctly afterwards
+		tree.insert(7);
+		tree.insert(8);
+		tree.remove(tree.find(1));
+
+		auto preOrderAfter = { 5, 3, 2, 4, 7, 6, 8 };
+		auto inOrderHeightsAfter = { 0, 1, 0, 2, 0, 1, 0 };
+
+		this->expectSequence(tree.begin<traversal_order::PRE_ORDER>(), tree.end(), preOrderAfter);
+		this->expectInOrderNodeHeights(tree, inOrderHeightsAfter);
+	}
+
+	TEST_F(AVLTreeStructureTest, SortedRangeBuildsLargeTreeWithMinimalHeight) {
+		constexpr int count = (1 << 16) - 1;
+
+		std::vector<int> elements(count);
+		std::iota(elements.begin(), elements.end(), 0);
+
+		SimpleAVL<int> tree(elements.begin(), elements.end());
+
+		ASSERT_EQ(tree.size(), count);
+		EXPECT_EQ(tree.height(), 15);
+		EXPECT_TRUE(std::equal(tree.begin(), tree.end(), elements.begin(), elements.end()));
+
+		for (int i = 0; i < count; i += 2)
+			tree.remove(tree.find(i));
+
+		EXPECT_EQ(tree.size(), count / 2);
+		EXPECT_EQ(*tree.minimum(), 1);
+		EXPECT_EQ(*tree.maximum(), count - 2);
+		EXPECT_TRUE(std::is_sorted(tree.begin(), tree.end()));
+	}
+
+	TEST_F(AVLTreeStructureTest, SortedRangeBuildsRankedTree) {
+		std::vector<int> elements(100);
+		std::iota(elements.begin(), elements.end(), 0);
+
+		RankedAVL<int> tree(elements.begin(), elements.end());
+
+		for (int i = 0; i < 100; ++i)
+			EXPECT_EQ(*tree.nth(i), i);
+
+		EXPECT_EQ(tree.countInRange(10, 19), 10);
+		EXPECT_EQ(tree.rankOf(50), 50);
+	}
+
+	TEST_F(AVLTreeStructureTest, CopyPreservesTreeStructure) {
+		SimpleAVL<int> tree{ 8, 3, 10, 1, 6, 14, 4, 7, 13 };
+		SimpleAVL<int> copy(tree);
+
+		EXPECT_TRUE(std::equal(
+			copy.begin<traversal_order::PRE_ORDER>(), copy.end(), 
+			tree.begin<traversal_order::PRE_ORDER>(), tree.end()
+		));
+
+		std::vector<std::size_t> heights, copiedHeights;
+
+		for (auto pos = tree.begin(); pos != tree.end(); ++pos)
+			heights.push_back(tree.heightOf(pos));
+
+		for (auto pos = copy.begin(); pos != copy.end(); ++pos)
+			copiedHeights.push_back(copy.heightOf(pos));
+
+		EXPECT_EQ(heights, copiedHeights);
+
+		using tree_type = MultiMapAVL<int, std::string>;
+		tree_type multimap{ {1, "1a"}, {1, "1b"}, {1, "1c"}, {2, "2a"} };
+		tree_type assigned;
+		assigned = multimap;
+
+		EXPECT_TRUE(std::equal(
+			assigned.begin<traversal_order::PRE_ORDER>(), assigned.end(), 
+			multimap.begin<traversal_order::PRE_ORDER>(), multimap.end()
+		));
+	}
+
+}
@@ -15,8 +15,16 @@
 * along with this program.  If not, see <https://www.gnu.org/licenses/>.
 * ========================================================================= */
 
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <numeric>
+#include <random>
+#include <ranges>
 #include <string>
 #include <utility>
+#include <vector>
 #include <gtest/gtest.h>
 
 #include "adapters/TreeTraversalAdapters.h"
@@ -483,4 +491,176 @@ namespace collection_tests {
 		this->expectSequence(tree.begin<traversal_order::POST_ORDER>(), tree.end(), postOrder);
 		this->expectSequence(tree.begin<traversal_order::LEVEL_ORDER>(), tree.end(), levelOrder);
 	}
+
+	TEST_F(BinarySearchTreeStructureTest, LevelOrderTraversesLargeTreeBreadthFirst) {
+		// inserting a perfect tree level by level makes the insertion order 
+		// its level order.
+		constexpr int depth = 16;
+		constexpr int count = (1 << depth) - 1;
+
+		std::vector<int> levelOrder;
+		levelOrder.reserve(count);
+
+		for (int level = 0; level < depth; ++level) {
+			int step = 1 << (depth - level);
+
+			for (int key = step / 2; key < count + 1; key += step)
+				levelOrder.push_back(key);
+		}
+
+		SimpleBST<int> tree(levelOrder.begin(), levelOrder.end());
+		ASSERT_EQ(tree.size(), count);
+
+		this->expectSequence(
+			tree.begin<traversal_order::LEVEL_ORDER>(), 
+			tree.end<traversal_order::LEVEL_ORDER>(), 
+			levelOrder
+		);
+
+		this->expectSequence(
+			tree.rbegin<traversal_order::LEVEL_ORDER>(), 
+			tree.rend<traversal_order::LEVEL_ORDER>(), 
+			levelOrder | std::views::reverse
+		);
+
+		std::vector<int> adapted;
+		for (int key : collections::levelOrder(tree))
+			adapted.push_back(key);
+
+		EXPECT_EQ(adapted, levelOrder);
+	}
+
+	TEST_F(BinarySearchTreeStructureTest, LevelOrderIteratorsMoveInBothDirections) {
+		/*
+						     (5)
+						    /   \
+						  (3)	(8)
+						 /   \    \
+						(1)  (4)   (9)
+		*/
+
+		SimpleBST<int> tree = { 5, 3, 8, 1, 4, 9 };
+
+		auto it = tree.begin<traversal_order::LEVEL_ORDER>();
+		auto copy = it;
+
+		EXPECT_EQ(*++it, 3);
+		EXPECT_EQ(*++it, 8);
+		EXPECT_EQ(*copy, 5);
+		EXPECT_EQ(*++copy, 3);
+		EXPECT_EQ(*--it, 3);
+		EXPECT_EQ(*--it, 5);
+		EXPECT_EQ(it, tree.begin<traversal_order::LEVEL_ORDER>());
+
+		auto last = tree.end<traversal_order::LEVEL_ORDER>();
+		EXPECT_EQ(*--last, 9);
+		EXPECT_EQ(*--last, 4);
+		EXPECT_EQ(*++last, 9);
+		EXPECT_EQ(++last, tree.end());
+
+		SimpleBST<int>::const_level_order_iterator constIt = it;
+		EXPECT_EQ(*constIt, 5);
+
+		auto middle = ++tree.begin<traversal_order::LEVEL_ORDER>();
+		auto ahead = middle;
+		++ahead;
+
+		EXPECT_EQ(*++ahead, 1);
+		EXPECT_EQ(*++middle, 8);
+		EXPECT_EQ(*++middle, 1);
+		EXPECT_EQ(*++ahead, 4);
+		EXPECT_EQ(*++middle, 4);
+	}
+
+	// counts the allocations made through any of its rebound copies.
+	template <class T>
+	struct CountingAllocator {
+		using value_type = T;
+
+		std::shared_ptr<size_t> count = std::make_shared<size_t>(0);
+
+		CountingAllocator() = default;
+
+		template <class U>
+		CountingAllocator(const CountingAllocator<U>& other) : count(other.count) {}
+
+		T* allocate(size_t n) {
+			++*count;
+			return std::allocator<T>().allocate(n);
+		}
+
+		void deallocate(T* p, size_t n) {
+			std::allocator<T>().deallocate(p, n);
+		}
+
+		template <class U>
+		bool operator==(const CountingAllocator<U>& other) const {
+			return count == other.count;
+		}
+	};
+
+	TEST_F(BinarySearchTreeStructureTest, LevelOrderPostIncrementDoesNotCopyQueue) {
+		using CountedBST = BinarySearchTree<
+			int, std::less<int>, CountingAllocator<int>, false
+		>;
+
+		std::vector<int> keys(1000);
+		std::iota(keys.begin(), keys.end(), 0);
+		std::shuffle(keys.begin(), keys.end(), std::mt19937{ 42 });
+
+		CountingAllocator<int> alloc;
+		CountedBST tree(keys.begin(), keys.end(), alloc);
+		size_t& allocations = *alloc.count;
+		allocations = 0;
+
+		// a queue copied on every step would allocate once per element, 
+		// while a single queue only grows geometrically.
+		size_t visited = 0;
+		for (auto it = tree.begin<traversal_order::LEVEL_ORDER>(); it != tree.end(); it++)
+			++visited;
+
+		EXPECT_EQ(visited, keys.size());
+		EXPECT_LT(allocations, 32u);
+
+		auto it = tree.begin<traversal_order::LEVEL_ORDER>();
+		std::advance(it, 5);
+		auto previous = it++;
+		auto expected = tree.begin<traversal_order::LEVEL_ORDER>();
+		std::advance(expected, 5);
+
+		EXPECT_EQ(previous, expected);
+		EXPECT_EQ(*++previous, *it);
+		EXPECT_EQ(*++previous, *++it);
+	}
+
+	TEST_F(BinarySearchTreeStructureTest, CachedHeightsMatchComputedHeights) {
+		using HeightCachedBST = BinarySearchTree<
+			int, std::less<int>, std::allocator<int>, false, false, true
+		>;
+
+		std::vector<int> keys(500);
+		std::iota(keys.begin(), keys.end(), 0);
+		std::shuffle(keys.begin(), keys.end(), std::mt19937{ 42 });
+
+		SimpleBST<int> expected(keys.begin(), keys.end());
+		HeightCachedBST tree(keys.begin(), keys.end());
+
+		auto expectSameHeights = [&]() {
+			ASSERT_EQ(tree.size(), expected.size());
+			EXPECT_EQ(tree.height(), expected.height());
+
+			auto it = expected.begin();
+			for (auto position = tree.begin(); position != tree.end(); ++position)
+				EXPECT_EQ(tree.heightOf(position), expected.heightOf(it++));
+		};
+
+		expectSameHeights();
+
+		for (size_t index = 0; index < keys.size(); index += 2) {
+			tree.remove(tree.find(keys[index]));
+			expected.remove(expected.find(keys[index]));
+		}
+
+		expectSameHeights();
+	}
 }
\ No newline at end of file
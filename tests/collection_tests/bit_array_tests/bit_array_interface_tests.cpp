@@ -0,0 +1,169 @@
+/* ============================================================================
+* Copyright (C) 2023 Ryan Eubank
+*
+* This program is free software: you can redistribute it and/or modify
+* it under the terms of the GNU General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License
+* along with this program.  If not, see <https://www.gnu.org/licenses/>.
+* ========================================================================= */
+
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "containers/BitArray.h"
+
+namespace collection_tests {
+
+	using namespace collections;
+
+	// ------------------------------------------------------------------------
+	/// <summary>
+	/// Tests that individual bits can be set, reset, flipped, and tested
+	/// across word boundaries.
+	/// </summary> ------------------------------------------------------------
+	TEST(BitArrayInterfaceTest, SetResetAndFlipModifySingleBits) {
+		BitArray<> bits(Size{ 130 });
+
+		bits.set(0);
+		bits.set(63);
+		bits.set(64, true);
+		bits.set(129);
+		bits.flip(1);
+		bits.reset(63);
+
+		EXPECT_TRUE(bits.test(0));
+		EXPECT_TRUE(bits.test(1));
+		EXPECT_FALSE(bits.test(63));
+		EXPECT_TRUE(bits.test(64));
+		EXPECT_TRUE(bits.test(129));
+		EXPECT_EQ(bits.count(), 4);
+	}
+
+	// ------------------------------------------------------------------------
+	/// <summary>
+	/// Tests that writes through the proxy reference update the array.
+	/// </summary> ------------------------------------------------------------
+	TEST(BitArrayInterfaceTest, ProxyReferenceAssignsUnderlyingBit) {
+		BitArray<> bits{ false, false, true };
+
+		bits[0] = true;
+		bits[2] = bits[1];
+		bits.back().flip();
+
+		EXPECT_TRUE(bits[0]);
+		EXPECT_FALSE(bits[1]);
+		EXPECT_TRUE(bits[2]);
+		EXPECT_THROW((void)bits.at(3), std::out_of_range);
+	}
+
+	// ------------------------------------------------------------------------
+	/// <summary>
+	/// Tests that findFirst and findNext visit exactly the set bits in
+	/// ascending order and return size() once exhausted.
+	/// </summary> ------------------------------------------------------------
+	TEST(BitArrayInterfaceTest, FindFirstAndFindNextVisitSetBitsInOrder) {
+		BitArray<> bits(Size{ 300 });
+		std::vector<size_t> expected = { 3, 64, 65, 127, 128, 299 };
+
+		for (auto i : expected)
+			bits.set(i);
+
+		std::vector<size_t> actual;
+		for (auto i = bits.findFirst(); i < bits.size(); i = bits.findNext(i))
+			actual.push_back(i);
+
+		EXPECT_EQ(actual, expected);
+		EXPECT_EQ(bits.findNext(299), bits.size());
+		EXPECT_EQ(BitArray<>(Size{ 70 }).findFirst(), 70);
+	}
+
+	// ------------------------------------------------------------------------
+	/// <summary>
+	/// Tests that resizing preserves existing bits and initializes new bits
+	/// to the requested value, including bits sharing the last word.
+	/// </summary> ------------------------------------------------------------
+	TEST(BitArrayInterfaceTest, ResizeFillsNewBitsWithValue) {
+		BitArray<> bits(Size{ 10 });
+		bits.set(2);
+
+		bits.resize(200, true);
+
+		EXPECT_EQ(bits.size(), 200);
+		EXPECT_EQ(bits.count(), 191);
+		EXPECT_FALSE(bits.test(9));
+		EXPECT_TRUE(bits.test(10));
+
+		bits.resize(3);
+
+		EXPECT_EQ(bits.size(), 3);
+		EXPECT_EQ(bits.count(), 1);
+		EXPECT_EQ(bits.wordCount(), 1);
+	}
+
+	// ------------------------------------------------------------------------
+	/// <summary>
+	/// Tests that appending and removing bits grows and shrinks the word
+	/// storage without leaving stale bits behind.
+	/// </summary> ------------------------------------------------------------
+	TEST(BitArrayInterfaceTest, InsertAndRemoveBackTrackWordStorage) {
+		BitArray<> bits;
+
+		for (int i = 0; i < 65; ++i)
+			bits.insertBack(true);
+
+		EXPECT_EQ(bits.wordCount(), 2);
+		EXPECT_TRUE(bits.all());
+
+		bits.removeBack();
+		EXPECT_EQ(bits.wordCount(), 1);
+
+		bits.insertBack(false);
+		EXPECT_EQ(bits.count(), 64);
+		EXPECT_FALSE(bits.all());
+		EXPECT_TRUE(bits.any());
+	}
+
+	// ------------------------------------------------------------------------
+	/// <summary>
+	/// Tests that set(), reset(), and flip() without arguments apply to
+	/// every bit and never touch bits past the end of the array.
+	/// </summary> ------------------------------------------------------------
+	TEST(BitArrayInterfaceTest, WholeArrayOperationsRespectSize) {
+		BitArray<> bits(Size{ 70 });
+
+		bits.set();
+		EXPECT_EQ(bits.count(), 70);
+		EXPECT_TRUE(bits.all());
+
+		bits.flip();
+		EXPECT_TRUE(bits.none());
+
+		bits.flip();
+		bits.reset();
+		EXPECT_EQ(bits.count(), 0);
+	}
+
+	// ------------------------------------------------------------------------
+	/// <summary>
+	/// Tests that a mutable iterator converts to a const iterator pointing
+	/// at the same bit.
+	/// </summary> ------------------------------------------------------------
+	TEST(BitArrayInterfaceTest, IteratorConvertsToConstIterator) {
+		BitArray<> bits{ false, true, false, true };
+
+		BitArray<>::iterator position = bits.begin() + 1;
+		BitArray<>::const_iterator converted = position;
+
+		EXPECT_TRUE(*converted);
+		EXPECT_EQ(converted, bits.cbegin() + 1);
+		EXPECT_EQ(bits.cend() - converted, 3);
+	}
+}
\ No newline at end of file
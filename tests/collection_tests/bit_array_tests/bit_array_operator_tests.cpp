@@ -0,0 +1,85 @@
+/* ============================================================================
+* Copyright (C) 2023 Ryan Eubank
+*
+* This program is free software: you can redistribute it and/or modify
+* it under the terms of the GNU General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License
+* along with this program.  If not, see <https://www.gnu.org/licenses/>.
+* ========================================================================= */
+
+#include <sstream>
+#include <gtest/gtest.h>
+
+#include "containers/BitArray.h"
+
+namespace collection_tests {
+
+	using namespace collections;
+
+	// ------------------------------------------------------------------------
+	/// <summary>
+	/// Tests the word-parallel AND, OR and XOR operators against arrays of
+	/// equal and differing lengths.
+	/// </summary> ------------------------------------------------------------
+	TEST(BitArrayOperatorTest, BitwiseOperatorsCombineWordByWord) {
+		BitArray<> lhs{ true, true, false, false, true };
+		BitArray<> rhs{ true, false, true, false };
+
+		EXPECT_EQ((lhs & rhs), (BitArray<>{ true, false, false, false, false }));
+		EXPECT_EQ((lhs | rhs), (BitArray<>{ true, true, true, false, true }));
+		EXPECT_EQ((lhs ^ rhs), (BitArray<>{ false, true, true, false, true }));
+	}
+
+	// ------------------------------------------------------------------------
+	/// <summary>
+	/// Tests that the NOT operator inverts only bits within the array.
+	/// </summary> ------------------------------------------------------------
+	TEST(BitArrayOperatorTest, NotOperatorInvertsBits) {
+		BitArray<> bits(Size{ 100 });
+		bits.set(50);
+
+		auto inverted = ~bits;
+
+		EXPECT_EQ(inverted.size(), 100);
+		EXPECT_EQ(inverted.count(), 99);
+		EXPECT_FALSE(inverted.test(50));
+	}
+
+	// ------------------------------------------------------------------------
+	/// <summary>
+	/// Tests that comparison orders arrays lexicographically by bit.
+	/// </summary> ------------------------------------------------------------
+	TEST(BitArrayOperatorTest, ComparisonIsLexicographic) {
+		BitArray<> a{ false, true, true };
+		BitArray<> b{ true, false };
+		BitArray<> c{ false, true };
+
+		EXPECT_LT(a, b);
+		EXPECT_LT(c, a);
+		EXPECT_NE(a, c);
+		EXPECT_EQ(a, (BitArray<>{ false, true, true }));
+	}
+
+	// ------------------------------------------------------------------------
+	/// <summary>
+	/// Tests that an array written to a stream can be read back.
+	/// </summary> ------------------------------------------------------------
+	TEST(BitArrayOperatorTest, StreamRoundTripPreservesBits) {
+		BitArray<> bits{ true, false, true, true };
+		BitArray<> result;
+		std::stringstream stream;
+
+		stream << bits;
+		stream >> result;
+
+		EXPECT_EQ(result, bits);
+	}
+}
@@ -0,0 +1,47 @@
+/* ============================================================================
+ * Copyright (C) 2023 Ryan Eubank
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ * ========================================================================= */
+
+#include <string>
+#include <gtest/gtest.h>
+
+#include "containers/BTree.h"
+
+#include "../../collection_test_suites/constructor_tests.h"
+
+namespace collection_tests {
+
+	using test_params = testing::Types<
+		BTreeSet<uint8_t>,
+		BTreeSet<uint16_t>,
+		BTreeSet<uint32_t>,
+		BTreeSet<uint64_t>,
+		BTreeSet<float>,
+		BTreeSet<void*>,
+		BTreeSet<std::string>,
+		BTreeSet<BTreeSet<int>>,
+		BTreeMap<uint8_t, std::string>,
+		BTreeMultiSet<uint8_t>,
+		BTreeMultiMap<uint8_t, std::string>
+	>;
+
+	INSTANTIATE_TYPED_TEST_SUITE_P(
+		BTreeTest,
+		ConstructorTests,
+		test_params
+	);
+
+}
\ No newline at end of file
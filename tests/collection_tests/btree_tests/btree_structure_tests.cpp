@@ -0,0 +1,262 @@
+/* ============================================================================
+* Copyright (C) 2023 Ryan Eubank
+*
+* This program is free software: you can redistribute it and/or modify
+* it under the terms of the GNU General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License
+* along with this program.  If not, see <https://www.gnu.org/licenses/>.
+* ========================================================================= */
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <random>
+#include <set>
+#include <string>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "containers/BTree.h"
+
+#include "../../collection_test_suites/collection_test_fixture.h"
+
+namespace collection_tests {
+
+	using namespace collections;
+
+	template <class element_t, std::size_t capacity>
+	using SmallBTree = BTree<
+		element_t,
+		std::less<element_t>,
+		std::allocator<element_t>,
+		false,
+		capacity
+	>;
+
+	template <class element_t, std::size_t capacity>
+	using SmallMultiBTree = BTree<
+		element_t,
+		std::less<element_t>,
+		std::allocator<element_t>,
+		true,
+		capacity
+	>;
+
+	class BTreeStructureTest : public CollectionTest<BTreeSet<int>> {
+	protected:
+		template <class tree_t, class reference_t>
+		void expectMatches(const tree_t& tree, const reference_t& expected) {
+			ASSERT_EQ(tree.size(), expected.size());
+			EXPECT_TRUE(std::equal(
+				tree.begin(), tree.end(), expected.begin(), expected.end()));
+			EXPECT_TRUE(std::equal(
+				tree.rbegin(), tree.rend(), expected.rbegin(), expected.rend()));
+		}
+
+		// inserts and removes random keys, checking every step against the
+		// standard library set of the same kind.
+		template <class tree_t, class reference_t>
+		void stressAgainst(unsigned seed, int range, int steps) {
+			std::mt19937 rng(seed);
+			std::uniform_int_distribution<int> keys(0, range);
+			tree_t tree;
+			reference_t expected;
+
+			for (int step = 0; step < steps; ++step) {
+				int key = keys(rng);
+
+				if (rng() % 3) {
+					auto result = tree.insert(key);
+					expected.insert(key);
+					ASSERT_EQ(*result, key);
+				}
+				else if (auto pos = tree.find(key); pos != tree.end()) {
+					auto next = tree.remove(pos);
+					auto expectedNext = expected.erase(expected.find(key));
+
+					if (expectedNext == expected.end())
+						ASSERT_EQ(next, tree.end());
+					else
+						ASSERT_EQ(*next, *expectedNext);
+				}
+				else
+					ASSERT_EQ(expected.count(key), 0);
+
+				if (step % 97 == 0)
+					expectMatches(tree, expected);
+			}
+
+			expectMatches(tree, expected);
+
+			for (int key = 0; key <= range; ++key) {
+				auto lower = tree.lowerBound(key);
+				auto upper = tree.upperBound(key);
+				auto expectedLower = expected.lower_bound(key);
+				auto expectedUpper = expected.upper_bound(key);
+
+				ASSERT_EQ(tree.count(key), expected.count(key));
+				ASSERT_EQ(lower == tree.end(), expectedLower == expected.end());
+				ASSERT_EQ(upper == tree.end(), expectedUpper == expected.end());
+
+				if (lower != tree.end())
+					ASSERT_EQ(*lower, *expectedLower);
+				if (upper != tree.end())
+					ASSERT_EQ(*upper, *expectedUpper);
+			}
+
+			while (!tree.isEmpty())
+				tree.remove(tree.begin());
+
+			EXPECT_EQ(tree.height(), 0);
+			EXPECT_EQ(tree.begin(), tree.end());
+		}
+	};
+
+	TEST_F(BTreeStructureTest, DefaultCapacityFillsSeveralCacheLines) {
+		EXPECT_EQ(BTreeSet<int>::node_capacity, 64);
+		EXPECT_EQ(BTreeSet<std::uint64_t>::node_capacity, 32);
+		EXPECT_GE(BTreeSet<std::string>::node_capacity, 3);
+	}
+
+	TEST_F(BTreeStructureTest, NodesSplitAsTheTreeGrows) {
+		SmallBTree<int, 3> tree{ 0, 1, 2 };
+
+		EXPECT_EQ(tree.height(), 0);
+
+		tree.insert(3);
+		EXPECT_EQ(tree.height(), 1);
+
+		for (int i = 4; i < 100; ++i)
+			tree.insert(i);
+
+		// every node holds at least one element, so 100 elements cannot
+		// need more than log2(101) levels.
+		EXPECT_LE(tree.height(), 6);
+		EXPECT_EQ(tree.size(), 100);
+		EXPECT_EQ(*tree.minimum(), 0);
+		EXPECT_EQ(*tree.maximum(), 99);
+	}
+
+	TEST_F(BTreeStructureTest, NodesMergeAsTheTreeShrinks) {
+		SmallBTree<int, 4> tree;
+
+		for (int i = 0; i < 200; ++i)
+			tree.insert(i);
+
+		auto pos = tree.begin();
+		while (pos != tree.end())
+			pos = tree.remove(std::next(pos));
+
+		EXPECT_EQ(tree.size(), 100);
+		EXPECT_LE(tree.height(), 6);
+
+		int expected = 0;
+		for (int element : tree) {
+			EXPECT_EQ(element, expected);
+			expected += 2;
+		}
+	}
+
+	TEST_F(BTreeStructureTest, RandomOperationsMatchStandardSet) {
+		stressAgainst<SmallBTree<int, 3>, std::set<int>>(1, 500, 5000);
+		stressAgainst<SmallBTree<int, 4>, std::set<int>>(2, 500, 5000);
+		stressAgainst<BTreeSet<int>, std::set<int>>(3, 20000, 30000);
+	}
+
+	TEST_F(BTreeStructureTest, RandomOperationsMatchStandardMultiSet) {
+		stressAgainst<SmallMultiBTree<int, 3>, std::multiset<int>>(4, 50, 5000);
+		stressAgainst<SmallMultiBTree<int, 4>, std::multiset<int>>(5, 50, 5000);
+		stressAgainst<BTreeMultiSet<int>, std::multiset<int>>(6, 500, 30000);
+	}
+
+	TEST_F(BTreeStructureTest, RemoveReturnsNextEqualElementInMultiTree) {
+		SmallMultiBTree<int, 3> tree;
+
+		for (int i = 0; i < 20; ++i)
+			tree.insert(i % 2);
+
+		auto pos = tree.remove(std::next(tree.begin(), 3));
+
+		EXPECT_EQ(std::distance(tree.begin(), pos), 3);
+		EXPECT_EQ(tree.count(0), 9);
+		EXPECT_EQ(tree.count(1), 10);
+	}
+
+	TEST_F(BTreeStructureTest, RemoveReturnsSuccessorFromEveryPosition) {
+		SmallMultiBTree<int, 3> source;
+
+		for (int i = 0; i < 40; ++i)
+			source.insert(i % 4);
+
+		for (int i = 0; i < 40; ++i) {
+			SmallMultiBTree<int, 3> tree = source;
+			auto pos = tree.remove(std::next(tree.begin(), i));
+
+			ASSERT_EQ(std::distance(tree.begin(), pos), i);
+		}
+
+		auto pos = source.remove(std::next(source.begin(), 5), std::prev(source.end(), 5));
+
+		EXPECT_EQ(source.size(), 10);
+		EXPECT_EQ(std::distance(source.begin(), pos), 5);
+		EXPECT_EQ(*pos, 3);
+	}
+
+	TEST_F(BTreeStructureTest, InsertRangeAcceptsKeysWithoutDefaultConstructor) {
+		struct Key {
+			int value;
+
+			explicit Key(int v) : value(v) {}
+
+			bool operator<(const Key& other) const {
+				return value < other.value;
+			}
+		};
+
+		std::vector<Key> keys = { Key(3), Key(1), Key(2) };
+		BTreeSet<Key> tree;
+
+		auto last = tree.insert(keys.begin(), keys.end());
+
+		EXPECT_EQ(tree.size(), 3);
+		EXPECT_EQ(last->value, 2);
+	}
+
+	TEST_F(BTreeStructureTest, GreaterComparisonOrdersDescending) {
+		BTree<int, std::greater<int>, std::allocator<int>, false, 5> tree;
+
+		for (int i = 0; i < 50; ++i)
+			tree.insert((i * 37) % 50);
+
+		EXPECT_TRUE(std::is_sorted(tree.begin(), tree.end(), std::greater<>{}));
+		EXPECT_EQ(*tree.lowerBound(25), 25);
+		EXPECT_EQ(*tree.upperBound(25), 24);
+		EXPECT_EQ(*tree.minimum(), 49);
+	}
+
+	TEST_F(BTreeStructureTest, CopyPreservesElementsAndStructure) {
+		SmallBTree<std::string, 3> tree;
+
+		for (int i = 0; i < 100; ++i)
+			tree.insert(std::to_string(i));
+
+		SmallBTree<std::string, 3> copy(tree);
+
+		EXPECT_EQ(copy, tree);
+		EXPECT_EQ(copy.height(), tree.height());
+
+		copy.remove(copy.find("50"));
+
+		EXPECT_TRUE(tree.contains("50"));
+		EXPECT_FALSE(copy.contains("50"));
+	}
+}
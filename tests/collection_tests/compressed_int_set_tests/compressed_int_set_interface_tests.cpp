@@ -0,0 +1,165 @@
+/* ============================================================================
+* Copyright (C) 2023 Ryan Eubank
+*
+* This program is free software: you can redistribute it and/or modify
+* it under the terms of the GNU General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License
+* along with this program.  If not, see <https://www.gnu.org/licenses/>.
+* ========================================================================= */
+
+
+#include <set>
+#include <sstream>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "containers/CompressedIntSet.h"
+
+namespace collection_tests {
+
+	using namespace collections;
+
+	class CompressedIntSetInterfaceTest : public testing::Test {
+	protected:
+		// Values spread across a sparse chunk, a dense chunk, and a chunk of
+		// long consecutive runs so every chunk form is exercised.
+		std::set<uint32_t> makeValues() {
+			std::set<uint32_t> values;
+			for (uint32_t i = 0; i < 1000; ++i)
+				values.insert(i * 37);
+			for (uint32_t i = 0; i < 20000; ++i)
+				values.insert((1u << 16) + i * 3);
+			for (uint32_t i = 0; i < 30000; ++i)
+				values.insert((5u << 16) + i);
+			values.insert(0xffffffff);
+			return values;
+		}
+
+		template <class set_t>
+		void expectEqual(const set_t& set, const std::set<uint32_t>& expected) {
+			ASSERT_EQ(set.size(), expected.size());
+			auto it = set.begin();
+			for (auto value : expected)
+				ASSERT_EQ(*it++, value);
+			EXPECT_EQ(it, set.end());
+		}
+	};
+
+	// ------------------------------------------------------------------------
+	/// <summary>
+	/// Tests that inserted values are iterated in ascending order without
+	/// duplicates across array and bitmap chunks.
+	/// </summary> ------------------------------------------------------------
+	TEST_F(CompressedIntSetInterfaceTest, InsertIteratesInOrder) {
+		auto expected = makeValues();
+		std::vector<uint32_t> shuffled(expected.rbegin(), expected.rend());
+		shuffled.insert(shuffled.end(), expected.begin(), expected.end());
+
+		CompressedIntSet<> set(from_range, shuffled);
+		expectEqual(set, expected);
+	}
+
+	// ------------------------------------------------------------------------
+	/// <summary>
+	/// Tests contains, find, lowerBound and upperBound against std::set.
+	/// </summary> ------------------------------------------------------------
+	TEST_F(CompressedIntSetInterfaceTest, LookupMatchesStdSet) {
+		auto expected = makeValues();
+		CompressedIntSet<> set(from_range, expected);
+
+		for (uint32_t probe : { 0u, 1u, 36u, 37u, 36963u, 36964u, 65535u,
+			65536u, 65537u, 125535u, 200000u, 327680u, 357679u, 357680u,
+			0xfffffffeu, 0xffffffffu }) {
+			EXPECT_EQ(set.contains(probe), expected.contains(probe)) << probe;
+			EXPECT_EQ(set.find(probe) != set.end(), expected.contains(probe));
+
+			auto lower = expected.lower_bound(probe);
+			auto result = set.lowerBound(probe);
+			if (lower == expected.end())
+				EXPECT_EQ(result, set.end()) << probe;
+			else
+				EXPECT_EQ(*result, *lower) << probe;
+
+			auto upper = expected.upper_bound(probe);
+			auto next = set.upperBound(probe);
+			if (upper == expected.end())
+				EXPECT_EQ(next, set.end()) << probe;
+			else
+				EXPECT_EQ(*next, *upper) << probe;
+		}
+	}
+
+	// ------------------------------------------------------------------------
+	/// <summary>
+	/// Tests that removal keeps the set consistent as dense chunks shrink
+	/// back into arrays and empty chunks are dropped.
+	/// </summary> ------------------------------------------------------------
+	TEST_F(CompressedIntSetInterfaceTest, RemoveShrinksChunks) {
+		auto expected = makeValues();
+		CompressedIntSet<> set(from_range, expected);
+
+		for (uint32_t i = 0; i < 20000; i += 2) {
+			uint32_t value = (1u << 16) + i * 3;
+			auto next = set.remove(set.find(value));
+			expected.erase(value);
+			EXPECT_EQ(*next, *expected.upper_bound(value));
+		}
+		expectEqual(set, expected);
+
+		auto first = set.lowerBound(0);
+		auto last = set.lowerBound(1u << 16);
+		set.remove(first, last);
+		std::erase_if(expected, [](uint32_t v) { return v < (1u << 16); });
+		expectEqual(set, expected);
+
+		set.remove(set.begin(), set.end());
+		EXPECT_TRUE(set.isEmpty());
+	}
+
+	// ------------------------------------------------------------------------
+	/// <summary>
+	/// Tests that optimize converts chunks to runs without changing the
+	/// contents, and that run chunks remain mutable afterwards.
+	/// </summary> ------------------------------------------------------------
+	TEST_F(CompressedIntSetInterfaceTest, OptimizePreservesContents) {
+		auto expected = makeValues();
+		CompressedIntSet<> set(from_range, expected);
+		CompressedIntSet<> copy = set;
+
+		set.optimize();
+		expectEqual(set, expected);
+		EXPECT_EQ(set, copy);
+		EXPECT_TRUE(set.contains((5u << 16) + 29999));
+		EXPECT_FALSE(set.contains((5u << 16) + 30000));
+		EXPECT_EQ(*set.lowerBound((5u << 16) + 100), (5u << 16) + 100);
+
+		set.insert((5u << 16) + 40000);
+		set.remove(set.find((5u << 16) + 15000));
+		expected.insert((5u << 16) + 40000);
+		expected.erase((5u << 16) + 15000);
+		expectEqual(set, expected);
+	}
+
+	// ------------------------------------------------------------------------
+	/// <summary>
+	/// Tests that the set round trips through the stream operators.
+	/// </summary> ------------------------------------------------------------
+	TEST_F(CompressedIntSetInterfaceTest, StreamRoundTrip) {
+		CompressedIntSet<> set = { 1, 5, 70000, 0xffffffff };
+		CompressedIntSet<> result;
+
+		std::stringstream stream;
+		stream << set;
+		stream >> result;
+
+		EXPECT_EQ(set, result);
+	}
+}
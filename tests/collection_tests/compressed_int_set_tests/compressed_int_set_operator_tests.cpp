@@ -0,0 +1,219 @@
+/* ============================================================================
+* Copyright (C) 2023 Ryan Eubank
+*
+* This program is free software: you can redistribute it and/or modify
+* it under the terms of the GNU General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License
+* along with this program.  If not, see <https://www.gnu.org/licenses/>.
+* ========================================================================= */
+
+
+#include <algorithm>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <set>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "containers/CompressedIntSet.h"
+
+namespace collection_tests {
+
+	using namespace collections;
+
+	// allocations left before budget_allocator throws, or -1 for no limit.
+	inline long allocation_budget = -1;
+
+	template <class T>
+	struct budget_allocator {
+		using value_type = T;
+
+		budget_allocator() = default;
+
+		template <class U>
+		budget_allocator(const budget_allocator<U>&) noexcept {}
+
+		T* allocate(std::size_t n) {
+			if (allocation_budget == 0)
+				throw std::bad_alloc();
+			if (allocation_budget > 0)
+				--allocation_budget;
+			return std::allocator<T>().allocate(n);
+		}
+
+		void deallocate(T* p, std::size_t n) noexcept {
+			std::allocator<T>().deallocate(p, n);
+		}
+
+		template <class U>
+		bool operator==(const budget_allocator<U>&) const noexcept {
+			return true;
+		}
+	};
+
+	class CompressedIntSetOperatorTest : public testing::Test {
+	protected:
+		std::set<uint32_t> _a;
+		std::set<uint32_t> _b;
+
+		// Overlapping inputs mixing sparse, dense, and run heavy chunks so
+		// each pairing of chunk forms meets in the set operations.
+		void SetUp() override {
+			for (uint32_t i = 0; i < 3000; ++i)
+				_a.insert(i * 5);
+			for (uint32_t i = 0; i < 40000; ++i)
+				_a.insert((1u << 16) + i);
+			for (uint32_t i = 0; i < 500; ++i)
+				_a.insert((3u << 16) + i * 100);
+
+			for (uint32_t i = 0; i < 5000; ++i)
+				_b.insert(i * 3);
+			for (uint32_t i = 0; i < 6000; ++i)
+				_b.insert((1u << 16) + i * 7);
+			for (uint32_t i = 0; i < 50000; ++i)
+				_b.insert((3u << 16) + i);
+			_b.insert(7u << 16);
+		}
+
+		std::set<uint32_t> apply(auto op) {
+			std::set<uint32_t> result;
+			op(_a.begin(), _a.end(), _b.begin(), _b.end(),
+				std::inserter(result, result.end()));
+			return result;
+		}
+
+		void expectEqual(
+			const CompressedIntSet<>& set,
+			const std::set<uint32_t>& expected
+		) {
+			ASSERT_EQ(set.size(), expected.size());
+			EXPECT_TRUE(std::equal(set.begin(), set.end(), expected.begin()));
+		}
+	};
+
+	// ------------------------------------------------------------------------
+	/// <summary>
+	/// Tests union, intersection and difference against the std algorithms.
+	/// </summary> ------------------------------------------------------------
+	TEST_F(CompressedIntSetOperatorTest, SetOperationsMatchStd) {
+		CompressedIntSet<> a(from_range, _a);
+		CompressedIntSet<> b(from_range, _b);
+
+		expectEqual(a | b, apply(std::ranges::set_union));
+		expectEqual(a & b, apply(std::ranges::set_intersection));
+		expectEqual(a - b, apply(std::ranges::set_difference));
+		expectEqual(b - a, [&] {
+			std::set<uint32_t> result;
+			std::ranges::set_difference(_b, _a, std::inserter(result, result.end()));
+			return result;
+		}());
+	}
+
+	// ------------------------------------------------------------------------
+	/// <summary>
+	/// Tests that set operations give the same results when either operand
+	/// has been optimized into run chunks.
+	/// </summary> ------------------------------------------------------------
+	TEST_F(CompressedIntSetOperatorTest, SetOperationsOnRunChunks) {
+		CompressedIntSet<> a(from_range, _a);
+		CompressedIntSet<> b(from_range, _b);
+		a.optimize();
+		b.optimize();
+
+		expectEqual(a | b, apply(std::ranges::set_union));
+		expectEqual(a & b, apply(std::ranges::set_intersection));
+		expectEqual(a - b, apply(std::ranges::set_difference));
+	}
+
+	// ------------------------------------------------------------------------
+	/// <summary>
+	/// Tests that a set operation running out of memory at any allocation 
+	/// leaves the set ordered and with a size matching its values.
+	/// </summary> ------------------------------------------------------------
+	TEST_F(CompressedIntSetOperatorTest, ThrowingAllocationLeavesSetValid) {
+		using budget_set = CompressedIntSet<budget_allocator<uint32_t>>;
+
+		auto isValid = [](const budget_set& set) {
+			std::size_t count = 0;
+			uint32_t last = 0;
+
+			for (uint32_t value : set) {
+				if ((count && value <= last) || !set.contains(value))
+					return false;
+				last = value;
+				++count;
+			}
+
+			return count == set.size();
+		};
+
+		for (int op = 0; op < 3; ++op) {
+			for (long budget = 0; ; ++budget) {
+				allocation_budget = -1;
+				budget_set a(from_range, _a);
+				budget_set b(from_range, _b);
+				b.optimize();
+
+				allocation_budget = budget;
+				bool done = true;
+
+				try {
+					if (op == 0)
+						a |= b;
+					else if (op == 1)
+						a &= b;
+					else
+						a -= b;
+				}
+				catch (const std::bad_alloc&) {
+					done = false;
+				}
+
+				allocation_budget = -1;
+				EXPECT_TRUE(isValid(a));
+
+				if (done)
+					break;
+			}
+		}
+	}
+
+	// ------------------------------------------------------------------------
+	/// <summary>
+	/// Tests that compound assignment with itself is well defined.
+	/// </summary> ------------------------------------------------------------
+	TEST_F(CompressedIntSetOperatorTest, SelfAssignmentOperations) {
+		CompressedIntSet<> a(from_range, _a);
+
+		a |= a;
+		expectEqual(a, _a);
+		a &= a;
+		expectEqual(a, _a);
+		a -= a;
+		EXPECT_TRUE(a.isEmpty());
+	}
+
+	// ------------------------------------------------------------------------
+	/// <summary>
+	/// Tests that comparison orders sets lexicographically by their values.
+	/// </summary> ------------------------------------------------------------
+	TEST_F(CompressedIntSetOperatorTest, ComparisonIsLexicographic) {
+		CompressedIntSet<> a = { 1, 2, 3 };
+		CompressedIntSet<> b = { 1, 2, 4 };
+		CompressedIntSet<> c = { 1, 2 };
+
+		EXPECT_LT(a, b);
+		EXPECT_LT(c, a);
+		EXPECT_NE(a, c);
+		EXPECT_EQ(a, CompressedIntSet<>({ 3, 2, 1 }));
+	}
+}
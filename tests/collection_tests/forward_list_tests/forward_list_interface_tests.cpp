@@ -15,12 +15,17 @@
 * along with this program.  If not, see <https://www.gnu.org/licenses/>.
 * ========================================================================= */
 
+#include <ranges>
+#include <stdexcept>
 #include <string>
 #include <gtest/gtest.h>
 
 #include "containers/ForwardList.h"
 #include "../../collection_test_suites/collection_test_fixture.h"
+#include "../../collection_test_suites/list_algorithm_tests.h"
+#include "../../collection_test_suites/list_batch_allocation_tests.h"
 #include "../../collection_test_suites/list_interface_tests.h"
+#include "../../collection_test_suites/list_node_recycling_tests.h"
 
 namespace collection_tests {
 
@@ -32,6 +37,24 @@ namespace collection_tests {
 		test_params
 	);
 
+	INSTANTIATE_TYPED_TEST_SUITE_P(
+		ForwardListTest,
+		ListAlgorithmTests,
+		test_params
+	);
+
+	INSTANTIATE_TYPED_TEST_SUITE_P(
+		ForwardListTest,
+		ListBatchAllocationTests,
+		test_params
+	);
+
+	INSTANTIATE_TYPED_TEST_SUITE_P(
+		ForwardListTest,
+		ListNodeRecyclingTests,
+		test_params
+	);
+
 	template <class T>
 	using ForwardListInterfaceTests = CollectionTest<T>;
 
@@ -429,4 +452,42 @@ namespace collection_tests {
 		auto result = list.removeAfter(list.stable_begin());
 		EXPECT_EQ(*result, c);
 	}
-}
\ No newline at end of file
+
+	// ------------------------------------------------------------------------
+	/// <summary>
+	/// Tests that a bulk load throwing partway destroys the elements it has
+	/// already built and frees their batch, both for ranges too short to 
+	/// batch and for ranges long enough to.
+	/// </summary> ------------------------------------------------------------
+	TEST(ForwardListBatchTest, ThrowingBatchConstructionDestroysBuiltElements) {
+		static int live = 0;
+
+		struct Counted {
+			int value;
+
+			explicit Counted(int v) : value(v) { 
+				if (v == 6)
+					throw std::runtime_error("element 6");
+				++live; 
+			}
+			Counted(const Counted& other) : value(other.value) { ++live; }
+			~Counted() { --live; }
+		};
+
+		using batches = NodeBatches<
+			ForwardList<Counted>::node_type, 
+			std::allocator<Counted>
+		>;
+
+		for (int count : { 10, static_cast<int>(batches::MIN_BATCH) }) {
+			auto elements = std::views::iota(0, count) 
+				| std::views::transform([](int v) { return Counted(v); });
+
+			EXPECT_THROW(
+				ForwardList<Counted>(elements.begin(), elements.end()), 
+				std::runtime_error
+			);
+			EXPECT_EQ(live, 0);
+		}
+	}
+}
@@ -0,0 +1,148 @@
+/* ============================================================================
+* Copyright (C) 2023 Ryan Eubank
+*
+* This program is free software: you can redistribute it and/or modify
+* it under the terms of the GNU General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License
+* along with this program.  If not, see <https://www.gnu.org/licenses/>.
+* ========================================================================= */
+
+
+#include <array>
+#include <stdexcept>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "containers/IntrusiveForwardList.h"
+
+namespace collection_tests {
+
+	using namespace collections;
+
+	struct Connection {
+		int id = 0;
+		IntrusiveForwardListHook hook{};
+	};
+
+	using connection_list = IntrusiveForwardList<Connection, &Connection::hook>;
+
+	static_assert(
+		forward_iterable<connection_list>,
+		"IntrusiveForwardList does not meet the requirements for forward iteration."
+	);
+
+	std::vector<int> idsOf(const connection_list& list) {
+		std::vector<int> ids;
+		for (const Connection& c : list)
+			ids.push_back(c.id);
+		return ids;
+	}
+
+	// ------------------------------------------------------------------------
+	/// <summary>
+	/// Tests that objects are linked in place at the front, back and middle
+	/// of the list without being copied.
+	/// </summary> ------------------------------------------------------------
+	TEST(IntrusiveForwardListTest, InsertLinksObjectsInPlace) {
+		std::array<Connection, 4> connections{ { {0}, {1}, {2}, {3} } };
+		connection_list list;
+
+		list.insertBack(connections[1]);
+		list.insertFront(connections[0]);
+		list.insertBack(connections[3]);
+		auto it = list.insert(std::next(list.begin(), 2), connections[2]);
+
+		EXPECT_EQ(&*it, &connections[2]);
+		EXPECT_EQ(&list.front(), &connections[0]);
+		EXPECT_EQ(&list.back(), &connections[3]);
+		EXPECT_EQ(list.size(), 4);
+		EXPECT_EQ(idsOf(list), (std::vector<int>{ 0, 1, 2, 3 }));
+		EXPECT_THROW(list.insertBack(connections[0]), std::invalid_argument);
+	}
+
+	// ------------------------------------------------------------------------
+	/// <summary>
+	/// Tests that objects are removed at iterators, by reference and from
+	/// both ends, leaving their hooks unlinked.
+	/// </summary> ------------------------------------------------------------
+	TEST(IntrusiveForwardListTest, RemoveUnlinksObjects) {
+		std::array<Connection, 5> connections{ { {0}, {1}, {2}, {3}, {4} } };
+		connection_list list(connections.begin(), connections.end());
+
+		auto next = list.remove(std::next(list.begin()));
+		EXPECT_EQ(&*next, &connections[2]);
+
+		list.remove(connections[3]);
+		list.removeBack();
+		EXPECT_EQ(idsOf(list), (std::vector<int>{ 0, 2 }));
+		EXPECT_EQ(&list.back(), &connections[2]);
+
+		list.insertBack(connections[4]);
+		list.remove(list.begin(), std::next(list.begin(), 2));
+		EXPECT_EQ(idsOf(list), (std::vector<int>{ 4 }));
+
+		list.removeFront();
+		EXPECT_TRUE(list.isEmpty());
+		for (const Connection& c : connections)
+			EXPECT_FALSE(c.hook.isLinked());
+	}
+
+	// ------------------------------------------------------------------------
+	/// <summary>
+	/// Tests that splicing, swapping and moving lists relink the objects 
+	/// and keep the sizes and tails of both lists correct.
+	/// </summary> ------------------------------------------------------------
+	TEST(IntrusiveForwardListTest, SpliceSwapAndMoveTransferObjects) {
+		std::array<Connection, 5> connections{ { {0}, {1}, {2}, {3}, {4} } };
+		connection_list list_1(connections.begin(), connections.begin() + 2);
+		connection_list list_2(connections.begin() + 2, connections.end());
+
+		list_1.splice(
+			std::next(list_1.begin()), 
+			list_2, 
+			std::next(list_2.begin()), 
+			list_2.end()
+		);
+
+		EXPECT_EQ(idsOf(list_1), (std::vector<int>{ 0, 3, 4, 1 }));
+		EXPECT_EQ(idsOf(list_2), (std::vector<int>{ 2 }));
+		EXPECT_EQ(&list_2.back(), &connections[2]);
+		EXPECT_EQ(list_1.size(), 4);
+		EXPECT_EQ(list_2.size(), 1);
+
+		swap(list_1, list_2);
+		connection_list list_3(std::move(list_2));
+		list_3.splice(list_3.end(), list_1);
+
+		EXPECT_TRUE(list_1.isEmpty());
+		EXPECT_TRUE(list_2.isEmpty());
+		EXPECT_EQ(idsOf(list_3), (std::vector<int>{ 0, 3, 4, 1, 2 }));
+		EXPECT_EQ(&list_3.back(), &connections[2]);
+		EXPECT_EQ(list_3.size(), 5);
+	}
+
+	// ------------------------------------------------------------------------
+	/// <summary>
+	/// Tests that destroying a list unlinks its objects without destroying
+	/// them.
+	/// </summary> ------------------------------------------------------------
+	TEST(IntrusiveForwardListTest, DestructorUnlinksObjects) {
+		std::array<Connection, 3> connections{ { {0}, {1}, {2} } };
+
+		{
+			connection_list list(connections.begin(), connections.end());
+			EXPECT_TRUE(connections[1].hook.isLinked());
+		}
+
+		for (const Connection& c : connections)
+			EXPECT_FALSE(c.hook.isLinked());
+	}
+}
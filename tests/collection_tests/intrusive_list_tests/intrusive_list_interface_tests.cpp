@@ -0,0 +1,172 @@
+/* ============================================================================
+* Copyright (C) 2023 Ryan Eubank
+*
+* This program is free software: you can redistribute it and/or modify
+* it under the terms of the GNU General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License
+* along with this program.  If not, see <https://www.gnu.org/licenses/>.
+* ========================================================================= */
+
+
+#include <array>
+#include <stdexcept>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "containers/IntrusiveList.h"
+
+namespace collection_tests {
+
+	using namespace collections;
+
+	struct Timer {
+		int id = 0;
+		IntrusiveListHook hook{};
+		IntrusiveListHook expiryHook{};
+	};
+
+	using timer_list = IntrusiveList<Timer, &Timer::hook>;
+	using expiry_list = IntrusiveList<Timer, &Timer::expiryHook>;
+
+	static_assert(
+		bidirectionally_iterable<timer_list>,
+		"IntrusiveList does not meet the requirements for bidirectional iteration."
+	);
+
+	std::vector<int> idsOf(const auto& list) {
+		std::vector<int> ids;
+		for (const Timer& t : list)
+			ids.push_back(t.id);
+		return ids;
+	}
+
+	// ------------------------------------------------------------------------
+	/// <summary>
+	/// Tests that objects are linked in place at the front, back and middle
+	/// of the list without being copied.
+	/// </summary> ------------------------------------------------------------
+	TEST(IntrusiveListTest, InsertLinksObjectsInPlace) {
+		std::array<Timer, 4> timers{ { {0}, {1}, {2}, {3} } };
+		timer_list list;
+
+		list.insertBack(timers[1]);
+		list.insertFront(timers[0]);
+		list.insertBack(timers[3]);
+		auto it = list.insert(std::next(list.begin(), 2), timers[2]);
+
+		EXPECT_EQ(&*it, &timers[2]);
+		EXPECT_EQ(&list.front(), &timers[0]);
+		EXPECT_EQ(&list.back(), &timers[3]);
+		EXPECT_EQ(list.size(), 4);
+		EXPECT_EQ(idsOf(list), (std::vector<int>{ 0, 1, 2, 3 }));
+		EXPECT_EQ(std::prev(list.end())->id, 3);
+	}
+
+	// ------------------------------------------------------------------------
+	/// <summary>
+	/// Tests that an object is removed by reference and that its hook is 
+	/// unlinked afterwards so it can be inserted again.
+	/// </summary> ------------------------------------------------------------
+	TEST(IntrusiveListTest, RemoveByReferenceUnlinksObject) {
+		std::array<Timer, 3> timers{ { {0}, {1}, {2} } };
+		timer_list list(timers.begin(), timers.end());
+
+		auto next = list.remove(timers[1]);
+
+		EXPECT_EQ(&*next, &timers[2]);
+		EXPECT_FALSE(timers[1].hook.isLinked());
+		EXPECT_EQ(idsOf(list), (std::vector<int>{ 0, 2 }));
+		EXPECT_THROW(list.insertBack(timers[0]), std::invalid_argument);
+
+		list.insertFront(timers[1]);
+		list.removeBack();
+		list.remove(list.begin(), list.end());
+
+		EXPECT_TRUE(list.isEmpty());
+		for (const Timer& t : timers)
+			EXPECT_FALSE(t.hook.isLinked());
+	}
+
+	// ------------------------------------------------------------------------
+	/// <summary>
+	/// Tests that an object with several hooks can belong to several lists
+	/// at once.
+	/// </summary> ------------------------------------------------------------
+	TEST(IntrusiveListTest, ObjectsCanBelongToSeveralLists) {
+		std::array<Timer, 3> timers{ { {0}, {1}, {2} } };
+		timer_list list(timers.begin(), timers.end());
+		expiry_list expiries;
+
+		expiries.insertBack(timers[2]);
+		expiries.insertBack(timers[0]);
+		list.remove(timers[0]);
+
+		EXPECT_EQ(idsOf(list), (std::vector<int>{ 1, 2 }));
+		EXPECT_EQ(idsOf(expiries), (std::vector<int>{ 2, 0 }));
+		EXPECT_EQ(&*expiries.iteratorTo(timers[0]), &timers[0]);
+	}
+
+	// ------------------------------------------------------------------------
+	/// <summary>
+	/// Tests that splicing, swapping and moving lists relink the objects 
+	/// and keep the sizes of both lists correct.
+	/// </summary> ------------------------------------------------------------
+	TEST(IntrusiveListTest, SpliceSwapAndMoveTransferObjects) {
+		std::array<Timer, 5> timers{ { {0}, {1}, {2}, {3}, {4} } };
+		timer_list list_1(timers.begin(), timers.begin() + 2);
+		timer_list list_2(timers.begin() + 2, timers.end());
+
+		list_1.splice(
+			std::next(list_1.begin()), 
+			list_2, 
+			list_2.begin(), 
+			std::next(list_2.begin(), 2)
+		);
+
+		EXPECT_EQ(idsOf(list_1), (std::vector<int>{ 0, 2, 3, 1 }));
+		EXPECT_EQ(idsOf(list_2), (std::vector<int>{ 4 }));
+		EXPECT_EQ(list_1.size(), 4);
+		EXPECT_EQ(list_2.size(), 1);
+
+		swap(list_1, list_2);
+		EXPECT_EQ(idsOf(list_1), (std::vector<int>{ 4 }));
+		EXPECT_EQ(idsOf(list_2), (std::vector<int>{ 0, 2, 3, 1 }));
+
+		timer_list list_3(std::move(list_2));
+		list_3.splice(list_3.end(), list_1);
+
+		EXPECT_TRUE(list_1.isEmpty());
+		EXPECT_TRUE(list_2.isEmpty());
+		EXPECT_EQ(idsOf(list_3), (std::vector<int>{ 0, 2, 3, 1, 4 }));
+		EXPECT_EQ(std::prev(list_3.end())->id, 4);
+	}
+
+	// ------------------------------------------------------------------------
+	/// <summary>
+	/// Tests that copies of linked objects start unlinked and that destroying
+	/// a list unlinks its objects without destroying them.
+	/// </summary> ------------------------------------------------------------
+	TEST(IntrusiveListTest, DestructorUnlinksObjects) {
+		std::array<Timer, 3> timers{ { {0}, {1}, {2} } };
+
+		{
+			timer_list list(timers.begin(), timers.end());
+			Timer copy = timers[1];
+
+			EXPECT_TRUE(timers[1].hook.isLinked());
+			EXPECT_EQ(copy.id, 1);
+			EXPECT_FALSE(copy.hook.isLinked());
+		}
+
+		for (const Timer& t : timers)
+			EXPECT_FALSE(t.hook.isLinked());
+	}
+}
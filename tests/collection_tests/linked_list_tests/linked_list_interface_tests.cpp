@@ -15,12 +15,19 @@
 * along with this program.  If not, see <https://www.gnu.org/licenses/>.
 * ========================================================================= */
 
+#include <ranges>
+#include <stdexcept>
 #include <string>
+#include <utility>
+#include <vector>
 #include <gtest/gtest.h>
 
 #include "containers/LinkedList.h"
 
+#include "../../collection_test_suites/list_algorithm_tests.h"
+#include "../../collection_test_suites/list_batch_allocation_tests.h"
 #include "../../collection_test_suites/list_interface_tests.h"
+#include "../../collection_test_suites/list_node_recycling_tests.h"
 
 namespace collection_tests {
 
@@ -32,4 +39,129 @@ namespace collection_tests {
 		test_params
 	);
 
-}
\ No newline at end of file
+	INSTANTIATE_TYPED_TEST_SUITE_P(
+		LinkedListTest,
+		ListAlgorithmTests,
+		test_params
+	);
+
+	INSTANTIATE_TYPED_TEST_SUITE_P(
+		LinkedListTest,
+		ListBatchAllocationTests,
+		test_params
+	);
+
+	INSTANTIATE_TYPED_TEST_SUITE_P(
+		LinkedListTest,
+		ListNodeRecyclingTests,
+		test_params
+	);
+
+	// ------------------------------------------------------------------------
+	/// <summary>
+	/// Tests that splicing with a caller supplied count moves the range and
+	/// updates the sizes of both lists by that count.
+	/// </summary> ------------------------------------------------------------
+	TEST(LinkedListSpliceTest, SpliceWithCountUpdatesSizes) {
+		LinkedList<std::string> a = { "a", "b", "c", "d", "e" };
+		LinkedList<std::string> b = { "x", "y" };
+
+		auto first = std::next(a.begin());
+		auto last = std::next(first, 3);
+		b.splice(std::next(b.begin()), a, first, last, Size(3));
+
+		std::vector<std::string> expectedA = { "a", "e" };
+		std::vector<std::string> expectedB = { "x", "b", "c", "d", "y" };
+		EXPECT_EQ(a.size(), 2);
+		EXPECT_EQ(b.size(), 5);
+		EXPECT_TRUE(std::ranges::equal(a, expectedA));
+		EXPECT_TRUE(std::ranges::equal(b, expectedB));
+	}
+
+	// ------------------------------------------------------------------------
+	/// <summary>
+	/// Tests that a deferred size splice leaves both lists able to recount 
+	/// their sizes, and that size dependent operations see the new sizes.
+	/// </summary> ------------------------------------------------------------
+	TEST(LinkedListSpliceTest, DeferredSizeSpliceRecountsOnDemand) {
+		LinkedList<int> producer = { 1, 2, 3, 4, 5, 6 };
+		LinkedList<int> consumer = { 0 };
+
+		consumer.splice(
+			consumer.end(), 
+			producer, 
+			std::next(producer.begin()), 
+			producer.end(), 
+			deferred_size
+		);
+		consumer.insertBack(7);
+		producer.removeFront();
+
+		EXPECT_TRUE(producer.isEmpty());
+		EXPECT_EQ(producer.size(), 0);
+		EXPECT_EQ(consumer.size(), 7);
+		EXPECT_EQ(consumer[6], 7);
+		EXPECT_EQ(consumer.at(5), 6);
+		EXPECT_EQ(consumer, LinkedList<int>({ 0, 2, 3, 4, 5, 6, 7 }));
+
+		LinkedList<int> moved(std::move(consumer));
+		moved.splice(
+			moved.begin(), 
+			producer, 
+			producer.begin(), 
+			producer.end(), 
+			deferred_size
+		);
+		EXPECT_EQ(std::as_const(moved).size(), 7);
+
+		moved.recount();
+		EXPECT_EQ(moved.size(), 7);
+		EXPECT_EQ(moved.back(), 7);
+
+		LinkedList<int> repeated = { 1, 1, 2 };
+		LinkedList<int> more = { 2, 3, 3, 3 };
+		repeated.splice(repeated.end(), more, more.begin(), more.end(), deferred_size);
+
+		EXPECT_EQ(repeated.unique(), 4);
+		EXPECT_EQ(std::as_const(repeated).size(), 3);
+		EXPECT_EQ(repeated, LinkedList<int>({ 1, 2, 3 }));
+	}
+
+	// ------------------------------------------------------------------------
+	/// <summary>
+	/// Tests that a bulk load throwing partway destroys the elements it has
+	/// already built and frees their batch, both for ranges too short to 
+	/// batch and for ranges long enough to.
+	/// </summary> ------------------------------------------------------------
+	TEST(LinkedListBatchTest, ThrowingBatchConstructionDestroysBuiltElements) {
+		static int live = 0;
+
+		struct Counted {
+			int value;
+
+			explicit Counted(int v) : value(v) { 
+				if (v == 6)
+					throw std::runtime_error("element 6");
+				++live; 
+			}
+			Counted(const Counted& other) : value(other.value) { ++live; }
+			~Counted() { --live; }
+		};
+
+		using batches = NodeBatches<
+			LinkedList<Counted>::node_type, 
+			std::allocator<Counted>
+		>;
+
+		for (int count : { 10, static_cast<int>(batches::MIN_BATCH) }) {
+			auto elements = std::views::iota(0, count) 
+				| std::views::transform([](int v) { return Counted(v); });
+
+			EXPECT_THROW(
+				LinkedList<Counted>(elements.begin(), elements.end()), 
+				std::runtime_error
+			);
+			EXPECT_EQ(live, 0);
+		}
+	}
+}
@@ -0,0 +1,209 @@
+/* ============================================================================
+* Copyright (C) 2023 Ryan Eubank
+*
+* This program is free software: you can redistribute it and/or modify
+* it under the terms of the GNU General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License
+* along with this program.  If not, see <https://www.gnu.org/licenses/>.
+* ========================================================================= */
+
+
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <gtest/gtest.h>
+
+#include "containers/AVLTree.h"
+#include "containers/BinarySearchTree.h"
+#include "containers/ForwardList.h"
+#include "containers/LinkedList.h"
+#include "containers/RedBlackTree.h"
+#include "containers/SplayTree.h"
+#include "util/NodeArena.h"
+
+#include "../../collection_test_suites/access_tests/associative_search_tests.h"
+#include "../../collection_test_suites/insertion_tests/associative_insertion_tests.h"
+#include "../../collection_test_suites/removal_tests/associative_removal_tests.h"
+#include "../../collection_test_suites/list_algorithm_tests.h"
+#include "../../collection_test_suites/list_interface_tests.h"
+#include "../../collection_test_suites/list_node_recycling_tests.h"
+
+namespace collection_tests {
+
+	using namespace collections;
+
+	using test_params = testing::Types<
+		SimpleBST<std::string, std::less, ArenaAllocator>,
+		SimpleAVL<std::string, std::less, ArenaAllocator>,
+		MultiAVL<std::string, std::less, ArenaAllocator>,
+		SimpleRedBlackTree<std::string, std::less, ArenaAllocator>,
+		SimpleSplayTree<std::string, std::less, ArenaAllocator>
+	>;
+
+	INSTANTIATE_TYPED_TEST_SUITE_P(
+		NodeArenaTreeTest,
+		AssociativeSearchTests,
+		test_params
+	);
+
+	INSTANTIATE_TYPED_TEST_SUITE_P(
+		NodeArenaTreeTest,
+		AssociativeInsertionTests,
+		test_params
+	);
+
+	INSTANTIATE_TYPED_TEST_SUITE_P(
+		NodeArenaTreeTest,
+		AssociativeRemovalTests,
+		test_params
+	);
+
+	using list_params = testing::Types<
+		LinkedList<std::string, ArenaAllocator<std::string>>,
+		ForwardList<std::string, ArenaAllocator<std::string>>
+	>;
+
+	INSTANTIATE_TYPED_TEST_SUITE_P(
+		NodeArenaListTest,
+		ListInterfaceTests,
+		list_params
+	);
+
+	INSTANTIATE_TYPED_TEST_SUITE_P(
+		NodeArenaListTest,
+		ListAlgorithmTests,
+		list_params
+	);
+
+	INSTANTIATE_TYPED_TEST_SUITE_P(
+		NodeArenaListTest,
+		ListNodeRecyclingTests,
+		list_params
+	);
+
+	// ------------------------------------------------------------------------
+	/// <summary>
+	/// Tests that arena blocks round trip through their 32-bit index and 
+	/// that no live block is assigned the null index.
+	/// </summary> ------------------------------------------------------------
+	TEST(NodeArenaTest, IndicesRoundTripToBlockAddresses) {
+		using arena_type = NodeArena<>;
+		arena_type arena;
+
+		void* a = arena.allocate(24);
+		void* b = arena.allocate(24);
+
+		EXPECT_NE(arena_type::indexOf(a), 0u);
+		EXPECT_NE(arena_type::indexOf(a), arena_type::indexOf(b));
+		EXPECT_EQ(arena_type::addressOf(b, arena_type::indexOf(a)), a);
+		EXPECT_EQ(arena_type::addressOf(a, arena_type::indexOf(b)), b);
+		EXPECT_EQ(arena_type::indexOf(nullptr), 0u);
+		EXPECT_EQ(arena_type::addressOf(a, 0), nullptr);
+
+		arena.deallocate(a, 24);
+		arena.deallocate(b, 24);
+	}
+
+	// ------------------------------------------------------------------------
+	/// <summary>
+	/// Tests that freed blocks are handed back out before new segment space.
+	/// </summary> ------------------------------------------------------------
+	TEST(NodeArenaTest, FreedBlocksAreReused) {
+		NodeArena<> arena;
+
+		void* a = arena.allocate(40);
+		arena.deallocate(a, 40);
+		EXPECT_EQ(arena.allocate(40), a);
+
+		arena.deallocate(a, 40);
+	}
+
+	// ------------------------------------------------------------------------
+	/// <summary>
+	/// Tests that lists drawing from separate caller owned arenas keep their
+	/// links apart, including across assignments that move a list to the 
+	/// other arena.
+	/// </summary> ------------------------------------------------------------
+	TEST(NodeArenaTest, ListsUseTheArenaOfTheirAllocator) {
+		using allocator = ArenaAllocator<uint32_t>;
+		using compact_list = LinkedList<uint32_t, allocator>;
+
+		NodeArena<> first;
+		NodeArena<> second;
+
+		compact_list a({ 1, 2, 3 }, allocator(first));
+		compact_list b({ 4, 5 }, allocator(second));
+
+		EXPECT_NE(a.allocator(), b.allocator());
+		EXPECT_NE(a.allocator(), allocator());
+
+		compact_list c{ allocator(second) };
+		c = a;
+		EXPECT_EQ(c.allocator().arena(), &first);
+
+		b = std::move(a);
+		EXPECT_EQ(b.allocator().arena(), &first);
+
+		swap(b, c);
+		b.insertBack(6);
+		c.insertFront(0);
+
+		EXPECT_EQ(b, compact_list({ 1, 2, 3, 6 }));
+		EXPECT_EQ(c, compact_list({ 0, 1, 2, 3 }));
+	}
+
+	// ------------------------------------------------------------------------
+	/// <summary>
+	/// Tests that an arena allocator shrinks the links of tree nodes to 32
+	/// bits.
+	/// </summary> ------------------------------------------------------------
+	TEST(NodeArenaTest, TreeNodesUseCompactLinks) {
+		using compact_node = Node<uint32_t, ArenaAllocator<uint32_t>, 3>;
+		using pointer_node = Node<uint32_t, std::allocator<uint32_t>, 3>;
+
+		EXPECT_EQ(
+			sizeof(compact_node), 
+			sizeof(uint32_t) + 3 * sizeof(uint32_t)
+		);
+		EXPECT_LT(sizeof(compact_node), sizeof(pointer_node));
+	}
+
+	// ------------------------------------------------------------------------
+	/// <summary>
+	/// Tests that an arena allocator shrinks the links of list nodes to 32
+	/// bits, and that moved and swapped lists keep working with their 
+	/// sentinels allocated from the arena.
+	/// </summary> ------------------------------------------------------------
+	TEST(NodeArenaTest, ListNodesUseCompactLinks) {
+		using compact_list = LinkedList<uint32_t, ArenaAllocator<uint32_t>>;
+		using pointer_list = LinkedList<uint32_t>;
+
+		EXPECT_EQ(
+			sizeof(compact_list::node_type), 
+			sizeof(uint32_t) + 2 * sizeof(uint32_t)
+		);
+		EXPECT_LT(
+			sizeof(compact_list::node_type), 
+			sizeof(pointer_list::node_type)
+		);
+
+		compact_list a = { 1, 2, 3 };
+		compact_list b = { 4 };
+		swap(a, b);
+		compact_list c(std::move(b));
+		b = std::move(a);
+		c.insertBack(5);
+
+		EXPECT_EQ(b, compact_list({ 4 }));
+		EXPECT_EQ(c, compact_list({ 1, 2, 3, 5 }));
+		EXPECT_TRUE(a.isEmpty());
+	}
+}
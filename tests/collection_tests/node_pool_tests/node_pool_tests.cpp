@@ -0,0 +1,164 @@
+/* ============================================================================
+* Copyright (C) 2023 Ryan Eubank
+*
+* This program is free software: you can redistribute it and/or modify
+* it under the terms of the GNU General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License
+* along with this program.  If not, see <https://www.gnu.org/licenses/>.
+* ========================================================================= */
+
+
+#include <string>
+#include <thread>
+#include <gtest/gtest.h>
+
+#include "containers/ForwardList.h"
+#include "containers/LinkedList.h"
+#include "util/NodePool.h"
+
+#include "../../collection_test_suites/list_interface_tests.h"
+#include "../../collection_test_suites/insertion_tests/sequential_insertion_tests.h"
+#include "../../collection_test_suites/removal_tests/sequential_removal_tests.h"
+
+namespace collection_tests {
+
+	using namespace collections;
+
+	using test_params = testing::Types<
+		LinkedList<std::string, NodePool<std::string>>,
+		ForwardList<std::string, NodePool<std::string>>
+	>;
+
+	INSTANTIATE_TYPED_TEST_SUITE_P(
+		NodePoolListTest,
+		ListInterfaceTests,
+		test_params
+	);
+
+	INSTANTIATE_TYPED_TEST_SUITE_P(
+		NodePoolListTest,
+		SequentialInsertionTests,
+		test_params
+	);
+
+	INSTANTIATE_TYPED_TEST_SUITE_P(
+		NodePoolListTest,
+		SequentialRemovalTests,
+		test_params
+	);
+
+	// ------------------------------------------------------------------------
+	/// <summary>
+	/// Tests that freed blocks are handed back out before new slab space.
+	/// </summary> ------------------------------------------------------------
+	TEST(NodePoolTest, FreedBlocksAreReused) {
+		NodePoolResource resource;
+		NodePool<std::string> pool(resource);
+
+		std::string* a = pool.allocate(1);
+		std::string* b = pool.allocate(1);
+		EXPECT_NE(a, b);
+
+		pool.deallocate(a, 1);
+		EXPECT_EQ(pool.allocate(1), a);
+
+		pool.deallocate(a, 1);
+		pool.deallocate(b, 1);
+	}
+
+	// ------------------------------------------------------------------------
+	/// <summary>
+	/// Tests that rebound allocators share a resource and compare equal,
+	/// while pools over distinct resources do not.
+	/// </summary> ------------------------------------------------------------
+	TEST(NodePoolTest, RebindSharesResource) {
+		NodePoolResource resource;
+		NodePool<int> pool(resource);
+		NodePool<double> rebound(pool);
+
+		EXPECT_EQ(pool.resource(), rebound.resource());
+		EXPECT_TRUE(pool == rebound);
+		EXPECT_TRUE(NodePool<int>() == NodePool<long>());
+		EXPECT_FALSE(pool == NodePool<int>());
+	}
+
+	// ------------------------------------------------------------------------
+	/// <summary>
+	/// Tests that default pools draw from the resource of their thread, and
+	/// that a list keeps that resource alive after the thread has exited.
+	/// </summary> ------------------------------------------------------------
+	TEST(NodePoolTest, DefaultPoolsUseThreadResources) {
+		LinkedList<std::string, NodePool<std::string>> list;
+		NodePool<int> local;
+
+		std::thread([&]() {
+			NodePool<int> remote;
+			EXPECT_FALSE(remote == local);
+
+			LinkedList<std::string, NodePool<std::string>> built(remote);
+			for (int i = 0; i < 100; ++i)
+				built.insertBack(std::to_string(i));
+			list = std::move(built);
+		}).join();
+
+		EXPECT_FALSE(list.allocator() == local);
+		EXPECT_EQ(list.size(), 100);
+		EXPECT_EQ(list.back(), "99");
+
+		list.insertBack("100");
+		list.clear();
+	}
+
+	// ------------------------------------------------------------------------
+	/// <summary>
+	/// Tests that a list built on a caller owned resource allocates its
+	/// nodes contiguously from the resource's slabs.
+	/// </summary> ------------------------------------------------------------
+	TEST(NodePoolTest, ListNodesComeFromResource) {
+		NodePoolResource resource;
+		NodePool<int> pool(resource);
+		LinkedList<int, NodePool<int>> list(pool);
+
+		for (int i = 0; i < 1000; ++i)
+			list.insertBack(i);
+
+		EXPECT_EQ(list.allocator(), pool);
+
+		auto first = reinterpret_cast<uintptr_t>(&*list.begin());
+		auto second = reinterpret_cast<uintptr_t>(&*std::next(list.begin()));
+		auto nodeSize = sizeof(LinkedList<int>::node_type);
+		EXPECT_EQ(second - first, (nodeSize + 7) / 8 * 8);
+
+		list.clear();
+		for (int i = 0; i < 1000; ++i)
+			list.insertBack(i);
+		EXPECT_EQ(list.size(), 1000);
+	}
+
+	// ------------------------------------------------------------------------
+	/// <summary>
+	/// Tests that large and over aligned requests bypass the slabs.
+	/// </summary> ------------------------------------------------------------
+	TEST(NodePoolTest, LargeRequestsBypassSlabs) {
+		struct alignas(64) wide { char data[64]; };
+
+		NodePoolResource resource;
+		NodePool<wide> pool(resource);
+
+		wide* a = pool.allocate(1);
+		wide* b = pool.allocate(100);
+		EXPECT_EQ(reinterpret_cast<uintptr_t>(a) % 64, 0);
+		EXPECT_EQ(reinterpret_cast<uintptr_t>(b) % 64, 0);
+
+		pool.deallocate(b, 100);
+		pool.deallocate(a, 1);
+	}
+}
@@ -0,0 +1,141 @@
+/* ============================================================================
+* Copyright (C) 2023 Ryan Eubank
+*
+* This program is free software: you can redistribute it and/or modify
+* it under the terms of the GNU General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License
+* along with this program.  If not, see <https://www.gnu.org/licenses/>.
+* ========================================================================= */
+
+
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "adapters/MPSCQueue.h"
+
+namespace collection_tests {
+
+	using namespace collections;
+
+	// ------------------------------------------------------------------------
+	/// <summary>
+	/// Tests that elements are dequeued in the order they were enqueued.
+	/// </summary> ------------------------------------------------------------
+	TEST(MPSCQueueTest, DequeuesElementsInEnqueueOrder) {
+		MPSCQueue<std::string> queue;
+
+		ASSERT_TRUE(queue.isEmpty());
+
+		queue.enqueue_back("a");
+		queue.enqueue_back(std::string(64, 'b'));
+		queue.emplace_back(3, 'c');
+
+		EXPECT_EQ(queue.front(), "a");
+		queue.dequeue_front();
+		EXPECT_EQ(queue.front(), std::string(64, 'b'));
+		queue.dequeue_front();
+		EXPECT_EQ(queue.front(), "ccc");
+		queue.dequeue_front();
+
+		EXPECT_TRUE(queue.isEmpty());
+
+		queue.enqueue_back("d");
+		EXPECT_EQ(queue.front(), "d");
+	}
+
+	// ------------------------------------------------------------------------
+	/// <summary>
+	/// Tests that a batched dequeue moves at most the requested number of
+	/// elements, stopping when the queue is empty.
+	/// </summary> ------------------------------------------------------------
+	TEST(MPSCQueueTest, BatchedDequeueMovesElementsInOrder) {
+		MPSCQueue<std::string> queue;
+		std::vector<std::string> out;
+
+		for (int i = 0; i < 5; ++i)
+			queue.enqueue_back(std::to_string(i));
+
+		EXPECT_EQ(queue.dequeue_front(std::back_inserter(out), 3), 3u);
+		EXPECT_EQ(out, (std::vector<std::string>{ "0", "1", "2" }));
+
+		EXPECT_EQ(queue.dequeue_front(std::back_inserter(out), 10), 2u);
+		EXPECT_EQ(out.size(), 5u);
+		EXPECT_EQ(out.back(), "4");
+		EXPECT_TRUE(queue.isEmpty());
+	}
+
+	// ------------------------------------------------------------------------
+	/// <summary>
+	/// Tests that elements still queued on destruction are destroyed.
+	/// </summary> ------------------------------------------------------------
+	TEST(MPSCQueueTest, DestructorDestroysRemainingElements) {
+		auto tracker = std::make_shared<int>(0);
+
+		{
+			MPSCQueue<std::shared_ptr<int>> queue;
+			for (int i = 0; i < 3; ++i)
+				queue.enqueue_back(tracker);
+
+			queue.dequeue_front();
+			EXPECT_EQ(tracker.use_count(), 3);
+		}
+
+		EXPECT_EQ(tracker.use_count(), 1);
+	}
+
+	// ------------------------------------------------------------------------
+	/// <summary>
+	/// Tests that concurrent producers lose no elements and that each 
+	/// producer's elements are dequeued in the order it enqueued them.
+	/// </summary> ------------------------------------------------------------
+	TEST(MPSCQueueTest, ConcurrentProducersPreservePerProducerOrder) {
+		constexpr uint32_t producers = 4;
+		constexpr uint32_t per_producer = 20000;
+
+		MPSCQueue<uint64_t> queue;
+		std::vector<std::thread> threads;
+
+		for (uint32_t p = 0; p < producers; ++p) {
+			threads.emplace_back([&queue, p]() {
+				for (uint32_t i = 0; i < per_producer; ++i)
+					queue.enqueue_back((uint64_t(p) << 32) | i);
+			});
+		}
+
+		std::vector<uint32_t> expected(producers, 0);
+		std::vector<uint64_t> batch;
+		uint32_t received = 0;
+
+		while (received < producers * per_producer) {
+			batch.clear();
+			queue.dequeue_front(std::back_inserter(batch), 64);
+
+			for (uint64_t value : batch) {
+				uint32_t producer = static_cast<uint32_t>(value >> 32);
+				EXPECT_EQ(static_cast<uint32_t>(value), expected[producer]++);
+			}
+
+			received += static_cast<uint32_t>(batch.size());
+		}
+
+		for (auto& thread : threads)
+			thread.join();
+
+		EXPECT_TRUE(queue.isEmpty());
+		for (uint32_t count : expected)
+			EXPECT_EQ(count, per_producer);
+	}
+}
@@ -0,0 +1,108 @@
+/* ============================================================================
+* Copyright (C) 2023 Ryan Eubank
+*
+* This program is free software: you can redistribute it and/or modify
+* it under the terms of the GNU General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License
+* along with this program.  If not, see <https://www.gnu.org/licenses/>.
+* ========================================================================= */
+
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "containers/RankSelectBitVector.h"
+
+namespace collection_tests {
+
+	using namespace collections;
+
+	class RankSelectBitVectorInterfaceTest : public testing::Test {
+	protected:
+		// Every third bit set, spanning several superblocks.
+		std::vector<bool> makeBits(size_t size) {
+			std::vector<bool> bits(size);
+			for (size_t i = 0; i < size; i += 3)
+				bits[i] = true;
+			return bits;
+		}
+	};
+
+	// ------------------------------------------------------------------------
+	/// <summary>
+	/// Tests that rank1 and rank0 count the set and cleared bits strictly
+	/// before every position, including size().
+	/// </summary> ------------------------------------------------------------
+	TEST_F(RankSelectBitVectorInterfaceTest, RankCountsBitsBeforeIndex) {
+		auto input = makeBits(10000);
+		RankSelectBitVector<> bits(from_range, input);
+
+		size_t expected = 0;
+		for (size_t i = 0; i < input.size(); ++i) {
+			ASSERT_EQ(bits.rank1(i), expected) << "Index: " << i;
+			ASSERT_EQ(bits.rank0(i), i - expected) << "Index: " << i;
+			expected += input[i];
+		}
+
+		EXPECT_EQ(bits.rank1(bits.size()), expected);
+		EXPECT_EQ(bits.count(), expected);
+	}
+
+	// ------------------------------------------------------------------------
+	/// <summary>
+	/// Tests that select1 locates every set bit and returns size() when
+	/// asked for more set bits than exist.
+	/// </summary> ------------------------------------------------------------
+	TEST_F(RankSelectBitVectorInterfaceTest, SelectLocatesKthSetBit) {
+		auto input = makeBits(20000);
+		RankSelectBitVector<> bits(from_range, input);
+
+		size_t k = 0;
+		for (size_t i = 0; i < input.size(); ++i)
+			if (input[i])
+				ASSERT_EQ(bits.select1(k++), i) << "k: " << k - 1;
+
+		EXPECT_EQ(bits.select1(k), bits.size());
+	}
+
+	// ------------------------------------------------------------------------
+	/// <summary>
+	/// Tests that select inverts rank for sparse vectors where most
+	/// superblocks are empty.
+	/// </summary> ------------------------------------------------------------
+	TEST_F(RankSelectBitVectorInterfaceTest, SelectInvertsRankOnSparseBits) {
+		BitArray<> input(Size{ 100000 });
+		input.set(5);
+		input.set(4095);
+		input.set(4096);
+		input.set(70000);
+		input.set(99999);
+
+		RankSelectBitVector<> bits(input);
+
+		for (auto i = input.findFirst(); i < input.size(); i = input.findNext(i))
+			EXPECT_EQ(bits.select1(bits.rank1(i)), i);
+
+		EXPECT_EQ(bits.count(), 5);
+	}
+
+	// ------------------------------------------------------------------------
+	/// <summary>
+	/// Tests that an empty vector answers queries without reading past its
+	/// (absent) storage.
+	/// </summary> ------------------------------------------------------------
+	TEST_F(RankSelectBitVectorInterfaceTest, EmptyVectorHasZeroRank) {
+		RankSelectBitVector<> bits;
+
+		EXPECT_EQ(bits.rank1(0), 0);
+		EXPECT_EQ(bits.select1(0), 0);
+		EXPECT_TRUE(bits.isEmpty());
+	}
+}
@@ -0,0 +1,86 @@
+/* ============================================================================
+* Copyright (C) 2023 Ryan Eubank
+*
+* This program is free software: you can redistribute it and/or modify
+* it under the terms of the GNU General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License
+* along with this program.  If not, see <https://www.gnu.org/licenses/>.
+* ========================================================================= */
+
+#include <functional>
+#include <string>
+#include <gtest/gtest.h>
+
+#include "containers/RedBlackTree.h"
+
+#include "../../collection_test_suites/access_tests/associative_bound_tests.h"
+#include "../../collection_test_suites/access_tests/associative_search_tests.h"
+#include "../../collection_test_suites/access_tests/bag_tests.h"
+#include "../../collection_test_suites/access_tests/map_tests.h"
+#include "../../collection_test_suites/access_tests/order_statistic_tests.h"
+
+namespace collection_tests {
+
+	using tree_test_params = testing::Types <
+		SimpleRedBlackTree<std::string>,
+		MapRedBlackTree<uint8_t, std::string>,
+		MultiRedBlackTree<std::string>,
+		MultiMapRedBlackTree<uint8_t, std::string>
+	>;
+
+	using bag_test_params = testing::Types<
+		MultiRedBlackTree<std::string>,
+		MultiMapRedBlackTree<uint8_t, std::string>
+	>;
+
+	using map_test_params = testing::Types<
+		MapRedBlackTree<uint8_t, std::string>,
+		MultiMapRedBlackTree<uint8_t, std::string>
+	>;
+
+	using ranked_test_params = testing::Types<
+		RankedRedBlackTree<std::string>,
+		RankedMapRedBlackTree<uint8_t, std::string>,
+		RankedMultiRedBlackTree<std::string>,
+		RankedMultiMapRedBlackTree<uint8_t, std::string>
+	>;
+
+	INSTANTIATE_TYPED_TEST_SUITE_P(
+		RedBlackTreeTest,
+		AssociativeSearchTests,
+		tree_test_params
+	);
+
+
+	INSTANTIATE_TYPED_TEST_SUITE_P(
+		RedBlackTreeTest,
+		AssociativeBoundTests,
+		tree_test_params
+	);
+
+	INSTANTIATE_TYPED_TEST_SUITE_P(
+		RedBlackTreeTest,
+		BagTests,
+		bag_test_params
+	);
+
+	INSTANTIATE_TYPED_TEST_SUITE_P(
+		RedBlackTreeTest,
+		MapTests,
+		map_test_params
+	);
+
+	INSTANTIATE_TYPED_TEST_SUITE_P(
+		RedBlackTreeTest,
+		OrderStatisticTests,
+		ranked_test_params
+	);
+}
\ No newline at end of file
@@ -0,0 +1,265 @@
+/* ============================================================================
+* Copyright (C) 2023 Ryan Eubank
+*
+* This program is free software: you can redistribute it and/or modify
+* it under the terms of the GNU General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License
+* along with this program.  If not, see <https://www.gnu.org/licenses/>.
+* ========================================================================= */
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <numeric>
+#include <random>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "adapters/TreeTraversalAdapters.h"
+#include "containers/BinarySearchTree.h"
+#include "containers/RedBlackTree.h"
+
+#include "../../collection_test_suites/collection_test_fixture.h"
+
+namespace collection_tests {
+
+	using namespace collections;
+
+	class RedBlackTreeStructureTest : public CollectionTest<SimpleRedBlackTree<int>> {
+	protected:
+		struct colored_node {
+			int key;
+			bool isRed;
+		};
+
+		// rebuilds the tree from its pre-order sequence and checks that the 
+		// root is black, no red node has a red child, and every path holds 
+		// the same number of black nodes.
+		template <class tree_t>
+		void expectValidColoring(const tree_t& tree) {
+			std::vector<colored_node> nodes;
+
+			for (auto pos = tree.template begin<traversal_order::PRE_ORDER>(); pos != tree.end(); ++pos)
+				nodes.push_back({ *pos, tree.isRed(pos) });
+
+			ASSERT_EQ(nodes.size(), tree.size());
+
+			if (!nodes.empty())
+				EXPECT_FALSE(nodes.front().isRed);
+
+			std::size_t index = 0;
+			bool isValid = true;
+			blackHeightOf(nodes, index, std::numeric_limits<int>::min(), std::numeric_limits<int>::max(), false, isValid);
+
+			EXPECT_EQ(index, nodes.size());
+			EXPECT_TRUE(isValid);
+
+			auto limit = 2 * std::log2(static_cast<double>(tree.size() + 1));
+			EXPECT_LE(static_cast<double>(tree.height()), limit);
+		}
+
+		int blackHeightOf(
+			const std::vector<colored_node>& nodes,
+			std::size_t& index,
+			int low,
+			int high,
+			bool isParentRed,
+			bool& isValid
+		) {
+			if (index == nodes.size() || nodes[index].key < low || nodes[index].key > high)
+				return 0;
+
+			colored_node n = nodes[index++];
+
+			if (n.isRed && isParentRed)
+				isValid = false;
+
+			int leftHeight = blackHeightOf(nodes, index, low, n.key, n.isRed, isValid);
+			int rightHeight = blackHeightOf(nodes, index, n.key, high, n.isRed, isValid);
+
+			if (leftHeight != rightHeight)
+				isValid = false;
+
+			return leftHeight + (n.isRed ? 0 : 1);
+		}
+
+		template <class tree_t>
+		std::vector<bool> colorsOf(const tree_t& tree) {
+			std::vector<bool> colors;
+
+			for (auto pos = tree.template begin<traversal_order::PRE_ORDER>(); pos != tree.end(); ++pos)
+				colors.push_back(tree.isRed(pos));
+
+			return colors;
+		}
+	};
+
+	TEST_F(RedBlackTreeStructureTest, InsertionRecolorsAndRotates) {
+		SimpleRedBlackTree<int> tree;
+
+		tree.insert(0);
+		tree.insert(1);
+
+		// 0 (black) with a red right child 1, so inserting 2 rotates left.
+		tree.insert(2);
+
+		auto preOrder = { 1, 0, 2 };
+		this->expectSequence(tree.begin<traversal_order::PRE_ORDER>(), tree.end(), preOrder);
+		EXPECT_EQ(colorsOf(tree), std::vector<bool>({ false, true, true }));
+
+		// the red uncle 0 is recolored rather than rotated.
+		tree.insert(3);
+
+		EXPECT_EQ(colorsOf(tree), std::vector<bool>({ false, false, false, true }));
+		expectValidColoring(tree);
+	}
+
+	TEST_F(RedBlackTreeStructureTest, SequentialInsertionKeepsTreeBalanced) {
+		SimpleRedBlackTree<int> ascending;
+		SimpleRedBlackTree<int> descending;
+
+		for (int i = 0; i < 1000; ++i) {
+			ascending.insert(i);
+			descending.insert(999 - i);
+		}
+
+		expectValidColoring(ascending);
+		expectValidColoring(descending);
+	}
+
+	TEST_F(RedBlackTreeStructureTest, RandomOperationsKeepTreeValid) {
+		std::mt19937 rng(11);
+		std::uniform_int_distribution<int> keys(0, 400);
+		SimpleRedBlackTree<int> tree;
+		std::set<int> expected;
+
+		for (int step = 0; step < 4000; ++step) {
+			int key = keys(rng);
+
+			if (rng() % 2) {
+				tree.insert(key);
+				expected.insert(key);
+			}
+			else if (auto pos = tree.find(key); pos != tree.end()) {
+				tree.remove(pos);
+				expected.erase(key);
+			}
+
+			if (step % 50 == 0)
+				expectValidColoring(tree);
+		}
+
+		expectValidColoring(tree);
+		EXPECT_TRUE(std::equal(tree.begin(), tree.end(), expected.begin(), expected.end()));
+
+		while (!tree.isEmpty()) {
+			tree.remove(tree.root());
+			expectValidColoring(tree);
+		}
+	}
+
+	TEST_F(RedBlackTreeStructureTest, RemovalKeepsRanksAndDuplicates) {
+		std::mt19937 rng(5);
+		std::uniform_int_distribution<int> keys(0, 60);
+		RankedMultiRedBlackTree<int> tree;
+		std::multiset<int> expected;
+
+		for (int i = 0; i < 2000; ++i) {
+			int key = keys(rng);
+			tree.insert(key);
+			expected.insert(key);
+		}
+
+		for (int i = 0; i < 1500; ++i) {
+			int key = keys(rng);
+
+			if (auto pos = tree.find(key); pos != tree.end()) {
+				tree.remove(pos);
+				expected.erase(expected.find(key));
+			}
+		}
+
+		ASSERT_EQ(tree.size(), expected.size());
+		EXPECT_TRUE(std::equal(tree.begin(), tree.end(), expected.begin(), expected.end()));
+
+		auto element = expected.begin();
+		for (std::size_t i = 0; i < expected.size(); ++i)
+			EXPECT_EQ(*tree.nth(i), *element++);
+
+		for (int key = 0; key <= 60; ++key)
+			EXPECT_EQ(tree.rankOf(key), std::distance(expected.begin(), expected.lower_bound(key)));
+	}
+
+	TEST_F(RedBlackTreeStructureTest, SortedRangeBuildsValidColoring) {
+		for (int count = 1; count <= 130; ++count) {
+			std::vector<int> elements(count);
+			std::iota(elements.begin(), elements.end(), 0);
+
+			SimpleRedBlackTree<int> tree(elements.begin(), elements.end());
+
+			expectValidColoring(tree);
+			EXPECT_EQ(tree.height(), std::bit_width(static_cast<unsigned>(count)) - 1);
+
+			tree.insert(count);
+			tree.remove(tree.find(0));
+			expectValidColoring(tree);
+		}
+	}
+
+	TEST_F(RedBlackTreeStructureTest, ColorsAddNoSpaceToNodes) {
+		// the color shares the parent link, so nodes are no larger than the 
+		// nodes of an unbalanced tree.
+		EXPECT_EQ(
+			sizeof(SimpleRedBlackTree<std::int64_t>::node_type), 
+			sizeof(SimpleBST<std::int64_t>::node_type)
+		);
+		EXPECT_EQ(
+			sizeof(RankedRedBlackTree<std::int64_t>::node_type), 
+			sizeof(BinarySearchTree<
+				std::int64_t, std::less<std::int64_t>, std::allocator<std::int64_t>, false, true
+			>::node_type)
+		);
+
+		// walking back up through the parent links must strip the colors.
+		SimpleRedBlackTree<std::int64_t> tree;
+		for (std::int64_t i = 0; i < 200; ++i)
+			tree.insert(i);
+
+		expectValidColoring(tree);
+		std::int64_t expected = 200;
+		for (auto pos = tree.rbegin(); pos != tree.rend(); ++pos)
+			EXPECT_EQ(*pos, --expected);
+
+		EXPECT_EQ(expected, 0);
+	}
+
+	TEST_F(RedBlackTreeStructureTest, CopyPreservesTreeStructureAndColors) {
+		SimpleRedBlackTree<int> tree;
+
+		for (int i = 0; i < 100; ++i)
+			tree.insert((i * 37) % 100);
+
+		SimpleRedBlackTree<int> copy(tree);
+
+		EXPECT_TRUE(std::ranges::equal(
+			tree.begin<traversal_order::PRE_ORDER>(), tree.end(),
+			copy.begin<traversal_order::PRE_ORDER>(), copy.end()
+		));
+		EXPECT_EQ(colorsOf(copy), colorsOf(tree));
+		expectValidColoring(copy);
+	}
+}
@@ -0,0 +1,199 @@
+/* ============================================================================
+* Copyright (C) 2023 Ryan Eubank
+*
+* This program is free software: you can redistribute it and/or modify
+* it under the terms of the GNU General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License
+* along with this program.  If not, see <https://www.gnu.org/licenses/>.
+* ========================================================================= */
+
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include <ranges>
+#include <stdexcept>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "containers/SkipList.h"
+
+namespace collection_tests {
+
+	using namespace collections;
+
+	class SkipListInterfaceTest : public testing::Test {
+	protected:
+		SkipList<int> _list;
+		std::vector<int> _expected;
+		std::mt19937 _random{ 42 };
+
+		void SetUp() override {
+			for (int i = 0; i < 200; ++i) {
+				_list.insertBack(i);
+				_expected.push_back(i);
+			}
+		}
+
+		size_t randomIndex(size_t bound) {
+			return std::uniform_int_distribution<size_t>(0, bound)(_random);
+		}
+
+		// Checks every element through both iteration and indexed access, 
+		// which relies on the link widths being correct at every level.
+		void expectMatches(const SkipList<int>& list, const std::vector<int>& expected) {
+			ASSERT_EQ(list.size(), expected.size());
+			EXPECT_TRUE(std::ranges::equal(list, expected));
+			EXPECT_TRUE(std::ranges::equal(
+				list | std::views::reverse, 
+				expected | std::views::reverse
+			));
+
+			for (size_t i = 0; i < expected.size(); ++i)
+				EXPECT_EQ(list[i], expected[i]);
+		}
+	};
+
+	// ------------------------------------------------------------------------
+	/// <summary>
+	/// Tests that random insertions and removals by index agree with a 
+	/// vector performing the same operations.
+	/// </summary> ------------------------------------------------------------
+	TEST_F(SkipListInterfaceTest, RandomIndexOperationsMatchVector) {
+		for (int i = 0; i < 500; ++i) {
+			if (i % 3 == 2) {
+				size_t index = randomIndex(_expected.size() - 1);
+				_list.remove(Index(index));
+				_expected.erase(_expected.begin() + index);
+			}
+			else {
+				size_t index = randomIndex(_expected.size());
+				_list.insert(Index(index), 1000 + i);
+				_expected.insert(_expected.begin() + index, 1000 + i);
+			}
+		}
+
+		expectMatches(_list, _expected);
+	}
+
+	// ------------------------------------------------------------------------
+	/// <summary>
+	/// Tests that indexOf returns the index of the element an iterator 
+	/// points to.
+	/// </summary> ------------------------------------------------------------
+	TEST_F(SkipListInterfaceTest, IndexOfReturnsIteratorIndex) {
+		size_t index = 0;
+		for (auto it = _list.begin(); it != _list.end(); ++it, ++index)
+			EXPECT_EQ(_list.indexOf(it), index);
+
+		EXPECT_EQ(_list.indexOf(_list.end()), _list.size());
+	}
+
+	// ------------------------------------------------------------------------
+	/// <summary>
+	/// Tests that range insertion and removal by index keep the list 
+	/// consistent.
+	/// </summary> ------------------------------------------------------------
+	TEST_F(SkipListInterfaceTest, RangeOperationsMatchVector) {
+		std::vector<int> values(77);
+		std::iota(values.begin(), values.end(), 5000);
+
+		_list.insert(Index(50), values.begin(), values.end());
+		_expected.insert(_expected.begin() + 50, values.begin(), values.end());
+		expectMatches(_list, _expected);
+
+		_list.remove(IndexRange{ 20, 180 });
+		_expected.erase(_expected.begin() + 20, _expected.begin() + 180);
+		expectMatches(_list, _expected);
+
+		EXPECT_THROW(_list.remove(IndexRange{ 10, 5 }), std::out_of_range);
+		EXPECT_THROW(_list.insert(Index(500), 1), std::out_of_range);
+	}
+
+	// ------------------------------------------------------------------------
+	/// <summary>
+	/// Tests that splicing a range between lists moves the nodes and keeps
+	/// indexed access correct in both lists.
+	/// </summary> ------------------------------------------------------------
+	TEST_F(SkipListInterfaceTest, SpliceBetweenListsMovesRange) {
+		SkipList<int> other;
+		std::vector<int> otherExpected;
+		for (int i = 0; i < 50; ++i) {
+			other.insertBack(-i);
+			otherExpected.push_back(-i);
+		}
+
+		auto first = std::next(_list.begin(), 30);
+		const int* address = &*first;
+		other.splice(
+			std::next(other.begin(), 10), _list, first, std::next(first, 120));
+
+		otherExpected.insert(
+			otherExpected.begin() + 10, 
+			_expected.begin() + 30, 
+			_expected.begin() + 150
+		);
+		_expected.erase(_expected.begin() + 30, _expected.begin() + 150);
+
+		expectMatches(_list, _expected);
+		expectMatches(other, otherExpected);
+		EXPECT_EQ(&other[10], address);
+	}
+
+	// ------------------------------------------------------------------------
+	/// <summary>
+	/// Tests that splicing ranges within the same list in either direction
+	/// reorders the elements correctly.
+	/// </summary> ------------------------------------------------------------
+	TEST_F(SkipListInterfaceTest, SpliceWithinListReordersRange) {
+		for (int i = 0; i < 100; ++i) {
+			size_t first = randomIndex(_expected.size() - 1);
+			size_t last = first + 1 + randomIndex(_expected.size() - first - 1);
+			size_t span = last - first;
+			size_t target = randomIndex(_expected.size() - span);
+			size_t position = target <= first ? target : target + span;
+
+			_list.splice(
+				std::next(_list.begin(), position), 
+				_list,
+				std::next(_list.begin(), first), 
+				std::next(_list.begin(), last)
+			);
+
+			std::vector<int> moved(
+				_expected.begin() + first, _expected.begin() + last);
+			_expected.erase(_expected.begin() + first, _expected.begin() + last);
+			_expected.insert(_expected.begin() + target, moved.begin(), moved.end());
+		}
+
+		expectMatches(_list, _expected);
+	}
+
+	// ------------------------------------------------------------------------
+	/// <summary>
+	/// Tests that moving and swapping lists preserves indexed access.
+	/// </summary> ------------------------------------------------------------
+	TEST_F(SkipListInterfaceTest, MoveAndSwapPreserveIndexing) {
+		SkipList<int> moved(std::move(_list));
+		EXPECT_TRUE(_list.isEmpty());
+		expectMatches(moved, _expected);
+
+		SkipList<int> other = { 1, 2, 3 };
+		swap(moved, other);
+		expectMatches(other, _expected);
+		expectMatches(moved, { 1, 2, 3 });
+
+		moved.insertFront(0);
+		other.removeBack();
+		_expected.pop_back();
+		expectMatches(moved, { 0, 1, 2, 3 });
+		expectMatches(other, _expected);
+	}
+}
@@ -0,0 +1,127 @@
+/* ============================================================================
+* Copyright (C) 2023 Ryan Eubank
+*
+* This program is free software: you can redistribute it and/or modify
+* it under the terms of the GNU General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License
+* along with this program.  If not, see <https://www.gnu.org/licenses/>.
+* ========================================================================= */
+
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "containers/SlotMap.h"
+
+namespace collection_tests {
+
+	using namespace collections;
+
+	class SlotMapInterfaceTest : public testing::Test {
+	protected:
+		SlotMap<std::string> _map;
+		std::vector<SlotHandle> _handles;
+
+		void SetUp() override {
+			for (auto value : { "a", "b", "c", "d", "e" })
+				_handles.push_back(_map.insert(value));
+		}
+	};
+
+	// ------------------------------------------------------------------------
+	/// <summary>
+	/// Tests that handles look up the values they were issued for.
+	/// </summary> ------------------------------------------------------------
+	TEST_F(SlotMapInterfaceTest, HandlesLookUpValues) {
+		EXPECT_EQ(_map.size(), 5);
+		EXPECT_EQ(_map[_handles[0]], "a");
+		EXPECT_EQ(_map.at(_handles[4]), "e");
+		EXPECT_EQ(*_map.find(_handles[2]), "c");
+		EXPECT_EQ(_map.handleOf(_map.begin() + 3), _handles[3]);
+	}
+
+	// ------------------------------------------------------------------------
+	/// <summary>
+	/// Tests that removal keeps values dense and handles to the remaining
+	/// values valid.
+	/// </summary> ------------------------------------------------------------
+	TEST_F(SlotMapInterfaceTest, RemoveKeepsOtherHandlesValid) {
+		EXPECT_TRUE(_map.remove(_handles[1]));
+		EXPECT_FALSE(_map.remove(_handles[1]));
+
+		std::vector<std::string> expected = { "a", "e", "c", "d" };
+		EXPECT_TRUE(std::ranges::equal(_map, expected));
+
+		for (size_t i : { 0, 2, 3, 4 })
+			EXPECT_EQ(_map.at(_handles[i]), std::string(1, char('a' + i)));
+
+		EXPECT_FALSE(_map.contains(_handles[1]));
+		EXPECT_EQ(_map.find(_handles[1]), _map.end());
+		EXPECT_THROW(static_cast<void>(_map.at(_handles[1])), std::out_of_range);
+	}
+
+	// ------------------------------------------------------------------------
+	/// <summary>
+	/// Tests that a reused slot issues a new generation so stale handles do
+	/// not alias the new value.
+	/// </summary> ------------------------------------------------------------
+	TEST_F(SlotMapInterfaceTest, ReusedSlotsRejectStaleHandles) {
+		_map.remove(_handles[2]);
+		auto handle = _map.insert("f");
+
+		EXPECT_EQ(handle.index, _handles[2].index);
+		EXPECT_NE(handle.generation, _handles[2].generation);
+		EXPECT_FALSE(_map.contains(_handles[2]));
+		EXPECT_EQ(_map[handle], "f");
+	}
+
+	// ------------------------------------------------------------------------
+	/// <summary>
+	/// Tests that clear invalidates every handle and range removal leaves
+	/// the remaining handles valid.
+	/// </summary> ------------------------------------------------------------
+	TEST_F(SlotMapInterfaceTest, ClearAndRangeRemove) {
+		_map.remove(_map.begin() + 1, _map.begin() + 3);
+		EXPECT_EQ(_map.size(), 3);
+		EXPECT_FALSE(_map.contains(_handles[1]));
+		EXPECT_FALSE(_map.contains(_handles[2]));
+		EXPECT_EQ(_map[_handles[3]], "d");
+		EXPECT_EQ(_map[_handles[4]], "e");
+
+		_map.clear();
+		EXPECT_TRUE(_map.isEmpty());
+		for (auto handle : _handles)
+			EXPECT_FALSE(_map.contains(handle));
+
+		auto handle = _map.insert("g");
+		EXPECT_EQ(_map.at(handle), "g");
+	}
+
+	// ------------------------------------------------------------------------
+	/// <summary>
+	/// Tests that copies share valid handles and that the map round trips
+	/// through the stream operators.
+	/// </summary> ------------------------------------------------------------
+	TEST_F(SlotMapInterfaceTest, CopyAndStreams) {
+		SlotMap<std::string> copy = _map;
+		EXPECT_EQ(copy, _map);
+		EXPECT_EQ(copy.at(_handles[3]), "d");
+
+		SlotMap<std::string> result;
+		std::stringstream stream;
+		stream << _map;
+		stream >> result;
+		EXPECT_EQ(result, _map);
+	}
+}
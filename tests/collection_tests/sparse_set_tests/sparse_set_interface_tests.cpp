@@ -0,0 +1,149 @@
+/* ============================================================================
+* Copyright (C) 2023 Ryan Eubank
+*
+* This program is free software: you can redistribute it and/or modify
+* it under the terms of the GNU General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License
+* along with this program.  If not, see <https://www.gnu.org/licenses/>.
+* ========================================================================= */
+
+
+#include <algorithm>
+#include <cstddef>
+#include <limits>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "containers/SparseSet.h"
+
+namespace collection_tests {
+
+	using namespace collections;
+
+	class SparseSetInterfaceTest : public testing::Test {
+	protected:
+		SparseSet<int> _set = { 5, 1, 9, 3, 100 };
+	};
+
+	// ------------------------------------------------------------------------
+	/// <summary>
+	/// Tests that keys are stored densely in insertion order and that
+	/// duplicate insertions return the existing key.
+	/// </summary> ------------------------------------------------------------
+	TEST_F(SparseSetInterfaceTest, InsertKeepsDenseOrder) {
+		std::vector<int> expected = { 5, 1, 9, 3, 100 };
+		EXPECT_TRUE(std::ranges::equal(_set, expected));
+
+		auto existing = _set.insert(9);
+		EXPECT_EQ(existing, _set.begin() + 2);
+		EXPECT_EQ(_set.size(), 5);
+		EXPECT_GE(_set.universe(), 101);
+	}
+
+	// ------------------------------------------------------------------------
+	/// <summary>
+	/// Tests that contains and find reject keys outside of the set,
+	/// including keys beyond the sparse array and negative keys.
+	/// </summary> ------------------------------------------------------------
+	TEST_F(SparseSetInterfaceTest, ContainsChecksMembership) {
+		for (int key : { 5, 1, 9, 3, 100 }) {
+			EXPECT_TRUE(_set.contains(key)) << key;
+			EXPECT_EQ(*_set.find(key), key);
+		}
+
+		for (int key : { 0, 2, 99, 101, 100000, -1 }) {
+			EXPECT_FALSE(_set.contains(key)) << key;
+			EXPECT_EQ(_set.find(key), _set.end());
+		}
+	}
+
+	// ------------------------------------------------------------------------
+	/// <summary>
+	/// Tests that removal moves the last key into the hole and keeps
+	/// lookups for the moved key valid.
+	/// </summary> ------------------------------------------------------------
+	TEST_F(SparseSetInterfaceTest, RemoveSwapsWithLast) {
+		auto next = _set.remove(_set.find(1));
+
+		EXPECT_EQ(*next, 100);
+		EXPECT_FALSE(_set.contains(1));
+		EXPECT_EQ(_set.find(100), _set.begin() + 1);
+
+		_set.remove(_set.begin() + 1, _set.begin() + 3);
+		EXPECT_EQ(_set.size(), 2);
+		EXPECT_TRUE(_set.contains(5));
+		EXPECT_TRUE(_set.contains(3));
+		EXPECT_FALSE(_set.contains(100));
+		EXPECT_FALSE(_set.contains(9));
+
+		auto last = _set.remove(_set.find(3));
+		EXPECT_EQ(last, _set.end());
+	}
+
+	// ------------------------------------------------------------------------
+	/// <summary>
+	/// Tests that clear empties the set without invalidating reinsertion of
+	/// previously present keys.
+	/// </summary> ------------------------------------------------------------
+	TEST_F(SparseSetInterfaceTest, ClearThenReinsert) {
+		_set.clear();
+		EXPECT_TRUE(_set.isEmpty());
+
+		for (int key : { 5, 1, 9, 3, 100 })
+			EXPECT_FALSE(_set.contains(key));
+
+		_set.insert(9);
+		_set.insert(1);
+		EXPECT_TRUE(_set.contains(9));
+		EXPECT_TRUE(_set.contains(1));
+		EXPECT_FALSE(_set.contains(5));
+		EXPECT_EQ(_set.size(), 2);
+	}
+
+	// ------------------------------------------------------------------------
+	/// <summary>
+	/// Tests that equality ignores insertion order and that the set round
+	/// trips through the stream operators.
+	/// </summary> ------------------------------------------------------------
+	TEST_F(SparseSetInterfaceTest, EqualityAndStreams) {
+		SparseSet<int> reordered = { 100, 3, 9, 1, 5 };
+		EXPECT_EQ(_set, reordered);
+
+		reordered.remove(reordered.find(9));
+		EXPECT_NE(_set, reordered);
+
+		SparseSet<int> result;
+		std::stringstream stream;
+		stream << _set;
+		stream >> result;
+		EXPECT_EQ(_set, result);
+	}
+
+	// ------------------------------------------------------------------------
+	/// <summary>
+	/// Tests that keys which cannot index the sparse array are rejected
+	/// without growing the set.
+	/// </summary> ------------------------------------------------------------
+	TEST_F(SparseSetInterfaceTest, InsertRejectsKeysOutOfRange) {
+		auto universe = _set.universe();
+
+		EXPECT_THROW(_set.insert(-1), std::out_of_range);
+		EXPECT_THROW(_set.emplace(std::numeric_limits<int>::min()), std::out_of_range);
+		EXPECT_EQ(_set.size(), 5);
+		EXPECT_EQ(_set.universe(), universe);
+
+		SparseSet<std::size_t> wide;
+		EXPECT_THROW(wide.insert(std::numeric_limits<std::size_t>::max()), std::out_of_range);
+		EXPECT_TRUE(wide.isEmpty());
+	}
+}
\ No newline at end of file
@@ -15,8 +15,16 @@
 * along with this program.  If not, see <https://www.gnu.org/licenses/>.
 * ========================================================================= */
 
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <numeric>
+#include <random>
+#include <set>
 #include <string>
 #include <utility>
+#include <vector>
 #include <gtest/gtest.h>
 
 #include "adapters/TreeTraversalAdapters.h"
@@ -744,4 +752,237 @@ namespace collection_tests {
 		this->expectSequence(tree.begin<traversal_order::PRE_ORDER>(), tree.end(), preOrder);
 		this->expectSequence(tree.begin<traversal_order::IN_ORDER>(), tree.end(), inOrder);
 	}
+
+	TEST_F(SplayTreeStructureTest, CachedHeightsMatchComputedHeights) {
+		using HeightCachedSplayTree = SplayTree<
+			int, std::less<int>, std::allocator<int>, false, true, true
+		>;
+
+		std::vector<int> keys(500);
+		std::iota(keys.begin(), keys.end(), 0);
+		std::shuffle(keys.begin(), keys.end(), std::mt19937{ 42 });
+
+		SimpleSplayTree<int> expected(keys.begin(), keys.end());
+		HeightCachedSplayTree tree(keys.begin(), keys.end());
+
+		auto expectSameShape = [&]() {
+			ASSERT_EQ(tree.size(), expected.size());
+			EXPECT_EQ(tree.height(), expected.height());
+
+			auto it = expected.begin();
+			for (auto position = tree.begin(); position != tree.end(); ++position) {
+				EXPECT_EQ(*position, *it);
+				EXPECT_EQ(tree.heightOf(position), expected.heightOf(it++));
+			}
+		};
+
+		expectSameShape();
+
+		for (size_t index = 0; index < keys.size(); index += 3) {
+			static_cast<void>(tree.find(keys[index]));
+			static_cast<void>(expected.find(keys[index]));
+		}
+
+		expectSameShape();
+
+		for (size_t index = 0; index < keys.size(); index += 2) {
+			tree.remove(tree.find(keys[index]));
+			expected.remove(expected.find(keys[index]));
+		}
+
+		expectSameShape();
+		EXPECT_EQ(*tree.nth(tree.size() / 2), *std::next(expected.begin(), expected.size() / 2));
+	}
+
+	TEST_F(SplayTreeStructureTest, TopDownInsertSplaysNewElementsToTheRoot) {
+		TopDownSplayTree<int> tree{};
+
+		for (const auto& e : this->elements) {
+			tree.insert(e);
+			EXPECT_EQ(*tree.root(), e);
+		}
+
+		tree.insert(5);
+
+		auto expectedInOrder = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+
+		EXPECT_EQ(*tree.root(), 5);
+		EXPECT_EQ(tree.size(), this->elements.size());
+		this->expectSequence(tree.begin(), tree.end(), expectedInOrder);
+	}
+
+	TEST_F(SplayTreeStructureTest, TopDownSearchSplaysElementsToTheRoot) {
+		TopDownSplayTree<int> tree(this->elements.begin(), this->elements.end());
+
+		for (int e : { 5, 9, 2, 3, 0, 7 }) {
+			EXPECT_EQ(*tree.find(e), e);
+			EXPECT_EQ(*tree.root(), e);
+		}
+
+		auto expectedInOrder = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+
+		EXPECT_EQ(tree.find(15), tree.end());
+		EXPECT_EQ(*tree.minimum(), 0);
+		EXPECT_EQ(*tree.maximum(), 9);
+		this->expectSequence(tree.begin(), tree.end(), expectedInOrder);
+	}
+
+	TEST_F(SplayTreeStructureTest, TopDownLowerBoundFindsFirstElementNotLess) {
+		TopDownSplayTree<int> tree = { 4, 10, 2, 0, 12, 6, 18, 16, 14, 8 };
+
+		for (int key = -1; key < 18; key += 2)
+			EXPECT_EQ(*tree.lowerBound(key), key + 1);
+
+		EXPECT_EQ(*tree.lowerBound(8), 8);
+		auto expectedInOrder = { 0, 2, 4, 6, 8, 10, 12, 14, 16, 18 };
+
+		EXPECT_EQ(tree.lowerBound(19), tree.end());
+		this->expectSequence(tree.begin(), tree.end(), expectedInOrder);
+	}
+
+	TEST_F(SplayTreeStructureTest, TopDownPlacesDuplicateElementsInCorrectPosition) {
+		using TopDownMultiMapSplayTree = SplayTree<
+			key_value_pair<const int, std::string>,
+			std::less<int>,
+			std::allocator<key_value_pair<int, std::string>>,
+			true, false, false, true
+		>;
+
+		TopDownMultiMapSplayTree tree = { 
+			{ 4, "4"},
+			{ 7, "7a"},
+			{ 12, "12" },
+			{ 7, "7b" },
+			{ 5, "5" },
+			{ 0, "0" },
+			{ 8, "8" },
+			{ 7, "7c" }
+		};
+
+		std::initializer_list<key_value_pair<int, std::string>> inOrder = { 
+			{ 0, "0" }, 
+			{ 4, "4"}, 
+			{ 5, "5" }, 
+			{ 7, "7c" }, 
+			{ 7, "7b" }, 
+			{ 7, "7a" }, 
+			{ 8, "8" }, 
+			{ 12, "12" }
+		};
+
+		this->expectSequence(tree.begin<traversal_order::IN_ORDER>(), tree.end(), inOrder);
+		EXPECT_EQ(tree.find(7)->value(), "7c");
+		EXPECT_EQ(tree.lowerBound(6)->value(), "7c");
+	}
+
+	TEST_F(SplayTreeStructureTest, TopDownRandomOperationsMatchStandardMultiSet) {
+		using RankedTopDownSplayTree = SplayTree<
+			int, std::less<int>, std::allocator<int>, true, true, true, true
+		>;
+
+		std::mt19937 rng(11);
+		std::uniform_int_distribution<int> keys(0, 200);
+		RankedTopDownSplayTree tree;
+		std::multiset<int> expected;
+
+		for (int step = 0; step < 5000; ++step) {
+			int key = keys(rng);
+
+			if (rng() % 3) {
+				tree.insert(key);
+				expected.insert(key);
+			}
+			else if (auto pos = tree.find(key); pos != tree.end()) {
+				tree.remove(pos);
+				expected.erase(expected.find(key));
+			}
+			else
+				EXPECT_FALSE(expected.contains(key));
+		}
+
+		ASSERT_EQ(tree.size(), expected.size());
+		EXPECT_TRUE(std::equal(tree.begin(), tree.end(), expected.begin(), expected.end()));
+		EXPECT_EQ(*tree.minimum(), *expected.begin());
+		EXPECT_EQ(*tree.maximum(), *expected.rbegin());
+
+		for (int key = 0; key <= 200; ++key)
+			EXPECT_EQ(tree.rankOf(key), std::distance(expected.begin(), expected.lower_bound(key)));
+
+		EXPECT_EQ(tree.height(), tree.heightOf(tree.root()));
+	}
+
+	TEST_F(SplayTreeStructureTest, ConstTreeSplaysOnSearchWhenSplayingReads) {
+		using ReadSplayTree = SplayTree<
+			int, std::less<int>, std::allocator<int>, false, false, false, false, always_splay
+		>;
+
+		// splaying reads restructures the tree behind const access, so the
+		// tree itself must not be defined const.
+		ReadSplayTree splayed(this->elements.begin(), this->elements.end());
+		const ReadSplayTree& tree = splayed;
+
+		for (int e : { 5, 9, 2, 3 }) {
+			EXPECT_EQ(*tree.find(e), e);
+			EXPECT_EQ(*tree.root(), e);
+		}
+
+		EXPECT_EQ(*tree.lowerBound(7), 7);
+		EXPECT_EQ(*tree.root(), 7);
+
+		EXPECT_EQ(*tree.upperBound(7), 8);
+		EXPECT_EQ(*tree.root(), 8);
+
+		auto expectedInOrder = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+		this->expectSequence(tree.begin(), tree.end(), expectedInOrder);
+	}
+
+	TEST_F(SplayTreeStructureTest, SemiSplayHalvesAccessedPath) {
+		using SemiSplayTree = SplayTree<
+			int, std::less<int>, std::allocator<int>, false, false, false, false, semi_splay
+		>;
+
+		std::vector<int> keys(64);
+		std::iota(keys.begin(), keys.end(), 0);
+
+		// ascending inserts splay fully and leave a single left path.
+		SemiSplayTree tree;
+		for (int key : keys)
+			tree.insert(key);
+
+		EXPECT_EQ(tree.height(), 63);
+		EXPECT_EQ(*tree.find(0), 0);
+
+		EXPECT_NE(*tree.root(), 0);
+		EXPECT_LE(tree.height(), 32);
+		this->expectSequence(tree.begin(), tree.end(), keys);
+	}
+
+	TEST_F(SplayTreeStructureTest, PeriodicSplayOnlySplaysEveryPeriodLookups) {
+		using PeriodicSplayTree = SplayTree<
+			int, std::less<int>, std::allocator<int>, false, false, false, false, periodic_splay<3>
+		>;
+
+		using TopDownPeriodicSplayTree = SplayTree<
+			int, std::less<int>, std::allocator<int>, false, false, false, true, periodic_splay<3>
+		>;
+
+		PeriodicSplayTree tree(this->elements.begin(), this->elements.end());
+		TopDownPeriodicSplayTree topDown(this->elements.begin(), this->elements.end());
+
+		// the non-const root() counts as a lookup, so roots are read const.
+		int root = *std::as_const(tree).root();
+		int topDownRoot = *std::as_const(topDown).root();
+
+		for (int e : { 9, 2 }) {
+			EXPECT_EQ(*tree.find(e), e);
+			EXPECT_EQ(*std::as_const(tree).root(), root);
+			EXPECT_EQ(*topDown.find(e), e);
+			EXPECT_EQ(*std::as_const(topDown).root(), topDownRoot);
+		}
+
+		EXPECT_EQ(*tree.find(0), 0);
+		EXPECT_EQ(*std::as_const(tree).root(), 0);
+		EXPECT_EQ(*topDown.find(0), 0);
+		EXPECT_EQ(*std::as_const(topDown).root(), 0);
+	}
 }
\ No newline at end of file
@@ -0,0 +1,338 @@
+/* ============================================================================
+* Copyright (C) 2023 Ryan Eubank
+*
+* This program is free software: you can redistribute it and/or modify
+* it under the terms of the GNU General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License
+* along with this program.  If not, see <https://www.gnu.org/licenses/>.
+* ========================================================================= */
+
+#include <algorithm>
+#include <climits>
+#include <cmath>
+#include <iterator>
+#include <numeric>
+#include <random>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "adapters/TreeTraversalAdapters.h"
+#include "containers/Treap.h"
+
+#include "../../collection_test_suites/collection_test_fixture.h"
+
+namespace collection_tests {
+
+	using namespace collections;
+
+	// orders ints until its budget of comparisons runs out, then throws 
+	// from every comparison.
+	struct budgeted_less {
+		static inline long budget = LONG_MAX;
+
+		bool operator()(int a, int b) const {
+			if (budget-- <= 0)
+				throw std::runtime_error("Out of comparisons.");
+			return a < b;
+		}
+	};
+
+	using BudgetedTreap = Treap<int, budgeted_less, std::allocator<int>, false>;
+
+	class TreapStructureTest : public CollectionTest<SimpleTreap<int>> {
+	protected:
+		std::vector<int> range(int first, int last) {
+			std::vector<int> elements(last - first);
+			std::iota(elements.begin(), elements.end(), first);
+			return elements;
+		}
+
+		// the expected depth of a treap is under 3 log2(n), so this bound
+		// only fails for trees that have degenerated.
+		template <class tree_t>
+		void expectShallow(const tree_t& tree) {
+			auto limit = 4 * std::log2(static_cast<double>(tree.size() + 2));
+			EXPECT_LE(static_cast<double>(tree.height()), limit);
+		}
+
+		template <class tree_t>
+		void expectElements(const tree_t& tree, const std::vector<int>& expected) {
+			ASSERT_EQ(tree.size(), expected.size());
+			EXPECT_TRUE(std::equal(
+				tree.begin(), tree.end(), expected.begin(), expected.end()));
+
+			if (!tree.isEmpty()) {
+				EXPECT_EQ(*tree.minimum(), expected.front());
+				EXPECT_EQ(*tree.maximum(), expected.back());
+			}
+
+			expectShallow(tree);
+		}
+
+		template <class tree_t>
+		std::vector<int> preOrderOf(const tree_t& tree) {
+			return std::vector<int>(
+				tree.template begin<traversal_order::PRE_ORDER>(), tree.end());
+		}
+	};
+
+	TEST_F(TreapStructureTest, SequentialInsertionKeepsTreeShallow) {
+		SimpleTreap<int> ascending;
+		SimpleTreap<int> descending;
+
+		for (int i = 0; i < 10000; ++i) {
+			ascending.insert(i);
+			descending.insert(9999 - i);
+		}
+
+		expectElements(ascending, range(0, 10000));
+		expectElements(descending, range(0, 10000));
+	}
+
+	TEST_F(TreapStructureTest, SortedRangeBuildsShallowTree) {
+		std::vector<int> elements = range(0, 100000);
+		SimpleTreap<int> tree(elements.begin(), elements.end());
+
+		expectElements(tree, elements);
+
+		// the built tree keeps its priorities for later updates.
+		for (int i = 0; i < 100000; i += 2)
+			tree.remove(tree.find(i));
+
+		for (int i = 100000; i < 110000; ++i)
+			tree.insert(i);
+
+		EXPECT_EQ(tree.size(), 60000);
+		expectShallow(tree);
+	}
+
+	TEST_F(TreapStructureTest, SortedRangeBuildsRankedTree) {
+		std::vector<int> elements = range(0, 1000);
+		SimpleTreap<int> tree(elements.begin(), elements.end());
+
+		for (int i = 0; i < 1000; ++i) {
+			EXPECT_EQ(*tree.nth(i), i);
+			EXPECT_EQ(tree.rankOf(i), i);
+		}
+	}
+
+	TEST_F(TreapStructureTest, RandomOperationsMatchStandardMultiSet) {
+		std::mt19937 rng(3);
+		std::uniform_int_distribution<int> keys(0, 200);
+		MultiTreap<int> tree;
+		std::multiset<int> expected;
+
+		for (int step = 0; step < 5000; ++step) {
+			int key = keys(rng);
+
+			if (rng() % 3) {
+				tree.insert(key);
+				expected.insert(key);
+			}
+			else if (auto pos = tree.find(key); pos != tree.end()) {
+				tree.remove(pos);
+				expected.erase(expected.find(key));
+			}
+		}
+
+		ASSERT_EQ(tree.size(), expected.size());
+		EXPECT_TRUE(std::equal(tree.begin(), tree.end(), expected.begin(), expected.end()));
+
+		for (int key = 0; key <= 200; ++key)
+			EXPECT_EQ(tree.rankOf(key), std::distance(expected.begin(), expected.lower_bound(key)));
+	}
+
+	TEST_F(TreapStructureTest, SplitMovesElementsFromKeyOnwards) {
+		std::vector<int> elements = range(0, 100);
+		std::ranges::shuffle(elements, std::mt19937(7));
+
+		SimpleTreap<int> tree(elements.begin(), elements.end());
+		SimpleTreap<int> upper = tree.split(40);
+
+		expectElements(tree, range(0, 40));
+		expectElements(upper, range(40, 100));
+
+		SimpleTreap<int> empty = tree.split(1000);
+
+		expectElements(tree, range(0, 40));
+		EXPECT_TRUE(empty.isEmpty());
+	}
+
+	TEST_F(TreapStructureTest, SplitKeepsRanksOfBothHalves) {
+		std::vector<int> elements = range(0, 500);
+		SimpleTreap<int> tree(elements.begin(), elements.end());
+		SimpleTreap<int> upper = tree.split(123);
+
+		for (int i = 0; i < 123; ++i)
+			EXPECT_EQ(*tree.nth(i), i);
+
+		for (int i = 0; i < 377; ++i)
+			EXPECT_EQ(*upper.nth(i), i + 123);
+	}
+
+	TEST_F(TreapStructureTest, UnrankedTreesKeepSubtreeCounts) {
+		std::vector<int> elements = range(0, 300);
+		std::ranges::shuffle(elements, std::mt19937(11));
+
+		SimpleTreap<int> tree(elements.begin(), elements.end());
+		SimpleTreap<int> upper = tree.split(200);
+
+		EXPECT_EQ(tree.size(), 200);
+		EXPECT_EQ(upper.size(), 100);
+
+		for (int key = 0; key < 200; key += 7)
+			EXPECT_EQ(tree.rankOf(key), key);
+
+		for (int key = 200; key < 300; key += 7)
+			EXPECT_EQ(upper.rankOf(key), key - 200);
+	}
+
+	TEST_F(TreapStructureTest, JoinConcatenatesTrees) {
+		std::vector<int> low = range(0, 300);
+		std::vector<int> high = range(300, 310);
+
+		SimpleTreap<int> joined = SimpleTreap<int>::join(
+			SimpleTreap<int>(low.begin(), low.end()),
+			SimpleTreap<int>(high.begin(), high.end())
+		);
+
+		expectElements(joined, range(0, 310));
+
+		joined.insert(-1);
+		joined.remove(joined.find(305));
+
+		EXPECT_EQ(*joined.minimum(), -1);
+		EXPECT_FALSE(joined.contains(305));
+		EXPECT_EQ(joined.size(), 310);
+	}
+
+	TEST_F(TreapStructureTest, JoinRejectsTreesOutOfOrder) {
+		SimpleTreap<int> low{ 1, 2, 3 };
+		SimpleTreap<int> high{ 3, 4, 5 };
+
+		EXPECT_THROW(
+			static_cast<void>(SimpleTreap<int>::join(low, high)), 
+			std::invalid_argument
+		);
+
+		MultiTreap<int> multiLow{ 1, 2, 3 };
+		MultiTreap<int> multiHigh{ 3, 4, 5 };
+
+		MultiTreap<int> joined = MultiTreap<int>::join(multiLow, multiHigh);
+		EXPECT_EQ(joined.count(3), 2);
+	}
+
+	TEST_F(TreapStructureTest, RemoveRangeCutsOutKeyRange) {
+		std::vector<int> elements = range(0, 1000);
+		std::ranges::shuffle(elements, std::mt19937(9));
+
+		SimpleTreap<int> tree(elements.begin(), elements.end());
+
+		EXPECT_EQ(tree.removeRange(100, 900), 800);
+
+		std::vector<int> expected = range(0, 100);
+		std::vector<int> tail = range(900, 1000);
+		expected.insert(expected.end(), tail.begin(), tail.end());
+
+		expectElements(tree, expected);
+
+		for (int i = 0; i < 200; ++i)
+			EXPECT_EQ(*tree.nth(i), expected[i]);
+
+		EXPECT_EQ(tree.removeRange(50, 50), 0);
+		EXPECT_EQ(tree.removeRange(60, 10), 0);
+		EXPECT_EQ(tree.removeRange(-5, 10), 10);
+		EXPECT_EQ(tree.removeRange(950, 5000), 50);
+		EXPECT_EQ(tree.size(), 140);
+		EXPECT_EQ(*tree.minimum(), 10);
+		EXPECT_EQ(*tree.maximum(), 949);
+	}
+
+	TEST_F(TreapStructureTest, RemoveRangeRemovesEveryDuplicate) {
+		MultiTreap<int> tree;
+
+		for (int i = 0; i < 30; ++i)
+			tree.insert(i % 6);
+
+		EXPECT_EQ(tree.removeRange(2, 4), 10);
+		EXPECT_EQ(tree.count(1), 5);
+		EXPECT_EQ(tree.count(2), 0);
+		EXPECT_EQ(tree.count(3), 0);
+		EXPECT_EQ(tree.count(4), 5);
+		EXPECT_EQ(tree.size(), 20);
+	}
+
+	TEST_F(TreapStructureTest, ThrowingRemoveRangeKeepsTree) {
+		std::vector<int> elements = range(0, 500);
+		std::ranges::shuffle(elements, std::mt19937(21));
+
+		// small budgets throw in the first split, larger ones in the second.
+		for (long budget : { 1L, 5L, 12L, 20L }) {
+			BudgetedTreap tree(elements.begin(), elements.end());
+
+			budgeted_less::budget = budget;
+			EXPECT_THROW(tree.removeRange(100, 400), std::runtime_error);
+			budgeted_less::budget = LONG_MAX;
+
+			expectElements(tree, range(0, 500));
+			EXPECT_EQ(*tree.minimum(), 0);
+			EXPECT_EQ(*tree.maximum(), 499);
+
+			EXPECT_EQ(tree.removeRange(100, 400), 300);
+			EXPECT_EQ(tree.size(), 200);
+		}
+	}
+
+	TEST_F(TreapStructureTest, CopyPreservesPriorities) {
+		SimpleTreap<int> tree;
+
+		for (int i = 0; i < 200; ++i)
+			tree.insert((i * 37) % 200);
+
+		SimpleTreap<int> copy(tree);
+
+		EXPECT_EQ(preOrderOf(copy), preOrderOf(tree));
+
+		// equal priorities make both trees restructure identically.
+		for (int i = 0; i < 200; i += 3) {
+			tree.remove(tree.find(i));
+			copy.remove(copy.find(i));
+		}
+
+		EXPECT_EQ(preOrderOf(copy), preOrderOf(tree));
+	}
+
+	TEST_F(TreapStructureTest, TreesDrawTheirOwnPriorities) {
+		SimpleTreap<int> first;
+		SimpleTreap<int> second;
+
+		for (int i = 0; i < 200; ++i) {
+			first.insert(i);
+			second.insert(i);
+		}
+
+		EXPECT_NE(preOrderOf(first), preOrderOf(second));
+
+		SimpleTreap<int> upper = first.split(100);
+
+		for (int i = 200; i < 400; ++i) {
+			first.insert(i);
+			upper.insert(i);
+		}
+
+		expectShallow(first);
+		expectShallow(upper);
+	}
+}